@@ -154,7 +154,7 @@ class HPP_FCL_DLLAPI AABB {
   inline FCL_REAL size() const { return (max_ - min_).squaredNorm(); }
 
   /// @brief Center of the AABB
-  inline Vec3f center() const { return (min_ + max_) * 0.5; }
+  inline Vec3f center() const { return (min_ + max_) * FCL_REAL(0.5); }
 
   /// @brief Width of the AABB
   inline FCL_REAL width() const { return max_[0] - min_[0]; }
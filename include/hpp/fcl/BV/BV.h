@@ -66,7 +66,7 @@ template <>
 struct Converter<AABB, AABB> {
   static void convert(const AABB& bv1, const Transform3f& tf1, AABB& bv2) {
     const Vec3f& center = bv1.center();
-    FCL_REAL r = (bv1.max_ - bv1.min_).norm() * 0.5;
+    FCL_REAL r = (bv1.max_ - bv1.min_).norm() * FCL_REAL(0.5);
     const Vec3f center2 = tf1.transform(center);
     bv2.min_ = center2 - Vec3f::Constant(r);
     bv2.max_ = center2 + Vec3f::Constant(r);
@@ -79,13 +79,13 @@ template <>
 struct Converter<AABB, OBB> {
   static void convert(const AABB& bv1, const Transform3f& tf1, OBB& bv2) {
     bv2.To = tf1.transform(bv1.center());
-    bv2.extent.noalias() = (bv1.max_ - bv1.min_) * 0.5;
+    bv2.extent.noalias() = (bv1.max_ - bv1.min_) * FCL_REAL(0.5);
     bv2.axes = tf1.getRotation();
   }
 
   static void convert(const AABB& bv1, OBB& bv2) {
     bv2.To = bv1.center();
-    bv2.extent.noalias() = (bv1.max_ - bv1.min_) * 0.5;
+    bv2.extent.noalias() = (bv1.max_ - bv1.min_) * FCL_REAL(0.5);
     bv2.axes.setIdentity();
   }
 };
@@ -115,15 +115,15 @@ struct Converter<OBBRSS, OBB> {
 template <>
 struct Converter<RSS, OBB> {
   static void convert(const RSS& bv1, const Transform3f& tf1, OBB& bv2) {
-    bv2.extent = Vec3f(bv1.length[0] * 0.5 + bv1.radius,
-                       bv1.length[1] * 0.5 + bv1.radius, bv1.radius);
+    bv2.extent = Vec3f(bv1.length[0] * FCL_REAL(0.5) + bv1.radius,
+                       bv1.length[1] * FCL_REAL(0.5) + bv1.radius, bv1.radius);
     bv2.To = tf1.transform(bv1.Tr);
     bv2.axes.noalias() = tf1.getRotation() * bv1.axes;
   }
 
   static void convert(const RSS& bv1, OBB& bv2) {
-    bv2.extent = Vec3f(bv1.length[0] * 0.5 + bv1.radius,
-                       bv1.length[1] * 0.5 + bv1.radius, bv1.radius);
+    bv2.extent = Vec3f(bv1.length[0] * FCL_REAL(0.5) + bv1.radius,
+                       bv1.length[1] * FCL_REAL(0.5) + bv1.radius, bv1.radius);
     bv2.To = bv1.Tr;
     bv2.axes = bv1.axes;
   }
@@ -133,7 +133,8 @@ template <typename BV1>
 struct Converter<BV1, AABB> {
   static void convert(const BV1& bv1, const Transform3f& tf1, AABB& bv2) {
     const Vec3f& center = bv1.center();
-    FCL_REAL r = Vec3f(bv1.width(), bv1.height(), bv1.depth()).norm() * 0.5;
+    FCL_REAL r =
+        Vec3f(bv1.width(), bv1.height(), bv1.depth()).norm() * FCL_REAL(0.5);
     const Vec3f center2 = tf1.transform(center);
     bv2.min_ = center2 - Vec3f::Constant(r);
     bv2.max_ = center2 + Vec3f::Constant(r);
@@ -141,7 +142,8 @@ struct Converter<BV1, AABB> {
 
   static void convert(const BV1& bv1, AABB& bv2) {
     const Vec3f& center = bv1.center();
-    FCL_REAL r = Vec3f(bv1.width(), bv1.height(), bv1.depth()).norm() * 0.5;
+    FCL_REAL r =
+        Vec3f(bv1.width(), bv1.height(), bv1.depth()).norm() * FCL_REAL(0.5);
     bv2.min_ = center - Vec3f::Constant(r);
     bv2.max_ = center + Vec3f::Constant(r);
   }
@@ -234,7 +236,7 @@ struct Converter<AABB, RSS> {
       }
     }
 
-    const Vec3f extent = (bv1.max_ - bv1.min_) * 0.5;
+    const Vec3f extent = (bv1.max_ - bv1.min_) * FCL_REAL(0.5);
     bv2.radius = extent[id[2]];
     bv2.length[0] = (extent[id[0]] - bv2.radius) * 2;
     bv2.length[1] = (extent[id[1]] - bv2.radius) * 2;
@@ -92,7 +92,7 @@ struct HPP_FCL_DLLAPI RSS {
   /// Not implemented
   bool overlap(const RSS& other, const CollisionRequest&,
                FCL_REAL& sqrDistLowerBound) const {
-    sqrDistLowerBound = sqrt(-1);
+    sqrDistLowerBound = sqrt(FCL_REAL(-1));
     return overlap(other);
   }
 
@@ -101,8 +101,10 @@ class HPP_FCL_DLLAPI BVHModelBase : public CollisionGeometry {
 
   /// @brief deconstruction, delete mesh data related.
   virtual ~BVHModelBase() {
-    delete[] vertices;
-    delete[] tri_indices;
+    if (own_storage) {
+      delete[] vertices;
+      delete[] tri_indices;
+    }
     delete[] prev_vertices;
   }
 
@@ -138,6 +140,23 @@ class HPP_FCL_DLLAPI BVHModelBase : public CollisionGeometry {
   /// hierarchy
   int endModel();
 
+  /// @brief Build the BVH model on existing vertices and triangles, without
+  /// copying them.
+  ///
+  /// \param own_storage whether the model takes the ownership of the arrays,
+  ///        which must then be allocated with new[]. Otherwise, the arrays must
+  ///        outlive the model and keep their size.
+  /// \param vertices, num_vertices the vertices of the model.
+  /// \param tri_indices, num_tris the triangles of the model, NULL and 0 for a
+  ///        point cloud.
+  /// \note The vertices can still be modified in place with
+  ///       beginReplaceModel() and beginUpdateModel().
+  int buildModel(bool own_storage, Vec3f* vertices, unsigned int num_vertices,
+                 Triangle* tri_indices, unsigned int num_tris);
+
+  /// @brief Whether the model releases its vertices and triangles.
+  bool ownStorage() const { return own_storage; }
+
   /// @brief Replace the geometry information of current frame (i.e. should have
   /// the same mesh topology with the previous frame)
   int beginReplaceModel();
@@ -230,9 +249,9 @@ class HPP_FCL_DLLAPI BVHModelBase : public CollisionGeometry {
   Matrix3f computeMomentofInertia() const {
     Matrix3f C = Matrix3f::Zero();
 
+    const FCL_REAL a = FCL_REAL(1) / 60, b = FCL_REAL(1) / 120;
     Matrix3f C_canonical;
-    C_canonical << 1 / 60.0, 1 / 120.0, 1 / 120.0, 1 / 120.0, 1 / 60.0,
-        1 / 120.0, 1 / 120.0, 1 / 120.0, 1 / 60.0;
+    C_canonical << a, b, b, b, a, b, b, b, a;
 
     for (unsigned int i = 0; i < num_tris; ++i) {
       const Triangle& tri = tri_indices[i];
@@ -260,6 +279,7 @@ class HPP_FCL_DLLAPI BVHModelBase : public CollisionGeometry {
   unsigned int num_tris_allocated;
   unsigned int num_vertices_allocated;
   unsigned int num_vertex_updated;  /// for ccd vertex update
+  bool own_storage;
 
  protected:
   /// \brief Comparison operators
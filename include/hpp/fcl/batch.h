@@ -0,0 +1,87 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HPP_FCL_BATCH_H
+#define HPP_FCL_BATCH_H
+
+#include <vector>
+
+#include <hpp/fcl/collision_data.h>
+#include <hpp/fcl/collision_object.h>
+
+namespace hpp {
+namespace fcl {
+
+/// @brief Pair of geometries with their poses, evaluated by the batch
+/// queries.
+struct HPP_FCL_DLLAPI BatchQuery {
+  const CollisionGeometry* o1;
+  Transform3f tf1;
+  const CollisionGeometry* o2;
+  Transform3f tf2;
+
+  BatchQuery() : o1(NULL), o2(NULL) {}
+
+  BatchQuery(const CollisionGeometry* o1, const Transform3f& tf1,
+             const CollisionGeometry* o2, const Transform3f& tf2)
+      : o1(o1), tf1(tf1), o2(o2), tf2(tf2) {}
+};
+
+/// @brief Collision checks of a batch of pairs, split between threads.
+///
+/// The threads are started on each call and each runs a contiguous range of
+/// the queries with its own QueryWorkspace. The first exception thrown by a
+/// query is rethrown once all the threads are done.
+///
+/// \param[in] queries the pairs of geometries.
+/// \param[in] request the request of every query.
+/// \param[out] results the result of each query, in the order of the pairs.
+/// \param[in] num_threads number of threads, or 0 for the number of hardware
+///            threads. The calling thread is one of them.
+HPP_FCL_DLLAPI void collideBatch(const std::vector<BatchQuery>& queries,
+                                 const CollisionRequest& request,
+                                 std::vector<CollisionResult>& results,
+                                 unsigned int num_threads = 0);
+
+/// @brief Distance computations of a batch of pairs, split between threads.
+/// \sa collideBatch
+HPP_FCL_DLLAPI void distanceBatch(const std::vector<BatchQuery>& queries,
+                                  const DistanceRequest& request,
+                                  std::vector<DistanceResult>& results,
+                                  unsigned int num_threads = 0);
+
+}  // namespace fcl
+}  // namespace hpp
+
+#endif
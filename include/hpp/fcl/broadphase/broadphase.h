@@ -42,6 +42,8 @@
 #include "hpp/fcl/broadphase/broadphase_SSaP.h"
 #include "hpp/fcl/broadphase/broadphase_interval_tree.h"
 #include "hpp/fcl/broadphase/broadphase_spatialhash.h"
+#include "hpp/fcl/broadphase/broadphase_hierarchical_spatialhash.h"
+#include "hpp/fcl/broadphase/broadphase_radix_SaP.h"
 
 #include "hpp/fcl/broadphase/default_broadphase_callbacks.h"
 
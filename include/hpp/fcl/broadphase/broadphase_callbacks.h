@@ -39,6 +39,7 @@
 
 #include "hpp/fcl/fwd.hh"
 #include "hpp/fcl/data_types.h"
+#include "hpp/fcl/metrics.h"
 
 namespace hpp {
 namespace fcl {
@@ -62,6 +63,7 @@ struct HPP_FCL_DLLAPI CollisionCallBackBase {
 
   /// @brief Functor call associated to the collide operation.
   virtual bool operator()(CollisionObject* o1, CollisionObject* o2) {
+    HPP_FCL_METRICS_RECORD(recordBroadPhasePair(false));
     return collide(o1, o2);
   }
 };
@@ -88,6 +90,7 @@ struct HPP_FCL_DLLAPI DistanceCallBackBase {
   /// @brief Functor call associated to the distance operation.
   virtual bool operator()(CollisionObject* o1, CollisionObject* o2,
                           FCL_REAL& dist) {
+    HPP_FCL_METRICS_RECORD(recordBroadPhasePair(true));
     return distance(o1, o2, dist);
   }
 };
@@ -44,6 +44,7 @@
 
 #include "hpp/fcl/collision_object.h"
 #include "hpp/fcl/broadphase/broadphase_callbacks.h"
+#include "hpp/fcl/tracing.h"
 
 namespace hpp {
 namespace fcl {
@@ -70,17 +70,45 @@ class HPP_FCL_DLLAPI DynamicAABBTreeCollisionManager
   bool octree_as_geometry_collide;
   bool octree_as_geometry_distance;
 
+  /// @brief Margin of the fat AABBs.
+  ///
+  /// When positive, the tree stores the AABB of each object enlarged by this
+  /// margin and extended along the object velocity (see setVelocity). The
+  /// update methods then only reinsert the objects which moved out of their
+  /// enlarged AABB. Defaults to 0: the tree stores the exact AABBs.
+  FCL_REAL fat_aabb_margin;
+
   DynamicAABBTreeCollisionManager();
 
   /// @brief add objects to the manager
+  /// An object registered as a static object cannot be added, an
+  /// std::invalid_argument is thrown.
   void registerObjects(const std::vector<CollisionObject*>& other_objs);
 
   /// @brief add one object to the manager
+  /// @sa registerObjects
   void registerObject(CollisionObject* obj);
 
+  /// @brief add static objects to the manager
+  ///
+  /// Static objects are stored in a separate tree, which update() does not
+  /// refresh and which is only rebalanced when static objects are added.
+  /// The self collision and self distance queries skip the pairs of static
+  /// objects. A static object which is moved must be updated explicitly with
+  /// update(CollisionObject*). An object registered as a dynamic object
+  /// cannot be added, an std::invalid_argument is thrown.
+  void registerStaticObjects(const std::vector<CollisionObject*>& other_objs);
+
+  /// @brief add one static object to the manager
+  /// @sa registerStaticObjects
+  void registerStaticObject(CollisionObject* obj);
+
   /// @brief remove one object from the manager
   void unregisterObject(CollisionObject* obj);
 
+  /// @brief whether the object was registered as a static object
+  bool isStatic(CollisionObject* obj) const;
+
   /// @brief initialize the manager, related with the specific type of manager
   void setup();
 
@@ -93,6 +121,11 @@ class HPP_FCL_DLLAPI DynamicAABBTreeCollisionManager
   /// @brief update the manager by explicitly given the set of objects update
   void update(const std::vector<CollisionObject*>& updated_objs);
 
+  /// @brief set the displacement of an object expected until the next update
+  ///
+  /// It is only used when fat_aabb_margin is positive.
+  void setVelocity(CollisionObject* obj, const Vec3f& vel);
+
   /// @brief clear the manager
   void clear();
 
@@ -135,13 +168,35 @@ class HPP_FCL_DLLAPI DynamicAABBTreeCollisionManager
   /// @brief returns the AABB tree structure.
   detail::HierarchyTree<AABB>& getTree();
 
+  /// @brief returns the AABB tree structure of the static objects.
+  const detail::HierarchyTree<AABB>& getStaticTree() const;
+
  private:
   detail::HierarchyTree<AABB> dtree{};
   std::unordered_map<CollisionObject*, DynamicAABBNode*> table;
 
+  detail::HierarchyTree<AABB> stree{};
+  std::unordered_map<CollisionObject*, DynamicAABBNode*> static_table;
+
+  /// @brief velocities given with setVelocity
+  std::unordered_map<CollisionObject*, Vec3f> velocities;
+
   bool setup_;
+  bool static_setup_;
 
   void update_(CollisionObject* updated_obj);
+
+  Vec3f velocity_(CollisionObject* obj) const;
+
+  /// @brief perform collision test between one object and the objects of the
+  /// tree whose root is given
+  bool collide_(DynamicAABBNode* root, CollisionObject* obj,
+                CollisionCallBackBase* callback) const;
+
+  /// @brief perform distance computation between one object and the objects
+  /// of the tree whose root is given
+  bool distance_(DynamicAABBNode* root, CollisionObject* obj,
+                 DistanceCallBackBase* callback, FCL_REAL& min_dist) const;
 };
 
 }  // namespace fcl
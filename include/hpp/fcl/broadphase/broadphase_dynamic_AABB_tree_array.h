@@ -70,6 +70,13 @@ class HPP_FCL_DLLAPI DynamicAABBTreeArrayCollisionManager
   bool octree_as_geometry_collide;
   bool octree_as_geometry_distance;
 
+  /// @brief Margin of the fat AABBs.
+  ///
+  /// Same as DynamicAABBTreeCollisionManager::fat_aabb_margin: when positive,
+  /// an object is reinserted only once it leaves the AABB stored in its node,
+  /// which is enlarged by the margin and by the velocity.
+  FCL_REAL fat_aabb_margin;
+
   DynamicAABBTreeArrayCollisionManager();
 
   /// @brief add objects to the manager
@@ -93,6 +100,11 @@ class HPP_FCL_DLLAPI DynamicAABBTreeArrayCollisionManager
   /// @brief update the manager by explicitly given the set of objects update
   void update(const std::vector<CollisionObject*>& updated_objs);
 
+  /// @brief set the displacement of an object expected until the next update
+  ///
+  /// It is only used when fat_aabb_margin is positive.
+  void setVelocity(CollisionObject* obj, const Vec3f& vel);
+
   /// @brief clear the manager
   void clear();
 
@@ -135,9 +147,14 @@ class HPP_FCL_DLLAPI DynamicAABBTreeArrayCollisionManager
   detail::implementation_array::HierarchyTree<AABB> dtree{};
   std::unordered_map<CollisionObject*, size_t> table;
 
+  /// @brief velocities given with setVelocity
+  std::unordered_map<CollisionObject*, Vec3f> velocities;
+
   bool setup_;
 
   void update_(CollisionObject* updated_obj);
+
+  Vec3f velocity_(CollisionObject* obj) const;
 };
 
 }  // namespace fcl
@@ -0,0 +1,233 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HPP_FCL_BROADPHASE_HIERARCHICAL_SPATIALHASH_H
+#define HPP_FCL_BROADPHASE_HIERARCHICAL_SPATIALHASH_H
+
+#include <map>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+#include "hpp/fcl/BV/AABB.h"
+#include "hpp/fcl/broadphase/broadphase_collision_manager.h"
+
+namespace hpp {
+namespace fcl {
+
+/// @brief Hierarchical spatial hashing collision manager.
+///
+/// Objects are stored in a hierarchy of uniform grids. The cell size of level
+/// \f$ l \f$ is \f$ c_0 r^l \f$ where \f$ c_0 \f$ is the cell size of the
+/// finest level and \f$ r \f$ the ratio between two consecutive levels. Each
+/// object is inserted into a single cell, the one containing the lower corner
+/// of its AABB, at the finest level whose cell size is larger than the AABB.
+/// Cell coordinates are hashed, so that the grids are sparse and unbounded:
+/// contrary to SpatialHashingCollisionManager, no scene limit is needed.
+/// Objects whose AABB is infinite (e.g. Halfspace) are kept in a separate list.
+class HPP_FCL_DLLAPI HierarchicalSpatialHashingCollisionManager
+    : public BroadPhaseCollisionManager {
+ public:
+  typedef BroadPhaseCollisionManager Base;
+  using Base::getObjects;
+
+  /// @param min_cell_size cell size of the finest level.
+  /// @param level_ratio ratio between the cell sizes of two consecutive
+  /// levels. It must be greater than 1.
+  HierarchicalSpatialHashingCollisionManager(
+      FCL_REAL min_cell_size = FCL_REAL(0.1), FCL_REAL level_ratio = 2);
+
+  /// @brief add one object to the manager
+  void registerObject(CollisionObject* obj);
+
+  /// @brief remove one object from the manager
+  void unregisterObject(CollisionObject* obj);
+
+  /// @brief initialize the manager, related with the specific type of manager
+  void setup();
+
+  /// @brief update the condition of manager
+  virtual void update();
+
+  /// @brief update the manager by explicitly given the object updated
+  void update(CollisionObject* updated_obj);
+
+  /// @brief update the manager by explicitly given the set of objects update
+  void update(const std::vector<CollisionObject*>& updated_objs);
+
+  /// @brief clear the manager
+  void clear();
+
+  /// @brief return the objects managed by the manager
+  void getObjects(std::vector<CollisionObject*>& objs) const;
+
+  /// @brief perform collision test between one object and all the objects
+  /// belonging to the manager
+  void collide(CollisionObject* obj, CollisionCallBackBase* callback) const;
+
+  /// @brief perform distance computation between one object and all the objects
+  /// belonging to the manager
+  void distance(CollisionObject* obj, DistanceCallBackBase* callback) const;
+
+  /// @brief perform collision test for the objects belonging to the manager
+  /// (i.e., N^2 self collision)
+  void collide(CollisionCallBackBase* callback) const;
+
+  /// @brief perform distance test for the objects belonging to the manager
+  /// (i.e., N^2 self distance)
+  void distance(DistanceCallBackBase* callback) const;
+
+  /// @brief perform collision test with objects belonging to another manager
+  void collide(BroadPhaseCollisionManager* other_manager,
+               CollisionCallBackBase* callback) const;
+
+  /// @brief perform distance test with objects belonging to another manager
+  void distance(BroadPhaseCollisionManager* other_manager,
+                DistanceCallBackBase* callback) const;
+
+  /// @brief whether the manager is empty
+  bool empty() const;
+
+  /// @brief the number of objects managed by the manager
+  size_t size() const;
+
+  /// @brief the number of non empty levels
+  size_t numLevels() const { return levels.size(); }
+
+  /// @brief the cell size of the finest level
+  FCL_REAL getMinCellSize() const { return min_cell_size; }
+
+  /// @brief the ratio between the cell sizes of two consecutive levels
+  FCL_REAL getLevelRatio() const { return level_ratio; }
+
+ protected:
+  /// @brief integer coordinates of a cell
+  struct CellKey {
+    std::int64_t x, y, z;
+
+    bool operator==(const CellKey& other) const {
+      return x == other.x && y == other.y && z == other.z;
+    }
+  };
+
+  /// @brief hash function of the cell coordinates
+  struct CellKeyHash {
+    std::size_t operator()(const CellKey& key) const {
+      return static_cast<std::size_t>(
+          (static_cast<std::uint64_t>(key.x) * 73856093u) ^
+          (static_cast<std::uint64_t>(key.y) * 19349663u) ^
+          (static_cast<std::uint64_t>(key.z) * 83492791u));
+    }
+  };
+
+  typedef std::vector<CollisionObject*> Cell;
+  typedef std::unordered_map<CellKey, Cell, CellKeyHash> CellMap;
+
+  /// @brief a sparse uniform grid
+  struct Level {
+    /// @brief the size of the cells of this level
+    FCL_REAL cell_size;
+
+    /// @brief the non empty cells
+    CellMap cells;
+
+    /// @brief the number of objects stored in this level
+    size_t num_objects;
+  };
+
+  /// @brief where an object is stored
+  struct ObjectEntry {
+    /// @brief the AABB of the object when it was inserted
+    AABB aabb;
+
+    /// @brief whether the object is stored in the list of unbounded objects
+    bool unbounded;
+
+    /// @brief the level containing the object
+    unsigned int level;
+
+    /// @brief the cell containing the object
+    CellKey cell;
+  };
+
+  typedef std::map<unsigned int, Level> LevelMap;
+  typedef std::unordered_map<CollisionObject*, ObjectEntry> ObjectMap;
+
+  /// @brief compute the level and cell of an AABB
+  void locate(const AABB& aabb, ObjectEntry& entry) const;
+
+  /// @brief store obj at the location given by entry
+  void insert(CollisionObject* obj, const ObjectEntry& entry);
+
+  /// @brief remove obj from the location given by entry
+  void remove(CollisionObject* obj, const ObjectEntry& entry);
+
+  /// @brief call visitor on every object of level whose AABB may overlap
+  /// query. Returns true if visitor asks to stop.
+  template <typename Visitor>
+  bool visitLevel(const Level& level, const AABB& query,
+                  Visitor& visitor) const;
+
+  /// @brief perform collision test between one object and the objects stored
+  /// in the levels greater or equal to min_level.
+  bool collide_(CollisionObject* obj, CollisionCallBackBase* callback,
+                unsigned int min_level, bool check_order) const;
+
+  /// @brief perform distance computation between one object and all the objects
+  /// belonging to the manager
+  bool distance_(CollisionObject* obj, DistanceCallBackBase* callback,
+                 FCL_REAL& min_dist) const;
+
+  /// @brief cell size of the finest level
+  FCL_REAL min_cell_size;
+
+  /// @brief ratio between the cell sizes of two consecutive levels
+  FCL_REAL level_ratio;
+
+  /// @brief the non empty levels, indexed by their rank
+  LevelMap levels;
+
+  /// @brief objects which cannot be stored in a grid, because their AABB is
+  /// infinite or too far from the origin.
+  std::vector<CollisionObject*> unbounded_objs;
+
+  /// @brief the location of every object
+  ObjectMap objs;
+};
+
+}  // namespace fcl
+
+}  // namespace hpp
+
+#endif
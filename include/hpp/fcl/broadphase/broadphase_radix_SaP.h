@@ -0,0 +1,176 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HPP_FCL_BROAD_PHASE_RADIX_SAP_H
+#define HPP_FCL_BROAD_PHASE_RADIX_SAP_H
+
+#include <vector>
+#include <cstdint>
+
+#include "hpp/fcl/BV/AABB.h"
+#include "hpp/fcl/broadphase/broadphase_collision_manager.h"
+
+namespace hpp {
+namespace fcl {
+
+/// @brief Sweep and prune collision manager designed for a large number of
+/// objects which all move at every step.
+///
+/// The bounds of the objects are stored in flat arrays (one array per axis and
+/// per bound), sorted along a single sweep axis. At each update, the arrays are
+/// re-sorted starting from the previous order: an insertion sort is used when
+/// the objects moved little, a radix sort on the floating point keys
+/// otherwise. The sweep tests the candidate intervals by blocks, which lets
+/// the compiler vectorize the overlap tests.
+class HPP_FCL_DLLAPI RadixSaPCollisionManager
+    : public BroadPhaseCollisionManager {
+ public:
+  typedef BroadPhaseCollisionManager Base;
+  using Base::getObjects;
+
+  RadixSaPCollisionManager();
+
+  /// @brief add one object to the manager
+  void registerObject(CollisionObject* obj);
+
+  /// @brief remove one object from the manager
+  void unregisterObject(CollisionObject* obj);
+
+  /// @brief initialize the manager, related with the specific type of manager
+  void setup();
+
+  /// @brief update the condition of manager
+  virtual void update();
+
+  /// @brief clear the manager
+  void clear();
+
+  /// @brief return the objects managed by the manager
+  void getObjects(std::vector<CollisionObject*>& objs) const;
+
+  /// @brief perform collision test between one object and all the objects
+  /// belonging to the manager
+  void collide(CollisionObject* obj, CollisionCallBackBase* callback) const;
+
+  /// @brief perform distance computation between one object and all the objects
+  /// belonging to the manager
+  void distance(CollisionObject* obj, DistanceCallBackBase* callback) const;
+
+  /// @brief perform collision test for the objects belonging to the manager
+  /// (i.e., N^2 self collision)
+  void collide(CollisionCallBackBase* callback) const;
+
+  /// @brief perform distance test for the objects belonging to the manager
+  /// (i.e., N^2 self distance)
+  void distance(DistanceCallBackBase* callback) const;
+
+  /// @brief perform collision test with objects belonging to another manager
+  void collide(BroadPhaseCollisionManager* other_manager,
+               CollisionCallBackBase* callback) const;
+
+  /// @brief perform distance test with objects belonging to another manager
+  void distance(BroadPhaseCollisionManager* other_manager,
+                DistanceCallBackBase* callback) const;
+
+  /// @brief whether the manager is empty
+  bool empty() const;
+
+  /// @brief the number of objects managed by the manager
+  size_t size() const;
+
+  /// @brief the axis along which the objects are currently sorted
+  int getSweepAxis() const { return sweep_axis; }
+
+  /// @brief Maximum number of element moves, relatively to the number of
+  /// objects, of the insertion sort run at each update. Above it, the update
+  /// falls back to a radix sort.
+  FCL_REAL max_insertion_sort_ratio;
+
+ protected:
+  /// @brief sort the cached bounds along the sweep axis, starting from the
+  /// current order
+  void sort();
+
+  /// @brief range of sorted positions whose interval along the sweep axis may
+  /// overlap [lo, hi]
+  void sweepRange(FCL_REAL lo, FCL_REAL hi, size_t& begin, size_t& end) const;
+
+  /// @brief compute the AABB of the object at a sorted position
+  AABB cachedAABB(size_t pos) const;
+
+  /// @brief perform collision test between one object and all the objects
+  /// belonging to the manager
+  bool collide_(CollisionObject* obj, CollisionCallBackBase* callback) const;
+
+  /// @brief perform distance computation between one object and the objects
+  /// belonging to the manager whose index is not lower than min_index.
+  bool distance_(CollisionObject* obj, DistanceCallBackBase* callback,
+                 FCL_REAL& min_dist, size_t min_index) const;
+
+  /// @brief the objects, in registration order
+  std::vector<CollisionObject*> objs;
+
+  /// @brief index in objs of the object at each sorted position
+  std::vector<size_t> indices;
+
+  /// @brief lower bounds of the objects along each axis, in sorted order
+  std::vector<FCL_REAL> lower[3];
+
+  /// @brief upper bounds of the objects along each axis, in sorted order
+  std::vector<FCL_REAL> upper[3];
+
+  /// @brief the axis along which lower[sweep_axis] is sorted
+  int sweep_axis;
+
+  /// @brief largest extent of the objects along the sweep axis
+  FCL_REAL max_extent;
+
+  /// @brief AABB of all the objects
+  AABB bound;
+
+  /// @brief whether the cached bounds are valid
+  bool setup_;
+
+ private:
+  /// @brief sort buffers, kept to avoid allocations at every update
+  std::vector<std::uint64_t> keys, keys_tmp;
+  std::vector<size_t> order, order_tmp;
+  std::vector<FCL_REAL> scratch;
+  std::vector<size_t> indices_tmp;
+};
+
+}  // namespace fcl
+}  // namespace hpp
+
+#endif
@@ -254,6 +254,8 @@ void SpatialHashingCollisionManager<HashTable>::getObjects(
 template <typename HashTable>
 void SpatialHashingCollisionManager<HashTable>::collide(
     CollisionObject* obj, CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_SPATIAL_HASH);
+  HPP_FCL_TRACE_SPAN("SpatialHashingCollisionManager::collide", "broadphase");
   if (size() == 0) return;
   collide_(obj, callback);
 }
@@ -262,6 +264,8 @@ void SpatialHashingCollisionManager<HashTable>::collide(
 template <typename HashTable>
 void SpatialHashingCollisionManager<HashTable>::distance(
     CollisionObject* obj, DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_SPATIAL_HASH);
+  HPP_FCL_TRACE_SPAN("SpatialHashingCollisionManager::distance", "broadphase");
   if (size() == 0) return;
   FCL_REAL min_dist = (std::numeric_limits<FCL_REAL>::max)();
   distance_(obj, callback, min_dist);
@@ -311,7 +315,7 @@ template <typename HashTable>
 bool SpatialHashingCollisionManager<HashTable>::distance_(
     CollisionObject* obj, DistanceCallBackBase* callback,
     FCL_REAL& min_dist) const {
-  auto delta = (obj->getAABB().max_ - obj->getAABB().min_) * 0.5;
+  auto delta = (obj->getAABB().max_ - obj->getAABB().min_) * FCL_REAL(0.5);
   auto aabb = obj->getAABB();
   if (min_dist < (std::numeric_limits<FCL_REAL>::max)()) {
     Vec3f min_dist_delta(min_dist, min_dist, min_dist);
@@ -377,6 +381,8 @@ bool SpatialHashingCollisionManager<HashTable>::distance_(
 template <typename HashTable>
 void SpatialHashingCollisionManager<HashTable>::collide(
     CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_SPATIAL_HASH);
+  HPP_FCL_TRACE_SPAN("SpatialHashingCollisionManager::collide", "broadphase");
   if (size() == 0) return;
 
   for (const auto& obj1 : objs) {
@@ -418,6 +424,8 @@ void SpatialHashingCollisionManager<HashTable>::collide(
 template <typename HashTable>
 void SpatialHashingCollisionManager<HashTable>::distance(
     DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_SPATIAL_HASH);
+  HPP_FCL_TRACE_SPAN("SpatialHashingCollisionManager::distance", "broadphase");
   if (size() == 0) return;
 
   this->enable_tested_set_ = true;
@@ -438,6 +446,8 @@ template <typename HashTable>
 void SpatialHashingCollisionManager<HashTable>::collide(
     BroadPhaseCollisionManager* other_manager_,
     CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_SPATIAL_HASH);
+  HPP_FCL_TRACE_SPAN("SpatialHashingCollisionManager::collide", "broadphase");
   auto* other_manager =
       static_cast<SpatialHashingCollisionManager<HashTable>*>(other_manager_);
 
@@ -464,6 +474,8 @@ template <typename HashTable>
 void SpatialHashingCollisionManager<HashTable>::distance(
     BroadPhaseCollisionManager* other_manager_,
     DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_SPATIAL_HASH);
+  HPP_FCL_TRACE_SPAN("SpatialHashingCollisionManager::distance", "broadphase");
   auto* other_manager =
       static_cast<SpatialHashingCollisionManager<HashTable>*>(other_manager_);
 
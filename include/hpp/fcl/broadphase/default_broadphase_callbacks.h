@@ -228,6 +228,38 @@ struct HPP_FCL_DLLAPI CollisionCallBackCollect : CollisionCallBackBase {
   size_t max_size;
 };
 
+/// @brief Collision callback to collect the pairs of objects in collision.
+///
+/// Unlike CollisionCallBackCollect, which collects the pairs whose bounding
+/// volumes overlap, the narrow phase is run on each pair with request.
+struct HPP_FCL_DLLAPI CollisionCallBackCollectColliding
+    : CollisionCallBackBase {
+  typedef std::pair<CollisionObject*, CollisionObject*> CollisionPair;
+
+  /// @brief Default constructor.
+  CollisionCallBackCollectColliding(
+      const CollisionRequest& request = CollisionRequest());
+
+  bool collide(CollisionObject* o1, CollisionObject* o2);
+
+  /// @brief Returns the pairs of objects in collision
+  const std::vector<CollisionPair>& getCollisionPairs() const {
+    return collision_pairs;
+  }
+
+  /// @brief Reset the callback
+  void init() { collision_pairs.clear(); }
+
+  virtual ~CollisionCallBackCollectColliding(){};
+
+  /// @brief Request of the narrow phase
+  CollisionRequest request;
+
+ protected:
+  std::vector<CollisionPair> collision_pairs;
+  CollisionResult result;
+};
+
 }  // namespace fcl
 
 }  // namespace hpp
@@ -158,20 +158,44 @@ bool HierarchyTree<BV>::update(Node* leaf, const BV& bv) {
 //==============================================================================
 template <typename S, typename BV>
 struct UpdateImpl {
-  static bool run(const HierarchyTree<BV>& tree,
+  static bool run(HierarchyTree<BV>& tree,
                   typename HierarchyTree<BV>::Node* leaf, const BV& bv,
                   const Vec3f& /*vel*/, FCL_REAL /*margin*/) {
-    if (leaf->bv.contain(bv)) return false;
-    tree.update_(leaf, bv);
-    return true;
+    return tree.update(leaf, bv);
   }
 
-  static bool run(const HierarchyTree<BV>& tree,
+  static bool run(HierarchyTree<BV>& tree,
                   typename HierarchyTree<BV>::Node* leaf, const BV& bv,
                   const Vec3f& /*vel*/) {
+    return tree.update(leaf, bv);
+  }
+};
+
+//==============================================================================
+template <typename S>
+struct UpdateImpl<S, AABB> {
+  /// When the leaf does not contain bv anymore, it is reinserted with bv
+  /// enlarged by margin and extended along vel.
+  static bool run(HierarchyTree<AABB>& tree,
+                  typename HierarchyTree<AABB>::Node* leaf, const AABB& bv,
+                  const Vec3f& vel, FCL_REAL margin) {
     if (leaf->bv.contain(bv)) return false;
-    tree.update_(leaf, bv);
-    return true;
+
+    AABB fat_bv(bv);
+    fat_bv.expand(margin);
+    for (int i = 0; i < 3; ++i) {
+      if (vel[i] > 0)
+        fat_bv.max_[i] += vel[i];
+      else
+        fat_bv.min_[i] += vel[i];
+    }
+    return tree.update(leaf, fat_bv);
+  }
+
+  static bool run(HierarchyTree<AABB>& tree,
+                  typename HierarchyTree<AABB>::Node* leaf, const AABB& bv,
+                  const Vec3f& vel) {
+    return run(tree, leaf, bv, vel, 0);
   }
 };
 
@@ -294,27 +294,47 @@ bool HierarchyTree<BV>::update(size_t leaf, const BV& bv) {
   return true;
 }
 
+//==============================================================================
+template <typename S, typename BV>
+struct UpdateImpl {
+  static bool run(HierarchyTree<BV>& tree, size_t leaf, const BV& bv,
+                  const Vec3f& /*vel*/, FCL_REAL /*margin*/) {
+    return tree.update(leaf, bv);
+  }
+};
+
+//==============================================================================
+template <typename S>
+struct UpdateImpl<S, AABB> {
+  /// When the leaf does not contain bv anymore, it is reinserted with bv
+  /// enlarged by margin and extended along vel.
+  static bool run(HierarchyTree<AABB>& tree, size_t leaf, const AABB& bv,
+                  const Vec3f& vel, FCL_REAL margin) {
+    if (tree.getNodes()[leaf].bv.contain(bv)) return false;
+
+    AABB fat_bv(bv);
+    fat_bv.expand(margin);
+    for (int i = 0; i < 3; ++i) {
+      if (vel[i] > 0)
+        fat_bv.max_[i] += vel[i];
+      else
+        fat_bv.min_[i] += vel[i];
+    }
+    return tree.update(leaf, fat_bv);
+  }
+};
+
 //==============================================================================
 template <typename BV>
 bool HierarchyTree<BV>::update(size_t leaf, const BV& bv, const Vec3f& vel,
                                FCL_REAL margin) {
-  HPP_FCL_UNUSED_VARIABLE(bv);
-  HPP_FCL_UNUSED_VARIABLE(vel);
-  HPP_FCL_UNUSED_VARIABLE(margin);
-
-  if (nodes[leaf].bv.contain(bv)) return false;
-  update_(leaf, bv);
-  return true;
+  return UpdateImpl<FCL_REAL, BV>::run(*this, leaf, bv, vel, margin);
 }
 
 //==============================================================================
 template <typename BV>
 bool HierarchyTree<BV>::update(size_t leaf, const BV& bv, const Vec3f& vel) {
-  HPP_FCL_UNUSED_VARIABLE(vel);
-
-  if (nodes[leaf].bv.contain(bv)) return false;
-  update_(leaf, bv);
-  return true;
+  return UpdateImpl<FCL_REAL, BV>::run(*this, leaf, bv, vel, 0);
 }
 
 //==============================================================================
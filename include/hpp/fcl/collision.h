@@ -118,6 +118,24 @@ class HPP_FCL_DLLAPI ComputeCollision {
     return res;
   }
 
+  /// @brief Thread-safe variant of the call operator.
+  ///
+  /// The per-call state (GJK settings and cached guess) is stored in
+  /// \c gjk_solver instead of the internal solver of this object. A single
+  /// ComputeCollision can then be shared between threads, each one of them
+  /// owning its solver.
+  ///
+  /// \code
+  ///   ComputeCollision calc_collision (o1, o2); // shared
+  ///   GJKSolver solver; // one per thread
+  ///   std::size_t ncontacts = calc_collision(tf1, tf2, request, result,
+  ///                                          solver);
+  /// \endcode
+  std::size_t operator()(const Transform3f& tf1, const Transform3f& tf2,
+                         const CollisionRequest& request,
+                         CollisionResult& result,
+                         GJKSolver& gjk_solver) const;
+
   bool operator==(const ComputeCollision& other) const {
     return o1 == other.o1 && o2 == other.o2 && solver == other.solver;
   }
@@ -136,14 +154,20 @@ class HPP_FCL_DLLAPI ComputeCollision {
   mutable const CollisionGeometry* o1;
   mutable const CollisionGeometry* o2;
 
+  /// @brief Scratch of the call operators which do not take a solver. It is
+  /// not part of the geometry pair and is the only state modified by those
+  /// operators.
   mutable GJKSolver solver;
 
   CollisionFunctionMatrix::CollisionFunc func;
   bool swap_geoms;
 
+  /// @brief Run the query using \c gjk_solver as scratch. This method must
+  /// not modify the state of this object. The call operators without a
+  /// solver pass the internal one.
   virtual std::size_t run(const Transform3f& tf1, const Transform3f& tf2,
                           const CollisionRequest& request,
-                          CollisionResult& result) const;
+                          CollisionResult& result, GJKSolver& gjk_solver) const;
 
  public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
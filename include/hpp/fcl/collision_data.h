@@ -38,6 +38,7 @@
 #ifndef HPP_FCL_COLLISION_DATA_H
 #define HPP_FCL_COLLISION_DATA_H
 
+#include <algorithm>
 #include <vector>
 #include <set>
 #include <limits>
@@ -113,6 +114,69 @@ struct HPP_FCL_DLLAPI Contact {
   bool operator!=(const Contact& other) const { return !(*this == other); }
 };
 
+/// @brief Statistics gathered during a query, when
+/// QueryRequest::enable_profiling is set.
+///
+/// Times are expressed in microseconds. A query between two shapes counts as a
+/// single leaf test.
+struct HPP_FCL_DLLAPI QueryProfile {
+  /// @brief number of tests between bounding volumes
+  unsigned int num_bv_tests;
+
+  /// @brief number of tests between primitives (triangles, cells or shapes)
+  unsigned int num_leaf_tests;
+
+  /// @brief number of runs of the GJK algorithm
+  unsigned int num_gjk_calls;
+
+  /// @brief total number of iterations of the GJK algorithm
+  unsigned int num_gjk_iterations;
+
+  /// @brief number of runs of the EPA algorithm
+  unsigned int num_epa_calls;
+
+  /// @brief total number of iterations of the EPA algorithm
+  unsigned int num_epa_iterations;
+
+  /// @brief total number of faces of the polytopes built by EPA
+  unsigned int num_epa_faces;
+
+  /// @brief number of calls to the support function of the Minkowski
+  /// difference, by GJK and EPA
+  unsigned int num_support_calls;
+
+  /// @brief time spent traversing the bounding volume hierarchies
+  double traversal_time;
+
+  /// @brief time spent in the leaf tests
+  double narrowphase_time;
+
+  QueryProfile() { clear(); }
+
+  void clear() {
+    num_bv_tests = num_leaf_tests = 0;
+    num_gjk_calls = num_gjk_iterations = 0;
+    num_epa_calls = num_epa_iterations = num_epa_faces = 0;
+    num_support_calls = 0;
+    traversal_time = narrowphase_time = 0;
+  }
+
+  /// @brief Accumulate the statistics of another profile.
+  QueryProfile& operator+=(const QueryProfile& other) {
+    num_bv_tests += other.num_bv_tests;
+    num_leaf_tests += other.num_leaf_tests;
+    num_gjk_calls += other.num_gjk_calls;
+    num_gjk_iterations += other.num_gjk_iterations;
+    num_epa_calls += other.num_epa_calls;
+    num_epa_iterations += other.num_epa_iterations;
+    num_epa_faces += other.num_epa_faces;
+    num_support_calls += other.num_support_calls;
+    traversal_time += other.traversal_time;
+    narrowphase_time += other.narrowphase_time;
+    return *this;
+  }
+};
+
 struct QueryResult;
 
 /// @brief base class for all query requests
@@ -149,6 +213,10 @@ struct HPP_FCL_DLLAPI QueryRequest {
   /// @brief enable timings when performing collision/distance request
   bool enable_timings;
 
+  /// @brief fill QueryResult::profile when performing collision/distance
+  /// request
+  bool enable_profiling;
+
   /// @brief threshold below which a collision is considered.
   FCL_REAL collision_distance_threshold;
 
@@ -161,11 +229,12 @@ struct HPP_FCL_DLLAPI QueryRequest {
         gjk_variant(GJKVariant::DefaultGJK),
         gjk_convergence_criterion(GJKConvergenceCriterion::VDB),
         gjk_convergence_criterion_type(GJKConvergenceCriterionType::Relative),
-        gjk_tolerance(1e-6),
+        gjk_tolerance(GJK_DEFAULT_TOLERANCE),
         gjk_max_iterations(128),
         cached_gjk_guess(1, 0, 0),
         cached_support_func_guess(support_func_guess_t::Zero()),
         enable_timings(false),
+        enable_profiling(false),
         collision_distance_threshold(
             Eigen::NumTraits<FCL_REAL>::dummy_precision()) {}
 
@@ -186,7 +255,8 @@ struct HPP_FCL_DLLAPI QueryRequest {
            enable_cached_gjk_guess == other.enable_cached_gjk_guess &&
            cached_gjk_guess == other.cached_gjk_guess &&
            cached_support_func_guess == other.cached_support_func_guess &&
-           enable_timings == other.enable_timings;
+           enable_timings == other.enable_timings &&
+           enable_profiling == other.enable_profiling;
     HPP_FCL_COMPILER_DIAGNOSTIC_POP
   }
 };
@@ -202,6 +272,10 @@ struct HPP_FCL_DLLAPI QueryResult {
   /// @brief timings for the given request
   CPUTimes timings;
 
+  /// @brief statistics of the given request, filled only when
+  /// QueryRequest::enable_profiling is set
+  QueryProfile profile;
+
   QueryResult()
       : cached_gjk_guess(Vec3f::Zero()),
         cached_support_func_guess(support_func_guess_t::Constant(-1)) {}
@@ -272,7 +346,7 @@ struct HPP_FCL_DLLAPI CollisionRequest : QueryRequest {
         enable_contact(flag & CONTACT),
         enable_distance_lower_bound(flag & DISTANCE_LOWER_BOUND),
         security_margin(0),
-        break_distance(1e-3),
+        break_distance(FCL_REAL(1e-3)),
         distance_upper_bound((std::numeric_limits<FCL_REAL>::max)()) {}
 
   /// @brief Default constructor.
@@ -281,7 +355,7 @@ struct HPP_FCL_DLLAPI CollisionRequest : QueryRequest {
         enable_contact(false),
         enable_distance_lower_bound(false),
         security_margin(0),
-        break_distance(1e-3),
+        break_distance(FCL_REAL(1e-3)),
         distance_upper_bound((std::numeric_limits<FCL_REAL>::max)()) {}
 
   bool isSatisfied(const CollisionResult& result) const;
@@ -379,6 +453,7 @@ struct HPP_FCL_DLLAPI CollisionResult : QueryResult {
     contacts.clear();
     distance_lower_bound = (std::numeric_limits<FCL_REAL>::max)();
     timings.clear();
+    profile.clear();
   }
 
   /// @brief reposition Contact objects when fcl inverts them
@@ -511,6 +586,7 @@ struct HPP_FCL_DLLAPI DistanceResult : QueryResult {
     b2 = NONE;
     nearest_points[0] = nearest_points[1] = normal = nan;
     timings.clear();
+    profile.clear();
   }
 
   /// @brief whether two DistanceResult are the same or not
@@ -554,6 +630,21 @@ inline void updateDistanceLowerBoundFromLeaf(const CollisionRequest&,
     res.nearest_points[1] = p1;
   }
 }
+
+/// @brief Complete the profile of a query which lasted query_time
+/// microseconds with the statistics gathered by the narrowphase solver.
+inline void completeProfile(const QueryProfile& solver_profile,
+                            const double query_time, QueryResult& res) {
+  QueryProfile& profile = res.profile;
+  profile += solver_profile;
+  if (profile.num_bv_tests == 0 && profile.num_leaf_tests == 0) {
+    // Query between two shapes, without traversal.
+    profile.num_leaf_tests = 1;
+    profile.narrowphase_time = query_time;
+  } else
+    profile.traversal_time =
+        (std::max)(0., query_time - profile.narrowphase_time);
+}
 }  // namespace internal
 
 inline CollisionRequestFlag operator~(CollisionRequestFlag a) {
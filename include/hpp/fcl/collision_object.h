@@ -56,12 +56,15 @@ enum OBJECT_TYPE {
   OT_GEOM,
   OT_OCTREE,
   OT_HFIELD,
+  OT_LINEAR_OCTREE,
+  OT_SDF,
   OT_COUNT
 };
 
 /// @brief traversal node type: bounding volume (AABB, OBB, RSS, kIOS, OBBRSS,
 /// KDOP16, KDOP18, kDOP24), basic shape (box, sphere, ellipsoid, capsule, cone,
-/// cylinder, convex, plane, triangle), and octree
+/// cylinder, convex, plane, triangle), octree, linear octree and signed
+/// distance field
 enum NODE_TYPE {
   BV_UNKNOWN,
   BV_AABB,
@@ -85,6 +88,8 @@ enum NODE_TYPE {
   GEOM_ELLIPSOID,
   HF_AABB,
   HF_OBBRSS,
+  GEOM_LINEAR_OCTREE,
+  GEOM_SDF,
   NODE_COUNT
 };
 
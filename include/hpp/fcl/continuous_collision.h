@@ -0,0 +1,206 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HPP_FCL_CONTINUOUS_COLLISION_H
+#define HPP_FCL_CONTINUOUS_COLLISION_H
+
+#include <hpp/fcl/data_types.h>
+#include <hpp/fcl/collision_object.h>
+#include <hpp/fcl/math/transform.h>
+
+namespace hpp {
+namespace fcl {
+
+/// @brief Interpolation of the pose of an object between two poses.
+enum CCDMotionType {
+  /// The translation is interpolated linearly and the rotation with a
+  /// constant angular velocity.
+  CCDM_LINEAR,
+  /// Screw motion: constant rotation about a fixed axis combined with a
+  /// constant translation along this axis.
+  CCDM_SCREW
+};
+
+/// @brief Motion of an object between two poses, parameterized by a time t
+/// in [0, 1].
+class HPP_FCL_DLLAPI Motion {
+ public:
+  Motion(const Transform3f& tf_beg, const Transform3f& tf_end,
+         CCDMotionType type = CCDM_LINEAR);
+
+  /// @brief Pose of the object at time t.
+  Transform3f getTransform(FCL_REAL t) const;
+
+  /// @brief Upper bound, over the whole motion, of the speed along a
+  /// direction of the points of the object which lie at distance at most
+  /// radius from its origin. The speed is given per unit of t and may be
+  /// negative when the object moves away along the direction.
+  ///
+  /// \param[in] direction unit direction, in the world frame.
+  /// \param[in] radius distance between the origin of the object and its
+  ///            farthest point.
+  FCL_REAL computeMotionBound(const Vec3f& direction, FCL_REAL radius) const;
+
+  /// @brief Upper bound, over the whole motion, of the norm of the velocity of
+  /// the points of the object which lie at distance at most radius from its
+  /// origin, once the linear velocity of the motion is removed.
+  FCL_REAL computeMotionBound(FCL_REAL radius) const;
+
+  /// @brief Linear velocity of the points of the rotation axis, in the world
+  /// frame.
+  const Vec3f& getLinearVelocity() const { return linear_velocity; }
+
+  CCDMotionType getMotionType() const { return type; }
+
+ protected:
+  Transform3f tf_beg;
+  CCDMotionType type;
+
+  /// @brief Rotation axis, in the frame of tf_beg, and rotation angle.
+  Vec3f axis;
+  FCL_REAL angle;
+
+  /// @brief Translation of the origin: along the rotation axis for a screw
+  /// motion, in the frame of tf_beg, and in the world frame otherwise.
+  Vec3f translation;
+
+  /// @brief For a screw motion, point of the rotation axis closest to the
+  /// origin of the object at the beginning, in the frame of tf_beg.
+  Vec3f axis_point;
+
+  /// @brief Angular velocity, in the world frame.
+  Vec3f angular_velocity;
+
+  /// @brief Linear velocity of the points of the rotation axis, in the world
+  /// frame.
+  Vec3f linear_velocity;
+
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/// @brief Request for a continuous collision query.
+struct HPP_FCL_DLLAPI ContinuousCollisionRequest {
+  /// @brief Maximal number of advancement steps.
+  size_t num_max_iterations;
+
+  /// @brief The objects are in contact when their distance is below this
+  /// threshold.
+  FCL_REAL toc_err;
+
+  /// @brief Interpolation of the poses of the objects.
+  CCDMotionType ccd_motion_type;
+
+  ContinuousCollisionRequest(size_t num_max_iterations_ = 100,
+                             FCL_REAL toc_err_ = FCL_REAL(1e-4),
+                             CCDMotionType ccd_motion_type_ = CCDM_LINEAR)
+      : num_max_iterations(num_max_iterations_),
+        toc_err(toc_err_),
+        ccd_motion_type(ccd_motion_type_) {}
+};
+
+/// @brief Result of a continuous collision query.
+struct HPP_FCL_DLLAPI ContinuousCollisionResult {
+  /// @brief Whether the objects collide during the motion.
+  bool is_collide;
+
+  /// @brief Time of the first contact in [0, 1], 1 when there is none.
+  FCL_REAL time_of_contact;
+
+  /// @brief Poses of the objects at the time of contact.
+  Transform3f contact_tf1, contact_tf2;
+
+  /// @brief Contact point and normal, pointing from the first object to the
+  /// second one, at the time of contact.
+  Vec3f contact_point, normal;
+
+  /// @brief Number of advancement steps performed.
+  size_t num_iterations;
+
+  ContinuousCollisionResult() { clear(); }
+
+  void clear() {
+    is_collide = false;
+    time_of_contact = 1;
+    contact_tf1.setIdentity();
+    contact_tf2.setIdentity();
+    contact_point.setZero();
+    normal.setZero();
+    num_iterations = 0;
+  }
+
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+/// @brief Continuous collision between two objects moving between two poses.
+///
+/// The time of contact is computed by conservative advancement: the objects
+/// are moved forward by their distance divided by a bound of their relative
+/// speed, until their distance falls below ContinuousCollisionRequest::toc_err.
+/// The returned time of contact never exceeds the exact one. If the maximal
+/// number of iterations is reached, the objects are reported in collision at
+/// the last time reached, so that the answer stays conservative.
+///
+/// Pairs of convex shapes, pairs of triangle meshes with RSS or OBBRSS
+/// bounding volumes, and pairs of such a mesh and a convex shape are
+/// supported. For meshes, each step only refines the front of the bounding
+/// volume pairs where the previous step stopped. The local AABB of the shapes
+/// must have been computed (see CollisionGeometry::computeLocalAABB), which is
+/// the case for the geometries of a CollisionObject.
+///
+/// \return the time of contact.
+HPP_FCL_DLLAPI FCL_REAL continuousCollide(
+    const CollisionGeometry* o1, const Transform3f& tf1_beg,
+    const Transform3f& tf1_end, const CollisionGeometry* o2,
+    const Transform3f& tf2_beg, const Transform3f& tf2_end,
+    const ContinuousCollisionRequest& request,
+    ContinuousCollisionResult& result);
+
+/// @copydoc continuousCollide(const CollisionGeometry*, const Transform3f&,
+/// const Transform3f&, const CollisionGeometry*, const Transform3f&, const
+/// Transform3f&, const ContinuousCollisionRequest&,
+/// ContinuousCollisionResult&)
+///
+/// The motions start from the current poses of the objects.
+HPP_FCL_DLLAPI FCL_REAL continuousCollide(
+    const CollisionObject* o1, const Transform3f& tf1_end,
+    const CollisionObject* o2, const Transform3f& tf2_end,
+    const ContinuousCollisionRequest& request,
+    ContinuousCollisionResult& result);
+
+}  // namespace fcl
+}  // namespace hpp
+
+#endif
@@ -62,7 +62,22 @@ namespace hpp {
 
 namespace hpp {
 namespace fcl {
+#ifdef HPP_FCL_USE_FLOAT
+typedef float FCL_REAL;
+#else
 typedef double FCL_REAL;
+#endif
+
+/// @brief Default tolerance of the GJK and EPA algorithms.
+/// In single precision, 1e-6 is below the rounding error on coordinates of
+/// order one and the algorithms would run until the maximum number of
+/// iterations.
+#ifdef HPP_FCL_USE_FLOAT
+static const FCL_REAL GJK_DEFAULT_TOLERANCE = 1e-4f;
+#else
+static const FCL_REAL GJK_DEFAULT_TOLERANCE = 1e-6;
+#endif
+
 typedef Eigen::Matrix<FCL_REAL, 3, 1> Vec3f;
 typedef Eigen::Matrix<FCL_REAL, Eigen::Dynamic, 1> VecXf;
 typedef Eigen::Matrix<FCL_REAL, 3, 3> Matrix3f;
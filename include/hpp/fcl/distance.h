@@ -112,6 +112,16 @@ class HPP_FCL_DLLAPI ComputeDistance {
     return res;
   }
 
+  /// @brief Thread-safe variant of the call operator.
+  ///
+  /// The per-call state (GJK settings and cached guess) is stored in
+  /// \c gjk_solver instead of the internal solver of this object.
+  /// \sa ComputeCollision::operator()(const Transform3f&, const Transform3f&,
+  /// const CollisionRequest&, CollisionResult&, GJKSolver&) const
+  FCL_REAL operator()(const Transform3f& tf1, const Transform3f& tf2,
+                      const DistanceRequest& request, DistanceResult& result,
+                      GJKSolver& gjk_solver) const;
+
   bool operator==(const ComputeDistance& other) const {
     return o1 == other.o1 && o2 == other.o2 && swap_geoms == other.swap_geoms &&
            solver == other.solver && func == other.func;
@@ -131,14 +141,19 @@ class HPP_FCL_DLLAPI ComputeDistance {
   mutable const CollisionGeometry* o1;
   mutable const CollisionGeometry* o2;
 
+  /// @brief Scratch of the call operators which do not take a solver.
+  /// \sa ComputeCollision::solver
   mutable GJKSolver solver;
 
   DistanceFunctionMatrix::DistanceFunc func;
   bool swap_geoms;
 
+  /// @brief Run the query using \c gjk_solver as scratch. This method must
+  /// not modify the state of this object. The call operators without a
+  /// solver pass the internal one.
   virtual FCL_REAL run(const Transform3f& tf1, const Transform3f& tf2,
-                       const DistanceRequest& request,
-                       DistanceResult& result) const;
+                       const DistanceRequest& request, DistanceResult& result,
+                       GJKSolver& gjk_solver) const;
 
  public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
@@ -106,6 +106,14 @@ typedef shared_ptr<BVHModelBase> BVHModelPtr_t;
 class OcTree;
 typedef shared_ptr<OcTree> OcTreePtr_t;
 typedef shared_ptr<const OcTree> OcTreeConstPtr_t;
+
+class LinearOcTree;
+typedef shared_ptr<LinearOcTree> LinearOcTreePtr_t;
+typedef shared_ptr<const LinearOcTree> LinearOcTreeConstPtr_t;
+
+class SignedDistanceField;
+typedef shared_ptr<SignedDistanceField> SignedDistanceFieldPtr_t;
+typedef shared_ptr<const SignedDistanceField> SignedDistanceFieldConstPtr_t;
 }  // namespace fcl
 }  // namespace hpp
 
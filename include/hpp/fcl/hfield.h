@@ -42,6 +42,9 @@
 #include <hpp/fcl/BV/BV_node.h>
 #include <hpp/fcl/BVH/BVH_internal.h>
 
+#include <cmath>
+#include <cstdint>
+#include <limits>
 #include <vector>
 
 namespace hpp {
@@ -170,6 +173,21 @@ struct UpdateBoundingVolume<AABB> {
 
 }  // namespace details
 
+/// @brief Storage of the heights of a HeightField.
+///
+/// The compact storages round the heights up, so that the stored height field
+/// always contains the one it was built from.
+///
+/// Only the height samples are affected by the storage. The grids along X and
+/// Y, the bounding volume hierarchy and the pyramid of maximal heights are
+/// stored with FCL_REAL whatever the storage. The hierarchy and the pyramid
+/// hold a few values per cell and dominate the memory of a height field.
+enum HeightFieldStorage {
+  HF_STORAGE_REAL,   ///< heights stored as FCL_REAL
+  HF_STORAGE_FLOAT,  ///< heights stored as float
+  HF_STORAGE_UINT16  ///< heights quantized on 16 bits with a scale and offset
+};
+
 /// @brief Data structure depicting a height field given by the base grid
 /// dimensions and the elevation along the grid. \tparam BV one of the bounding
 /// volume class in \ref Bounding_Volume.
@@ -189,8 +207,11 @@ class HPP_FCL_DLLAPI HeightField : public CollisionGeometry {
   /// @brief Constructing an empty HeightField
   HeightField()
       : CollisionGeometry(),
+        storage(HF_STORAGE_REAL),
         min_height((std::numeric_limits<FCL_REAL>::min)()),
-        max_height((std::numeric_limits<FCL_REAL>::max)()) {}
+        max_height((std::numeric_limits<FCL_REAL>::max)()),
+        height_scale(0),
+        height_offset(0) {}
 
   /// @brief Constructing an HeightField from its base dimensions and the set of
   /// heights points.
@@ -202,11 +223,13 @@ class HPP_FCL_DLLAPI HeightField : public CollisionGeometry {
   /// \param[in] heights Matrix containing the altitude of each point compositng
   /// the height field
   /// \param[in] min_height Minimal height of the height field
+  /// \param[in] storage Storage of the heights
   ///
   HeightField(const FCL_REAL x_dim, const FCL_REAL y_dim,
-              const MatrixXf& heights, const FCL_REAL min_height = (FCL_REAL)0)
+              const MatrixXf& heights, const FCL_REAL min_height = (FCL_REAL)0,
+              const HeightFieldStorage storage = HF_STORAGE_REAL)
       : CollisionGeometry() {
-    init(x_dim, y_dim, heights, min_height);
+    init(x_dim, y_dim, heights, min_height, storage);
   }
 
   /// @brief Copy contructor from another HeightField
@@ -217,21 +240,73 @@ class HPP_FCL_DLLAPI HeightField : public CollisionGeometry {
       : CollisionGeometry(other),
         x_dim(other.x_dim),
         y_dim(other.y_dim),
+        storage(other.storage),
         heights(other.heights),
+        float_heights(other.float_heights),
+        quantized_heights(other.quantized_heights),
         min_height(other.min_height),
         max_height(other.max_height),
+        height_scale(other.height_scale),
+        height_offset(other.height_offset),
         x_grid(other.x_grid),
         y_grid(other.y_grid),
         bvs(other.bvs),
-        num_bvs(other.num_bvs) {}
+        num_bvs(other.num_bvs),
+        max_height_pyramid(other.max_height_pyramid),
+        cell_bv_ids(other.cell_bv_ids) {}
 
   /// @brief Returns a const reference of the grid along the X direction.
   const VecXf& getXGrid() const { return x_grid; }
   /// @brief Returns a const reference of the grid along the Y direction.
   const VecXf& getYGrid() const { return y_grid; }
 
-  /// @brief Returns a const reference of the heights
-  const MatrixXf& getHeights() const { return heights; }
+  /// @brief Returns a const reference of the heights.
+  /// @note The heights are stored in such a matrix with HF_STORAGE_REAL only.
+  /// With the compact storages, an std::logic_error is thrown: use
+  /// decodedHeights instead.
+  const MatrixXf& getHeights() const {
+    if (storage != HF_STORAGE_REAL)
+      HPP_FCL_THROW_PRETTY(
+          "The heights are not stored as FCL_REAL. Use decodedHeights.",
+          std::logic_error);
+    return heights;
+  }
+
+  /// @brief Returns a copy of the heights, decoded from their storage.
+  MatrixXf decodedHeights() const {
+    switch (storage) {
+      case HF_STORAGE_FLOAT:
+        return float_heights.template cast<FCL_REAL>();
+      case HF_STORAGE_UINT16:
+        return ((quantized_heights.template cast<FCL_REAL>() * height_scale)
+                    .array() +
+                height_offset)
+            .matrix();
+      default:
+        return heights;
+    }
+  }
+
+  /// @brief Returns the height of the point (x_id, y_id) of the grid.
+  FCL_REAL getHeight(const Eigen::DenseIndex x_id,
+                     const Eigen::DenseIndex y_id) const {
+    switch (storage) {
+      case HF_STORAGE_FLOAT:
+        return float_heights(y_id, x_id);
+      case HF_STORAGE_UINT16:
+        return height_offset + height_scale * quantized_heights(y_id, x_id);
+      default:
+        return heights(y_id, x_id);
+    }
+  }
+
+  /// @brief Returns the storage of the heights.
+  HeightFieldStorage getStorage() const { return storage; }
+
+  /// @brief Returns the scale of the quantized heights (HF_STORAGE_UINT16).
+  FCL_REAL getHeightScale() const { return height_scale; }
+  /// @brief Returns the offset of the quantized heights (HF_STORAGE_UINT16).
+  FCL_REAL getHeightOffset() const { return height_offset; }
 
   /// @brief Returns the dimension of the Height Field along the X direction.
   FCL_REAL getXDim() const { return x_dim; }
@@ -243,6 +318,21 @@ class HPP_FCL_DLLAPI HeightField : public CollisionGeometry {
   /// @brief Returns the maximal height value of the Height Field.
   FCL_REAL getMaxHeight() const { return max_height; }
 
+  /// @brief Returns the pyramid of the maximal heights of the cells.
+  ///
+  /// Level 0 contains the maximal height of each cell, and level l the one of
+  /// the blocks of 2^l x 2^l cells. Rows and columns respectively correspond
+  /// to the y and x indexes of the cells. The last level has a single block.
+  const std::vector<MatrixXf>& getMaxHeightPyramid() const {
+    return max_height_pyramid;
+  }
+
+  /// @brief Returns the index of the leaf BV of the cell (x_id, y_id).
+  unsigned int getCellBVIndex(const Eigen::DenseIndex x_id,
+                              const Eigen::DenseIndex y_id) const {
+    return cell_bv_ids(y_id, x_id);
+  }
+
   virtual HeightField<BV>* clone() const { return new HeightField(*this); }
 
   /// @brief deconstruction, delete mesh data related.
@@ -256,44 +346,90 @@ class HPP_FCL_DLLAPI HeightField : public CollisionGeometry {
                   max_height);
     const AABB aabb_(A, B);
 
-    aabb_radius = (A - B).norm() / 2.;
+    aabb_radius = (A - B).norm() / 2;
     aabb_local = aabb_;
     aabb_center = aabb_.center();
   }
 
   /// @brief Update Height Field height
   void updateHeights(const MatrixXf& new_heights) {
-    if (new_heights.rows() != heights.rows() ||
-        new_heights.cols() != heights.cols())
+    if (new_heights.rows() != y_grid.size() ||
+        new_heights.cols() != x_grid.size())
       HPP_FCL_THROW_PRETTY(
           "The matrix containing the new heights values does not have the same "
           "matrix size as the original one.\n"
           "\tinput values - rows: "
               << new_heights.rows() << " - cols: " << new_heights.cols() << "\n"
-              << "\texpected values - rows: " << heights.rows()
-              << " - cols: " << heights.cols() << "\n",
+              << "\texpected values - rows: " << y_grid.size()
+              << " - cols: " << x_grid.size() << "\n",
           std::invalid_argument);
 
-    heights = new_heights.cwiseMax(min_height);
+    setHeights(new_heights);
     this->max_height = recursiveUpdateHeight(0);
-    assert(this->max_height == heights.maxCoeff());
+    assert(this->max_height == storedMaxHeight());
+    buildMaxHeightPyramid();
+  }
+
+  /// @brief Update a rectangular block of the Height Field heights.
+  ///
+  /// Only the cells touching the block are refreshed, together with the
+  /// bounding volumes containing them up to the root.
+  ///
+  /// \param[in] x_id index of the first column of the block.
+  /// \param[in] y_id index of the first row of the block.
+  /// \param[in] new_heights new values of the heights of the block.
+  void updateHeightsBlock(const Eigen::DenseIndex x_id,
+                          const Eigen::DenseIndex y_id,
+                          const MatrixXf& new_heights) {
+    const Eigen::DenseIndex NX = x_grid.size(), NY = y_grid.size();
+    if (x_id < 0 || y_id < 0 || x_id + new_heights.cols() > NX ||
+        y_id + new_heights.rows() > NY)
+      HPP_FCL_THROW_PRETTY(
+          "The block of new heights does not fit in the Height Field.\n"
+              << "\tinput values - x_id: " << x_id << " - y_id: " << y_id
+              << " - rows: " << new_heights.rows()
+              << " - cols: " << new_heights.cols() << "\n"
+              << "\texpected values - rows: " << NY << " - cols: " << NX
+              << "\n",
+          std::invalid_argument);
+    if (new_heights.size() == 0) return;
+
+    if (!setHeightsBlock(x_id, y_id, new_heights)) {
+      // The new heights exceed the range of the quantization.
+      MatrixXf all_heights = decodedHeights();
+      all_heights.block(y_id, x_id, new_heights.rows(), new_heights.cols()) =
+          new_heights;
+      updateHeights(all_heights);
+      return;
+    }
+
+    // Cells sharing at least one vertex with the block.
+    const Eigen::DenseIndex cx0 = (std::max)(x_id - 1, Eigen::DenseIndex(0)),
+                            cy0 = (std::max)(y_id - 1, Eigen::DenseIndex(0)),
+                            cx1 = (std::min)(x_id + new_heights.cols(), NX - 1),
+                            cy1 = (std::min)(y_id + new_heights.rows(), NY - 1);
+    this->max_height = recursiveUpdateHeight(0, cx0, cy0, cx1, cy1);
+    assert(this->max_height == storedMaxHeight());
+    updateMaxHeightPyramid(cx0, cy0, cx1, cy1);
   }
 
  protected:
   void init(const FCL_REAL x_dim, const FCL_REAL y_dim, const MatrixXf& heights,
-            const FCL_REAL min_height) {
+            const FCL_REAL min_height,
+            const HeightFieldStorage storage = HF_STORAGE_REAL) {
     this->x_dim = x_dim;
     this->y_dim = y_dim;
-    this->heights = heights.cwiseMax(min_height);
+    this->storage = storage;
     this->min_height = min_height;
-    this->max_height = heights.maxCoeff();
+    setHeights(heights);
+    this->max_height = storedMaxHeight();
 
     const Eigen::DenseIndex NX = heights.cols(), NY = heights.rows();
     assert(NX >= 2 && "The number of columns is too small.");
     assert(NY >= 2 && "The number of rows is too small.");
 
-    x_grid = VecXf::LinSpaced(NX, -0.5 * x_dim, 0.5 * x_dim);
-    y_grid = VecXf::LinSpaced(NY, 0.5 * y_dim, -0.5 * y_dim);
+    x_grid = VecXf::LinSpaced(NX, -x_dim / 2, x_dim / 2);
+    y_grid = VecXf::LinSpaced(NY, y_dim / 2, -y_dim / 2);
 
     // Allocate BVS
     const size_t num_tot_bvs =
@@ -318,13 +454,22 @@ class HPP_FCL_DLLAPI HeightField : public CollisionGeometry {
   /// @brief Dimensions in meters along X and Y directions
   FCL_REAL x_dim, y_dim;
 
-  /// @brief Elevation values in meters of the Height Field
+  /// @brief Storage of the heights
+  HeightFieldStorage storage;
+
+  /// @brief Elevation values in meters of the Height Field, depending on the
+  /// storage. The two other matrices are empty.
   MatrixXf heights;
+  Eigen::Matrix<float, Eigen::Dynamic, Eigen::Dynamic> float_heights;
+  Eigen::Matrix<uint16_t, Eigen::Dynamic, Eigen::Dynamic> quantized_heights;
 
   /// @brief Minimal height of the Height Field: all values bellow min_height
   /// will be discarded.
   FCL_REAL min_height, max_height;
 
+  /// @brief Quantization of the heights: height_offset + height_scale * q.
+  FCL_REAL height_scale, height_offset;
+
   /// @brief Grids along the X and Y directions. Useful for plotting or other
   /// related things.
   VecXf x_grid, y_grid;
@@ -333,25 +478,184 @@ class HPP_FCL_DLLAPI HeightField : public CollisionGeometry {
   BVS bvs;
   unsigned int num_bvs;
 
+  /// @brief Maximal heights of the cells and of blocks of cells, see
+  /// getMaxHeightPyramid.
+  std::vector<MatrixXf> max_height_pyramid;
+
+  /// @brief Index in bvs of the leaf of each cell (row y_id, column x_id).
+  Eigen::Matrix<unsigned int, Eigen::Dynamic, Eigen::Dynamic> cell_bv_ids;
+
   /// @brief Build the bounding volume hierarchy
   int buildTree() {
     num_bvs = 1;
     const FCL_REAL max_recursive_height =
-        recursiveBuildTree(0, 0, heights.cols() - 1, 0, heights.rows() - 1);
+        recursiveBuildTree(0, 0, x_grid.size() - 1, 0, y_grid.size() - 1);
     assert(max_recursive_height == max_height &&
            "the maximal height is not correct");
     HPP_FCL_UNUSED_VARIABLE(max_recursive_height);
 
     bvs.resize(num_bvs);
+    buildCellIndex();
     return BVH_OK;
   }
 
+  /// @brief Build the cell to leaf BV map and the pyramid of maximal heights
+  /// from the bounding volume hierarchy.
+  void buildCellIndex() {
+    cell_bv_ids.resize(y_grid.size() - 1, x_grid.size() - 1);
+    for (unsigned int i = 0; i < num_bvs; ++i)
+      if (bvs[i].isLeaf()) cell_bv_ids(bvs[i].y_id, bvs[i].x_id) = i;
+    buildMaxHeightPyramid();
+  }
+
+  /// @brief Build the pyramid of the maximal heights of the cells.
+  void buildMaxHeightPyramid() {
+    const Eigen::DenseIndex NX = x_grid.size() - 1, NY = y_grid.size() - 1;
+    max_height_pyramid.resize(1);
+    max_height_pyramid[0].resize(NY, NX);
+    while (max_height_pyramid.back().size() > 1) {
+      const MatrixXf& fine = max_height_pyramid.back();
+      const MatrixXf coarse((fine.rows() + 1) / 2, (fine.cols() + 1) / 2);
+      max_height_pyramid.push_back(coarse);
+    }
+    updateMaxHeightPyramid(0, 0, NX, NY);
+  }
+
+  /// @brief Update the pyramid of the maximal heights for the cells in
+  /// [cx0, cx1) x [cy0, cy1).
+  void updateMaxHeightPyramid(Eigen::DenseIndex cx0, Eigen::DenseIndex cy0,
+                              Eigen::DenseIndex cx1, Eigen::DenseIndex cy1) {
+    MatrixXf& cells = max_height_pyramid[0];
+    for (Eigen::DenseIndex j = cy0; j < cy1; ++j)
+      for (Eigen::DenseIndex i = cx0; i < cx1; ++i)
+        cells(j, i) = cellMaxHeight(i, j);
+
+    for (size_t level = 1; level < max_height_pyramid.size(); ++level) {
+      const MatrixXf& fine = max_height_pyramid[level - 1];
+      MatrixXf& coarse = max_height_pyramid[level];
+      cx0 /= 2;
+      cy0 /= 2;
+      cx1 = (cx1 + 1) / 2;
+      cy1 = (cy1 + 1) / 2;
+      for (Eigen::DenseIndex j = cy0; j < cy1; ++j)
+        for (Eigen::DenseIndex i = cx0; i < cx1; ++i)
+          coarse(j, i) = fine
+                             .block(2 * j, 2 * i,
+                                    (std::min)(Eigen::DenseIndex(2),
+                                               fine.rows() - 2 * j),
+                                    (std::min)(Eigen::DenseIndex(2),
+                                               fine.cols() - 2 * i))
+                             .maxCoeff();
+    }
+  }
+
+  /// @brief Maximal height of the four corners of the cell (x_id, y_id).
+  FCL_REAL cellMaxHeight(const Eigen::DenseIndex x_id,
+                         const Eigen::DenseIndex y_id) const {
+    return (std::max)(
+        (std::max)(getHeight(x_id, y_id), getHeight(x_id + 1, y_id)),
+        (std::max)(getHeight(x_id, y_id + 1), getHeight(x_id + 1, y_id + 1)));
+  }
+
+  /// @brief Maximal height, as stored.
+  FCL_REAL storedMaxHeight() const {
+    switch (storage) {
+      case HF_STORAGE_FLOAT:
+        return float_heights.maxCoeff();
+      case HF_STORAGE_UINT16:
+        return height_offset + height_scale * quantized_heights.maxCoeff();
+      default:
+        return heights.maxCoeff();
+    }
+  }
+
+  /// @brief Round a height up to a float.
+  static float encodeFloat(const FCL_REAL height) {
+    float value = static_cast<float>(height);
+    if (value < height)
+      value = std::nextafter(value, (std::numeric_limits<float>::max)());
+    return value;
+  }
+
+  /// @brief Round a height up to a quantized value.
+  uint16_t encodeUInt16(const FCL_REAL height) const {
+    const FCL_REAL q_max = (std::numeric_limits<uint16_t>::max)();
+    if (height_scale <= 0) return 0;
+    FCL_REAL q = std::ceil((height - height_offset) / height_scale);
+    q = (std::min)((std::max)(q, FCL_REAL(0)), q_max);
+    while (q < q_max && height_offset + height_scale * q < height) ++q;
+    return static_cast<uint16_t>(q);
+  }
+
+  /// @brief Store new heights, clamped to min_height. For HF_STORAGE_UINT16,
+  /// the scale and offset are set to cover the new heights.
+  void setHeights(const MatrixXf& new_heights) {
+    const MatrixXf clamped_heights = new_heights.cwiseMax(min_height);
+    heights.resize(0, 0);
+    float_heights.resize(0, 0);
+    quantized_heights.resize(0, 0);
+    height_scale = height_offset = 0;
+    switch (storage) {
+      case HF_STORAGE_FLOAT:
+        float_heights.resize(clamped_heights.rows(), clamped_heights.cols());
+        setHeightsBlock(0, 0, clamped_heights);
+        break;
+      case HF_STORAGE_UINT16: {
+        const FCL_REAL q_max = (std::numeric_limits<uint16_t>::max)();
+        height_offset = min_height;
+        height_scale = (clamped_heights.maxCoeff() - min_height) / q_max;
+        while (height_offset + height_scale * q_max <
+               clamped_heights.maxCoeff())
+          height_scale = std::nextafter(
+              height_scale, (std::numeric_limits<FCL_REAL>::max)());
+        quantized_heights.resize(clamped_heights.rows(),
+                                 clamped_heights.cols());
+        setHeightsBlock(0, 0, clamped_heights);
+        break;
+      }
+      default:
+        heights = clamped_heights;
+    }
+  }
+
+  /// @brief Store a block of new heights, clamped to min_height.
+  /// @return false if the new heights exceed the range of HF_STORAGE_UINT16,
+  /// in which case nothing is stored.
+  bool setHeightsBlock(const Eigen::DenseIndex x_id,
+                       const Eigen::DenseIndex y_id,
+                       const MatrixXf& new_heights) {
+    const MatrixXf clamped_heights = new_heights.cwiseMax(min_height);
+    const Eigen::DenseIndex rows = new_heights.rows(),
+                            cols = new_heights.cols();
+    switch (storage) {
+      case HF_STORAGE_FLOAT:
+        for (Eigen::DenseIndex j = 0; j < rows; ++j)
+          for (Eigen::DenseIndex i = 0; i < cols; ++i)
+            float_heights(y_id + j, x_id + i) =
+                encodeFloat(clamped_heights(j, i));
+        break;
+      case HF_STORAGE_UINT16: {
+        const FCL_REAL q_max = (std::numeric_limits<uint16_t>::max)();
+        if (clamped_heights.maxCoeff() > height_offset + height_scale * q_max)
+          return false;
+        for (Eigen::DenseIndex j = 0; j < rows; ++j)
+          for (Eigen::DenseIndex i = 0; i < cols; ++i)
+            quantized_heights(y_id + j, x_id + i) =
+                encodeUInt16(clamped_heights(j, i));
+        break;
+      }
+      default:
+        heights.block(y_id, x_id, rows, cols) = clamped_heights;
+    }
+    return true;
+  }
+
   FCL_REAL recursiveUpdateHeight(const size_t bv_id) {
     HFNode<BV>& bv_node = bvs[bv_id];
 
     FCL_REAL max_height;
     if (bv_node.isLeaf()) {
-      max_height = heights.block<2, 2>(bv_node.y_id, bv_node.x_id).maxCoeff();
+      max_height = cellMaxHeight(bv_node.x_id, bv_node.y_id);
     } else {
       FCL_REAL
       max_left_height = recursiveUpdateHeight(bv_node.leftChild()),
@@ -371,12 +675,48 @@ class HPP_FCL_DLLAPI HeightField : public CollisionGeometry {
     return max_height;
   }
 
+  /// @brief Same as recursiveUpdateHeight(bv_id), but only the nodes
+  /// containing cells in [cx0, cx1) x [cy0, cy1) are refreshed.
+  FCL_REAL recursiveUpdateHeight(const size_t bv_id,
+                                 const Eigen::DenseIndex cx0,
+                                 const Eigen::DenseIndex cy0,
+                                 const Eigen::DenseIndex cx1,
+                                 const Eigen::DenseIndex cy1) {
+    HFNode<BV>& bv_node = bvs[bv_id];
+    if (bv_node.x_id >= cx1 || bv_node.x_id + bv_node.x_size <= cx0 ||
+        bv_node.y_id >= cy1 || bv_node.y_id + bv_node.y_size <= cy0)
+      return bv_node.max_height;
+
+    FCL_REAL max_height;
+    if (bv_node.isLeaf()) {
+      max_height = cellMaxHeight(bv_node.x_id, bv_node.y_id);
+    } else {
+      FCL_REAL
+      max_left_height = recursiveUpdateHeight(bv_node.leftChild(), cx0, cy0,
+                                              cx1, cy1),
+      max_right_height = recursiveUpdateHeight(bv_node.rightChild(), cx0, cy0,
+                                               cx1, cy1);
+
+      max_height = (std::max)(max_left_height, max_right_height);
+    }
+
+    bv_node.max_height = max_height;
+
+    const Vec3f pointA(x_grid[bv_node.x_id], y_grid[bv_node.y_id], min_height);
+    const Vec3f pointB(x_grid[bv_node.x_id + bv_node.x_size],
+                       y_grid[bv_node.y_id + bv_node.y_size], max_height);
+
+    details::UpdateBoundingVolume<BV>::run(pointA, pointB, bv_node.bv);
+
+    return max_height;
+  }
+
   FCL_REAL recursiveBuildTree(const size_t bv_id, const Eigen::DenseIndex x_id,
                               const Eigen::DenseIndex x_size,
                               const Eigen::DenseIndex y_id,
                               const Eigen::DenseIndex y_size) {
-    assert(x_id < heights.cols() && "x_id is out of bounds");
-    assert(y_id < heights.rows() && "y_id is out of bounds");
+    assert(x_id < x_grid.size() && "x_id is out of bounds");
+    assert(y_id < y_grid.size() && "y_id is out of bounds");
     assert(x_size >= 0 && y_size >= 0 &&
            "x_size or y_size are not of correct value");
     assert(bv_id < bvs.size() && "bv_id exceeds the vector dimension");
@@ -386,7 +726,7 @@ class HPP_FCL_DLLAPI HeightField : public CollisionGeometry {
     if (x_size == 1 &&
         y_size == 1)  // don't build any BV for the current child node
     {
-      max_height = heights.block<2, 2>(y_id, x_id).maxCoeff();
+      max_height = cellMaxHeight(x_id, y_id);
     } else {
       bv_node.first_child = num_bvs;
       num_bvs += 2;
@@ -460,8 +800,12 @@ class HPP_FCL_DLLAPI HeightField : public CollisionGeometry {
     const HeightField& other = *other_ptr;
 
     return x_dim == other.x_dim && y_dim == other.y_dim &&
-           heights == other.heights && min_height == other.min_height &&
-           max_height == other.max_height && x_grid == other.x_grid &&
+           storage == other.storage && heights == other.heights &&
+           float_heights == other.float_heights &&
+           quantized_heights == other.quantized_heights &&
+           min_height == other.min_height && max_height == other.max_height &&
+           height_scale == other.height_scale &&
+           height_offset == other.height_offset && x_grid == other.x_grid &&
            y_grid == other.y_grid && bvs == other.bvs &&
            num_bvs == other.num_bvs;
   }
@@ -167,7 +167,7 @@ class BVSplitter {
       }
     }
 
-    split_value = sum / num_primitives;
+    split_value = sum / FCL_REAL(num_primitives);
   }
 
   /// @brief Split algorithm 3: Split the node according to the median of the
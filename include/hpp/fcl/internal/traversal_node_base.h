@@ -119,6 +119,33 @@ class CollisionTraversalNodeBase : public TraversalNodeBase {
   virtual void leafCollides(unsigned int /*b1*/, unsigned int /*b2*/,
                             FCL_REAL& /*sqrDistLowerBound*/) const = 0;
 
+  /// @brief BV test between b1 and b2, accounted in the profile of the result
+  /// if profiling is requested.
+  bool profiledBVDisjoints(unsigned int b1, unsigned int b2,
+                           FCL_REAL& sqrDistLowerBound) const {
+    if (request.enable_profiling) ++result->profile.num_bv_tests;
+    return BVDisjoints(b1, b2, sqrDistLowerBound);
+  }
+
+  /// @brief Leaf test between b1 and b2, accounted in the profile of the
+  /// result if profiling is requested.
+  void profiledLeafCollides(unsigned int b1, unsigned int b2,
+                            FCL_REAL& sqrDistLowerBound) const {
+    if (!request.enable_profiling) {
+      leafCollides(b1, b2, sqrDistLowerBound);
+      return;
+    }
+    Timer timer;
+    leafCollides(b1, b2, sqrDistLowerBound);
+    ++result->profile.num_leaf_tests;
+    result->profile.narrowphase_time += timer.elapsed().user;
+  }
+
+  /// @brief Collision testing with a traversal specific to the node, run by
+  /// collide instead of the recursion on the BV trees.
+  /// @return whether the node has such a traversal.
+  virtual bool collideWithoutRecursion() const { return false; }
+
   /// @brief Check whether the traversal can stop
   bool canStop() const { return this->request.isSatisfied(*(this->result)); }
 
@@ -154,6 +181,27 @@ class DistanceTraversalNodeBase : public TraversalNodeBase {
   /// @brief Leaf test between node b1 and b2, if they are both leafs
   virtual void leafComputeDistance(unsigned int b1, unsigned int b2) const = 0;
 
+  /// @brief BV test between b1 and b2, accounted in the profile of the result
+  /// if profiling is requested.
+  FCL_REAL profiledBVDistanceLowerBound(unsigned int b1,
+                                        unsigned int b2) const {
+    if (request.enable_profiling) ++result->profile.num_bv_tests;
+    return BVDistanceLowerBound(b1, b2);
+  }
+
+  /// @brief Leaf test between b1 and b2, accounted in the profile of the
+  /// result if profiling is requested.
+  void profiledLeafComputeDistance(unsigned int b1, unsigned int b2) const {
+    if (!request.enable_profiling) {
+      leafComputeDistance(b1, b2);
+      return;
+    }
+    Timer timer;
+    leafComputeDistance(b1, b2);
+    ++result->profile.num_leaf_tests;
+    result->profile.narrowphase_time += timer.elapsed().user;
+  }
+
   /// @brief Check whether the traversal can stop
   virtual bool canStop(FCL_REAL /*c*/) const { return false; }
 
@@ -189,9 +189,8 @@ class MeshHeightFieldCollisionTraversalNode
 
     TriangleP tri1(P1, P2, P3);
 
-    typedef Convex<Triangle> ConvexTriangle;
-    ConvexTriangle convex1, convex2;
-    details::buildConvexTriangles(node2, *this->model2, convex2, convex2);
+    details::HeightFieldCellPrism convex1, convex2;
+    details::buildCellPrisms(node2, *this->model2, convex1, convex2);
 
     GJKSolver solver;
     Vec3f p1,
@@ -211,7 +210,7 @@ class MeshHeightFieldCollisionTraversalNode
         penetrationDepth = -distance;
         if (distance > 0) {
           normal = (p2 - p1).normalized();
-          p = .5 * (p1 + p2);
+          p = (p1 + p2) / 2;
         }
         this->result->addContact(Contact(this->model1, this->model2,
                                          primitive_id1, primitive_id2, p,
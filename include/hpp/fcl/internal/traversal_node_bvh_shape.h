@@ -218,7 +218,7 @@ class MeshShapeCollisionTraversalNode
       if (this->request.num_max_contacts > this->result->numContacts()) {
         this->result->addContact(
             Contact(this->model1, this->model2, primitive_id, Contact::NONE,
-                    .5 * (c1 + c2), (c2 - c1).normalized(), -distance));
+                    (c1 + c2) / 2, (c2 - c1).normalized(), -distance));
       }
     } else
       sqrDistLowerBound = distToCollision * distToCollision;
@@ -318,7 +318,7 @@ class ShapeMeshCollisionTraversalNode
       if (this->request.num_max_contacts > this->result->numContacts()) {
         this->result->addContact(
             Contact(this->model1, this->model2, Contact::NONE, primitive_id,
-                    .5 * (c1 + c2), (c2 - c1).normalized(), -distance));
+                    (c1 + c2) / 2, (c2 - c1).normalized(), -distance));
       }
     } else
       sqrDistLowerBound = distToCollision * distToCollision;
@@ -222,7 +222,7 @@ class MeshCollisionTraversalNode : public BVHCollisionTraversalNode<BV> {
         // above (P1, P2, P3).
         if (distance > 0) {
           normal = (p2 - p1).normalized();
-          p = .5 * (p1 + p2);
+          p = (p1 + p2) / 2;
         }
         this->result->addContact(Contact(this->model1, this->model2,
                                          primitive_id1, primitive_id2, p,
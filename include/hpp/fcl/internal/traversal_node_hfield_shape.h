@@ -55,55 +55,43 @@ namespace fcl {
 /// @{
 
 namespace details {
-template <typename BV>
-Convex<Quadrilateral> buildConvexQuadrilateral(const HFNode<BV>& node,
-                                               const HeightField<BV>& model) {
-  const MatrixXf& heights = model.getHeights();
-  const VecXf& x_grid = model.getXGrid();
-  const VecXf& y_grid = model.getYGrid();
-
-  const FCL_REAL min_height = model.getMinHeight();
-
-  const FCL_REAL x0 = x_grid[node.x_id], x1 = x_grid[node.x_id + 1],
-                 y0 = y_grid[node.y_id], y1 = y_grid[node.y_id + 1];
-  const Eigen::Block<const MatrixXf, 2, 2> cell =
-      heights.block<2, 2>(node.y_id, node.x_id);
+/// @brief Triangular prism between the minimal height of a height field and
+/// one of the two triangles of a cell.
+///
+/// The vertices are stored in the object itself, so that building the prisms
+/// of a cell does not allocate. No neighbor graph is built: with six vertices,
+/// the support function is a linear scan.
+class HeightFieldCellPrism : public ConvexBase {
+ public:
+  HeightFieldCellPrism() : ConvexBase() {}
+
+  /// @brief set the prism below the triangle (a, b, c), down to min_height.
+  void set(const Vec3f& a, const Vec3f& b, const Vec3f& c,
+           FCL_REAL min_height) {
+    vertices[0] << a[0], a[1], min_height;
+    vertices[1] << b[0], b[1], min_height;
+    vertices[2] << c[0], c[1], min_height;
+    vertices[3] = a;
+    vertices[4] = b;
+    vertices[5] = c;
+    initialize(false, vertices, 6);
+  }
 
-  assert(cell.maxCoeff() > min_height &&
-         "max_height is lower than min_height");  // Check whether the geometry
-                                                  // is degenerated
+ private:
+  HeightFieldCellPrism(const HeightFieldCellPrism&);
+  HeightFieldCellPrism& operator=(const HeightFieldCellPrism&);
 
-  Vec3f* pts = new Vec3f[8];
-  pts[0] = Vec3f(x0, y0, min_height);
-  pts[1] = Vec3f(x0, y1, min_height);
-  pts[2] = Vec3f(x1, y1, min_height);
-  pts[3] = Vec3f(x1, y0, min_height);
-  pts[4] = Vec3f(x0, y0, cell(0, 0));
-  pts[5] = Vec3f(x0, y1, cell(1, 0));
-  pts[6] = Vec3f(x1, y1, cell(1, 1));
-  pts[7] = Vec3f(x1, y0, cell(0, 1));
-
-  Quadrilateral* polygons = new Quadrilateral[6];
-  polygons[0].set(0, 3, 2, 1);  // x+ side
-  polygons[1].set(0, 1, 5, 4);  // y- side
-  polygons[2].set(1, 2, 6, 5);  // x- side
-  polygons[3].set(2, 3, 7, 6);  // y+ side
-  polygons[4].set(3, 0, 4, 7);  // z- side
-  polygons[5].set(4, 5, 6, 7);  // z+ side
-
-  return Convex<Quadrilateral>(true,
-                               pts,  // points
-                               8,    // num points
-                               polygons,
-                               6  // number of polygons
-  );
-}
+  Vec3f vertices[6];
+};
 
+/// @brief Build the two triangular prisms of a height field cell.
+///
+/// The cell is split along the diagonal from (x0, y1) to (x1, y0), which keeps
+/// each prism convex.
 template <typename BV>
-void buildConvexTriangles(const HFNode<BV>& node, const HeightField<BV>& model,
-                          Convex<Triangle>& convex1,
-                          Convex<Triangle>& convex2) {
-  const MatrixXf& heights = model.getHeights();
+void buildCellPrisms(const HFNode<BV>& node, const HeightField<BV>& model,
+                     HeightFieldCellPrism& prism1,
+                     HeightFieldCellPrism& prism2) {
   const VecXf& x_grid = model.getXGrid();
   const VecXf& y_grid = model.getYGrid();
 
@@ -112,64 +100,18 @@ void buildConvexTriangles(const HFNode<BV>& node, const HeightField<BV>& model,
   const FCL_REAL x0 = x_grid[node.x_id], x1 = x_grid[node.x_id + 1],
                  y0 = y_grid[node.y_id], y1 = y_grid[node.y_id + 1];
   const FCL_REAL max_height = node.max_height;
-  const Eigen::Block<const MatrixXf, 2, 2> cell =
-      heights.block<2, 2>(node.y_id, node.x_id);
 
   assert(max_height > min_height &&
          "max_height is lower than min_height");  // Check whether the geometry
                                                   // is degenerated
   HPP_FCL_UNUSED_VARIABLE(max_height);
 
-  {
-    Vec3f* pts = new Vec3f[8];
-    pts[0] = Vec3f(x0, y0, min_height);
-    pts[1] = Vec3f(x0, y1, min_height);
-    pts[2] = Vec3f(x1, y1, min_height);
-    pts[3] = Vec3f(x1, y0, min_height);
-    pts[4] = Vec3f(x0, y0, cell(0, 0));
-    pts[5] = Vec3f(x0, y1, cell(1, 0));
-    pts[6] = Vec3f(x1, y1, cell(1, 1));
-    pts[7] = Vec3f(x1, y0, cell(0, 1));
-
-    Triangle* triangles = new Triangle[8];
-    triangles[0].set(0, 1, 3);  // bottom
-    triangles[1].set(4, 5, 7);  // top
-    triangles[2].set(0, 1, 4);
-    triangles[3].set(4, 1, 5);
-    triangles[4].set(1, 7, 3);
-    triangles[5].set(1, 5, 7);
-    triangles[6].set(0, 3, 7);
-    triangles[7].set(7, 4, 0);
-
-    convex1.set(true,
-                pts,  // points
-                8,    // num points
-                triangles,
-                8  // number of polygons
-    );
-  }
-
-  {
-    Vec3f* pts = new Vec3f[8];
-    memcpy(pts, convex1.points, 8 * sizeof(Vec3f));
-
-    Triangle* triangles = new Triangle[8];
-    triangles[0].set(3, 2, 1);  // top
-    triangles[1].set(5, 6, 7);  // bottom
-    triangles[2].set(1, 2, 5);
-    triangles[3].set(5, 2, 6);
-    triangles[4].set(1, 3, 7);
-    triangles[5].set(1, 7, 5);
-    triangles[6].set(2, 3, 7);
-    triangles[7].set(6, 2, 3);
-
-    convex2.set(true,
-                pts,  // points
-                8,    // num points
-                triangles,
-                8  // number of polygons
-    );
-  }
+  const Vec3f p00(x0, y0, model.getHeight(node.x_id, node.y_id)),
+      p01(x0, y1, model.getHeight(node.x_id, node.y_id + 1)),
+      p11(x1, y1, model.getHeight(node.x_id + 1, node.y_id + 1)),
+      p10(x1, y0, model.getHeight(node.x_id + 1, node.y_id));
+  prism1.set(p00, p01, p10, min_height);
+  prism2.set(p01, p11, p10, min_height);
 }
 }  // namespace details
 
@@ -243,9 +185,9 @@ class HeightFieldShapeCollisionTraversalNode
     return disjoint;
   }
 
-  template <typename Polygone>
-  bool shapeDistance(const Convex<Polygone>& convex1,
-                     const Convex<Polygone>& convex2, const Transform3f& tf1,
+  bool shapeDistance(const details::HeightFieldCellPrism& convex1,
+                     const details::HeightFieldCellPrism& convex2,
+                     const Transform3f& tf1,
                      const S& shape, const Transform3f& tf2, FCL_REAL& distance,
                      Vec3f& c1, Vec3f& c2, Vec3f& normal) const {
     const Transform3f Id;
@@ -261,7 +203,7 @@ class HeightFieldShapeCollisionTraversalNode
 
     if (RTIsIdentity)
       collision2 = !nsolver->shapeDistance(convex2, Id, shape, tf2, distance2,
-                                           c1, c2, normal);
+                                           contact2_1, contact2_2, normal2);
     else
       collision2 = !nsolver->shapeDistance(convex2, tf1, shape, tf2, distance2,
                                            contact2_1, contact2_2, normal2);
@@ -288,9 +230,9 @@ class HeightFieldShapeCollisionTraversalNode
     return false;
   }
 
-  template <typename Polygone>
-  bool shapeCollision(const Convex<Polygone>& convex1,
-                      const Convex<Polygone>& convex2, const Transform3f& tf1,
+  bool shapeCollision(const details::HeightFieldCellPrism& convex1,
+                      const details::HeightFieldCellPrism& convex2,
+                      const Transform3f& tf1,
                       const S& shape, const Transform3f& tf2,
                       FCL_REAL& distance_lower_bound, Vec3f& contact_point,
                       Vec3f& normal) const {
@@ -354,14 +296,8 @@ class HeightFieldShapeCollisionTraversalNode
 
     // Split quadrilateral primitives into two convex shapes corresponding to
     // polyhedron with triangular bases. This is essential to keep the convexity
-
-    //    typedef Convex<Quadrilateral> ConvexQuadrilateral;
-    //    const ConvexQuadrilateral convex =
-    //    details::buildConvexQuadrilateral(node,*this->model1);
-
-    typedef Convex<Triangle> ConvexTriangle;
-    ConvexTriangle convex1, convex2;
-    details::buildConvexTriangles(node, *this->model1, convex1, convex2);
+    details::HeightFieldCellPrism convex1, convex2;
+    details::buildCellPrisms(node, *this->model1, convex1, convex2);
 
     FCL_REAL distance;
     //    Vec3f contact_point, normal;
@@ -380,7 +316,7 @@ class HeightFieldShapeCollisionTraversalNode
       sqrDistLowerBound = 0;
       if (this->request.num_max_contacts > this->result->numContacts()) {
         this->result->addContact(Contact(this->model1, this->model2, (int)b1,
-                                         (int)Contact::NONE, .5 * (c1 + c2),
+                                         (int)Contact::NONE, (c1 + c2) / 2,
                                          (c2 - c1).normalized(), -distance));
       }
     } else if (collision && this->request.security_margin >= 0) {
@@ -402,6 +338,29 @@ class HeightFieldShapeCollisionTraversalNode
     assert(this->result->isCollision() || sqrDistLowerBound > 0);
   }
 
+  /// @brief Collision testing through the grid of the height field.
+  ///
+  /// The cells are reached by descending the pyramid of maximal heights of the
+  /// height field, from its coarsest level down to the cells, with the AABB of
+  /// the shape expressed in the frame of the height field. Contrary to the
+  /// traversal of the BV hierarchy, no BV of the height field is transformed.
+  void collideCells() const {
+    const Transform3f tf = this->tf1.inverseTimes(this->tf2);
+    computeBV(*this->model2, tf, query_aabb);
+
+    const std::vector<MatrixXf>& pyramid = this->model1->getMaxHeightPyramid();
+    const MatrixXf& top = pyramid.back();
+    const int level = static_cast<int>(pyramid.size()) - 1;
+    for (Eigen::DenseIndex by = 0; by < top.rows(); ++by)
+      for (Eigen::DenseIndex bx = 0; bx < top.cols(); ++bx)
+        if (collideBlock(level, bx, by)) return;
+  }
+
+  bool collideWithoutRecursion() const {
+    collideCells();
+    return true;
+  }
+
   const GJKSolver* nsolver;
 
   const HeightField<BV>* model1;
@@ -413,6 +372,52 @@ class HeightFieldShapeCollisionTraversalNode
   mutable int num_bv_tests;
   mutable int num_leaf_tests;
   mutable FCL_REAL query_time_seconds;
+
+ private:
+  /// @brief Test the block (bx, by) of the given level of the pyramid and
+  /// descend into its sub-blocks.
+  /// @return whether the query can stop.
+  bool collideBlock(const int level, const Eigen::DenseIndex bx,
+                    const Eigen::DenseIndex by) const {
+    const MatrixXf& max_heights =
+        this->model1->getMaxHeightPyramid()[static_cast<size_t>(level)];
+    const MatrixXf& cells = this->model1->getMaxHeightPyramid()[0];
+    const VecXf& x_grid = this->model1->getXGrid();
+    const VecXf& y_grid = this->model1->getYGrid();
+
+    const Eigen::DenseIndex x0 = bx << level, y0 = by << level,
+                            x1 = (std::min)((bx + 1) << level, cells.cols()),
+                            y1 = (std::min)((by + 1) << level, cells.rows());
+    const AABB block(
+        Vec3f(x_grid[x0], y_grid[y1], this->model1->getMinHeight()),
+        Vec3f(x_grid[x1], y_grid[y0], max_heights(by, bx)));
+
+    if (this->enable_statistics) this->num_bv_tests++;
+    if (this->request.enable_profiling) ++this->result->profile.num_bv_tests;
+    FCL_REAL sqrDist;
+    if (!block.overlap(query_aabb, this->request, sqrDist)) {
+      internal::updateDistanceLowerBoundFromBV(this->request, *this->result,
+                                               sqrDist);
+      return false;
+    }
+
+    if (level == 0) {
+      this->profiledLeafCollides(this->model1->getCellBVIndex(bx, by), 0,
+                                 sqrDist);
+      return this->canStop();
+    }
+
+    const MatrixXf& finer =
+        this->model1->getMaxHeightPyramid()[static_cast<size_t>(level - 1)];
+    for (Eigen::DenseIndex cy = 2 * by;
+         cy < (std::min)(2 * by + 2, finer.rows()); ++cy)
+      for (Eigen::DenseIndex cx = 2 * bx;
+           cx < (std::min)(2 * bx + 2, finer.cols()); ++cx)
+        if (collideBlock(level - 1, cx, cy)) return true;
+    return false;
+  }
+
+  mutable AABB query_aabb;
 };
 
 /// @}
@@ -469,17 +474,25 @@ class HeightFieldShapeDistanceTraversalNode : public DistanceTraversalNodeBase {
   void leafComputeDistance(unsigned int b1, unsigned int /*b2*/) const {
     if (this->enable_statistics) this->num_leaf_tests++;
 
-    const BVNode<BV>& node = this->model1->getBV(b1);
+    const HFNode<BV>& node = this->model1->getBV(b1);
 
-    typedef Convex<Quadrilateral> ConvexQuadrilateral;
-    const ConvexQuadrilateral convex =
-        details::buildConvexQuadrilateral(node, *this->model1);
+    details::HeightFieldCellPrism convex1, convex2;
+    details::buildCellPrisms(node, *this->model1, convex1, convex2);
 
-    FCL_REAL d;
+    FCL_REAL d, d2;
     Vec3f closest_p1, closest_p2, normal;
+    Vec3f closest2_p1, closest2_p2, normal2;
 
-    nsolver->shapeDistance(convex, this->tf1, *(this->model2), this->tf2, d,
+    nsolver->shapeDistance(convex1, this->tf1, *(this->model2), this->tf2, d,
                            closest_p1, closest_p2, normal);
+    nsolver->shapeDistance(convex2, this->tf1, *(this->model2), this->tf2, d2,
+                           closest2_p1, closest2_p2, normal2);
+    if (d2 < d) {
+      d = d2;
+      closest_p1 = closest2_p1;
+      closest_p2 = closest2_p2;
+      normal = normal2;
+    }
 
     this->result->update(d, this->model1, this->model2, b1,
                          DistanceResult::NONE, closest_p1, closest_p2, normal);
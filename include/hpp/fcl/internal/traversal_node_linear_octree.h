@@ -0,0 +1,274 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HPP_FCL_TRAVERSAL_NODE_LINEAR_OCTREE_H
+#define HPP_FCL_TRAVERSAL_NODE_LINEAR_OCTREE_H
+
+/// @cond INTERNAL
+
+#include <algorithm>
+
+#include <hpp/fcl/collision_data.h>
+#include <hpp/fcl/internal/traversal_node_base.h>
+#include <hpp/fcl/internal/shape_shape_func.h>
+#include <hpp/fcl/narrowphase/narrowphase.h>
+#include <hpp/fcl/linear_octree.h>
+#include <hpp/fcl/shape/geometric_shapes_utility.h>
+
+namespace hpp {
+namespace fcl {
+
+/// @addtogroup Traversal_For_Collision
+/// @{
+
+/// @brief Traversal node for collision between a linear octree and a shape.
+///
+/// The nodes of the tree are visited from the root, the leaves below a node
+/// being found by binary search in the sorted codes of the leaves.
+template <typename S>
+class HPP_FCL_DLLAPI LinearOcTreeShapeCollisionTraversalNode
+    : public CollisionTraversalNodeBase {
+ public:
+  LinearOcTreeShapeCollisionTraversalNode(const CollisionRequest& request)
+      : CollisionTraversalNodeBase(request) {
+    model1 = NULL;
+    model2 = NULL;
+
+    nsolver = NULL;
+  }
+
+  bool BVDisjoints(unsigned int, unsigned int, FCL_REAL&) const {
+    return false;
+  }
+
+  void leafCollides(unsigned int, unsigned int,
+                    FCL_REAL& sqrDistLowerBound) const {
+    if (model1->getNumLeaves() > 0)
+      collideRecurse(0, model1->getTreeDepth(), 0, model1->getNumLeaves());
+    sqrDistLowerBound = std::max((FCL_REAL)0, result->distance_lower_bound);
+    sqrDistLowerBound *= sqrDistLowerBound;
+  }
+
+  const LinearOcTree* model1;
+  const S* model2;
+
+  /// @brief AABB of model2 in the frame of model1.
+  AABB model2_bv;
+
+  const GJKSolver* nsolver;
+
+ private:
+  /// @brief Collision between the leaves [begin, end) below a node and the
+  /// shape.
+  /// @return whether the collision request is satisfied.
+  bool collideRecurse(const LinearOcTree::Code code, const unsigned int level,
+                      const std::size_t begin, const std::size_t end) const {
+    if (end - begin == 1) return collideLeaf(begin);
+
+    FCL_REAL sqrDistLowerBound;
+    if (!model1->getNodeBV(code, level)
+             .overlap(model2_bv, request, sqrDistLowerBound)) {
+      internal::updateDistanceLowerBoundFromBV(request, *result,
+                                               sqrDistLowerBound);
+      return false;
+    }
+
+    const std::vector<LinearOcTree::Code>& codes = model1->getLeafCodes();
+    const LinearOcTree::Code child_size = LinearOcTree::Code(1)
+                                          << (3 * (level - 1));
+    std::size_t child_begin = begin;
+    for (LinearOcTree::Code i = 0; i < 8 && child_begin < end; ++i) {
+      const LinearOcTree::Code child_code = code + i * child_size;
+      const std::size_t child_end =
+          (std::size_t)(std::lower_bound(codes.begin() + child_begin,
+                                         codes.begin() + end,
+                                         child_code + child_size) -
+                        codes.begin());
+      if (child_end > child_begin &&
+          collideRecurse(child_code, level - 1, child_begin, child_end))
+        return true;
+      child_begin = child_end;
+    }
+    return false;
+  }
+
+  /// @brief Collision between the i-th leaf and the shape.
+  /// @return whether the collision request is satisfied.
+  bool collideLeaf(const std::size_t i) const {
+    const AABB bv = model1->getLeafBV(i);
+    FCL_REAL sqrDistLowerBound;
+    if (!bv.overlap(model2_bv, request, sqrDistLowerBound)) {
+      internal::updateDistanceLowerBoundFromBV(request, *result,
+                                               sqrDistLowerBound);
+      return false;
+    }
+
+    Box box;
+    Transform3f box_tf;
+    constructBox(bv, tf1, box, box_tf);
+
+    bool contactNotAdded = (result->numContacts() >= request.num_max_contacts);
+    std::size_t ncontact = ShapeShapeCollide<Box, S>(
+        &box, box_tf, model2, tf2, nsolver, request, *result);
+    assert(ncontact == 0 || ncontact == 1);
+    if (!contactNotAdded && ncontact == 1) {
+      // Update contact information.
+      const Contact& c = result->getContact(result->numContacts() - 1);
+      result->setContact(result->numContacts() - 1,
+                         Contact(model1, c.o2, (int)i, c.b2, c.pos, c.normal,
+                                 c.penetration_depth));
+    }
+
+    return canStop();
+  }
+};
+
+/// @}
+
+/// @addtogroup Traversal_For_Distance
+/// @{
+
+/// @brief Traversal node for distance between a linear octree and a shape.
+///
+/// The children of a node are visited closest first.
+template <typename S>
+class HPP_FCL_DLLAPI LinearOcTreeShapeDistanceTraversalNode
+    : public DistanceTraversalNodeBase {
+ public:
+  LinearOcTreeShapeDistanceTraversalNode() {
+    model1 = NULL;
+    model2 = NULL;
+
+    nsolver = NULL;
+  }
+
+  FCL_REAL BVDistanceLowerBound(unsigned int, unsigned int) const {
+    return -1;
+  }
+
+  void leafComputeDistance(unsigned int, unsigned int) const {
+    if (model1->getNumLeaves() > 0)
+      distanceRecurse(0, model1->getTreeDepth(), 0, model1->getNumLeaves());
+  }
+
+  const LinearOcTree* model1;
+  const S* model2;
+
+  /// @brief AABB of model2 in the frame of model1.
+  AABB model2_bv;
+
+  const GJKSolver* nsolver;
+
+ private:
+  /// @brief Distance between the leaves [begin, end) below a node and the
+  /// shape.
+  /// @return whether the distance request is satisfied.
+  bool distanceRecurse(const LinearOcTree::Code code, const unsigned int level,
+                       const std::size_t begin, const std::size_t end) const {
+    if (end - begin == 1) return distanceLeaf(begin);
+
+    const std::vector<LinearOcTree::Code>& codes = model1->getLeafCodes();
+    const LinearOcTree::Code child_size = LinearOcTree::Code(1)
+                                          << (3 * (level - 1));
+    LinearOcTree::Code child_codes[8];
+    std::size_t child_ranges[8][2];
+    FCL_REAL child_distances[8];
+    unsigned int num_children = 0;
+    std::size_t child_begin = begin;
+    for (LinearOcTree::Code i = 0; i < 8 && child_begin < end; ++i) {
+      const LinearOcTree::Code child_code = code + i * child_size;
+      const std::size_t child_end =
+          (std::size_t)(std::lower_bound(codes.begin() + child_begin,
+                                         codes.begin() + end,
+                                         child_code + child_size) -
+                        codes.begin());
+      if (child_end > child_begin) {
+        const FCL_REAL d =
+            model1->getNodeBV(child_code, level - 1).distance(model2_bv);
+        // Insert the child, sorted by distance.
+        unsigned int k = num_children++;
+        for (; k > 0 && child_distances[k - 1] > d; --k) {
+          child_codes[k] = child_codes[k - 1];
+          child_ranges[k][0] = child_ranges[k - 1][0];
+          child_ranges[k][1] = child_ranges[k - 1][1];
+          child_distances[k] = child_distances[k - 1];
+        }
+        child_codes[k] = child_code;
+        child_ranges[k][0] = child_begin;
+        child_ranges[k][1] = child_end;
+        child_distances[k] = d;
+      }
+      child_begin = child_end;
+    }
+
+    for (unsigned int k = 0; k < num_children; ++k) {
+      if (child_distances[k] >= result->min_distance) break;
+      if (distanceRecurse(child_codes[k], level - 1, child_ranges[k][0],
+                          child_ranges[k][1]))
+        return true;
+    }
+    return false;
+  }
+
+  /// @brief Distance between the i-th leaf and the shape.
+  /// @return whether the distance request is satisfied.
+  bool distanceLeaf(const std::size_t i) const {
+    const AABB bv = model1->getLeafBV(i);
+    if (bv.distance(model2_bv) >= result->min_distance) return false;
+
+    Box box;
+    Transform3f box_tf;
+    constructBox(bv, tf1, box, box_tf);
+
+    FCL_REAL dist;
+    Vec3f closest_p1, closest_p2, normal;
+    nsolver->shapeDistance(box, box_tf, *model2, tf2, dist, closest_p1,
+                           closest_p2, normal);
+
+    result->update(dist, model1, model2, (int)i, DistanceResult::NONE,
+                   closest_p1, closest_p2, normal);
+
+    return request.isSatisfied(*result);
+  }
+};
+
+/// @}
+
+}  // namespace fcl
+
+}  // namespace hpp
+
+/// @endcond
+
+#endif
@@ -78,6 +78,11 @@ class HPP_FCL_DLLAPI OcTreeSolver {
     crequest = &request_;
     cresult = &result_;
 
+    if (tree1->getOccupiedLeaves() && tree2->getOccupiedLeaves()) {
+      OcTreeIntersectLeaves(tree1, tree2, tf1, tf2);
+      return;
+    }
+
     OcTreeIntersectRecurse(tree1, tree1->getRoot(), tree1->getRootBV(), tree2,
                            tree2->getRoot(), tree2->getRootBV(), tf1, tf2);
   }
@@ -90,6 +95,11 @@ class HPP_FCL_DLLAPI OcTreeSolver {
     drequest = &request_;
     dresult = &result_;
 
+    if (tree1->getOccupiedLeaves() && tree2->getOccupiedLeaves()) {
+      OcTreeDistanceLeaves(tree1, tree2, tf1, tf2);
+      return;
+    }
+
     OcTreeDistanceRecurse(tree1, tree1->getRoot(), tree1->getRootBV(), tree2,
                           tree2->getRoot(), tree2->getRootBV(), tf1, tf2);
   }
@@ -103,6 +113,11 @@ class HPP_FCL_DLLAPI OcTreeSolver {
     crequest = &request_;
     cresult = &result_;
 
+    if (tree1->getOccupiedLeaves()) {
+      OcTreeMeshIntersectLeaves(tree1, tree2, tf1, tf2);
+      return;
+    }
+
     OcTreeMeshIntersectRecurse(tree1, tree1->getRoot(), tree1->getRootBV(),
                                tree2, 0, tf1, tf2);
   }
@@ -116,6 +131,11 @@ class HPP_FCL_DLLAPI OcTreeSolver {
     drequest = &request_;
     dresult = &result_;
 
+    if (tree1->getOccupiedLeaves()) {
+      OcTreeMeshDistanceLeaves(tree1, tree2, tf1, tf2);
+      return;
+    }
+
     OcTreeMeshDistanceRecurse(tree1, tree1->getRoot(), tree1->getRootBV(),
                               tree2, 0, tf1, tf2);
   }
@@ -131,6 +151,11 @@ class HPP_FCL_DLLAPI OcTreeSolver {
     crequest = &request_;
     cresult = &result_;
 
+    if (tree2->getOccupiedLeaves()) {
+      OcTreeMeshIntersectLeaves(tree2, tree1, tf2, tf1);
+      return;
+    }
+
     OcTreeMeshIntersectRecurse(tree2, tree2->getRoot(), tree2->getRootBV(),
                                tree1, 0, tf2, tf1);
   }
@@ -144,8 +169,13 @@ class HPP_FCL_DLLAPI OcTreeSolver {
     drequest = &request_;
     dresult = &result_;
 
-    OcTreeMeshDistanceRecurse(tree1, 0, tree2, tree2->getRoot(),
-                              tree2->getRootBV(), tf1, tf2);
+    if (tree2->getOccupiedLeaves()) {
+      OcTreeMeshDistanceLeaves(tree2, tree1, tf2, tf1);
+      return;
+    }
+
+    OcTreeMeshDistanceRecurse(tree2, tree2->getRoot(), tree2->getRootBV(),
+                              tree1, 0, tf2, tf1);
   }
 
   /// @brief collision between octree and shape
@@ -157,6 +187,11 @@ class HPP_FCL_DLLAPI OcTreeSolver {
     crequest = &request_;
     cresult = &result_;
 
+    if (tree->getOccupiedLeaves()) {
+      OcTreeShapeIntersectLeaves(tree, s, tf1, tf2);
+      return;
+    }
+
     AABB bv2;
     computeBV<AABB>(s, Transform3f(), bv2);
     OBB obb2;
@@ -174,6 +209,11 @@ class HPP_FCL_DLLAPI OcTreeSolver {
     crequest = &request_;
     cresult = &result_;
 
+    if (tree->getOccupiedLeaves()) {
+      OcTreeShapeIntersectLeaves(tree, s, tf2, tf1);
+      return;
+    }
+
     AABB bv1;
     computeBV<AABB>(s, Transform3f(), bv1);
     OBB obb1;
@@ -191,6 +231,11 @@ class HPP_FCL_DLLAPI OcTreeSolver {
     drequest = &request_;
     dresult = &result_;
 
+    if (tree->getOccupiedLeaves()) {
+      OcTreeShapeDistanceLeaves(tree, s, tf1, tf2);
+      return;
+    }
+
     AABB aabb2;
     computeBV<AABB>(s, tf2, aabb2);
     OcTreeShapeDistanceRecurse(tree, tree->getRoot(), tree->getRootBV(), s,
@@ -206,6 +251,11 @@ class HPP_FCL_DLLAPI OcTreeSolver {
     drequest = &request_;
     dresult = &result_;
 
+    if (tree->getOccupiedLeaves()) {
+      OcTreeShapeDistanceLeaves(tree, s, tf2, tf1);
+      return;
+    }
+
     AABB aabb1;
     computeBV<AABB>(s, tf1, aabb1);
     OcTreeShapeDistanceRecurse(tree, tree->getRoot(), tree->getRootBV(), s,
@@ -213,6 +263,802 @@ class HPP_FCL_DLLAPI OcTreeSolver {
   }
 
  private:
+  /// @brief Collision between the occupied leaves of an octree and a shape.
+  ///
+  /// The shape AABB is expressed in the frame of the octree, and tested
+  /// against the flattened hierarchy built by OcTree::buildOccupiedLeaves.
+  template <typename S>
+  void OcTreeShapeIntersectLeaves(const OcTree* tree1, const S& s,
+                                  const Transform3f& tf1,
+                                  const Transform3f& tf2) const {
+    const OcTreeOccupiedLeaves& leaves = *tree1->getOccupiedLeaves();
+    if (s.isUncertain()) return;
+
+    AABB aabb2;
+    computeBV<AABB>(s, tf1.inverseTimes(tf2), aabb2);
+
+    // The hierarchy is balanced, so that its depth is below 32.
+    unsigned int stack[64];
+    int stack_size = 0;
+    if (!leaves.nodes.empty()) stack[stack_size++] = 0;
+    while (stack_size > 0) {
+      const unsigned int node_id = stack[--stack_size];
+      const OcTreeOccupiedLeaves::Node& node = leaves.nodes[node_id];
+      FCL_REAL sqrDistLowerBound;
+      if (!node.bv.overlap(aabb2, *crequest, sqrDistLowerBound)) {
+        internal::updateDistanceLowerBoundFromBV(*crequest, *cresult,
+                                                 sqrDistLowerBound);
+        continue;
+      }
+
+      if (!node.isLeaf()) {
+        stack[stack_size++] = node.index;
+        stack[stack_size++] = node_id + 1;
+        continue;
+      }
+
+      for (unsigned int i = node.index; i < node.index + node.num_boxes; ++i)
+        if (OcTreeShapeIntersectBox(tree1, leaves, i, s, aabb2, tf1, tf2))
+          return;
+    }
+
+    // Boxes added by incremental updates.
+    for (unsigned int i = leaves.num_hierarchy_boxes;
+         i < (unsigned int)leaves.boxes.size(); ++i)
+      if (OcTreeShapeIntersectBox(tree1, leaves, i, s, aabb2, tf1, tf2))
+        return;
+  }
+
+  /// @brief Collision between the box i of the occupied leaves and a shape.
+  /// @return whether the collision request is satisfied.
+  template <typename S>
+  bool OcTreeShapeIntersectBox(const OcTree* tree1,
+                               const OcTreeOccupiedLeaves& leaves,
+                               const unsigned int i, const S& s,
+                               const AABB& aabb2, const Transform3f& tf1,
+                               const Transform3f& tf2) const {
+    if (leaves.isRemoved(i)) return false;
+    FCL_REAL sqrDistLowerBound;
+    if (!leaves.boxes[i].overlap(aabb2, *crequest, sqrDistLowerBound)) {
+      internal::updateDistanceLowerBoundFromBV(*crequest, *cresult,
+                                               sqrDistLowerBound);
+      return false;
+    }
+
+    Box box;
+    Transform3f box_tf;
+    constructBox(leaves.boxes[i], tf1, box, box_tf);
+
+    bool contactNotAdded =
+        (cresult->numContacts() >= crequest->num_max_contacts);
+    std::size_t ncontact = ShapeShapeCollide<Box, S>(
+        &box, box_tf, &s, tf2, solver, *crequest, *cresult);
+    assert(ncontact == 0 || ncontact == 1);
+    if (!contactNotAdded && ncontact == 1) {
+      // Update contact information.
+      const Contact& c = cresult->getContact(cresult->numContacts() - 1);
+      cresult->setContact(cresult->numContacts() - 1,
+                          Contact(tree1, c.o2, leaves.node_ids[i], c.b2, c.pos,
+                                  c.normal, c.penetration_depth));
+    }
+
+    return crequest->isSatisfied(*cresult);
+  }
+
+  /// @brief Distance between the occupied leaves of an octree and a shape.
+  ///
+  /// The nodes of the flattened hierarchy are visited closest child first.
+  template <typename S>
+  void OcTreeShapeDistanceLeaves(const OcTree* tree1, const S& s,
+                                 const Transform3f& tf1,
+                                 const Transform3f& tf2) const {
+    const OcTreeOccupiedLeaves& leaves = *tree1->getOccupiedLeaves();
+
+    AABB aabb2;
+    computeBV<AABB>(s, tf1.inverseTimes(tf2), aabb2);
+
+    // The hierarchy is balanced, so that its depth is below 32.
+    unsigned int stack[64];
+    int stack_size = 0;
+    if (!leaves.nodes.empty()) stack[stack_size++] = 0;
+    while (stack_size > 0) {
+      const unsigned int node_id = stack[--stack_size];
+      const OcTreeOccupiedLeaves::Node& node = leaves.nodes[node_id];
+      if (node.bv.distance(aabb2) >= dresult->min_distance) continue;
+
+      if (!node.isLeaf()) {
+        const unsigned int left = node_id + 1, right = node.index;
+        if (leaves.nodes[left].bv.distance(aabb2) <
+            leaves.nodes[right].bv.distance(aabb2)) {
+          stack[stack_size++] = right;
+          stack[stack_size++] = left;
+        } else {
+          stack[stack_size++] = left;
+          stack[stack_size++] = right;
+        }
+        continue;
+      }
+
+      for (unsigned int i = node.index; i < node.index + node.num_boxes; ++i)
+        if (OcTreeShapeDistanceBox(tree1, leaves, i, s, aabb2, tf1, tf2))
+          return;
+    }
+
+    // Boxes added by incremental updates.
+    for (unsigned int i = leaves.num_hierarchy_boxes;
+         i < (unsigned int)leaves.boxes.size(); ++i)
+      if (OcTreeShapeDistanceBox(tree1, leaves, i, s, aabb2, tf1, tf2)) return;
+  }
+
+  /// @brief Distance between the box i of the occupied leaves and a shape.
+  /// @return whether the distance request is satisfied.
+  template <typename S>
+  bool OcTreeShapeDistanceBox(const OcTree* tree1,
+                              const OcTreeOccupiedLeaves& leaves,
+                              const unsigned int i, const S& s,
+                              const AABB& aabb2, const Transform3f& tf1,
+                              const Transform3f& tf2) const {
+    if (leaves.isRemoved(i) ||
+        leaves.boxes[i].distance(aabb2) >= dresult->min_distance)
+      return false;
+
+    Box box;
+    Transform3f box_tf;
+    constructBox(leaves.boxes[i], tf1, box, box_tf);
+
+    FCL_REAL dist;
+    Vec3f closest_p1, closest_p2, normal;
+    solver->shapeDistance(box, box_tf, s, tf2, dist, closest_p1, closest_p2,
+                          normal);
+
+    dresult->update(dist, tree1, &s, leaves.node_ids[i], DistanceResult::NONE,
+                    closest_p1, closest_p2, normal);
+
+    return drequest->isSatisfied(*dresult);
+  }
+
+  /// @brief Whether the AABB bv1 in frame tf1 and the bounding volume bv2 in
+  /// frame tf2 are disjoint. If so, the distance lower bound of the collision
+  /// result is updated.
+  template <typename BV>
+  bool OcTreeLeavesBVDisjoints(const AABB& bv1, const Transform3f& tf1,
+                               const BV& bv2, const Transform3f& tf2) const {
+    OBB obb1, obb2;
+    convertBV(bv1, tf1, obb1);
+    convertBV(bv2, tf2, obb2);
+    FCL_REAL sqrDistLowerBound;
+    if (obb1.overlap(obb2, *crequest, sqrDistLowerBound)) return false;
+    internal::updateDistanceLowerBoundFromBV(*crequest, *cresult,
+                                             sqrDistLowerBound);
+    return true;
+  }
+
+  /// @brief Lower bound of the distance between the AABB bv1 in frame tf1 and
+  /// the bounding volume bv2 in frame tf2.
+  ///
+  /// bv2 is bounded by the AABB of its OBB in the frame of bv1.
+  template <typename BV>
+  FCL_REAL OcTreeLeavesBVDistance(const AABB& bv1, const Transform3f& tf1,
+                                  const BV& bv2, const Transform3f& tf2) const {
+    OBB obb2;
+    convertBV(bv2, tf1.inverseTimes(tf2), obb2);
+    const Vec3f half_size(obb2.axes.cwiseAbs() * obb2.extent);
+    return bv1.distance(AABB(obb2.To - half_size, obb2.To + half_size));
+  }
+
+  /// @brief Collision between the occupied leaves of two octrees.
+  ///
+  /// Both hierarchies are traversed simultaneously. The boxes added by
+  /// incremental updates of an octree are tested against the hierarchy and
+  /// the added boxes of the other one.
+  void OcTreeIntersectLeaves(const OcTree* tree1, const OcTree* tree2,
+                             const Transform3f& tf1,
+                             const Transform3f& tf2) const {
+    const OcTreeOccupiedLeaves& leaves1 = *tree1->getOccupiedLeaves();
+    const OcTreeOccupiedLeaves& leaves2 = *tree2->getOccupiedLeaves();
+    const bool has_nodes1 = !leaves1.nodes.empty(),
+               has_nodes2 = !leaves2.nodes.empty();
+    if (has_nodes1 && has_nodes2 &&
+        OcTreeIntersectLeavesRecurse(tree1, leaves1, 0, tree2, leaves2, 0, tf1,
+                                     tf2))
+      return;
+
+    // Boxes added by incremental updates.
+    const unsigned int num_boxes1 = (unsigned int)leaves1.boxes.size(),
+                       num_boxes2 = (unsigned int)leaves2.boxes.size();
+    for (unsigned int i = leaves1.num_hierarchy_boxes; i < num_boxes1; ++i) {
+      if (has_nodes2 && OcTreeIntersectBoxLeavesRecurse(
+                            tree1, leaves1, i, tree2, leaves2, 0, tf1, tf2))
+        return;
+      for (unsigned int j = leaves2.num_hierarchy_boxes; j < num_boxes2; ++j)
+        if (OcTreeIntersectBoxes(tree1, leaves1, i, tree2, leaves2, j, tf1,
+                                 tf2))
+          return;
+    }
+    if (!has_nodes1) return;
+    for (unsigned int j = leaves2.num_hierarchy_boxes; j < num_boxes2; ++j)
+      if (OcTreeIntersectLeavesBoxRecurse(tree1, leaves1, 0, tree2, leaves2, j,
+                                          tf1, tf2))
+        return;
+  }
+
+  /// @brief Collision between the nodes node1 and node2 of the hierarchies of
+  /// the occupied leaves of two octrees.
+  /// @return whether the collision request is satisfied.
+  bool OcTreeIntersectLeavesRecurse(const OcTree* tree1,
+                                    const OcTreeOccupiedLeaves& leaves1,
+                                    const unsigned int node1,
+                                    const OcTree* tree2,
+                                    const OcTreeOccupiedLeaves& leaves2,
+                                    const unsigned int node2,
+                                    const Transform3f& tf1,
+                                    const Transform3f& tf2) const {
+    const OcTreeOccupiedLeaves::Node& n1 = leaves1.nodes[node1];
+    const OcTreeOccupiedLeaves::Node& n2 = leaves2.nodes[node2];
+    if (OcTreeLeavesBVDisjoints(n1.bv, tf1, n2.bv, tf2)) return false;
+
+    if (n1.isLeaf()) {
+      for (unsigned int i = n1.index; i < n1.index + n1.num_boxes; ++i)
+        if (OcTreeIntersectBoxLeavesRecurse(tree1, leaves1, i, tree2, leaves2,
+                                            node2, tf1, tf2))
+          return true;
+      return false;
+    }
+    if (n2.isLeaf()) {
+      for (unsigned int j = n2.index; j < n2.index + n2.num_boxes; ++j)
+        if (OcTreeIntersectLeavesBoxRecurse(tree1, leaves1, node1, tree2,
+                                            leaves2, j, tf1, tf2))
+          return true;
+      return false;
+    }
+
+    // Determine which tree to traverse first.
+    if (n1.bv.size() > n2.bv.size())
+      return OcTreeIntersectLeavesRecurse(tree1, leaves1, node1 + 1, tree2,
+                                          leaves2, node2, tf1, tf2) ||
+             OcTreeIntersectLeavesRecurse(tree1, leaves1, n1.index, tree2,
+                                          leaves2, node2, tf1, tf2);
+    return OcTreeIntersectLeavesRecurse(tree1, leaves1, node1, tree2, leaves2,
+                                        node2 + 1, tf1, tf2) ||
+           OcTreeIntersectLeavesRecurse(tree1, leaves1, node1, tree2, leaves2,
+                                        n2.index, tf1, tf2);
+  }
+
+  /// @brief Collision between the box i of the occupied leaves of tree1 and
+  /// the node node2 of the hierarchy of tree2.
+  /// @return whether the collision request is satisfied.
+  bool OcTreeIntersectBoxLeavesRecurse(const OcTree* tree1,
+                                       const OcTreeOccupiedLeaves& leaves1,
+                                       const unsigned int i,
+                                       const OcTree* tree2,
+                                       const OcTreeOccupiedLeaves& leaves2,
+                                       const unsigned int node2,
+                                       const Transform3f& tf1,
+                                       const Transform3f& tf2) const {
+    const OcTreeOccupiedLeaves::Node& n2 = leaves2.nodes[node2];
+    if (leaves1.isRemoved(i) ||
+        OcTreeLeavesBVDisjoints(leaves1.boxes[i], tf1, n2.bv, tf2))
+      return false;
+
+    if (n2.isLeaf()) {
+      for (unsigned int j = n2.index; j < n2.index + n2.num_boxes; ++j)
+        if (OcTreeIntersectBoxes(tree1, leaves1, i, tree2, leaves2, j, tf1,
+                                 tf2))
+          return true;
+      return false;
+    }
+    return OcTreeIntersectBoxLeavesRecurse(tree1, leaves1, i, tree2, leaves2,
+                                           node2 + 1, tf1, tf2) ||
+           OcTreeIntersectBoxLeavesRecurse(tree1, leaves1, i, tree2, leaves2,
+                                           n2.index, tf1, tf2);
+  }
+
+  /// @brief Collision between the node node1 of the hierarchy of tree1 and
+  /// the box j of the occupied leaves of tree2.
+  /// @return whether the collision request is satisfied.
+  bool OcTreeIntersectLeavesBoxRecurse(const OcTree* tree1,
+                                       const OcTreeOccupiedLeaves& leaves1,
+                                       const unsigned int node1,
+                                       const OcTree* tree2,
+                                       const OcTreeOccupiedLeaves& leaves2,
+                                       const unsigned int j,
+                                       const Transform3f& tf1,
+                                       const Transform3f& tf2) const {
+    const OcTreeOccupiedLeaves::Node& n1 = leaves1.nodes[node1];
+    if (leaves2.isRemoved(j) ||
+        OcTreeLeavesBVDisjoints(n1.bv, tf1, leaves2.boxes[j], tf2))
+      return false;
+
+    if (n1.isLeaf()) {
+      for (unsigned int i = n1.index; i < n1.index + n1.num_boxes; ++i)
+        if (OcTreeIntersectBoxes(tree1, leaves1, i, tree2, leaves2, j, tf1,
+                                 tf2))
+          return true;
+      return false;
+    }
+    return OcTreeIntersectLeavesBoxRecurse(tree1, leaves1, node1 + 1, tree2,
+                                           leaves2, j, tf1, tf2) ||
+           OcTreeIntersectLeavesBoxRecurse(tree1, leaves1, n1.index, tree2,
+                                           leaves2, j, tf1, tf2);
+  }
+
+  /// @brief Collision between the box i of the occupied leaves of tree1 and
+  /// the box j of the occupied leaves of tree2.
+  /// @return whether the collision request is satisfied.
+  bool OcTreeIntersectBoxes(const OcTree* tree1,
+                            const OcTreeOccupiedLeaves& leaves1,
+                            const unsigned int i, const OcTree* tree2,
+                            const OcTreeOccupiedLeaves& leaves2,
+                            const unsigned int j, const Transform3f& tf1,
+                            const Transform3f& tf2) const {
+    if (leaves1.isRemoved(i) || leaves2.isRemoved(j) ||
+        OcTreeLeavesBVDisjoints(leaves1.boxes[i], tf1, leaves2.boxes[j], tf2))
+      return false;
+
+    const int id1 = leaves1.node_ids[i], id2 = leaves2.node_ids[j];
+    if (!crequest->enable_contact) {  // Overlap
+      if (cresult->numContacts() < crequest->num_max_contacts)
+        cresult->addContact(Contact(tree1, tree2, id1, id2));
+      return crequest->isSatisfied(*cresult);
+    }
+
+    Box box1, box2;
+    Transform3f box1_tf, box2_tf;
+    constructBox(leaves1.boxes[i], tf1, box1, box1_tf);
+    constructBox(leaves2.boxes[j], tf2, box2, box2_tf);
+
+    // shapeDistance returns whether GJK succeeded, not whether the boxes
+    // collide.
+    FCL_REAL distance;
+    Vec3f c1, c2, normal;
+    solver->shapeDistance(box1, box1_tf, box2, box2_tf, distance, c1, c2,
+                          normal);
+    bool collision = distance <= 0;
+    FCL_REAL distToCollision = distance - crequest->security_margin;
+
+    if (cresult->numContacts() < crequest->num_max_contacts) {
+      if (collision)
+        cresult->addContact(
+            Contact(tree1, tree2, id1, id2, c1, normal, -distance));
+      else if (distToCollision <= 0)
+        cresult->addContact(Contact(tree1, tree2, id1, id2, (c1 + c2) / 2,
+                                    (c2 - c1).normalized(), -distance));
+    }
+    internal::updateDistanceLowerBoundFromLeaf(*crequest, *cresult,
+                                               distToCollision, c1, c2);
+
+    return crequest->isSatisfied(*cresult);
+  }
+
+  /// @brief Distance between the occupied leaves of two octrees.
+  ///
+  /// Both hierarchies are traversed simultaneously, closest pair of nodes
+  /// first. The boxes added by incremental updates of an octree are tested
+  /// against the hierarchy and the added boxes of the other one.
+  void OcTreeDistanceLeaves(const OcTree* tree1, const OcTree* tree2,
+                            const Transform3f& tf1,
+                            const Transform3f& tf2) const {
+    const OcTreeOccupiedLeaves& leaves1 = *tree1->getOccupiedLeaves();
+    const OcTreeOccupiedLeaves& leaves2 = *tree2->getOccupiedLeaves();
+    const bool has_nodes1 = !leaves1.nodes.empty(),
+               has_nodes2 = !leaves2.nodes.empty();
+    if (has_nodes1 && has_nodes2 &&
+        OcTreeDistanceLeavesRecurse(tree1, leaves1, 0, tree2, leaves2, 0, tf1,
+                                    tf2))
+      return;
+
+    // Boxes added by incremental updates.
+    const unsigned int num_boxes1 = (unsigned int)leaves1.boxes.size(),
+                       num_boxes2 = (unsigned int)leaves2.boxes.size();
+    for (unsigned int i = leaves1.num_hierarchy_boxes; i < num_boxes1; ++i) {
+      if (has_nodes2 && OcTreeDistanceBoxLeavesRecurse(
+                            tree1, leaves1, i, tree2, leaves2, 0, tf1, tf2))
+        return;
+      for (unsigned int j = leaves2.num_hierarchy_boxes; j < num_boxes2; ++j)
+        if (OcTreeDistanceBoxes(tree1, leaves1, i, tree2, leaves2, j, tf1,
+                                tf2))
+          return;
+    }
+    if (!has_nodes1) return;
+    for (unsigned int j = leaves2.num_hierarchy_boxes; j < num_boxes2; ++j)
+      if (OcTreeDistanceLeavesBoxRecurse(tree1, leaves1, 0, tree2, leaves2, j,
+                                         tf1, tf2))
+        return;
+  }
+
+  /// @brief Distance between the nodes node1 and node2 of the hierarchies of
+  /// the occupied leaves of two octrees.
+  /// @return whether the distance request is satisfied.
+  bool OcTreeDistanceLeavesRecurse(const OcTree* tree1,
+                                   const OcTreeOccupiedLeaves& leaves1,
+                                   const unsigned int node1,
+                                   const OcTree* tree2,
+                                   const OcTreeOccupiedLeaves& leaves2,
+                                   const unsigned int node2,
+                                   const Transform3f& tf1,
+                                   const Transform3f& tf2) const {
+    const OcTreeOccupiedLeaves::Node& n1 = leaves1.nodes[node1];
+    const OcTreeOccupiedLeaves::Node& n2 = leaves2.nodes[node2];
+    if (OcTreeLeavesBVDistance(n1.bv, tf1, n2.bv, tf2) >=
+        dresult->min_distance)
+      return false;
+
+    if (n1.isLeaf()) {
+      for (unsigned int i = n1.index; i < n1.index + n1.num_boxes; ++i)
+        if (OcTreeDistanceBoxLeavesRecurse(tree1, leaves1, i, tree2, leaves2,
+                                           node2, tf1, tf2))
+          return true;
+      return false;
+    }
+    if (n2.isLeaf()) {
+      for (unsigned int j = n2.index; j < n2.index + n2.num_boxes; ++j)
+        if (OcTreeDistanceLeavesBoxRecurse(tree1, leaves1, node1, tree2,
+                                           leaves2, j, tf1, tf2))
+          return true;
+      return false;
+    }
+
+    // Determine which tree to traverse first, and visit the closest child
+    // first.
+    unsigned int children1[2] = {node1, node1},
+                 children2[2] = {node2 + 1, n2.index};
+    FCL_REAL d[2];
+    if (n1.bv.size() > n2.bv.size()) {
+      children1[0] = node1 + 1;
+      children1[1] = n1.index;
+      children2[0] = children2[1] = node2;
+      for (int k = 0; k < 2; ++k)
+        d[k] = OcTreeLeavesBVDistance(leaves1.nodes[children1[k]].bv, tf1,
+                                      n2.bv, tf2);
+    } else {
+      for (int k = 0; k < 2; ++k)
+        d[k] = OcTreeLeavesBVDistance(n1.bv, tf1,
+                                      leaves2.nodes[children2[k]].bv, tf2);
+    }
+    const int first = d[1] < d[0] ? 1 : 0;
+    return OcTreeDistanceLeavesRecurse(tree1, leaves1, children1[first], tree2,
+                                       leaves2, children2[first], tf1, tf2) ||
+           OcTreeDistanceLeavesRecurse(tree1, leaves1, children1[1 - first],
+                                       tree2, leaves2, children2[1 - first],
+                                       tf1, tf2);
+  }
+
+  /// @brief Distance between the box i of the occupied leaves of tree1 and
+  /// the node node2 of the hierarchy of tree2.
+  /// @return whether the distance request is satisfied.
+  bool OcTreeDistanceBoxLeavesRecurse(const OcTree* tree1,
+                                      const OcTreeOccupiedLeaves& leaves1,
+                                      const unsigned int i,
+                                      const OcTree* tree2,
+                                      const OcTreeOccupiedLeaves& leaves2,
+                                      const unsigned int node2,
+                                      const Transform3f& tf1,
+                                      const Transform3f& tf2) const {
+    const OcTreeOccupiedLeaves::Node& n2 = leaves2.nodes[node2];
+    if (leaves1.isRemoved(i) ||
+        OcTreeLeavesBVDistance(leaves1.boxes[i], tf1, n2.bv, tf2) >=
+            dresult->min_distance)
+      return false;
+
+    if (n2.isLeaf()) {
+      for (unsigned int j = n2.index; j < n2.index + n2.num_boxes; ++j)
+        if (OcTreeDistanceBoxes(tree1, leaves1, i, tree2, leaves2, j, tf1,
+                                tf2))
+          return true;
+      return false;
+    }
+    return OcTreeDistanceBoxLeavesRecurse(tree1, leaves1, i, tree2, leaves2,
+                                          node2 + 1, tf1, tf2) ||
+           OcTreeDistanceBoxLeavesRecurse(tree1, leaves1, i, tree2, leaves2,
+                                          n2.index, tf1, tf2);
+  }
+
+  /// @brief Distance between the node node1 of the hierarchy of tree1 and the
+  /// box j of the occupied leaves of tree2.
+  /// @return whether the distance request is satisfied.
+  bool OcTreeDistanceLeavesBoxRecurse(const OcTree* tree1,
+                                      const OcTreeOccupiedLeaves& leaves1,
+                                      const unsigned int node1,
+                                      const OcTree* tree2,
+                                      const OcTreeOccupiedLeaves& leaves2,
+                                      const unsigned int j,
+                                      const Transform3f& tf1,
+                                      const Transform3f& tf2) const {
+    const OcTreeOccupiedLeaves::Node& n1 = leaves1.nodes[node1];
+    if (leaves2.isRemoved(j) ||
+        OcTreeLeavesBVDistance(n1.bv, tf1, leaves2.boxes[j], tf2) >=
+            dresult->min_distance)
+      return false;
+
+    if (n1.isLeaf()) {
+      for (unsigned int i = n1.index; i < n1.index + n1.num_boxes; ++i)
+        if (OcTreeDistanceBoxes(tree1, leaves1, i, tree2, leaves2, j, tf1,
+                                tf2))
+          return true;
+      return false;
+    }
+    return OcTreeDistanceLeavesBoxRecurse(tree1, leaves1, node1 + 1, tree2,
+                                          leaves2, j, tf1, tf2) ||
+           OcTreeDistanceLeavesBoxRecurse(tree1, leaves1, n1.index, tree2,
+                                          leaves2, j, tf1, tf2);
+  }
+
+  /// @brief Distance between the box i of the occupied leaves of tree1 and
+  /// the box j of the occupied leaves of tree2.
+  /// @return whether the distance request is satisfied.
+  bool OcTreeDistanceBoxes(const OcTree* tree1,
+                           const OcTreeOccupiedLeaves& leaves1,
+                           const unsigned int i, const OcTree* tree2,
+                           const OcTreeOccupiedLeaves& leaves2,
+                           const unsigned int j, const Transform3f& tf1,
+                           const Transform3f& tf2) const {
+    if (leaves1.isRemoved(i) || leaves2.isRemoved(j) ||
+        OcTreeLeavesBVDistance(leaves1.boxes[i], tf1, leaves2.boxes[j], tf2) >=
+            dresult->min_distance)
+      return false;
+
+    Box box1, box2;
+    Transform3f box1_tf, box2_tf;
+    constructBox(leaves1.boxes[i], tf1, box1, box1_tf);
+    constructBox(leaves2.boxes[j], tf2, box2, box2_tf);
+
+    FCL_REAL dist;
+    Vec3f closest_p1, closest_p2, normal;
+    solver->shapeDistance(box1, box1_tf, box2, box2_tf, dist, closest_p1,
+                          closest_p2, normal);
+
+    dresult->update(dist, tree1, tree2, leaves1.node_ids[i],
+                    leaves2.node_ids[j], closest_p1, closest_p2, normal);
+
+    return drequest->isSatisfied(*dresult);
+  }
+
+  /// @brief Collision between the occupied leaves of an octree and a mesh.
+  ///
+  /// The hierarchy of the occupied leaves and the one of the mesh are
+  /// traversed simultaneously. The boxes added by incremental updates are
+  /// tested against the hierarchy of the mesh.
+  template <typename BV>
+  void OcTreeMeshIntersectLeaves(const OcTree* tree1,
+                                 const BVHModel<BV>* tree2,
+                                 const Transform3f& tf1,
+                                 const Transform3f& tf2) const {
+    const OcTreeOccupiedLeaves& leaves = *tree1->getOccupiedLeaves();
+    if (tree2->isUncertain() || tree2->getNumBVs() == 0) return;
+
+    if (!leaves.nodes.empty() &&
+        OcTreeMeshIntersectLeavesRecurse(tree1, leaves, 0, tree2, 0, tf1, tf2))
+      return;
+
+    // Boxes added by incremental updates.
+    for (unsigned int i = leaves.num_hierarchy_boxes;
+         i < (unsigned int)leaves.boxes.size(); ++i)
+      if (OcTreeMeshIntersectBoxRecurse(tree1, leaves, i, tree2, 0, tf1, tf2))
+        return;
+  }
+
+  /// @brief Collision between the node node1 of the hierarchy of the occupied
+  /// leaves of an octree and the node root2 of a mesh.
+  /// @return whether the collision request is satisfied.
+  template <typename BV>
+  bool OcTreeMeshIntersectLeavesRecurse(const OcTree* tree1,
+                                        const OcTreeOccupiedLeaves& leaves,
+                                        const unsigned int node1,
+                                        const BVHModel<BV>* tree2,
+                                        const unsigned int root2,
+                                        const Transform3f& tf1,
+                                        const Transform3f& tf2) const {
+    const OcTreeOccupiedLeaves::Node& n1 = leaves.nodes[node1];
+    const BVNode<BV>& bvn2 = tree2->getBV(root2);
+    if (OcTreeLeavesBVDisjoints(n1.bv, tf1, bvn2.bv, tf2)) return false;
+
+    if (n1.isLeaf()) {
+      for (unsigned int i = n1.index; i < n1.index + n1.num_boxes; ++i)
+        if (OcTreeMeshIntersectBoxRecurse(tree1, leaves, i, tree2, root2, tf1,
+                                          tf2))
+          return true;
+      return false;
+    }
+
+    // Determine which tree to traverse first.
+    if (bvn2.isLeaf() || n1.bv.size() > bvn2.bv.size())
+      return OcTreeMeshIntersectLeavesRecurse(tree1, leaves, node1 + 1, tree2,
+                                              root2, tf1, tf2) ||
+             OcTreeMeshIntersectLeavesRecurse(tree1, leaves, n1.index, tree2,
+                                              root2, tf1, tf2);
+    return OcTreeMeshIntersectLeavesRecurse(tree1, leaves, node1, tree2,
+                                            (unsigned int)bvn2.leftChild(), tf1,
+                                            tf2) ||
+           OcTreeMeshIntersectLeavesRecurse(tree1, leaves, node1, tree2,
+                                            (unsigned int)bvn2.rightChild(),
+                                            tf1, tf2);
+  }
+
+  /// @brief Collision between the box i of the occupied leaves of an octree
+  /// and the node root2 of a mesh.
+  /// @return whether the collision request is satisfied.
+  template <typename BV>
+  bool OcTreeMeshIntersectBoxRecurse(const OcTree* tree1,
+                                     const OcTreeOccupiedLeaves& leaves,
+                                     const unsigned int i,
+                                     const BVHModel<BV>* tree2,
+                                     const unsigned int root2,
+                                     const Transform3f& tf1,
+                                     const Transform3f& tf2) const {
+    const BVNode<BV>& bvn2 = tree2->getBV(root2);
+    if (leaves.isRemoved(i) ||
+        OcTreeLeavesBVDisjoints(leaves.boxes[i], tf1, bvn2.bv, tf2))
+      return false;
+
+    if (!bvn2.isLeaf())
+      return OcTreeMeshIntersectBoxRecurse(tree1, leaves, i, tree2,
+                                           (unsigned int)bvn2.leftChild(), tf1,
+                                           tf2) ||
+             OcTreeMeshIntersectBoxRecurse(tree1, leaves, i, tree2,
+                                           (unsigned int)bvn2.rightChild(), tf1,
+                                           tf2);
+
+    Box box;
+    Transform3f box_tf;
+    constructBox(leaves.boxes[i], tf1, box, box_tf);
+
+    int primitive_id = bvn2.primitiveId();
+    const Triangle& tri_id = tree2->tri_indices[primitive_id];
+    const Vec3f& p1 = tree2->vertices[tri_id[0]];
+    const Vec3f& p2 = tree2->vertices[tri_id[1]];
+    const Vec3f& p3 = tree2->vertices[tri_id[2]];
+
+    Vec3f c1, c2, normal;
+    FCL_REAL distance;
+
+    bool collision = solver->shapeTriangleInteraction(
+        box, box_tf, p1, p2, p3, tf2, distance, c1, c2, normal);
+    FCL_REAL distToCollision = distance - crequest->security_margin;
+
+    if (cresult->numContacts() < crequest->num_max_contacts) {
+      if (collision) {
+        cresult->addContact(Contact(tree1, tree2, leaves.node_ids[i],
+                                    primitive_id, c1, normal, -distance));
+      } else if (distToCollision < 0) {
+        cresult->addContact(Contact(tree1, tree2, leaves.node_ids[i],
+                                    primitive_id, (c1 + c2) / 2,
+                                    (c2 - c1).normalized(), -distance));
+      }
+    }
+    internal::updateDistanceLowerBoundFromLeaf(*crequest, *cresult,
+                                               distToCollision, c1, c2);
+
+    return crequest->isSatisfied(*cresult);
+  }
+
+  /// @brief Distance between the occupied leaves of an octree and a mesh.
+  ///
+  /// The hierarchy of the occupied leaves and the one of the mesh are
+  /// traversed simultaneously. The boxes added by incremental updates are
+  /// tested against the hierarchy of the mesh.
+  template <typename BV>
+  void OcTreeMeshDistanceLeaves(const OcTree* tree1, const BVHModel<BV>* tree2,
+                                const Transform3f& tf1,
+                                const Transform3f& tf2) const {
+    const OcTreeOccupiedLeaves& leaves = *tree1->getOccupiedLeaves();
+    if (tree2->getNumBVs() == 0) return;
+
+    if (!leaves.nodes.empty() &&
+        OcTreeMeshDistanceLeavesRecurse(tree1, leaves, 0, tree2, 0, tf1, tf2))
+      return;
+
+    // Boxes added by incremental updates.
+    for (unsigned int i = leaves.num_hierarchy_boxes;
+         i < (unsigned int)leaves.boxes.size(); ++i)
+      if (OcTreeMeshDistanceBoxRecurse(tree1, leaves, i, tree2, 0, tf1, tf2))
+        return;
+  }
+
+  /// @brief Distance between the node node1 of the hierarchy of the occupied
+  /// leaves of an octree and the node root2 of a mesh.
+  /// @return whether the distance request is satisfied.
+  template <typename BV>
+  bool OcTreeMeshDistanceLeavesRecurse(const OcTree* tree1,
+                                       const OcTreeOccupiedLeaves& leaves,
+                                       const unsigned int node1,
+                                       const BVHModel<BV>* tree2,
+                                       const unsigned int root2,
+                                       const Transform3f& tf1,
+                                       const Transform3f& tf2) const {
+    const OcTreeOccupiedLeaves::Node& n1 = leaves.nodes[node1];
+    const BVNode<BV>& bvn2 = tree2->getBV(root2);
+    if (OcTreeLeavesBVDistance(n1.bv, tf1, bvn2.bv, tf2) >=
+        dresult->min_distance)
+      return false;
+
+    if (n1.isLeaf()) {
+      for (unsigned int i = n1.index; i < n1.index + n1.num_boxes; ++i)
+        if (OcTreeMeshDistanceBoxRecurse(tree1, leaves, i, tree2, root2, tf1,
+                                         tf2))
+          return true;
+      return false;
+    }
+
+    // Determine which tree to traverse first, and visit the closest child
+    // first.
+    unsigned int children1[2] = {node1, node1},
+                 children2[2] = {(unsigned int)bvn2.leftChild(),
+                                 (unsigned int)bvn2.rightChild()};
+    FCL_REAL d[2];
+    if (bvn2.isLeaf() || n1.bv.size() > bvn2.bv.size()) {
+      children1[0] = node1 + 1;
+      children1[1] = n1.index;
+      children2[0] = children2[1] = root2;
+      for (int k = 0; k < 2; ++k)
+        d[k] = OcTreeLeavesBVDistance(leaves.nodes[children1[k]].bv, tf1,
+                                      bvn2.bv, tf2);
+    } else {
+      for (int k = 0; k < 2; ++k)
+        d[k] = OcTreeLeavesBVDistance(n1.bv, tf1,
+                                      tree2->getBV(children2[k]).bv, tf2);
+    }
+    const int first = d[1] < d[0] ? 1 : 0;
+    return OcTreeMeshDistanceLeavesRecurse(tree1, leaves, children1[first],
+                                           tree2, children2[first], tf1,
+                                           tf2) ||
+           OcTreeMeshDistanceLeavesRecurse(tree1, leaves, children1[1 - first],
+                                           tree2, children2[1 - first], tf1,
+                                           tf2);
+  }
+
+  /// @brief Distance between the box i of the occupied leaves of an octree and
+  /// the node root2 of a mesh.
+  /// @return whether the distance request is satisfied.
+  template <typename BV>
+  bool OcTreeMeshDistanceBoxRecurse(const OcTree* tree1,
+                                    const OcTreeOccupiedLeaves& leaves,
+                                    const unsigned int i,
+                                    const BVHModel<BV>* tree2,
+                                    const unsigned int root2,
+                                    const Transform3f& tf1,
+                                    const Transform3f& tf2) const {
+    const BVNode<BV>& bvn2 = tree2->getBV(root2);
+    if (leaves.isRemoved(i) ||
+        OcTreeLeavesBVDistance(leaves.boxes[i], tf1, bvn2.bv, tf2) >=
+            dresult->min_distance)
+      return false;
+
+    if (!bvn2.isLeaf()) {
+      // Visit the closest child first.
+      unsigned int left = (unsigned int)bvn2.leftChild(),
+                   right = (unsigned int)bvn2.rightChild();
+      if (OcTreeLeavesBVDistance(leaves.boxes[i], tf1, tree2->getBV(right).bv,
+                                 tf2) <
+          OcTreeLeavesBVDistance(leaves.boxes[i], tf1, tree2->getBV(left).bv,
+                                 tf2))
+        std::swap(left, right);
+      return OcTreeMeshDistanceBoxRecurse(tree1, leaves, i, tree2, left, tf1,
+                                          tf2) ||
+             OcTreeMeshDistanceBoxRecurse(tree1, leaves, i, tree2, right, tf1,
+                                          tf2);
+    }
+
+    Box box;
+    Transform3f box_tf;
+    constructBox(leaves.boxes[i], tf1, box, box_tf);
+
+    int primitive_id = bvn2.primitiveId();
+    const Triangle& tri_id = tree2->tri_indices[primitive_id];
+    const Vec3f& p1 = tree2->vertices[tri_id[0]];
+    const Vec3f& p2 = tree2->vertices[tri_id[1]];
+    const Vec3f& p3 = tree2->vertices[tri_id[2]];
+
+    FCL_REAL dist;
+    Vec3f closest_p1, closest_p2, normal;
+    solver->shapeTriangleInteraction(box, box_tf, p1, p2, p3, tf2, dist,
+                                     closest_p1, closest_p2, normal);
+
+    dresult->update(dist, tree1, tree2, leaves.node_ids[i], primitive_id,
+                    closest_p1, closest_p2, normal);
+
+    return drequest->isSatisfied(*dresult);
+  }
+
   template <typename S>
   bool OcTreeShapeDistanceRecurse(const OcTree* tree1,
                                   const OcTree::OcTreeNode* root1,
@@ -473,7 +1319,7 @@ class HPP_FCL_DLLAPI OcTreeSolver {
         } else if (distToCollision < 0) {
           cresult->addContact(Contact(
               tree1, tree2, (int)(root1 - tree1->getRoot()), primitive_id,
-              .5 * (c1 + c2), (c2 - c1).normalized(), -distance));
+              (c1 + c2) / 2, (c2 - c1).normalized(), -distance));
         }
       }
       internal::updateDistanceLowerBoundFromLeaf(*crequest, *cresult,
@@ -637,10 +1483,13 @@ class HPP_FCL_DLLAPI OcTreeSolver {
       constructBox(bv1, tf1, box1, box1_tf);
       constructBox(bv2, tf2, box2, box2_tf);
 
+      // shapeDistance returns whether GJK succeeded, not whether the boxes
+      // collide.
       FCL_REAL distance;
       Vec3f c1, c2, normal;
-      bool collision = solver->shapeDistance(box1, box1_tf, box2, box2_tf,
-                                             distance, c1, c2, normal);
+      solver->shapeDistance(box1, box1_tf, box2, box2_tf, distance, c1, c2,
+                            normal);
+      bool collision = distance <= 0;
       FCL_REAL distToCollision = distance - crequest->security_margin;
 
       if (cresult->numContacts() < crequest->num_max_contacts) {
@@ -653,7 +1502,7 @@ class HPP_FCL_DLLAPI OcTreeSolver {
           cresult->addContact(
               Contact(tree1, tree2, static_cast<int>(root1 - tree1->getRoot()),
                       static_cast<int>(root2 - tree2->getRoot()),
-                      .5 * (c1 + c2), (c2 - c1).normalized(), -distance));
+                      (c1 + c2) / 2, (c2 - c1).normalized(), -distance));
       }
       internal::updateDistanceLowerBoundFromLeaf(*crequest, *cresult,
                                                  distToCollision, c1, c2);
@@ -840,7 +1689,6 @@ class HPP_FCL_DLLAPI OcTreeMeshCollisionTraversalNode
 
   void leafCollides(unsigned int, unsigned int,
                     FCL_REAL& sqrDistLowerBound) const {
-    std::cout << "leafCollides" << std::endl;
     otsolver->OcTreeMeshIntersect(model1, model2, tf1, tf2, request, *result);
     sqrDistLowerBound = std::max((FCL_REAL)0, result->distance_lower_bound);
     sqrDistLowerBound *= sqrDistLowerBound;
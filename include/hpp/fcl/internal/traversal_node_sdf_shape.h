@@ -0,0 +1,408 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HPP_FCL_TRAVERSAL_NODE_SDF_SHAPE_H
+#define HPP_FCL_TRAVERSAL_NODE_SDF_SHAPE_H
+
+/// @cond INTERNAL
+
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <utility>
+
+#include <hpp/fcl/collision_data.h>
+#include <hpp/fcl/internal/traversal_node_base.h>
+#include <hpp/fcl/narrowphase/narrowphase.h>
+#include <hpp/fcl/sdf.h>
+#include <hpp/fcl/shape/geometric_shapes.h>
+#include <hpp/fcl/shape/geometric_shapes_utility.h>
+#include <hpp/fcl/workspace.h>
+
+namespace hpp {
+namespace fcl {
+
+namespace details {
+/// @brief Shape searched in a signed distance field, in the frame of the
+/// field.
+template <typename S>
+struct SDFShape {
+  SDFShape(const S& shape, const Transform3f& tf, const GJKSolver* nsolver)
+      : shape(shape), tf(tf), nsolver(nsolver), point(0) {}
+
+  /// Whether the shape may intersect a box. The blocks of cells which the
+  /// shape does not intersect are not searched.
+  bool intersects(const Vec3f&, const Vec3f&) const { return true; }
+
+  /// Point of the shape closest to a point.
+  Vec3f project(const Vec3f& p) const {
+    FCL_REAL dist;
+    Vec3f p1, p2, normal;
+    nsolver->shapeDistance(point, Transform3f(p), shape, tf, dist, p1, p2,
+                           normal);
+    return dist <= 0 ? p : p2;
+  }
+
+  const S& shape;
+  const Transform3f& tf;
+  const GJKSolver* nsolver;
+  const Sphere point;
+};
+
+template <>
+struct SDFShape<Plane> {
+  SDFShape(const Plane& shape, const Transform3f& tf, const GJKSolver*)
+      : plane(transform(shape, tf)) {}
+
+  bool intersects(const Vec3f& center, const Vec3f& half) const {
+    return std::fabs(plane.signedDistance(center)) <=
+           plane.n.cwiseAbs().dot(half);
+  }
+
+  Vec3f project(const Vec3f& p) const {
+    return p - plane.signedDistance(p) * plane.n;
+  }
+
+  Plane plane;
+};
+
+template <>
+struct SDFShape<Halfspace> {
+  SDFShape(const Halfspace& shape, const Transform3f& tf, const GJKSolver*)
+      : halfspace(transform(shape, tf)) {}
+
+  bool intersects(const Vec3f& center, const Vec3f& half) const {
+    return halfspace.signedDistance(center) <=
+           halfspace.n.cwiseAbs().dot(half);
+  }
+
+  Vec3f project(const Vec3f& p) const {
+    const FCL_REAL dist = halfspace.signedDistance(p);
+    return dist <= 0 ? p : Vec3f(p - dist * halfspace.n);
+  }
+
+  Halfspace halfspace;
+};
+
+/// @brief Minimum of a signed distance field over a shape.
+///
+/// The blocks of cells overlapping the AABB of the shape are visited by
+/// increasing lower bound, from the coarsest level of
+/// SignedDistanceField::getBlockBounds down to the cells, whose lower bound
+/// is the minimum of their corners. The planes and halfspaces, whose AABB
+/// usually covers the whole grid, only visit the blocks they intersect. In
+/// each cell, the field is evaluated at the point of the shape closest to the
+/// lowest corner, so that the returned value exceeds the minimum by at most
+/// the diagonal of a cell.
+///
+/// \param[in] sdf the signed distance field.
+/// \param[in] shape the shape.
+/// \param[in] tf pose of the shape in the frame of the field.
+/// \param[in] nsolver solver used to project the corners onto the shape,
+///            except the planes and halfspaces.
+/// \param[in] stop_value the search stops as soon as the field is below this
+///            value.
+/// \param[out] point the point of the shape where the field is minimal, in
+///             the frame of the field.
+/// \param[out] cell index of the cell of the lowest corner.
+/// \return the minimum of the field over the shape.
+template <typename S>
+FCL_REAL computeSDFShapeDistance(const SignedDistanceField& sdf,
+                                 const S& shape, const Transform3f& tf,
+                                 const GJKSolver* nsolver,
+                                 const FCL_REAL stop_value, Vec3f& point,
+                                 Eigen::DenseIndex& cell) {
+  typedef SignedDistanceField::Dims Dims;
+  // Lower bound, level and index of a block, the level -1 being the cells.
+  typedef std::pair<FCL_REAL, std::pair<int, Eigen::DenseIndex> > Block;
+  const Dims& dims = sdf.getDims();
+  const Dims cell_dims(dims - Dims::Ones());
+  const Vec3f& origin = sdf.getOrigin();
+  const FCL_REAL resolution = sdf.getResolution();
+
+  // Range of the cells overlapping the AABB of the shape, clamped to the
+  // grid: the field outside of the grid grows with the distance to the grid.
+  AABB aabb;
+  computeBV<AABB>(shape, tf, aabb);
+  Eigen::DenseIndex lo[3], hi[3];
+  for (int a = 0; a < 3; ++a) {
+    const FCL_REAL max_id = (FCL_REAL)(dims[a] - 2);
+    const FCL_REAL l = (aabb.min_[a] - origin[a]) / resolution;
+    const FCL_REAL h = (aabb.max_[a] - origin[a]) / resolution;
+    lo[a] = (Eigen::DenseIndex)std::floor(std::max((FCL_REAL)0,
+                                                   std::min(l, max_id)));
+    hi[a] = (Eigen::DenseIndex)std::floor(std::max((FCL_REAL)0,
+                                                   std::min(h, max_id)));
+  }
+
+  // The shapes which do not intersect the grid are searched over the whole
+  // range, their closest points lying on the border of the grid.
+  const SDFShape<S> query(shape, tf, nsolver);
+  const FCL_REAL half_resolution = resolution / 2;
+  const bool clipped = query.intersects(
+      origin + half_resolution * cell_dims.cast<FCL_REAL>(),
+      half_resolution * cell_dims.cast<FCL_REAL>());
+
+  const FCL_REAL* values = sdf.getValues().data();
+  const Eigen::DenseIndex corners[8] = {0,
+                                        1,
+                                        dims[0],
+                                        dims[0] + 1,
+                                        dims[0] * dims[1],
+                                        dims[0] * dims[1] + 1,
+                                        dims[0] * dims[1] + dims[0],
+                                        dims[0] * dims[1] + dims[0] + 1};
+  const std::vector<VecXf>& block_bounds = sdf.getBlockBounds();
+  const std::vector<Dims>& block_dims = sdf.getBlockDims();
+
+  QueryWorkspace* workspace = QueryWorkspace::current();
+  std::vector<Block> local_blocks;
+  std::vector<Block>& heap = workspace ? workspace->sdf_blocks : local_blocks;
+  const std::greater<Block> later;
+  const int top = (int)block_bounds.size() - 1;
+  heap.clear();
+  heap.push_back(Block(block_bounds[(std::size_t)top][0],
+                       std::make_pair(top, (Eigen::DenseIndex)0)));
+
+  FCL_REAL min_distance = (std::numeric_limits<FCL_REAL>::max)();
+  while (!heap.empty()) {
+    std::pop_heap(heap.begin(), heap.end(), later);
+    const Block block(heap.back());
+    heap.pop_back();
+    if (block.first >= min_distance) break;
+    const int level = block.second.first;
+    const Eigen::DenseIndex id = block.second.second;
+
+    if (level >= 0) {
+      // Push the children overlapping the range of cells.
+      const Dims& parent_dims = block_dims[(std::size_t)level];
+      const Dims& child_dims =
+          level > 0 ? block_dims[(std::size_t)level - 1] : cell_dims;
+      const Eigen::DenseIndex size = (Eigen::DenseIndex)1 << level;
+      const Eigen::DenseIndex parent[3] = {
+          id % parent_dims[0], (id / parent_dims[0]) % parent_dims[1],
+          id / (parent_dims[0] * parent_dims[1])};
+      Eigen::DenseIndex begin[3], end[3];
+      for (int a = 0; a < 3; ++a) {
+        begin[a] = std::max(2 * parent[a], lo[a] / size);
+        end[a] = std::min(std::min(2 * parent[a] + 1, hi[a] / size),
+                          child_dims[a] - 1);
+      }
+      for (Eigen::DenseIndex k = begin[2]; k <= end[2]; ++k)
+        for (Eigen::DenseIndex j = begin[1]; j <= end[1]; ++j)
+          for (Eigen::DenseIndex i = begin[0]; i <= end[0]; ++i) {
+            if (clipped) {
+              const Vec3f first((FCL_REAL)(i * size), (FCL_REAL)(j * size),
+                                (FCL_REAL)(k * size));
+              const Vec3f last(
+                  Vec3f((FCL_REAL)((i + 1) * size), (FCL_REAL)((j + 1) * size),
+                        (FCL_REAL)((k + 1) * size))
+                      .cwiseMin(cell_dims.cast<FCL_REAL>()));
+              if (!query.intersects(
+                      origin + half_resolution * (first + last),
+                      half_resolution * (last - first)))
+                continue;
+            }
+            const Eigen::DenseIndex child =
+                i + child_dims[0] * (j + child_dims[1] * k);
+            FCL_REAL lower_bound;
+            if (level > 0)
+              lower_bound = block_bounds[(std::size_t)level - 1][child];
+            else {
+              const Eigen::DenseIndex sample = sdf.getIndex(i, j, k);
+              lower_bound = values[sample];
+              for (int c = 1; c < 8; ++c)
+                lower_bound =
+                    std::min(lower_bound, values[sample + corners[c]]);
+            }
+            if (lower_bound >= min_distance) continue;
+            heap.push_back(
+                Block(lower_bound, std::make_pair(level - 1, child)));
+            std::push_heap(heap.begin(), heap.end(), later);
+          }
+      continue;
+    }
+
+    // Evaluate the field in the cell.
+    const Eigen::DenseIndex ci = id % cell_dims[0],
+                            cj = (id / cell_dims[0]) % cell_dims[1],
+                            ck = id / (cell_dims[0] * cell_dims[1]);
+    const Eigen::DenseIndex sample = sdf.getIndex(ci, cj, ck);
+    int lowest = 0;
+    for (int c = 1; c < 8; ++c)
+      if (values[sample + corners[c]] < values[sample + corners[lowest]])
+        lowest = c;
+    const Vec3f corner(
+        origin + resolution * Vec3f((FCL_REAL)(ci + (lowest & 1)),
+                                    (FCL_REAL)(cj + ((lowest >> 1) & 1)),
+                                    (FCL_REAL)(ck + ((lowest >> 2) & 1))));
+    const Vec3f x(query.project(corner));
+    const FCL_REAL value = sdf.computeDistance(x);
+    if (value < min_distance) {
+      min_distance = value;
+      point = x;
+      cell = sample;
+      if (min_distance <= stop_value) break;
+    }
+  }
+  return min_distance;
+}
+
+/// @brief Witness points of the minimum of a signed distance field over a
+/// shape, in the world frame.
+///
+/// The point of the surface of the field is obtained by following the
+/// gradient at the point of the shape.
+inline void computeSDFShapeWitnesses(const SignedDistanceField& sdf,
+                                     const Transform3f& tf,
+                                     const Vec3f& point,
+                                     const FCL_REAL distance, Vec3f& p1,
+                                     Vec3f& p2, Vec3f& normal) {
+  Vec3f gradient;
+  sdf.computeDistance(point, gradient);
+  const FCL_REAL norm = gradient.norm();
+  normal = tf.getRotation() * (norm > 0 ? Vec3f(gradient / norm) : gradient);
+  p2 = tf.transform(point);
+  p1 = p2 - distance * normal;
+}
+}  // namespace details
+
+/// @addtogroup Traversal_For_Collision
+/// @{
+
+/// @brief Traversal node for collision between a signed distance field and a
+/// shape.
+template <typename S>
+class HPP_FCL_DLLAPI SDFShapeCollisionTraversalNode
+    : public CollisionTraversalNodeBase {
+ public:
+  SDFShapeCollisionTraversalNode(const CollisionRequest& request)
+      : CollisionTraversalNodeBase(request) {
+    model1 = NULL;
+    model2 = NULL;
+
+    nsolver = NULL;
+  }
+
+  bool BVDisjoints(unsigned int, unsigned int, FCL_REAL&) const {
+    return false;
+  }
+
+  void leafCollides(unsigned int, unsigned int,
+                    FCL_REAL& sqrDistLowerBound) const {
+    const Transform3f tf(tf1.inverseTimes(tf2));
+    // Without contact, the search stops at the first colliding point.
+    const FCL_REAL stop_value =
+        request.enable_contact
+            ? -(std::numeric_limits<FCL_REAL>::max)()
+            : request.security_margin + request.collision_distance_threshold;
+    Vec3f point;
+    Eigen::DenseIndex cell = 0;
+    const FCL_REAL distance = details::computeSDFShapeDistance(
+        *model1, *model2, tf, nsolver, stop_value, point, cell);
+
+    Vec3f p1, p2, normal;
+    details::computeSDFShapeWitnesses(*model1, tf1, point, distance, p1, p2,
+                                      normal);
+
+    const FCL_REAL distToCollision = distance - request.security_margin;
+    internal::updateDistanceLowerBoundFromLeaf(request, *result,
+                                               distToCollision, p1, p2);
+    if (distToCollision <= request.collision_distance_threshold &&
+        result->numContacts() < request.num_max_contacts)
+      result->addContact(Contact(model1, model2, (int)cell, Contact::NONE,
+                                 (p1 + p2) / 2, normal, -distance));
+
+    sqrDistLowerBound = std::max((FCL_REAL)0, result->distance_lower_bound);
+    sqrDistLowerBound *= sqrDistLowerBound;
+  }
+
+  const SignedDistanceField* model1;
+  const S* model2;
+
+  const GJKSolver* nsolver;
+};
+
+/// @}
+
+/// @addtogroup Traversal_For_Distance
+/// @{
+
+/// @brief Traversal node for distance between a signed distance field and a
+/// shape.
+template <typename S>
+class HPP_FCL_DLLAPI SDFShapeDistanceTraversalNode
+    : public DistanceTraversalNodeBase {
+ public:
+  SDFShapeDistanceTraversalNode() {
+    model1 = NULL;
+    model2 = NULL;
+
+    nsolver = NULL;
+  }
+
+  FCL_REAL BVDistanceLowerBound(unsigned int, unsigned int) const {
+    return -1;
+  }
+
+  void leafComputeDistance(unsigned int, unsigned int) const {
+    Vec3f point;
+    Eigen::DenseIndex cell = 0;
+    const FCL_REAL distance = details::computeSDFShapeDistance(
+        *model1, *model2, tf1.inverseTimes(tf2), nsolver,
+        -(std::numeric_limits<FCL_REAL>::max)(), point, cell);
+
+    Vec3f p1, p2, normal;
+    details::computeSDFShapeWitnesses(*model1, tf1, point, distance, p1, p2,
+                                      normal);
+
+    result->update(distance, model1, model2, (int)cell, DistanceResult::NONE,
+                   p1, p2, normal);
+  }
+
+  const SignedDistanceField* model1;
+  const S* model2;
+
+  const GJKSolver* nsolver;
+};
+
+/// @}
+
+}  // namespace fcl
+
+}  // namespace hpp
+
+/// @endcond
+
+#endif
@@ -48,6 +48,8 @@
 
 //#include <hpp/fcl/internal/traversal_node_hfields.h>
 #include <hpp/fcl/internal/traversal_node_hfield_shape.h>
+#include <hpp/fcl/internal/traversal_node_linear_octree.h>
+#include <hpp/fcl/internal/traversal_node_sdf_shape.h>
 
 #ifdef HPP_FCL_HAS_OCTOMAP
 #include <hpp/fcl/internal/traversal_node_octree.h>
@@ -358,6 +360,94 @@ bool initialize(MeshShapeCollisionTraversalNode<BV, S, 0>& node,
   return true;
 }
 
+/// @brief Initialize traversal node for collision between a linear octree and
+/// a shape, given current object transform
+template <typename S>
+bool initialize(LinearOcTreeShapeCollisionTraversalNode<S>& node,
+                const LinearOcTree& model1, const Transform3f& tf1,
+                const S& model2, const Transform3f& tf2,
+                const GJKSolver* nsolver, CollisionResult& result) {
+  node.result = &result;
+
+  node.model1 = &model1;
+  node.model2 = &model2;
+
+  node.nsolver = nsolver;
+
+  node.tf1 = tf1;
+  node.tf2 = tf2;
+
+  computeBV(model2, tf1.inverseTimes(tf2), node.model2_bv);
+
+  return true;
+}
+
+/// @brief Initialize traversal node for distance between a linear octree and
+/// a shape, given current object transform
+template <typename S>
+bool initialize(LinearOcTreeShapeDistanceTraversalNode<S>& node,
+                const LinearOcTree& model1, const Transform3f& tf1,
+                const S& model2, const Transform3f& tf2,
+                const GJKSolver* nsolver, const DistanceRequest& request,
+                DistanceResult& result) {
+  node.request = request;
+  node.result = &result;
+
+  node.model1 = &model1;
+  node.model2 = &model2;
+
+  node.nsolver = nsolver;
+
+  node.tf1 = tf1;
+  node.tf2 = tf2;
+
+  computeBV(model2, tf1.inverseTimes(tf2), node.model2_bv);
+
+  return true;
+}
+
+/// @brief Initialize traversal node for collision between a signed distance
+/// field and a shape, given current object transform
+template <typename S>
+bool initialize(SDFShapeCollisionTraversalNode<S>& node,
+                const SignedDistanceField& model1, const Transform3f& tf1,
+                const S& model2, const Transform3f& tf2,
+                const GJKSolver* nsolver, CollisionResult& result) {
+  node.result = &result;
+
+  node.model1 = &model1;
+  node.model2 = &model2;
+
+  node.nsolver = nsolver;
+
+  node.tf1 = tf1;
+  node.tf2 = tf2;
+
+  return true;
+}
+
+/// @brief Initialize traversal node for distance between a signed distance
+/// field and a shape, given current object transform
+template <typename S>
+bool initialize(SDFShapeDistanceTraversalNode<S>& node,
+                const SignedDistanceField& model1, const Transform3f& tf1,
+                const S& model2, const Transform3f& tf2,
+                const GJKSolver* nsolver, const DistanceRequest& request,
+                DistanceResult& result) {
+  node.request = request;
+  node.result = &result;
+
+  node.model1 = &model1;
+  node.model2 = &model2;
+
+  node.nsolver = nsolver;
+
+  node.tf1 = tf1;
+  node.tf2 = tf2;
+
+  return true;
+}
+
 /// @brief Initialize traversal node for collision between one mesh and one
 /// shape, given current object transform
 template <typename BV, typename S>
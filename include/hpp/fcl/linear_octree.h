@@ -0,0 +1,222 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HPP_FCL_LINEAR_OCTREE_H
+#define HPP_FCL_LINEAR_OCTREE_H
+
+#include <vector>
+#include <stdint.h>
+
+#include <hpp/fcl/fwd.hh>
+#include <hpp/fcl/BV/AABB.h>
+#include <hpp/fcl/collision_object.h>
+
+namespace hpp {
+namespace fcl {
+
+/// @brief Binary occupancy octree stored as the sorted Morton codes of its
+/// occupied leaves.
+///
+/// The tree covers the cube \f$ [-h, h]^3 \f$ with
+/// \f$ h = 2^{depth-1} \times resolution \f$, as an octomap::OcTree of the same
+/// resolution and depth. A leaf at level \f$ l \f$ is a cube of
+/// \f$ 2^l \f$ voxels per side and is identified by the Morton code of its
+/// first voxel, whose \f$ 3 l \f$ lowest bits are zero. Since the leaves are
+/// sorted by code, the leaves below any node of the tree form a contiguous
+/// range, so that the tree is traversed without storing any node.
+class HPP_FCL_DLLAPI LinearOcTree : public CollisionGeometry {
+ public:
+  /// @brief Morton code of a voxel: bit \f$ 3 i \f$ (resp. \f$ 3 i + 1 \f$,
+  /// \f$ 3 i + 2 \f$) is the bit \f$ i \f$ of the x (resp. y, z) key.
+  typedef uint64_t Code;
+
+  /// @brief Maximal depth of the tree, so that the codes fit on 64 bits.
+  static const unsigned int max_tree_depth = 21;
+
+  /// @brief Constructing an empty tree with a given resolution and depth.
+  explicit LinearOcTree(FCL_REAL resolution, unsigned int depth = 16);
+
+  LinearOcTree(const LinearOcTree& other)
+      : CollisionGeometry(other),
+        resolution(other.resolution),
+        depth(other.depth),
+        codes(other.codes),
+        levels(other.levels) {}
+
+  LinearOcTree* clone() const { return new LinearOcTree(*this); }
+
+  /// @brief Set the occupied leaves of the tree.
+  ///
+  /// \param[in] codes the Morton codes of the first voxel of the leaves.
+  /// \param[in] levels the levels of the leaves, 0 being a single voxel.
+  ///
+  /// Leaves contained in another leaf are discarded, and the eight children of
+  /// a node that are all occupied are merged into the node.
+  void setLeaves(const std::vector<Code>& codes,
+                 const std::vector<unsigned char>& levels);
+
+  /// @brief Set the occupied voxels of the tree from a point cloud.
+  ///
+  /// The points must lie in the root bounding volume of the tree.
+  void setOccupiedPoints(
+      const Eigen::Matrix<FCL_REAL, Eigen::Dynamic, 3>& point_cloud);
+
+  /// @brief Returns the Morton code of the voxel containing a point.
+  Code computeCode(const Vec3f& point) const;
+
+  /// @brief Returns the Morton code of the voxel of integer coordinates
+  /// (kx, ky, kz), the voxel (0, 0, 0) being the one of lowest coordinates.
+  static Code computeCode(const Code kx, const Code ky, const Code kz) {
+    return spreadBits(kx) | (spreadBits(ky) << 1) | (spreadBits(kz) << 2);
+  }
+
+  /// @brief Returns whether the voxel containing a point is occupied.
+  bool isOccupied(const Vec3f& point) const;
+
+  /// @brief Returns the bounding volume of a node, given the code of its first
+  /// voxel and its level.
+  AABB getNodeBV(const Code code, const unsigned int level) const {
+    const FCL_REAL half = (FCL_REAL)(Code(1) << (depth - 1));
+    const FCL_REAL size = resolution * (FCL_REAL)(Code(1) << level);
+    Vec3f min((FCL_REAL)compactBits(code) - half,
+              (FCL_REAL)compactBits(code >> 1) - half,
+              (FCL_REAL)compactBits(code >> 2) - half);
+    min *= resolution;
+    return AABB(min, min + Vec3f::Constant(size));
+  }
+
+  /// @brief Returns the bounding volume of the i-th leaf.
+  AABB getLeafBV(const std::size_t i) const {
+    return getNodeBV(codes[i], levels[i]);
+  }
+
+  /// @brief Returns the bounding volume of the root.
+  AABB getRootBV() const {
+    const FCL_REAL delta = (FCL_REAL)(Code(1) << (depth - 1)) * resolution;
+    return AABB(Vec3f(-delta, -delta, -delta), Vec3f(delta, delta, delta));
+  }
+
+  /// @brief Returns the size of a voxel.
+  FCL_REAL getResolution() const { return resolution; }
+
+  /// @brief Returns the depth of the tree.
+  unsigned int getTreeDepth() const { return depth; }
+
+  /// @brief Returns the number of occupied leaves.
+  std::size_t getNumLeaves() const { return codes.size(); }
+
+  /// @brief Returns the sorted Morton codes of the occupied leaves.
+  const std::vector<Code>& getLeafCodes() const { return codes; }
+
+  /// @brief Returns the levels of the occupied leaves.
+  const std::vector<unsigned char>& getLeafLevels() const { return levels; }
+
+  /// @brief Compute the AABB of the occupied leaves in the local frame.
+  void computeLocalAABB();
+
+  /// @brief Get the object type: it is a linear octree
+  OBJECT_TYPE getObjectType() const { return OT_LINEAR_OCTREE; }
+
+  /// @brief Get the node type: it is a linear octree
+  NODE_TYPE getNodeType() const { return GEOM_LINEAR_OCTREE; }
+
+  /// @brief Interleave the 21 lowest bits of x with two zero bits.
+  static Code spreadBits(Code x) {
+    x &= 0x1fffff;
+    x = (x | x << 32) & 0x1f00000000ffffULL;
+    x = (x | x << 16) & 0x1f0000ff0000ffULL;
+    x = (x | x << 8) & 0x100f00f00f00f00fULL;
+    x = (x | x << 4) & 0x10c30c30c30c30c3ULL;
+    x = (x | x << 2) & 0x1249249249249249ULL;
+    return x;
+  }
+
+  /// @brief Inverse of spreadBits, ignoring the bits in between.
+  static Code compactBits(Code x) {
+    x &= 0x1249249249249249ULL;
+    x = (x ^ (x >> 2)) & 0x10c30c30c30c30c3ULL;
+    x = (x ^ (x >> 4)) & 0x100f00f00f00f00fULL;
+    x = (x ^ (x >> 8)) & 0x1f0000ff0000ffULL;
+    x = (x ^ (x >> 16)) & 0x1f00000000ffffULL;
+    x = (x ^ (x >> 32)) & 0x1fffff;
+    return x;
+  }
+
+ private:
+  virtual bool isEqual(const CollisionGeometry& _other) const {
+    const LinearOcTree* other_ptr = dynamic_cast<const LinearOcTree*>(&_other);
+    if (other_ptr == nullptr) return false;
+    const LinearOcTree& other = *other_ptr;
+
+    return resolution == other.resolution && depth == other.depth &&
+           codes == other.codes && levels == other.levels;
+  }
+
+  /// @brief Compute the Morton code of the voxel containing a point.
+  /// @return false if the point is outside of the tree.
+  bool computeVoxelCode(const Vec3f& point, Code& code) const;
+
+  /// @brief size of a voxel
+  FCL_REAL resolution;
+
+  /// @brief depth of the tree
+  unsigned int depth;
+
+  /// @brief sorted Morton codes of the first voxel of the occupied leaves
+  std::vector<Code> codes;
+
+  /// @brief levels of the occupied leaves
+  std::vector<unsigned char> levels;
+
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+///
+/// \brief Build a LinearOcTree from a point cloud and a given resolution
+///
+/// \param[in] point_cloud The input points to insert in the tree
+/// \param[in] resolution of the tree.
+///
+/// \returns A LinearOcTree of depth 16, as the OcTree built by makeOctree.
+///
+HPP_FCL_DLLAPI LinearOcTreePtr_t makeLinearOctree(
+    const Eigen::Matrix<FCL_REAL, Eigen::Dynamic, 3>& point_cloud,
+    const FCL_REAL resolution);
+
+}  // namespace fcl
+
+}  // namespace hpp
+
+#endif
@@ -0,0 +1,186 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HPP_FCL_METRICS_H
+#define HPP_FCL_METRICS_H
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include <boost/cstdint.hpp>
+
+#include <hpp/fcl/fwd.hh>
+#include <hpp/fcl/collision_object.h>
+#include <hpp/fcl/narrowphase/gjk.h>
+
+namespace hpp {
+namespace fcl {
+
+/// @brief Process-wide metrics of the narrowphase and broadphase.
+///
+/// The metrics are recorded only if the library is compiled with
+/// HPP_FCL_ENABLE_METRICS (CMake option of the same name). Otherwise, the
+/// recording points are compiled out and the snapshots are empty.
+///
+/// Each thread records into its own counters, which are summed when taking a
+/// snapshot. The counters of a thread which exits are kept in the registry.
+namespace metrics {
+
+/// @brief Broadphase managers whose pairs are counted.
+enum BroadPhaseManagerType {
+  BP_NAIVE,
+  BP_SAP,
+  BP_SSAP,
+  BP_RADIX_SAP,
+  BP_INTERVAL_TREE,
+  BP_DYNAMIC_AABB_TREE,
+  BP_DYNAMIC_AABB_TREE_ARRAY,
+  BP_SPATIAL_HASH,
+  BP_HIERARCHICAL_SPATIAL_HASH,
+  BP_COUNT
+};
+
+/// @brief Number of bins of the histograms of GJK iterations.
+///
+/// The bin 0 counts the runs with at most one iteration, and the bin i > 0 the
+/// runs with 2^(i-1) < iterations <= 2^i. The last bin has no upper limit.
+static const std::size_t num_iteration_bins = 9;
+
+/// @brief Number of statuses returned by EPA.
+static const std::size_t num_epa_statuses = 9;
+
+/// @brief Index of the bin counting a run of GJK of \p iterations.
+HPP_FCL_DLLAPI std::size_t iterationBin(std::size_t iterations);
+
+/// @brief Index of an EPA status, between 0 and num_epa_statuses - 1.
+HPP_FCL_DLLAPI std::size_t epaStatusIndex(details::EPA::Status status);
+
+HPP_FCL_DLLAPI const char* getEPAStatusName(std::size_t index);
+
+HPP_FCL_DLLAPI const char* getBroadPhaseManagerName(
+    BroadPhaseManagerType manager);
+
+/// @brief Runs of GJK between two types of shapes.
+struct HPP_FCL_DLLAPI GJKPairMetrics {
+  NODE_TYPE node_type1;
+  NODE_TYPE node_type2;
+
+  /// @brief number of runs per status, indexed by details::GJK::Status
+  boost::uint64_t status_counts[3];
+
+  /// @brief number of runs per number of iterations, see num_iteration_bins
+  boost::uint64_t iteration_histogram[num_iteration_bins];
+};
+
+/// @brief Pairs of objects reported by a type of broadphase manager.
+struct HPP_FCL_DLLAPI BroadPhaseMetrics {
+  BroadPhaseManagerType manager;
+
+  /// @brief number of pairs given to collision callbacks
+  boost::uint64_t num_collision_pairs;
+
+  /// @brief number of pairs given to distance callbacks
+  boost::uint64_t num_distance_pairs;
+};
+
+/// @brief Metrics recorded by all the threads since the last reset.
+struct HPP_FCL_DLLAPI MetricsSnapshot {
+  /// @brief the pairs of shape types for which GJK ran at least once
+  std::vector<GJKPairMetrics> gjk;
+
+  /// @brief number of runs of EPA per status, see epaStatusIndex
+  boost::uint64_t epa_status_counts[num_epa_statuses];
+
+  /// @brief the types of managers which reported at least one pair
+  std::vector<BroadPhaseMetrics> broadphase;
+
+  MetricsSnapshot();
+
+  /// @brief Write the snapshot as a JSON object.
+  void toJSON(std::ostream& os) const;
+
+  /// @brief The snapshot as a JSON object.
+  std::string toJSON() const;
+};
+
+/// @brief Take a snapshot of the metrics of all the threads.
+HPP_FCL_DLLAPI MetricsSnapshot snapshot();
+
+/// @brief Reset the metrics of all the threads.
+/// @note Increments made concurrently by other threads may be lost.
+HPP_FCL_DLLAPI void reset();
+
+/// @brief Record a run of GJK between two shapes.
+HPP_FCL_DLLAPI void recordGJK(NODE_TYPE node_type1, NODE_TYPE node_type2,
+                              details::GJK::Status status,
+                              std::size_t iterations);
+
+/// @brief Record a run of EPA.
+HPP_FCL_DLLAPI void recordEPA(details::EPA::Status status);
+
+/// @brief Record a pair of objects given to a callback by the manager of the
+/// current BroadPhaseScope, if any.
+HPP_FCL_DLLAPI void recordBroadPhasePair(bool distance);
+
+/// @brief Attribute the pairs given to the callbacks to a type of manager
+/// during its lifetime.
+///
+/// Nested scopes keep the manager of the outermost one, so that the pairs of
+/// a query between two managers are attributed to the one which is queried.
+class HPP_FCL_DLLAPI BroadPhaseScope {
+ public:
+  explicit BroadPhaseScope(BroadPhaseManagerType manager);
+  ~BroadPhaseScope();
+
+ private:
+  bool outermost;
+};
+
+}  // namespace metrics
+
+}  // namespace fcl
+}  // namespace hpp
+
+#ifdef HPP_FCL_ENABLE_METRICS
+#define HPP_FCL_METRICS_BROADPHASE_SCOPE(manager)             \
+  ::hpp::fcl::metrics::BroadPhaseScope hpp_fcl_metrics_scope( \
+      ::hpp::fcl::metrics::manager)
+#define HPP_FCL_METRICS_RECORD(call) ::hpp::fcl::metrics::call
+#else
+#define HPP_FCL_METRICS_BROADPHASE_SCOPE(manager)
+#define HPP_FCL_METRICS_RECORD(call)
+#endif
+
+#endif
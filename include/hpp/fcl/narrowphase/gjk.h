@@ -180,6 +180,9 @@ struct HPP_FCL_DLLAPI GJK {
   /// - \f$ d_{ub} < d \f$ when there is no collision and GJK cannot compute the
   ///   closest points.
   ///
+  /// When GJK fails, \f$ d \f$ is the distance of the last simplex, an upper
+  /// bound of the distance.
+  ///
   /// where \f$ d \f$ is the GJK::distance, \f$ R \f$ is the sum of the \c shape
   /// MinkowskiDiff::inflation and \f$ d_{ub} \f$ is the
   /// GJK::distance_upper_bound.
@@ -192,7 +195,8 @@ struct HPP_FCL_DLLAPI GJK {
   /// The tolerance argument is useful for continuous shapes and for polyhedron
   /// with some vertices closer than this threshold.
   ///
-  /// Suggested values are 100 iterations and a tolerance of 1e-6.
+  /// Suggested values are 100 iterations and a tolerance of
+  /// \ref GJK_DEFAULT_TOLERANCE.
   GJK(unsigned int max_iterations_, FCL_REAL tolerance_)
       : max_iterations(max_iterations_), tolerance(tolerance_) {
     initialize();
@@ -254,6 +258,10 @@ struct HPP_FCL_DLLAPI GJK {
   /// @brief Get GJK number of iterations.
   inline size_t getIterations() { return iterations; }
 
+  /// @brief Get the number of calls to the support function during the last
+  /// run of GJK.
+  inline size_t getNumCallSupport() const { return num_call_support; }
+
   /// @brief Get GJK tolerance.
   inline FCL_REAL getTolerance() { return tolerance; }
 
@@ -269,6 +277,7 @@ struct HPP_FCL_DLLAPI GJK {
   FCL_REAL tolerance;
   FCL_REAL distance_upper_bound;
   size_t iterations;
+  size_t num_call_support;
 
   /// @brief discard one vertex from the simplex
   inline void removeVertex(Simplex& simplex);
@@ -305,7 +314,7 @@ struct HPP_FCL_DLLAPI GJK {
 
 static const size_t EPA_MAX_FACES = 128;
 static const size_t EPA_MAX_VERTICES = 64;
-static const FCL_REAL EPA_EPS = 0.000001;
+static const FCL_REAL EPA_EPS = GJK_DEFAULT_TOLERANCE;
 static const size_t EPA_MAX_ITERATIONS = 255;
 
 /// @brief class for EPA algorithm
@@ -362,6 +371,9 @@ struct HPP_FCL_DLLAPI EPA {
   unsigned int max_vertex_num;
   unsigned int max_iterations;
   FCL_REAL tolerance;
+  size_t iterations;
+  size_t num_call_support;
+  bool owns_store;
 
  public:
   enum Status {
@@ -395,10 +407,13 @@ struct HPP_FCL_DLLAPI EPA {
   }
 
   ~EPA() {
+    if (!owns_store) return;
     delete[] sv_store;
     delete[] fc_store;
   }
 
+  /// @brief Allocate the vertices and faces of the polytope, or take them
+  /// from the QueryWorkspace bound to the thread if any.
   void initialize();
 
   /// \return a Status which can be demangled using (status & Valid) or
@@ -410,6 +425,13 @@ struct HPP_FCL_DLLAPI EPA {
   /// @return true on success
   bool getClosestPoints(const MinkowskiDiff& shape, Vec3f& w0, Vec3f& w1);
 
+  /// @brief Get EPA number of iterations.
+  inline size_t getIterations() const { return iterations; }
+
+  /// @brief Get the number of calls to the support function during the last
+  /// run of EPA.
+  inline size_t getNumCallSupport() const { return num_call_support; }
+
  private:
   bool getEdgeDist(SimplexF* face, SimplexV* a, SimplexV* b, FCL_REAL& dist);
 
@@ -45,6 +45,7 @@
 
 #include <hpp/fcl/narrowphase/gjk.h>
 #include <hpp/fcl/collision_data.h>
+#include <hpp/fcl/metrics.h>
 
 namespace hpp {
 namespace fcl {
@@ -99,6 +100,23 @@ struct HPP_FCL_DLLAPI GJKSolver {
     gjk.convergence_criterion_type = gjk_convergence_criterion_type;
   }
 
+  /// @brief Account a run of GJK in the profile, if profiling is enabled.
+  void profileGJK(details::GJK& gjk) const {
+    if (!enable_profiling) return;
+    ++profile.num_gjk_calls;
+    profile.num_gjk_iterations += (unsigned int)gjk.getIterations();
+    profile.num_support_calls += (unsigned int)gjk.getNumCallSupport();
+  }
+
+  /// @brief Account a run of EPA in the profile, if profiling is enabled.
+  void profileEPA(const details::EPA& epa) const {
+    if (!enable_profiling) return;
+    ++profile.num_epa_calls;
+    profile.num_epa_iterations += (unsigned int)epa.getIterations();
+    profile.num_epa_faces += (unsigned int)epa.hull.count;
+    profile.num_support_calls += (unsigned int)epa.getNumCallSupport();
+  }
+
   /// @brief intersection checking between two shapes
   template <typename S1, typename S2>
   bool shapeIntersect(const S1& s1, const Transform3f& tf1, const S2& s2,
@@ -114,6 +132,9 @@ struct HPP_FCL_DLLAPI GJKSolver {
     initialize_gjk(gjk, shape, s1, s2, guess, support_hint);
 
     details::GJK::Status gjk_status = gjk.evaluate(shape, guess, support_hint);
+    profileGJK(gjk);
+    HPP_FCL_METRICS_RECORD(recordGJK(s1.getNodeType(), s2.getNodeType(),
+                                     gjk_status, gjk.getIterations()));
     HPP_FCL_COMPILER_DIAGNOSTIC_PUSH
     HPP_FCL_COMPILER_DIAGNOSTIC_IGNORED_DEPRECECATED_DECLARATIONS
     if (gjk_initial_guess == GJKInitialGuess::CachedGuess ||
@@ -139,16 +160,19 @@ struct HPP_FCL_DLLAPI GJKSolver {
           details::EPA epa(epa_max_face_num, epa_max_vertex_num,
                            epa_max_iterations, epa_tolerance);
           details::EPA::Status epa_status = epa.evaluate(gjk, -guess);
+          profileEPA(epa);
+          HPP_FCL_METRICS_RECORD(recordEPA(epa_status));
           if (epa_status & details::EPA::Valid ||
               epa_status == details::EPA::OutOfFaces        // Warnings
               || epa_status == details::EPA::OutOfVertices  // Warnings
+              || epa_status == details::EPA::Degenerated    // Warnings
           ) {
             epa.getClosestPoints(shape, w0, w1);
             distance_lower_bound = -epa.depth;
             if (normal) (*normal).noalias() = tf1.getRotation() * epa.normal;
             if (contact_points)
               *contact_points =
-                  tf1.transform(w0 - epa.normal * (epa.depth * 0.5));
+                  tf1.transform(w0 - epa.normal * (epa.depth / 2));
             return true;
           } else if (epa_status == details::EPA::FallBack) {
             epa.getClosestPoints(shape, w0, w1);
@@ -195,6 +219,9 @@ struct HPP_FCL_DLLAPI GJKSolver {
     initialize_gjk(gjk, shape, s, tri, guess, support_hint);
 
     details::GJK::Status gjk_status = gjk.evaluate(shape, guess, support_hint);
+    profileGJK(gjk);
+    HPP_FCL_METRICS_RECORD(recordGJK(s.getNodeType(), tri.getNodeType(),
+                                     gjk_status, gjk.getIterations()));
 
     HPP_FCL_COMPILER_DIAGNOSTIC_PUSH
     HPP_FCL_COMPILER_DIAGNOSTIC_IGNORED_DEPRECECATED_DECLARATIONS
@@ -218,15 +245,18 @@ struct HPP_FCL_DLLAPI GJKSolver {
           details::EPA epa(epa_max_face_num, epa_max_vertex_num,
                            epa_max_iterations, epa_tolerance);
           details::EPA::Status epa_status = epa.evaluate(gjk, -guess);
+          profileEPA(epa);
+          HPP_FCL_METRICS_RECORD(recordEPA(epa_status));
           if (epa_status & details::EPA::Valid ||
               epa_status == details::EPA::OutOfFaces        // Warnings
               || epa_status == details::EPA::OutOfVertices  // Warnings
+              || epa_status == details::EPA::Degenerated    // Warnings
           ) {
             epa.getClosestPoints(shape, w0, w1);
             distance = -epa.depth;
             normal.noalias() = tf1.getRotation() * epa.normal;
-            p1 = p2 = tf1.transform(w0 - epa.normal * (epa.depth * 0.5));
-            assert(distance <= 1e-6);
+            p1 = p2 = tf1.transform(w0 - epa.normal * (epa.depth / 2));
+            assert(distance <= epa_tolerance);
           } else {
             distance = -(std::numeric_limits<FCL_REAL>::max)();
             gjk.getClosestPoints(shape, w0, w1);
@@ -272,6 +302,9 @@ struct HPP_FCL_DLLAPI GJKSolver {
     initialize_gjk(gjk, shape, s1, s2, guess, support_hint);
 
     details::GJK::Status gjk_status = gjk.evaluate(shape, guess, support_hint);
+    profileGJK(gjk);
+    HPP_FCL_METRICS_RECORD(recordGJK(s1.getNodeType(), s2.getNodeType(),
+                                     gjk_status, gjk.getIterations()));
     if (gjk_initial_guess == GJKInitialGuess::CachedGuess ||
         enable_cached_guess) {
       cached_guess = gjk.getGuessFromSimplex();
@@ -316,14 +349,17 @@ struct HPP_FCL_DLLAPI GJKSolver {
         details::EPA epa(epa_max_face_num, epa_max_vertex_num,
                          epa_max_iterations, epa_tolerance);
         details::EPA::Status epa_status = epa.evaluate(gjk, -guess);
+        profileEPA(epa);
+        HPP_FCL_METRICS_RECORD(recordEPA(epa_status));
         if (epa_status & details::EPA::Valid ||
             epa_status == details::EPA::OutOfFaces        // Warnings
             || epa_status == details::EPA::OutOfVertices  // Warnings
+            || epa_status == details::EPA::Degenerated    // Warnings
             || epa_status == details::EPA::FallBack) {
           Vec3f w0, w1;
           epa.getClosestPoints(shape, w0, w1);
           assert(epa.depth >= -eps);
-          distance = (std::min)(0., -epa.depth);
+          distance = (std::min)(FCL_REAL(0), -epa.depth);
           normal.noalias() = tf1.getRotation() * epa.normal;
           p1 = tf1.transform(w0);
           p2 = tf1.transform(w1);
@@ -343,11 +379,11 @@ struct HPP_FCL_DLLAPI GJKSolver {
   /// @brief Default constructor for GJK algorithm
   GJKSolver() {
     gjk_max_iterations = 128;
-    gjk_tolerance = 1e-6;
+    gjk_tolerance = GJK_DEFAULT_TOLERANCE;
     epa_max_face_num = 128;
     epa_max_vertex_num = 64;
     epa_max_iterations = 255;
-    epa_tolerance = 1e-6;
+    epa_tolerance = GJK_DEFAULT_TOLERANCE;
     enable_cached_guess = false;  // TODO: use gjk_initial_guess instead
     cached_guess = Vec3f(1, 0, 0);
     support_func_cached_guess = support_func_guess_t::Zero();
@@ -356,6 +392,7 @@ struct HPP_FCL_DLLAPI GJKSolver {
     gjk_variant = GJKVariant::DefaultGJK;
     gjk_convergence_criterion = GJKConvergenceCriterion::VDB;
     gjk_convergence_criterion_type = GJKConvergenceCriterionType::Relative;
+    enable_profiling = false;
   }
 
   /// @brief Constructor from a DistanceRequest
@@ -371,7 +408,7 @@ struct HPP_FCL_DLLAPI GJKSolver {
     epa_max_face_num = 128;
     epa_max_vertex_num = 64;
     epa_max_iterations = 255;
-    epa_tolerance = 1e-6;
+    epa_tolerance = GJK_DEFAULT_TOLERANCE;
 
     set(request);
   }
@@ -394,6 +431,8 @@ struct HPP_FCL_DLLAPI GJKSolver {
       cached_guess = request.cached_gjk_guess;
       support_func_cached_guess = request.cached_support_func_guess;
     }
+    enable_profiling = request.enable_profiling;
+    profile.clear();
   }
 
   /// @brief Constructor from a CollisionRequest
@@ -409,7 +448,7 @@ struct HPP_FCL_DLLAPI GJKSolver {
     epa_max_face_num = 128;
     epa_max_vertex_num = 64;
     epa_max_iterations = 255;
-    epa_tolerance = 1e-6;
+    epa_tolerance = GJK_DEFAULT_TOLERANCE;
 
     set(request);
   }
@@ -432,11 +471,14 @@ struct HPP_FCL_DLLAPI GJKSolver {
       cached_guess = request.cached_gjk_guess;
       support_func_cached_guess = request.cached_support_func_guess;
     }
+    enable_profiling = request.enable_profiling;
+    profile.clear();
 
     // The distance upper bound should be at least greater to the requested
     // security margin. Otherwise, we will likely miss some collisions.
     distance_upper_bound = (std::max)(
-        0., (std::max)(request.distance_upper_bound, request.security_margin));
+        FCL_REAL(0),
+        (std::max)(request.distance_upper_bound, request.security_margin));
   }
 
   /// @brief Copy constructor
@@ -513,6 +555,13 @@ struct HPP_FCL_DLLAPI GJKSolver {
   ///        the two shapes have a distance greather than distance_upper_bound.
   mutable FCL_REAL distance_upper_bound;
 
+  /// @brief Whether the runs of GJK and EPA are accounted in profile
+  bool enable_profiling;
+
+  /// @brief Statistics of the runs of GJK and EPA since the last call to set,
+  /// filled only if enable_profiling is true.
+  mutable QueryProfile profile;
+
  public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
 };
@@ -39,15 +39,70 @@
 #define HPP_FCL_OCTREE_H
 
 #include <boost/array.hpp>
+#include <unordered_map>
 
 #include <octomap/octomap.h>
 #include <hpp/fcl/fwd.hh>
 #include <hpp/fcl/BV/AABB.h>
 #include <hpp/fcl/collision_object.h>
+#include <hpp/fcl/linear_octree.h>
+#include <hpp/fcl/sdf.h>
 
 namespace hpp {
 namespace fcl {
 
+/// @brief Flattened bounding volume hierarchy over the occupied leaves of an
+/// OcTree.
+///
+/// The boxes of the leaves are stored contiguously, sorted in the order of
+/// the leaves of the hierarchy. The nodes of the hierarchy are stored in
+/// depth-first order, so that the left child of an internal node directly
+/// follows it.
+///
+/// Incremental updates (see OcTree::updateOccupiedLeaves) append the new boxes
+/// after the ones of the hierarchy, and replace the removed boxes by empty
+/// AABBs, until the hierarchy is rebuilt.
+struct HPP_FCL_DLLAPI OcTreeOccupiedLeaves {
+  struct Node {
+    /// @brief bounding volume of the boxes below the node
+    AABB bv;
+    /// @brief index of the right child of an internal node, or of the first
+    /// box of a leaf.
+    unsigned int index;
+    /// @brief number of boxes of a leaf, 0 for an internal node.
+    unsigned int num_boxes;
+
+    bool isLeaf() const { return num_boxes > 0; }
+  };
+
+  /// @brief Maximal number of boxes in a leaf of the hierarchy
+  static const unsigned int max_leaf_size = 4;
+
+  /// @brief nodes of the hierarchy, the first one being the root.
+  std::vector<Node> nodes;
+  /// @brief boxes of the occupied leaves of the octree
+  std::vector<AABB> boxes;
+  /// @brief identifier of the octree node of each box, as reported in the
+  /// contacts and distance results.
+  std::vector<int> node_ids;
+
+  /// @brief number of boxes covered by the hierarchy. The following ones were
+  /// added by incremental updates.
+  unsigned int num_hierarchy_boxes;
+  /// @brief number of boxes removed by incremental updates.
+  unsigned int num_removed_boxes;
+  /// @brief index of the box of each occupied leaf, given the code of its key
+  /// and depth.
+  std::unordered_map<uint64_t, unsigned int> box_ids;
+
+  OcTreeOccupiedLeaves() : num_hierarchy_boxes(0), num_removed_boxes(0) {}
+
+  /// @brief whether the box i was removed by an incremental update.
+  bool isRemoved(unsigned int i) const {
+    return boxes[i].min_[0] > boxes[i].max_[0];
+  }
+};
+
 /// @brief Octree is one type of collision geometry which can encode uncertainty
 /// information in the sensor data.
 class HPP_FCL_DLLAPI OcTree : public CollisionGeometry {
@@ -59,6 +114,8 @@ class HPP_FCL_DLLAPI OcTree : public CollisionGeometry {
   FCL_REAL occupancy_threshold;
   FCL_REAL free_threshold;
 
+  shared_ptr<OcTreeOccupiedLeaves> occupied_leaves;
+
  public:
   typedef octomap::OcTreeNode OcTreeNode;
 
@@ -66,22 +123,22 @@ class HPP_FCL_DLLAPI OcTree : public CollisionGeometry {
   explicit OcTree(FCL_REAL resolution)
       : tree(shared_ptr<const octomap::OcTree>(
             new octomap::OcTree(resolution))) {
-    default_occupancy = tree->getOccupancyThres();
+    default_occupancy = FCL_REAL(tree->getOccupancyThres());
 
     // default occupancy/free threshold is consistent with default setting from
     // octomap
-    occupancy_threshold = tree->getOccupancyThres();
+    occupancy_threshold = FCL_REAL(tree->getOccupancyThres());
     free_threshold = 0;
   }
 
   /// @brief construct octree from octomap
   explicit OcTree(const shared_ptr<const octomap::OcTree>& tree_)
       : tree(tree_) {
-    default_occupancy = tree->getOccupancyThres();
+    default_occupancy = FCL_REAL(tree->getOccupancyThres());
 
     // default occupancy/free threshold is consistent with default setting from
     // octomap
-    occupancy_threshold = tree->getOccupancyThres();
+    occupancy_threshold = FCL_REAL(tree->getOccupancyThres());
     free_threshold = 0;
   }
 
@@ -90,7 +147,8 @@ class HPP_FCL_DLLAPI OcTree : public CollisionGeometry {
         tree(other.tree),
         default_occupancy(other.default_occupancy),
         occupancy_threshold(other.occupancy_threshold),
-        free_threshold(other.free_threshold) {}
+        free_threshold(other.free_threshold),
+        occupied_leaves(other.occupied_leaves) {}
 
   OcTree* clone() const { return new OcTree(*this); }
 
@@ -105,7 +163,8 @@ class HPP_FCL_DLLAPI OcTree : public CollisionGeometry {
 
   /// @brief get the bounding volume for the root
   AABB getRootBV() const {
-    FCL_REAL delta = (1 << tree->getTreeDepth()) * tree->getResolution() / 2;
+    FCL_REAL delta =
+        FCL_REAL((1 << tree->getTreeDepth()) * tree->getResolution() / 2);
 
     // std::cout << "octree size " << delta << std::endl;
     return AABB(Vec3f(-delta, -delta, -delta), Vec3f(delta, delta, delta));
@@ -146,12 +205,12 @@ class HPP_FCL_DLLAPI OcTree : public CollisionGeometry {
          it != end; ++it) {
       // if(tree->isNodeOccupied(*it))
       if (isNodeOccupied(&*it)) {
-        FCL_REAL size = it.getSize();
-        FCL_REAL x = it.getX();
-        FCL_REAL y = it.getY();
-        FCL_REAL z = it.getZ();
-        FCL_REAL c = (*it).getOccupancy();
-        FCL_REAL t = tree->getOccupancyThres();
+        FCL_REAL size = FCL_REAL(it.getSize());
+        FCL_REAL x = FCL_REAL(it.getX());
+        FCL_REAL y = FCL_REAL(it.getY());
+        FCL_REAL z = FCL_REAL(it.getZ());
+        FCL_REAL c = FCL_REAL((*it).getOccupancy());
+        FCL_REAL t = FCL_REAL(tree->getOccupancyThres());
 
         boost::array<FCL_REAL, 6> box = {{x, y, z, size, c, t}};
         boxes.push_back(box);
@@ -160,6 +219,17 @@ class HPP_FCL_DLLAPI OcTree : public CollisionGeometry {
     return boxes;
   }
 
+  /// @brief Convert the occupied leaves of the octree into a LinearOcTree of
+  /// the same resolution and depth.
+  LinearOcTreePtr_t toLinearOcTree() const;
+
+  /// @brief Build a SignedDistanceField with one sample per voxel of the
+  /// octree, from its occupied leaves.
+  ///
+  /// \param[in] padding distance between the occupied voxels and the border of
+  ///            the grid.
+  SignedDistanceFieldPtr_t toSignedDistanceField(FCL_REAL padding) const;
+
   /// @brief the threshold used to decide whether one node is occupied, this is
   /// NOT the octree occupied_thresold
   FCL_REAL getOccupancyThres() const { return occupancy_threshold; }
@@ -172,9 +242,47 @@ class HPP_FCL_DLLAPI OcTree : public CollisionGeometry {
 
   void setCellDefaultOccupancy(FCL_REAL d) { default_occupancy = d; }
 
-  void setOccupancyThres(FCL_REAL d) { occupancy_threshold = d; }
+  void setOccupancyThres(FCL_REAL d) {
+    occupancy_threshold = d;
+    occupied_leaves.reset();
+  }
+
+  void setFreeThres(FCL_REAL d) {
+    free_threshold = d;
+    occupied_leaves.reset();
+  }
 
-  void setFreeThres(FCL_REAL d) { free_threshold = d; }
+  /// @brief Build the flattened hierarchy of the occupied leaves of the
+  /// octree.
+  ///
+  /// Once built, the collision and distance queries against shapes and meshes
+  /// traverse it instead of the octomap nodes, as do the queries against
+  /// another octree whose hierarchy is built too. It must be updated after the
+  /// octomap is modified, and it is discarded when the thresholds change.
+  void buildOccupiedLeaves();
+
+  /// @brief Update the flattened hierarchy of the occupied leaves after the
+  /// voxels of the given keys were modified in the octomap.
+  ///
+  /// Only the boxes of the leaves containing these voxels are replaced, along
+  /// with the boxes of the leaves expanded or pruned by octomap around them.
+  /// The hierarchy is rebuilt once the replaced boxes exceed a fraction of it.
+  void updateOccupiedLeaves(const std::vector<octomap::OcTreeKey>& keys);
+
+  /// @brief Update the flattened hierarchy of the occupied leaves with the
+  /// keys reported by the change detection of the octomap.
+  ///
+  /// The change detection must be enabled in the octomap, and its changed keys
+  /// reset by the caller once the update is done.
+  void updateOccupiedLeavesFromChangedKeys();
+
+  /// @brief Discard the flattened hierarchy of the occupied leaves.
+  void clearOccupiedLeaves() { occupied_leaves.reset(); }
+
+  /// @brief Returns the flattened hierarchy of the occupied leaves, if built.
+  shared_ptr<const OcTreeOccupiedLeaves> getOccupiedLeaves() const {
+    return occupied_leaves;
+  }
 
   /// @return ptr to child number childIdx of node
   OcTreeNode* getNodeChild(OcTreeNode* node, unsigned int childIdx) {
@@ -239,27 +347,27 @@ class HPP_FCL_DLLAPI OcTree : public CollisionGeometry {
 static inline void computeChildBV(const AABB& root_bv, unsigned int i,
                                   AABB& child_bv) {
   if (i & 1) {
-    child_bv.min_[0] = (root_bv.min_[0] + root_bv.max_[0]) * 0.5;
+    child_bv.min_[0] = (root_bv.min_[0] + root_bv.max_[0]) / 2;
     child_bv.max_[0] = root_bv.max_[0];
   } else {
     child_bv.min_[0] = root_bv.min_[0];
-    child_bv.max_[0] = (root_bv.min_[0] + root_bv.max_[0]) * 0.5;
+    child_bv.max_[0] = (root_bv.min_[0] + root_bv.max_[0]) / 2;
   }
 
   if (i & 2) {
-    child_bv.min_[1] = (root_bv.min_[1] + root_bv.max_[1]) * 0.5;
+    child_bv.min_[1] = (root_bv.min_[1] + root_bv.max_[1]) / 2;
     child_bv.max_[1] = root_bv.max_[1];
   } else {
     child_bv.min_[1] = root_bv.min_[1];
-    child_bv.max_[1] = (root_bv.min_[1] + root_bv.max_[1]) * 0.5;
+    child_bv.max_[1] = (root_bv.min_[1] + root_bv.max_[1]) / 2;
   }
 
   if (i & 4) {
-    child_bv.min_[2] = (root_bv.min_[2] + root_bv.max_[2]) * 0.5;
+    child_bv.min_[2] = (root_bv.min_[2] + root_bv.max_[2]) / 2;
     child_bv.max_[2] = root_bv.max_[2];
   } else {
     child_bv.min_[2] = root_bv.min_[2];
-    child_bv.max_[2] = (root_bv.min_[2] + root_bv.max_[2]) * 0.5;
+    child_bv.max_[2] = (root_bv.min_[2] + root_bv.max_[2]) / 2;
   }
 }
 
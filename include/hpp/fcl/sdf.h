@@ -0,0 +1,223 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HPP_FCL_SDF_H
+#define HPP_FCL_SDF_H
+
+#include <vector>
+
+#include <hpp/fcl/fwd.hh>
+#include <hpp/fcl/data_types.h>
+#include <hpp/fcl/BV/AABB.h>
+#include <hpp/fcl/collision_object.h>
+
+namespace hpp {
+namespace fcl {
+
+/// @brief Signed distance field sampled on a regular grid.
+///
+/// The sample (i, j, k) lies at origin + resolution * (i, j, k) and holds the
+/// signed distance to the surface of the object, negative inside. Between the
+/// samples, the field is interpolated trilinearly. Outside of the grid, it is
+/// extrapolated by adding the distance to the grid to the value at the
+/// closest point of the grid.
+class HPP_FCL_DLLAPI SignedDistanceField : public CollisionGeometry {
+ public:
+  typedef Eigen::Matrix<Eigen::DenseIndex, 3, 1> Dims;
+
+  /// @brief Constructing a field from its samples.
+  ///
+  /// \param[in] origin position of the sample (0, 0, 0).
+  /// \param[in] resolution distance between two consecutive samples.
+  /// \param[in] dims number of samples along each axis, at least 2.
+  /// \param[in] values samples, the x index varying the fastest.
+  SignedDistanceField(const Vec3f& origin, FCL_REAL resolution,
+                      const Dims& dims, const VecXf& values);
+
+  SignedDistanceField(const SignedDistanceField& other)
+      : CollisionGeometry(other),
+        origin(other.origin),
+        resolution(other.resolution),
+        dims(other.dims),
+        values(other.values),
+        block_bounds(other.block_bounds),
+        block_dims(other.block_dims) {}
+
+  SignedDistanceField* clone() const { return new SignedDistanceField(*this); }
+
+  /// @brief Returns the position of the sample (0, 0, 0).
+  const Vec3f& getOrigin() const { return origin; }
+
+  /// @brief Returns the distance between two consecutive samples.
+  FCL_REAL getResolution() const { return resolution; }
+
+  /// @brief Returns the number of samples along each axis.
+  const Dims& getDims() const { return dims; }
+
+  /// @brief Returns the samples, the x index varying the fastest.
+  const VecXf& getValues() const { return values; }
+
+  /// @brief Returns the sample (i, j, k).
+  FCL_REAL getValue(Eigen::DenseIndex i, Eigen::DenseIndex j,
+                    Eigen::DenseIndex k) const {
+    return values[i + dims[0] * (j + dims[1] * k)];
+  }
+
+  /// @brief Returns the index of the sample (i, j, k), which is also the index
+  /// of the cell between the samples (i, j, k) and (i + 1, j + 1, k + 1).
+  Eigen::DenseIndex getIndex(Eigen::DenseIndex i, Eigen::DenseIndex j,
+                             Eigen::DenseIndex k) const {
+    return i + dims[0] * (j + dims[1] * k);
+  }
+
+  /// @brief Returns the lower bounds of the field over blocks of cells.
+  ///
+  /// The block (i, j, k) of the level l gathers the cells 2^(l+1) i to
+  /// 2^(l+1) (i + 1) - 1 along x, and similarly along y and z. It holds the
+  /// minimum of the samples of these cells. The last level has a single
+  /// block.
+  const std::vector<VecXf>& getBlockBounds() const { return block_bounds; }
+
+  /// @brief Returns the number of blocks of each level along each axis.
+  const std::vector<Dims>& getBlockDims() const { return block_dims; }
+
+  /// @brief Evaluate the signed distance at a point of the local frame.
+  FCL_REAL computeDistance(const Vec3f& p) const;
+
+  /// @brief Evaluate the signed distance and its gradient at a point of the
+  /// local frame.
+  FCL_REAL computeDistance(const Vec3f& p, Vec3f& gradient) const;
+
+  /// @brief Evaluate the signed distances and their gradients at the rows of
+  /// points, expressed in the local frame.
+  void computeDistances(
+      const Eigen::Matrix<FCL_REAL, Eigen::Dynamic, 3>& points,
+      VecXf& distances,
+      Eigen::Matrix<FCL_REAL, Eigen::Dynamic, 3>& gradients) const;
+
+  /// @brief Compute the AABB of the grid in the local frame.
+  void computeLocalAABB();
+
+  /// @brief Get the object type: it is a signed distance field
+  OBJECT_TYPE getObjectType() const { return OT_SDF; }
+
+  /// @brief Get the node type: it is a signed distance field
+  NODE_TYPE getNodeType() const { return GEOM_SDF; }
+
+ private:
+  virtual bool isEqual(const CollisionGeometry& _other) const {
+    const SignedDistanceField* other_ptr =
+        dynamic_cast<const SignedDistanceField*>(&_other);
+    if (other_ptr == nullptr) return false;
+    const SignedDistanceField& other = *other_ptr;
+
+    return origin == other.origin && resolution == other.resolution &&
+           dims == other.dims && values == other.values;
+  }
+
+  /// @brief position of the sample (0, 0, 0)
+  Vec3f origin;
+
+  /// @brief distance between two consecutive samples
+  FCL_REAL resolution;
+
+  /// @brief number of samples along each axis
+  Dims dims;
+
+  /// @brief samples, the x index varying the fastest
+  VecXf values;
+
+  /// @brief minimum of the samples over blocks of cells, by level
+  std::vector<VecXf> block_bounds;
+
+  /// @brief number of blocks of each level along each axis
+  std::vector<Dims> block_dims;
+
+  /// @brief Compute the lower bounds of the field over the blocks of cells.
+  void computeBlockBounds();
+
+ public:
+  EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+};
+
+///
+/// \brief Build a SignedDistanceField from a closed triangle mesh
+///
+/// The distances are exact close to the triangles and propagated by
+/// sweeping the closest triangles elsewhere. The sign is given by the parity
+/// of the number of triangles crossed along the x axis, so that the mesh
+/// must be watertight.
+///
+/// \param[in] mesh the triangle mesh.
+/// \param[in] resolution distance between two consecutive samples.
+/// \param[in] padding distance between the AABB of the mesh and the border of
+///            the grid.
+///
+HPP_FCL_DLLAPI SignedDistanceFieldPtr_t
+makeSignedDistanceField(const BVHModelBase& mesh, const FCL_REAL resolution,
+                        const FCL_REAL padding);
+
+///
+/// \brief Build a SignedDistanceField from an occupancy grid
+///
+/// Each sample is the center of a voxel. The distance of a free (resp.
+/// occupied) voxel is the distance to the center of the closest occupied
+/// (resp. free) voxel, reduced by half of the resolution.
+///
+/// \param[in] origin position of the voxel (0, 0, 0).
+/// \param[in] resolution size of the voxels.
+/// \param[in] dims number of voxels along each axis, at least 2.
+/// \param[in] occupied occupancy of the voxels, the x index varying the
+///            fastest.
+///
+HPP_FCL_DLLAPI SignedDistanceFieldPtr_t makeSignedDistanceField(
+    const Vec3f& origin, const FCL_REAL resolution,
+    const SignedDistanceField::Dims& dims, const std::vector<bool>& occupied);
+
+///
+/// \brief Build a SignedDistanceField from the occupied leaves of a
+/// LinearOcTree, with one sample per voxel of the tree.
+///
+/// \param[in] tree the linear octree, with at least one occupied leaf.
+/// \param[in] padding distance between the occupied voxels and the border of
+///            the grid.
+///
+HPP_FCL_DLLAPI SignedDistanceFieldPtr_t
+makeSignedDistanceField(const LinearOcTree& tree, const FCL_REAL padding);
+
+}  // namespace fcl
+
+}  // namespace hpp
+
+#endif
@@ -21,6 +21,7 @@ struct BVHModelBaseAccessor : hpp::fcl::BVHModelBase {
   typedef hpp::fcl::BVHModelBase Base;
   using Base::num_tris_allocated;
   using Base::num_vertices_allocated;
+  using Base::own_storage;
 };
 }  // namespace internal
 
@@ -53,7 +54,7 @@ void save(Archive &ar, const hpp::fcl::BVHModelBase &bvh_model,
   if (bvh_model.num_vertices > 0) {
     typedef Eigen::Matrix<FCL_REAL, 3, Eigen::Dynamic> AsVertixMatrix;
     const Eigen::Map<const AsVertixMatrix> vertices_map(
-        reinterpret_cast<const double *>(bvh_model.vertices), 3,
+        reinterpret_cast<const FCL_REAL *>(bvh_model.vertices), 3,
         bvh_model.num_vertices);
     ar &make_nvp("vertices", vertices_map);
   }
@@ -74,7 +75,7 @@ void save(Archive &ar, const hpp::fcl::BVHModelBase &bvh_model,
     ar << make_nvp("has_prev_vertices", has_prev_vertices);
     typedef Eigen::Matrix<FCL_REAL, 3, Eigen::Dynamic> AsVertixMatrix;
     const Eigen::Map<const AsVertixMatrix> prev_vertices_map(
-        reinterpret_cast<const double *>(bvh_model.prev_vertices), 3,
+        reinterpret_cast<const FCL_REAL *>(bvh_model.prev_vertices), 3,
         bvh_model.num_vertices);
     ar &make_nvp("prev_vertices", prev_vertices_map);
   } else {
@@ -103,6 +104,16 @@ void load(Archive &ar, hpp::fcl::BVHModelBase &bvh_model,
                  boost::serialization::base_object<hpp::fcl::CollisionGeometry>(
                      bvh_model));
 
+  typedef internal::BVHModelBaseAccessor Accessor;
+  Accessor &accessor = reinterpret_cast<Accessor &>(bvh_model);
+  if (!accessor.own_storage) {
+    // Do not write in the storage of the caller.
+    bvh_model.vertices = NULL;
+    bvh_model.tri_indices = NULL;
+    bvh_model.num_vertices = bvh_model.num_tris = 0;
+    accessor.own_storage = true;
+  }
+
   unsigned int num_vertices;
   ar >> make_nvp("num_vertices", num_vertices);
   if (num_vertices != bvh_model.num_vertices) {
@@ -114,7 +125,7 @@ void load(Archive &ar, hpp::fcl::BVHModelBase &bvh_model,
   if (num_vertices > 0) {
     typedef Eigen::Matrix<FCL_REAL, 3, Eigen::Dynamic> AsVertixMatrix;
     Eigen::Map<AsVertixMatrix> vertices_map(
-        reinterpret_cast<double *>(bvh_model.vertices), 3,
+        reinterpret_cast<FCL_REAL *>(bvh_model.vertices), 3,
         bvh_model.num_vertices);
     ar >> make_nvp("vertices", vertices_map);
   } else
@@ -141,9 +152,8 @@ void load(Archive &ar, hpp::fcl::BVHModelBase &bvh_model,
 
   ar >> make_nvp("build_state", bvh_model.build_state);
 
-  typedef internal::BVHModelBaseAccessor Accessor;
-  reinterpret_cast<Accessor &>(bvh_model).num_tris_allocated = num_tris;
-  reinterpret_cast<Accessor &>(bvh_model).num_vertices_allocated = num_vertices;
+  accessor.num_tris_allocated = num_tris;
+  accessor.num_vertices_allocated = num_vertices;
 
   bool has_prev_vertices;
   ar >> make_nvp("has_prev_vertices", has_prev_vertices);
@@ -156,7 +166,7 @@ void load(Archive &ar, hpp::fcl::BVHModelBase &bvh_model,
     if (num_vertices > 0) {
       typedef Eigen::Matrix<FCL_REAL, 3, Eigen::Dynamic> AsVertixMatrix;
       Eigen::Map<AsVertixMatrix> prev_vertices_map(
-          reinterpret_cast<double *>(bvh_model.prev_vertices), 3,
+          reinterpret_cast<FCL_REAL *>(bvh_model.prev_vertices), 3,
           bvh_model.num_vertices);
       ar &make_nvp("prev_vertices", prev_vertices_map);
     }
@@ -8,6 +8,8 @@
 #include "hpp/fcl/collision_data.h"
 #include "hpp/fcl/serialization/fwd.h"
 
+#include <boost/serialization/version.hpp>
+
 namespace boost {
 namespace serialization {
 
@@ -37,7 +39,7 @@ HPP_FCL_SERIALIZATION_SPLIT(hpp::fcl::Contact)
 
 template <class Archive>
 void serialize(Archive& ar, hpp::fcl::QueryRequest& query_request,
-               const unsigned int /*version*/) {
+               const unsigned int version) {
   ar& make_nvp("gjk_initial_guess", query_request.gjk_initial_guess);
   // TODO: use gjk_initial_guess instead
   HPP_FCL_COMPILER_DIAGNOSTIC_PUSH
@@ -49,6 +51,10 @@ void serialize(Archive& ar, hpp::fcl::QueryRequest& query_request,
   ar& make_nvp("cached_support_func_guess",
                query_request.cached_support_func_guess);
   ar& make_nvp("enable_timings", query_request.enable_timings);
+  if (version > 0)
+    ar& make_nvp("enable_profiling", query_request.enable_profiling);
+  else if (Archive::is_loading::value)
+    query_request.enable_profiling = false;
 }
 
 template <class Archive>
@@ -142,4 +148,7 @@ HPP_FCL_SERIALIZATION_SPLIT(hpp::fcl::DistanceResult)
 }  // namespace serialization
 }  // namespace boost
 
+// Version 1 adds QueryRequest::enable_profiling.
+BOOST_CLASS_VERSION(hpp::fcl::QueryRequest, 1)
+
 #endif  // ifndef HPP_FCL_SERIALIZATION_COLLISION_DATA_H
@@ -10,9 +10,19 @@
 #include "hpp/fcl/serialization/fwd.h"
 #include "hpp/fcl/serialization/OBBRSS.h"
 
+#include <boost/serialization/version.hpp>
+
 namespace boost {
 namespace serialization {
 
+/// Version 1 adds the compact storages of the heights.
+template <typename BV>
+struct version<hpp::fcl::HeightField<BV> > {
+  typedef mpl::int_<1> type;
+  typedef mpl::integral_c_tag tag;
+  BOOST_STATIC_CONSTANT(int, value = version::type::value);
+};
+
 template <class Archive>
 void serialize(Archive &ar, hpp::fcl::HFNodeBase &node,
                const unsigned int /*version*/) {
@@ -36,11 +46,17 @@ namespace internal {
 template <typename BV>
 struct HeightFieldAccessor : hpp::fcl::HeightField<BV> {
   typedef hpp::fcl::HeightField<BV> Base;
+  using Base::buildCellIndex;
   using Base::bvs;
+  using Base::float_heights;
+  using Base::height_offset;
+  using Base::height_scale;
   using Base::heights;
   using Base::max_height;
   using Base::min_height;
   using Base::num_bvs;
+  using Base::quantized_heights;
+  using Base::storage;
   using Base::x_dim;
   using Base::x_grid;
   using Base::y_dim;
@@ -50,7 +66,7 @@ struct HeightFieldAccessor : hpp::fcl::HeightField<BV> {
 
 template <class Archive, typename BV>
 void serialize(Archive &ar, hpp::fcl::HeightField<BV> &hf_model,
-               const unsigned int /*version*/) {
+               const unsigned int version) {
   ar &make_nvp(
       "base",
       boost::serialization::base_object<hpp::fcl::CollisionGeometry>(hf_model));
@@ -68,6 +84,21 @@ void serialize(Archive &ar, hpp::fcl::HeightField<BV> &hf_model,
 
   ar &make_nvp("bvs", access.bvs);
   ar &make_nvp("num_bvs", access.num_bvs);
+
+  if (version > 0) {
+    ar &make_nvp("storage", access.storage);
+    ar &make_nvp("float_heights", access.float_heights);
+    ar &make_nvp("quantized_heights", access.quantized_heights);
+    ar &make_nvp("height_scale", access.height_scale);
+    ar &make_nvp("height_offset", access.height_offset);
+  } else if (Archive::is_loading::value) {
+    access.storage = hpp::fcl::HF_STORAGE_REAL;
+    access.float_heights.resize(0, 0);
+    access.quantized_heights.resize(0, 0);
+    access.height_scale = access.height_offset = 0;
+  }
+
+  if (Archive::is_loading::value) access.buildCellIndex();
 }
 }  // namespace serialization
 }  // namespace boost
@@ -103,9 +103,9 @@ Matrix3f Convex<PolygonT>::computeMomentofInertia() const {
 
   Matrix3f C = Matrix3f::Zero();
 
+  const FCL_REAL a = FCL_REAL(1) / 60, b = FCL_REAL(1) / 120;
   Matrix3f C_canonical;
-  C_canonical << 1 / 60.0, 1 / 120.0, 1 / 120.0, 1 / 120.0, 1 / 60.0, 1 / 120.0,
-      1 / 120.0, 1 / 120.0, 1 / 60.0;
+  C_canonical << a, b, b, b, a, b, b, b, a;
 
   for (unsigned int i = 0; i < num_polygons; ++i) {
     const PolygonT& polygon = polygons[i];
@@ -114,7 +114,7 @@ Matrix3f Convex<PolygonT>::computeMomentofInertia() const {
     Vec3f plane_center(0, 0, 0);
     for (size_type j = 0; j < polygon.size(); ++j)
       plane_center += points[polygon[(index_type)j]];
-    plane_center /= polygon.size();
+    plane_center /= FCL_REAL(polygon.size());
 
     // compute the volume of tetrahedron making by neighboring two points, the
     // plane center and the reference point (zero) of the convex shape
@@ -148,7 +148,7 @@ Vec3f Convex<PolygonT>::computeCOM() const {
     Vec3f plane_center(0, 0, 0);
     for (size_type j = 0; j < polygon.size(); ++j)
       plane_center += points[polygon[(index_type)j]];
-    plane_center /= polygon.size();
+    plane_center /= FCL_REAL(polygon.size());
 
     // compute the volume of tetrahedron making by neighboring two points, the
     // plane center and the reference point (zero) of the convex shape
@@ -181,7 +181,7 @@ FCL_REAL Convex<PolygonT>::computeVolume() const {
     Vec3f plane_center(0, 0, 0);
     for (size_type j = 0; j < polygon.size(); ++j)
       plane_center += points[polygon[(index_type)j]];
-    plane_center /= polygon.size();
+    plane_center /= FCL_REAL(polygon.size());
 
     // compute the volume of tetrahedron making by neighboring two points, the
     // plane center and the reference point (zero point) of the convex shape
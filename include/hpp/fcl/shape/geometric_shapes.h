@@ -210,7 +210,7 @@ class HPP_FCL_DLLAPI Sphere : public ShapeBase {
   NODE_TYPE getNodeType() const { return GEOM_SPHERE; }
 
   Matrix3f computeMomentofInertia() const {
-    FCL_REAL I = 0.4 * radius * radius * computeVolume();
+    FCL_REAL I = FCL_REAL(0.4) * radius * radius * computeVolume();
     return I * Matrix3f::Identity();
   }
 
@@ -277,8 +277,8 @@ class HPP_FCL_DLLAPI Ellipsoid : public ShapeBase {
     FCL_REAL a2 = V * radii[0] * radii[0];
     FCL_REAL b2 = V * radii[1] * radii[1];
     FCL_REAL c2 = V * radii[2] * radii[2];
-    return (Matrix3f() << 0.2 * (b2 + c2), 0, 0, 0, 0.2 * (a2 + c2), 0, 0, 0,
-            0.2 * (a2 + b2))
+    return (Matrix3f() << FCL_REAL(0.2) * (b2 + c2), 0, 0, 0,
+            FCL_REAL(0.2) * (a2 + c2), 0, 0, 0, FCL_REAL(0.2) * (a2 + b2))
         .finished();
   }
 
@@ -348,20 +348,22 @@ class HPP_FCL_DLLAPI Capsule : public ShapeBase {
 
   FCL_REAL computeVolume() const {
     return boost::math::constants::pi<FCL_REAL>() * radius * radius *
-           ((halfLength * 2) + radius * 4 / 3.0);
+           ((halfLength * 2) + radius * 4 / FCL_REAL(3));
   }
 
   Matrix3f computeMomentofInertia() const {
     FCL_REAL v_cyl = radius * radius * (halfLength * 2) *
                      boost::math::constants::pi<FCL_REAL>();
     FCL_REAL v_sph = radius * radius * radius *
-                     boost::math::constants::pi<FCL_REAL>() * 4 / 3.0;
+                     boost::math::constants::pi<FCL_REAL>() * 4 / FCL_REAL(3);
 
     FCL_REAL h2 = halfLength * halfLength;
     FCL_REAL r2 = radius * radius;
-    FCL_REAL ix = v_cyl * (h2 / 3. + r2 / 4.) +
-                  v_sph * (0.4 * r2 + h2 + 0.75 * radius * halfLength);
-    FCL_REAL iz = (0.5 * v_cyl + 0.4 * v_sph) * radius * radius;
+    FCL_REAL ix = v_cyl * (h2 / 3 + r2 / 4) +
+                  v_sph * (FCL_REAL(0.4) * r2 + h2 +
+                           FCL_REAL(0.75) * radius * halfLength);
+    FCL_REAL iz =
+        (FCL_REAL(0.5) * v_cyl + FCL_REAL(0.4) * v_sph) * radius * radius;
 
     return (Matrix3f() << ix, 0, 0, 0, ix, 0, 0, 0, iz).finished();
   }
@@ -431,14 +433,14 @@ class HPP_FCL_DLLAPI Cone : public ShapeBase {
 
   Matrix3f computeMomentofInertia() const {
     FCL_REAL V = computeVolume();
-    FCL_REAL ix =
-        V * (0.4 * halfLength * halfLength + 3 * radius * radius / 20);
-    FCL_REAL iz = 0.3 * V * radius * radius;
+    FCL_REAL ix = V * (FCL_REAL(0.4) * halfLength * halfLength +
+                       3 * radius * radius / 20);
+    FCL_REAL iz = FCL_REAL(0.3) * V * radius * radius;
 
     return (Matrix3f() << ix, 0, 0, 0, ix, 0, 0, 0, iz).finished();
   }
 
-  Vec3f computeCOM() const { return Vec3f(0, 0, -0.5 * halfLength); }
+  Vec3f computeCOM() const { return Vec3f(0, 0, -halfLength / 2); }
 
   FCL_REAL minInflationValue() const { return -(std::min)(radius, halfLength); }
 
@@ -462,7 +464,7 @@ class HPP_FCL_DLLAPI Cone : public ShapeBase {
     const FCL_REAL bottom_inflation = value;
 
     const FCL_REAL new_lz = 2 * halfLength + top_inflation + bottom_inflation;
-    const FCL_REAL new_cz = (top_inflation + bottom_inflation) / 2.;
+    const FCL_REAL new_cz = (top_inflation + bottom_inflation) / 2;
     const FCL_REAL new_radius = new_lz / tan_alpha;
 
     return std::make_pair(Cone(new_radius, new_lz),
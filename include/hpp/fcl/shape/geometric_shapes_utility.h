@@ -42,6 +42,7 @@
 #include <hpp/fcl/shape/geometric_shapes.h>
 #include <hpp/fcl/BV/BV.h>
 #include <hpp/fcl/internal/BV_fitter.h>
+#include <hpp/fcl/workspace.h>
 
 namespace hpp {
 namespace fcl {
@@ -50,29 +51,46 @@ namespace fcl {
 namespace details {
 /// @brief get the vertices of some convex shape which can bound the given shape
 /// in a specific configuration
-HPP_FCL_DLLAPI std::vector<Vec3f> getBoundVertices(const Box& box,
-                                                   const Transform3f& tf);
-HPP_FCL_DLLAPI std::vector<Vec3f> getBoundVertices(const Sphere& sphere,
-                                                   const Transform3f& tf);
-HPP_FCL_DLLAPI std::vector<Vec3f> getBoundVertices(const Ellipsoid& ellipsoid,
-                                                   const Transform3f& tf);
-HPP_FCL_DLLAPI std::vector<Vec3f> getBoundVertices(const Capsule& capsule,
-                                                   const Transform3f& tf);
-HPP_FCL_DLLAPI std::vector<Vec3f> getBoundVertices(const Cone& cone,
-                                                   const Transform3f& tf);
-HPP_FCL_DLLAPI std::vector<Vec3f> getBoundVertices(const Cylinder& cylinder,
-                                                   const Transform3f& tf);
-HPP_FCL_DLLAPI std::vector<Vec3f> getBoundVertices(const ConvexBase& convex,
-                                                   const Transform3f& tf);
-HPP_FCL_DLLAPI std::vector<Vec3f> getBoundVertices(const TriangleP& triangle,
-                                                   const Transform3f& tf);
+HPP_FCL_DLLAPI void getBoundVertices(const Box& box, const Transform3f& tf,
+                                     std::vector<Vec3f>& result);
+HPP_FCL_DLLAPI void getBoundVertices(const Sphere& sphere,
+                                     const Transform3f& tf,
+                                     std::vector<Vec3f>& result);
+HPP_FCL_DLLAPI void getBoundVertices(const Ellipsoid& ellipsoid,
+                                     const Transform3f& tf,
+                                     std::vector<Vec3f>& result);
+HPP_FCL_DLLAPI void getBoundVertices(const Capsule& capsule,
+                                     const Transform3f& tf,
+                                     std::vector<Vec3f>& result);
+HPP_FCL_DLLAPI void getBoundVertices(const Cone& cone, const Transform3f& tf,
+                                     std::vector<Vec3f>& result);
+HPP_FCL_DLLAPI void getBoundVertices(const Cylinder& cylinder,
+                                     const Transform3f& tf,
+                                     std::vector<Vec3f>& result);
+HPP_FCL_DLLAPI void getBoundVertices(const ConvexBase& convex,
+                                     const Transform3f& tf,
+                                     std::vector<Vec3f>& result);
+HPP_FCL_DLLAPI void getBoundVertices(const TriangleP& triangle,
+                                     const Transform3f& tf,
+                                     std::vector<Vec3f>& result);
+
+template <typename S>
+std::vector<Vec3f> getBoundVertices(const S& s, const Transform3f& tf) {
+  std::vector<Vec3f> result;
+  getBoundVertices(s, tf, result);
+  return result;
+}
 }  // namespace details
 /// @endcond
 
 /// @brief calculate a bounding volume for a shape in a specific configuration
 template <typename BV, typename S>
 inline void computeBV(const S& s, const Transform3f& tf, BV& bv) {
-  std::vector<Vec3f> convex_bound_vertices = details::getBoundVertices(s, tf);
+  QueryWorkspace* workspace = QueryWorkspace::current();
+  std::vector<Vec3f> local_vertices;
+  std::vector<Vec3f>& convex_bound_vertices =
+      workspace ? workspace->bound_vertices : local_vertices;
+  details::getBoundVertices(s, tf, convex_bound_vertices);
   fit(&convex_bound_vertices[0], (unsigned int)convex_bound_vertices.size(),
       bv);
 }
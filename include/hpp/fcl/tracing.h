@@ -0,0 +1,140 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HPP_FCL_TRACING_H
+#define HPP_FCL_TRACING_H
+
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <hpp/fcl/fwd.hh>
+
+namespace hpp {
+namespace fcl {
+
+/// @brief Timeline traces of the queries.
+///
+/// The spans are emitted only if the library is compiled with
+/// HPP_FCL_ENABLE_TRACING (CMake option of the same name) and a sink is
+/// installed with setTraceSink. Otherwise, the spans are compiled out.
+///
+/// Spans are emitted for collide and distance, the queries of the broadphase
+/// managers, the BVH traversals and EPA.
+namespace tracing {
+
+/// @brief Begin or end of a span.
+struct HPP_FCL_DLLAPI TraceEvent {
+  enum Phase { BEGIN, END };
+
+  /// @brief name of the span, a string literal
+  const char* name;
+
+  /// @brief category of the span, a string literal
+  const char* category;
+
+  Phase phase;
+
+  /// @brief time of the event in microseconds, from a monotonic clock
+  double timestamp;
+
+  /// @brief index of the thread, in order of first event
+  unsigned int thread_id;
+};
+
+/// @brief Receiver of the trace events.
+///
+/// The events may be recorded concurrently by several threads.
+class HPP_FCL_DLLAPI TraceSink {
+ public:
+  virtual ~TraceSink() {}
+
+  virtual void record(const TraceEvent& event) = 0;
+};
+
+/// @brief Install the sink receiving the events, or remove it with NULL.
+/// @note The sink must outlive the spans which began while it was installed.
+HPP_FCL_DLLAPI void setTraceSink(TraceSink* sink);
+
+HPP_FCL_DLLAPI TraceSink* getTraceSink();
+
+/// @brief Sink keeping the events in memory, to write them in the JSON trace
+/// format read by chrome://tracing and Perfetto.
+class HPP_FCL_DLLAPI ChromeTraceWriter : public TraceSink {
+ public:
+  void record(const TraceEvent& event);
+
+  /// @brief Write the events recorded so far.
+  void write(std::ostream& os) const;
+
+  /// @brief Write the events recorded so far to a file.
+  void write(const std::string& filename) const;
+
+  /// @brief Discard the events recorded so far.
+  void clear();
+
+  std::size_t size() const;
+
+ private:
+  mutable std::mutex mutex;
+  std::vector<TraceEvent> events;
+};
+
+/// @brief Emit the begin and end events of a span at construction and
+/// destruction, if a sink is installed.
+class HPP_FCL_DLLAPI TraceSpan {
+ public:
+  TraceSpan(const char* name, const char* category);
+  ~TraceSpan();
+
+ private:
+  TraceSink* sink;
+  const char* name;
+  const char* category;
+};
+
+}  // namespace tracing
+
+}  // namespace fcl
+}  // namespace hpp
+
+#ifdef HPP_FCL_ENABLE_TRACING
+#define HPP_FCL_TRACE_SPAN(name, category) \
+  ::hpp::fcl::tracing::TraceSpan hpp_fcl_trace_span(name, category)
+#else
+#define HPP_FCL_TRACE_SPAN(name, category)
+#endif
+
+#endif
@@ -0,0 +1,118 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HPP_FCL_WORKSPACE_H
+#define HPP_FCL_WORKSPACE_H
+
+#include <utility>
+#include <vector>
+
+#include <hpp/fcl/fwd.hh>
+#include <hpp/fcl/narrowphase/gjk.h>
+
+namespace hpp {
+namespace fcl {
+
+/// @brief Scratch memory of the queries run in a thread.
+///
+/// While a workspace is bound to a thread, the queries run in this thread
+/// take their temporary buffers from it instead of allocating them: the
+/// polytope of EPA, the visited vertices of the support function of large
+/// convex objects, the vertices bounding the shapes whose bounding volume is
+/// fitted, the stack of the non-recursive BVH traversal and the blocks of the
+/// signed distance fields searched against shapes. The buffers grow to the
+/// size required by the queries and are never shrunk, so that, once the
+/// queries were run once, running them again performs no heap allocation.
+/// This requires as well to reuse the result objects, whose contacts keep
+/// their capacity when cleared.
+///
+/// The queries between BVH models whose bounding volumes are not
+/// orientation-aware (AABB and KDOP) copy the models and always allocate.
+///
+/// \code
+/// QueryWorkspace workspace;
+/// QueryWorkspace::Scope scope(workspace);
+/// // collide and distance calls of this thread use the workspace.
+/// \endcode
+class HPP_FCL_DLLAPI QueryWorkspace {
+ public:
+  QueryWorkspace() {}
+
+  /// @brief Workspace bound to the calling thread, or NULL.
+  static QueryWorkspace* current();
+
+  /// @brief Bind a workspace to the calling thread for the lifetime of the
+  /// object. The previously bound workspace is restored at destruction.
+  class HPP_FCL_DLLAPI Scope {
+   public:
+    explicit Scope(QueryWorkspace& workspace);
+    ~Scope();
+
+   private:
+    Scope(const Scope&);
+    Scope& operator=(const Scope&);
+
+    QueryWorkspace* previous;
+  };
+
+  /// @brief vertices and faces of the polytope of EPA
+  std::vector<details::EPA::SimplexV> epa_vertices;
+  std::vector<details::EPA::SimplexF> epa_faces;
+
+  /// @brief vertices visited by the support function of convex objects
+  std::vector<int8_t> visited;
+
+  /// @brief vertices bounding a shape, to fit its bounding volume
+  std::vector<Vec3f> bound_vertices;
+
+  /// @brief points projected on the axes of an RSS being fitted
+  std::vector<FCL_REAL> rss_points;
+
+  /// @brief stack of the non-recursive collision traversal
+  std::vector<std::pair<unsigned int, unsigned int> > bv_pairs;
+
+  /// @brief heap of the blocks of a signed distance field searched against a
+  /// shape, by lower bound, level and index
+  std::vector<std::pair<FCL_REAL, std::pair<int, Eigen::DenseIndex> > >
+      sdf_blocks;
+
+ private:
+  QueryWorkspace(const QueryWorkspace&);
+  QueryWorkspace& operator=(const QueryWorkspace&);
+};
+
+}  // namespace fcl
+}  // namespace hpp
+
+#endif
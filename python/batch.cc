@@ -0,0 +1,270 @@
+//
+// Software License Agreement (BSD License)
+//
+//  Copyright (c) 2026 INRIA
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//   * Neither the name of CNRS-LAAS. nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+//  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+//  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+//  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+//  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+//  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//  POSSIBILITY OF SUCH DAMAGE.
+
+#include <eigenpy/eigenpy.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#include <hpp/fcl/fwd.hh>
+#include <hpp/fcl/batch.h>
+
+#include "fcl.hh"
+#include "buffer.hh"
+#include "gil.hh"
+
+using namespace boost::python;
+using namespace hpp::fcl;
+using namespace hpp::fcl::python;
+
+namespace {
+typedef Eigen::Matrix<bool, Eigen::Dynamic, 1> VectorXb;
+typedef Eigen::Matrix<FCL_REAL, Eigen::Dynamic, 1> VectorXr;
+typedef Eigen::Matrix<FCL_REAL, Eigen::Dynamic, 3, Eigen::RowMajor>
+    RowMatrixX3;
+
+/// Read poses from a buffer of Scalar values.
+template <typename Scalar>
+std::vector<Transform3f> readTransforms(const Py_buffer& view) {
+  const Scalar* data = static_cast<const Scalar*>(view.buf);
+  std::vector<Transform3f> transforms;
+  if (view.ndim == 2 && view.shape[1] == 7) {
+    transforms.resize((std::size_t)view.shape[0]);
+    for (std::size_t i = 0; i < transforms.size(); ++i, data += 7) {
+      const Quaternion3f q((FCL_REAL)data[6], (FCL_REAL)data[3],
+                           (FCL_REAL)data[4], (FCL_REAL)data[5]);
+      transforms[i].setTransform(
+          q.normalized(),
+          Vec3f((FCL_REAL)data[0], (FCL_REAL)data[1], (FCL_REAL)data[2]));
+    }
+  } else if (view.ndim == 3 && view.shape[1] == 4 && view.shape[2] == 4) {
+    transforms.resize((std::size_t)view.shape[0]);
+    for (std::size_t i = 0; i < transforms.size(); ++i, data += 16) {
+      Matrix3f R;
+      R << (FCL_REAL)data[0], (FCL_REAL)data[1], (FCL_REAL)data[2],
+          (FCL_REAL)data[4], (FCL_REAL)data[5], (FCL_REAL)data[6],
+          (FCL_REAL)data[8], (FCL_REAL)data[9], (FCL_REAL)data[10];
+      transforms[i].setTransform(
+          R, Vec3f((FCL_REAL)data[3], (FCL_REAL)data[7], (FCL_REAL)data[11]));
+    }
+  } else
+    throw std::invalid_argument(
+        "the poses must be of shape (N, 7) or (N, 4, 4).");
+  return transforms;
+}
+
+/// Read poses from an array of shape (N, 7), made of translations and
+/// quaternions (x, y, z, w), or of shape (N, 4, 4), made of homogeneous
+/// matrices.
+std::vector<Transform3f> readTransforms(const object& array) {
+  const Buffer buffer(array);
+  const Py_buffer& view = buffer.view;
+  if (buffer.type() == 'd' && view.itemsize == sizeof(double))
+    return readTransforms<double>(view);
+  if (buffer.type() == 'f' && view.itemsize == sizeof(float))
+    return readTransforms<float>(view);
+  throw std::invalid_argument(
+      "the poses must be an array of float64 or float32.");
+}
+
+/// Read pairs of indices from an integer array of shape (M, 2).
+std::vector<std::pair<std::size_t, std::size_t> > readPairs(
+    const object& array, std::size_t num_geometries) {
+  const Buffer buffer(array);
+  const Py_buffer& view = buffer.view;
+  const char type = buffer.type();
+  if ((type != 'i' && type != 'l' && type != 'q') ||
+      (view.itemsize != 4 && view.itemsize != 8))
+    throw std::invalid_argument("the pairs must be an array of integers.");
+  if (view.ndim != 2 || view.shape[1] != 2)
+    throw std::invalid_argument("the pairs must be of shape (M, 2).");
+
+  std::vector<std::pair<std::size_t, std::size_t> > pairs(
+      (std::size_t)view.shape[0]);
+  for (std::size_t i = 0; i < pairs.size(); ++i) {
+    long long index[2];
+    for (std::size_t k = 0; k < 2; ++k) {
+      if (view.itemsize == 4)
+        index[k] = static_cast<const int32_t*>(view.buf)[2 * i + k];
+      else
+        index[k] = static_cast<const int64_t*>(view.buf)[2 * i + k];
+      if (index[k] < 0 || (std::size_t)index[k] >= num_geometries)
+        throw std::out_of_range("a pair refers to an unknown geometry.");
+    }
+    pairs[i] = std::make_pair((std::size_t)index[0], (std::size_t)index[1]);
+  }
+  return pairs;
+}
+
+/// Queries of a geometry pair for each pose pair. A single pose is used for
+/// every query, so that a single pose and no pose give no query, as numpy
+/// broadcasting does.
+std::vector<BatchQuery> makeQueries(const CollisionGeometry* o1,
+                                    const CollisionGeometry* o2,
+                                    const object& tf1, const object& tf2) {
+  const std::vector<Transform3f> tfs1(readTransforms(tf1)),
+      tfs2(readTransforms(tf2));
+  if (tfs1.size() != tfs2.size() && tfs1.size() != 1 && tfs2.size() != 1)
+    throw std::invalid_argument("the numbers of poses differ.");
+
+  std::vector<BatchQuery> queries(tfs1.size() == 1 ? tfs2.size()
+                                                   : tfs1.size());
+  for (std::size_t i = 0; i < queries.size(); ++i)
+    queries[i] = BatchQuery(o1, tfs1[tfs1.size() == 1 ? 0 : i], o2,
+                            tfs2[tfs2.size() == 1 ? 0 : i]);
+  return queries;
+}
+
+/// Queries of pairs of geometries, each geometry having its pose.
+std::vector<BatchQuery> makeQueries(const list& geometries,
+                                    const object& transforms,
+                                    const object& pairs) {
+  const std::size_t num_geometries = (std::size_t)len(geometries);
+  std::vector<const CollisionGeometry*> objects(num_geometries);
+  for (std::size_t i = 0; i < num_geometries; ++i)
+    objects[i] = extract<const CollisionGeometry*>(geometries[i]);
+  const std::vector<Transform3f> tfs(readTransforms(transforms));
+  if (tfs.size() != num_geometries)
+    throw std::invalid_argument("there must be one pose per geometry.");
+
+  const std::vector<std::pair<std::size_t, std::size_t> > indices(
+      readPairs(pairs, num_geometries));
+  std::vector<BatchQuery> queries(indices.size());
+  for (std::size_t i = 0; i < queries.size(); ++i) {
+    const std::size_t a = indices[i].first, b = indices[i].second;
+    queries[i] = BatchQuery(objects[a], tfs[a], objects[b], tfs[b]);
+  }
+  return queries;
+}
+
+/// Run the collision checks without the GIL and return the collision flags
+/// and the distance lower bounds.
+tuple collide(const std::vector<BatchQuery>& queries,
+              const CollisionRequest& request, unsigned int num_threads) {
+  std::vector<CollisionResult> results;
+  {
+    GILRelease release;
+    collideBatch(queries, request, results, num_threads);
+  }
+  VectorXb collisions(results.size());
+  VectorXr distance_lower_bounds(results.size());
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    collisions[(Eigen::DenseIndex)i] = results[i].isCollision();
+    distance_lower_bounds[(Eigen::DenseIndex)i] =
+        results[i].distance_lower_bound;
+  }
+  return make_tuple(collisions, distance_lower_bounds);
+}
+
+/// Run the distance computations without the GIL and return the distances
+/// and the nearest points.
+tuple distance(const std::vector<BatchQuery>& queries,
+               const DistanceRequest& request, unsigned int num_threads) {
+  std::vector<DistanceResult> results;
+  {
+    GILRelease release;
+    distanceBatch(queries, request, results, num_threads);
+  }
+  VectorXr distances(results.size());
+  RowMatrixX3 points1(results.size(), 3), points2(results.size(), 3);
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    const Eigen::DenseIndex row = (Eigen::DenseIndex)i;
+    distances[row] = results[i].min_distance;
+    points1.row(row) = results[i].nearest_points[0];
+    points2.row(row) = results[i].nearest_points[1];
+  }
+  return make_tuple(distances, points1, points2);
+}
+
+tuple collidePoses(const CollisionGeometry* o1, const CollisionGeometry* o2,
+                   const object& tf1, const object& tf2,
+                   const CollisionRequest& request, unsigned int num_threads) {
+  return collide(makeQueries(o1, o2, tf1, tf2), request, num_threads);
+}
+
+tuple collidePairs(const list& geometries, const object& transforms,
+                   const object& pairs, const CollisionRequest& request,
+                   unsigned int num_threads) {
+  return collide(makeQueries(geometries, transforms, pairs), request,
+                 num_threads);
+}
+
+tuple distancePoses(const CollisionGeometry* o1, const CollisionGeometry* o2,
+                    const object& tf1, const object& tf2,
+                    const DistanceRequest& request, unsigned int num_threads) {
+  return distance(makeQueries(o1, o2, tf1, tf2), request, num_threads);
+}
+
+tuple distancePairs(const list& geometries, const object& transforms,
+                    const object& pairs, const DistanceRequest& request,
+                    unsigned int num_threads) {
+  return distance(makeQueries(geometries, transforms, pairs), request,
+                  num_threads);
+}
+}  // namespace
+
+void exposeBatchAPI() {
+  eigenpy::enableEigenPySpecific<VectorXb>();
+  eigenpy::enableEigenPySpecific<RowMatrixX3>();
+
+  def("collideBatch", &collidePoses,
+      (arg("o1"), arg("o2"), arg("tf1"), arg("tf2"),
+       arg("request") = CollisionRequest(), arg("num_threads") = 0),
+      "Collision checks between two geometries for each pair of poses,\n"
+      "run in parallel without the GIL.\n"
+      "The poses are arrays of float64 or float32 of shape (N, 7), made of\n"
+      "translations and quaternions (x, y, z, w), or of shape (N, 4, 4).\n"
+      "A single pose is used for every query.\n"
+      "Return the collision flags and the distance lower bounds.");
+  def("collideBatch", &collidePairs,
+      (arg("geometries"), arg("transforms"), arg("pairs"),
+       arg("request") = CollisionRequest(), arg("num_threads") = 0),
+      "Collision checks between pairs of geometries, run in parallel without\n"
+      "the GIL.\n"
+      "The transforms hold the pose of each geometry, and pairs is an\n"
+      "integer array of shape (M, 2) of indices of geometries.\n"
+      "Return the collision flags and the distance lower bounds.");
+  def("distanceBatch", &distancePoses,
+      (arg("o1"), arg("o2"), arg("tf1"), arg("tf2"),
+       arg("request") = DistanceRequest(), arg("num_threads") = 0),
+      "Distances between two geometries for each pair of poses, computed in\n"
+      "parallel without the GIL. The poses are given as in collideBatch.\n"
+      "Return the distances and the nearest points of both geometries.");
+  def("distanceBatch", &distancePairs,
+      (arg("geometries"), arg("transforms"), arg("pairs"),
+       arg("request") = DistanceRequest(), arg("num_threads") = 0),
+      "Distances between pairs of geometries, computed in parallel without\n"
+      "the GIL. The pairs are given as in collideBatch.\n"
+      "Return the distances and the nearest points of both geometries.");
+}
@@ -42,6 +42,8 @@
 #include "hpp/fcl/broadphase/broadphase_SSaP.h"
 #include "hpp/fcl/broadphase/broadphase_interval_tree.h"
 #include "hpp/fcl/broadphase/broadphase_spatialhash.h"
+#include "hpp/fcl/broadphase/broadphase_hierarchical_spatialhash.h"
+#include "hpp/fcl/broadphase/broadphase_radix_SaP.h"
 
 #ifdef HPP_FCL_HAS_DOXYGEN_AUTODOC
 #include "doxygen_autodoc/functions.h"
@@ -61,10 +63,27 @@
 
 using namespace hpp::fcl;
 
+/// Convert the pairs collected by the callbacks into a list of tuples of
+/// CollisionObject. The objects are referenced, not copied.
+struct CollisionPairsToPython {
+  typedef std::pair<CollisionObject *, CollisionObject *> CollisionPair;
+
+  static PyObject *convert(const std::vector<CollisionPair> &pairs) {
+    bp::list list;
+    for (std::size_t i = 0; i < pairs.size(); ++i)
+      list.append(
+          bp::make_tuple(bp::ptr(pairs[i].first), bp::ptr(pairs[i].second)));
+    return bp::incref(list.ptr());
+  }
+};
+
 void exposeBroadPhase() {
   CollisionCallBackBaseWrapper::expose();
   DistanceCallBackBaseWrapper::expose();
 
+  bp::to_python_converter<std::vector<CollisionPairsToPython::CollisionPair>,
+                          CollisionPairsToPython>();
+
   // CollisionCallBackDefault
   bp::class_<CollisionCallBackDefault, bp::bases<CollisionCallBackBase> >(
       "CollisionCallBackDefault", bp::no_init)
@@ -86,6 +105,16 @@ void exposeBroadPhase() {
                        bp::return_value_policy<bp::copy_const_reference>())
       .DEF_CLASS_FUNC(CollisionCallBackCollect, exist);
 
+  // CollisionCallBackCollectColliding
+  bp::class_<CollisionCallBackCollectColliding,
+             bp::bases<CollisionCallBackBase> >(
+      "CollisionCallBackCollectColliding", bp::no_init)
+      .def(dv::init<CollisionCallBackCollectColliding,
+                    bp::optional<const CollisionRequest &> >())
+      .DEF_CLASS_FUNC2(CollisionCallBackCollectColliding, getCollisionPairs,
+                       bp::return_value_policy<bp::copy_const_reference>())
+      .DEF_RW_CLASS_ATTRIB(CollisionCallBackCollectColliding, request);
+
   bp::class_<CollisionData>("CollisionData", bp::no_init)
       .def(dv::init<CollisionData>())
       .DEF_RW_CLASS_ATTRIB(CollisionData, request)
@@ -98,18 +127,57 @@ void exposeBroadPhase() {
       .DEF_RW_CLASS_ATTRIB(DistanceData, result)
       .DEF_RW_CLASS_ATTRIB(DistanceData, done);
 
+  eigenpy::enableEigenPySpecific<
+      BroadPhaseCollisionManagerWrapper::IndexPairs>();
   BroadPhaseCollisionManagerWrapper::expose();
 
-  BroadPhaseCollisionManagerWrapper::exposeDerived<
-      DynamicAABBTreeCollisionManager>();
-  BroadPhaseCollisionManagerWrapper::exposeDerived<
-      DynamicAABBTreeArrayCollisionManager>();
+  {
+    typedef DynamicAABBTreeCollisionManager Derived;
+    bp::class_<Derived, bp::bases<BroadPhaseCollisionManager> >(
+        "DynamicAABBTreeCollisionManager", bp::no_init)
+        .def(dv::init<Derived>())
+        .def("registerStaticObjects", &Derived::registerStaticObjects,
+             bp::with_custodian_and_ward_postcall<1, 2>())
+        .def("registerStaticObject", &Derived::registerStaticObject,
+             bp::with_custodian_and_ward_postcall<1, 2>())
+        .def("isStatic", &Derived::isStatic)
+        .def("setVelocity", &Derived::setVelocity)
+        .def_readwrite("fat_aabb_margin", &Derived::fat_aabb_margin);
+  }
+  {
+    typedef DynamicAABBTreeArrayCollisionManager Derived;
+    bp::class_<Derived, bp::bases<BroadPhaseCollisionManager> >(
+        "DynamicAABBTreeArrayCollisionManager", bp::no_init)
+        .def(dv::init<Derived>())
+        .def("setVelocity", &Derived::setVelocity)
+        .def_readwrite("fat_aabb_margin", &Derived::fat_aabb_margin);
+  }
   BroadPhaseCollisionManagerWrapper::exposeDerived<
       IntervalTreeCollisionManager>();
   BroadPhaseCollisionManagerWrapper::exposeDerived<SSaPCollisionManager>();
   BroadPhaseCollisionManagerWrapper::exposeDerived<SaPCollisionManager>();
   BroadPhaseCollisionManagerWrapper::exposeDerived<NaiveCollisionManager>();
 
+  {
+    typedef RadixSaPCollisionManager Derived;
+    bp::class_<Derived, bp::bases<BroadPhaseCollisionManager> >(
+        "RadixSaPCollisionManager", bp::no_init)
+        .def(dv::init<Derived>())
+        .def("getSweepAxis", &Derived::getSweepAxis)
+        .def_readwrite("max_insertion_sort_ratio",
+                       &Derived::max_insertion_sort_ratio);
+  }
+
+  {
+    typedef HierarchicalSpatialHashingCollisionManager Derived;
+    bp::class_<Derived, bp::bases<BroadPhaseCollisionManager> >(
+        "HierarchicalSpatialHashingCollisionManager", bp::no_init)
+        .def(dv::init<Derived, bp::optional<FCL_REAL, FCL_REAL> >())
+        .def("numLevels", &Derived::numLevels)
+        .def("getMinCellSize", &Derived::getMinCellSize)
+        .def("getLevelRatio", &Derived::getLevelRatio);
+  }
+
   // Specific case of SpatialHashingCollisionManager
   {
     typedef detail::SimpleHashTable<AABB, CollisionObject *,
@@ -50,6 +50,11 @@
 
 #include <boost/algorithm/string/replace.hpp>
 
+#include <algorithm>
+#include <map>
+
+#include "../gil.hh"
+
 namespace hpp {
 namespace fcl {
 
@@ -57,6 +62,8 @@ struct BroadPhaseCollisionManagerWrapper
     : BroadPhaseCollisionManager,
       bp::wrapper<BroadPhaseCollisionManager> {
   typedef BroadPhaseCollisionManager Base;
+  typedef Eigen::Matrix<Eigen::DenseIndex, Eigen::Dynamic, 2, Eigen::RowMajor>
+      IndexPairs;
 
   void registerObjects(const std::vector<CollisionObject *> &other_objs) {
     this->get_override("registerObjects")(other_objs);
@@ -119,6 +126,59 @@ struct BroadPhaseCollisionManagerWrapper
 #pragma GCC diagnostic pop
   }
 
+  /// @brief Pairs of indices of the objects in collision, sorted by
+  /// increasing indices.
+  ///
+  /// The broad phase and the narrow phase run without the GIL, unless the
+  /// manager is implemented in Python. The registered objects and their
+  /// geometries must therefore not be instances of Python subclasses
+  /// overriding methods called by the collision checks, since these
+  /// overrides would run without the GIL.
+  static IndexPairs collidingPairs(const Base &self,
+                                   const CollisionRequest &request,
+                                   const bp::object &objects) {
+    std::vector<CollisionObject *> objs;
+    if (objects.is_none())
+      self.getObjects(objs);
+    else {
+      const std::size_t num_objects = (std::size_t)bp::len(objects);
+      objs.resize(num_objects);
+      for (std::size_t i = 0; i < num_objects; ++i)
+        objs[i] = bp::extract<CollisionObject *>(objects[i]);
+    }
+    std::map<const CollisionObject *, Eigen::DenseIndex> indices;
+    for (std::size_t i = 0; i < objs.size(); ++i)
+      indices[objs[i]] = (Eigen::DenseIndex)i;
+
+    CollisionCallBackCollectColliding callback(request);
+    if (dynamic_cast<const BroadPhaseCollisionManagerWrapper *>(&self))
+      self.collide(&callback);
+    else {
+      python::GILRelease release;
+      self.collide(&callback);
+    }
+
+    const std::vector<CollisionCallBackCollectColliding::CollisionPair>
+        &collision_pairs = callback.getCollisionPairs();
+    std::vector<std::pair<Eigen::DenseIndex, Eigen::DenseIndex> > pairs(
+        collision_pairs.size());
+    for (std::size_t i = 0; i < pairs.size(); ++i) {
+      std::map<const CollisionObject *, Eigen::DenseIndex>::const_iterator
+          first = indices.find(collision_pairs[i].first),
+          second = indices.find(collision_pairs[i].second);
+      if (first == indices.end() || second == indices.end())
+        throw std::invalid_argument(
+            "a colliding object is missing from the objects.");
+      pairs[i] = std::minmax(first->second, second->second);
+    }
+    std::sort(pairs.begin(), pairs.end());
+
+    IndexPairs res((Eigen::DenseIndex)pairs.size(), 2);
+    for (std::size_t i = 0; i < pairs.size(); ++i)
+      res.row((Eigen::DenseIndex)i) << pairs[i].first, pairs[i].second;
+    return res;
+  }
+
   static void expose() {
     bp::class_<BroadPhaseCollisionManagerWrapper, boost::noncopyable>(
         "BroadPhaseCollisionManager", bp::no_init)
@@ -209,7 +269,18 @@ struct BroadPhaseCollisionManagerWrapper
              doxygen::member_func_doc(
                  (void(Base::*)(BroadPhaseCollisionManager *,
                                 DistanceCallBackBase *) const) &
-                 Base::distance));
+                 Base::distance))
+
+        .def("collidingPairs", &collidingPairs,
+             (bp::arg("self"), bp::arg("request") = CollisionRequest(),
+              bp::arg("objects") = bp::object()),
+             "Collision checks between all the pairs of registered objects,\n"
+             "run without the GIL.\n"
+             "The objects and their geometries must not be instances of\n"
+             "Python subclasses overriding the methods used by the collision\n"
+             "checks, since they would be called without the GIL.\n"
+             "Return an array of shape (M, 2) with the indices of the objects\n"
+             "in collision in objects, getObjects() by default.");
   }
 
   template <typename Derived>
@@ -0,0 +1,135 @@
+//
+// Software License Agreement (BSD License)
+//
+//  Copyright (c) 2026 INRIA
+//  All rights reserved.
+//
+//  Redistribution and use in source and binary forms, with or without
+//  modification, are permitted provided that the following conditions
+//  are met:
+//
+//   * Redistributions of source code must retain the above copyright
+//     notice, this list of conditions and the following disclaimer.
+//   * Redistributions in binary form must reproduce the above
+//     copyright notice, this list of conditions and the following
+//     disclaimer in the documentation and/or other materials provided
+//     with the distribution.
+//   * Neither the name of CNRS-LAAS. nor the names of its
+//     contributors may be used to endorse or promote products derived
+//     from this software without specific prior written permission.
+//
+//  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+//  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+//  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+//  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+//  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+//  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+//  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+//  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+//  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+//  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+//  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+//  POSSIBILITY OF SUCH DAMAGE.
+
+
+#include "buffer.hh"
+
+namespace hpp {
+namespace fcl {
+namespace python {
+
+namespace {
+/// Python object exposing a matrix through the buffer protocol, which keeps
+/// the owner of the matrix alive.
+struct ArrayView {
+  PyObject ob_base;
+  PyObject* owner;
+  void* data;
+  Py_ssize_t shape[2];
+  Py_ssize_t strides[2];
+  Py_ssize_t itemsize;
+  char format[2];
+  bool readonly;
+  bool c_contiguous;
+};
+
+int getArrayViewBuffer(PyObject* self, Py_buffer* view, int flags) {
+  ArrayView* array = reinterpret_cast<ArrayView*>(self);
+  if ((flags & PyBUF_WRITABLE) == PyBUF_WRITABLE && array->readonly) {
+    PyErr_SetString(PyExc_BufferError, "the array is read-only.");
+    view->obj = NULL;
+    return -1;
+  }
+  if ((flags & PyBUF_STRIDES) != PyBUF_STRIDES && !array->c_contiguous) {
+    PyErr_SetString(PyExc_BufferError, "the array is not C-contiguous.");
+    view->obj = NULL;
+    return -1;
+  }
+  view->buf = array->data;
+  view->obj = self;
+  Py_INCREF(self);
+  view->len = array->shape[0] * array->shape[1] * array->itemsize;
+  view->readonly = array->readonly;
+  view->itemsize = array->itemsize;
+  view->format = (flags & PyBUF_FORMAT) ? array->format : NULL;
+  view->ndim = 2;
+  view->shape = (flags & PyBUF_ND) ? array->shape : NULL;
+  view->strides = (flags & PyBUF_STRIDES) ? array->strides : NULL;
+  view->suboffsets = NULL;
+  view->internal = NULL;
+  return 0;
+}
+
+void deallocArrayView(PyObject* self) {
+  Py_XDECREF(reinterpret_cast<ArrayView*>(self)->owner);
+  Py_TYPE(self)->tp_free(self);
+}
+
+PyTypeObject* arrayViewType() {
+  static PyBufferProcs buffer_procs;
+  static PyTypeObject type;
+  if (type.tp_name == NULL) {
+    // The type is never released.
+    Py_INCREF(reinterpret_cast<PyObject*>(&type));
+    buffer_procs.bf_getbuffer = &getArrayViewBuffer;
+    type.tp_name = "hppfcl.ArrayView";
+    type.tp_basicsize = sizeof(ArrayView);
+    type.tp_dealloc = &deallocArrayView;
+    type.tp_as_buffer = &buffer_procs;
+    type.tp_flags = Py_TPFLAGS_DEFAULT;
+    type.tp_doc = "Matrix stored by another object.";
+    if (PyType_Ready(&type) != 0) {
+      type.tp_name = NULL;
+      boost::python::throw_error_already_set();
+    }
+  }
+  return &type;
+}
+}  // namespace
+
+boost::python::object makeArrayView(const boost::python::object& owner,
+                                    void* data, Py_ssize_t rows,
+                                    Py_ssize_t cols, char format,
+                                    Py_ssize_t itemsize, bool row_major,
+                                    bool readonly) {
+  ArrayView* array = PyObject_New(ArrayView, arrayViewType());
+  if (array == NULL) boost::python::throw_error_already_set();
+  array->owner = boost::python::incref(owner.ptr());
+  array->data = data;
+  array->shape[0] = rows;
+  array->shape[1] = cols;
+  array->strides[0] = row_major ? cols * itemsize : itemsize;
+  array->strides[1] = row_major ? itemsize : rows * itemsize;
+  array->itemsize = itemsize;
+  array->format[0] = format;
+  array->format[1] = 0;
+  array->readonly = readonly;
+  array->c_contiguous = row_major || cols == 1;
+  const boost::python::object view(
+      (boost::python::handle<>(reinterpret_cast<PyObject*>(array))));
+  return boost::python::import("numpy").attr("asarray")(view);
+}
+
+}  // namespace python
+}  // namespace fcl
+}  // namespace hpp
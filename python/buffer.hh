@@ -0,0 +1,69 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#ifndef HPP_FCL_PYTHON_BUFFER_HH
+#define HPP_FCL_PYTHON_BUFFER_HH
+
+#include <cstring>
+
+#include <boost/python.hpp>
+
+namespace hpp {
+namespace fcl {
+namespace python {
+
+/// @brief Type code of the elements of a buffer, without byte order.
+inline char bufferType(const Py_buffer& view) {
+  const std::size_t length = view.format ? std::strlen(view.format) : 0;
+  return length > 0 ? view.format[length - 1] : 0;
+}
+
+/// @brief View on the C-contiguous buffer of an object, e.g. a NumPy array.
+struct Buffer {
+  Py_buffer view;
+
+  explicit Buffer(const boost::python::object& array,
+                  int flags = PyBUF_C_CONTIGUOUS) {
+    if (PyObject_GetBuffer(array.ptr(), &view, flags | PyBUF_FORMAT) != 0)
+      boost::python::throw_error_already_set();
+  }
+
+  ~Buffer() { PyBuffer_Release(&view); }
+
+  /// Type code of the elements, without byte order.
+  char type() const { return bufferType(view); }
+
+ private:
+  Buffer(const Buffer&);
+  Buffer& operator=(const Buffer&);
+};
+
+/// @brief NumPy array on a matrix stored by a Python object, without copy.
+///
+/// The array keeps the owner alive.
+/// \param owner the object which stores the matrix.
+/// \param data, rows, cols the matrix.
+/// \param format, itemsize the type of the coefficients, as in the struct
+///        module.
+/// \param row_major whether the coefficients are stored row by row.
+/// \param readonly whether the array can be modified.
+boost::python::object makeArrayView(const boost::python::object& owner,
+                                    void* data, Py_ssize_t rows,
+                                    Py_ssize_t cols, char format,
+                                    Py_ssize_t itemsize, bool row_major,
+                                    bool readonly);
+
+/// @brief Buffer format of an unsigned integer type.
+template <typename T>
+char unsignedFormat() {
+  return sizeof(T) == sizeof(unsigned long long)
+             ? (sizeof(T) == sizeof(unsigned long) ? 'L' : 'Q')
+             : (sizeof(T) == sizeof(unsigned int) ? 'I' : 'H');
+}
+
+}  // namespace python
+}  // namespace fcl
+}  // namespace hpp
+
+#endif  // ifndef HPP_FCL_PYTHON_BUFFER_HH
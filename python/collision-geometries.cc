@@ -35,14 +35,22 @@
 #include <eigenpy/eigenpy.hpp>
 #include <eigenpy/eigen-to-python.hpp>
 
+#include <cctype>
+#include <cstring>
+#include <sstream>
+
 #include "fcl.hh"
+#include "buffer.hh"
 #include "deprecation.hh"
+#include "gil.hh"
 
 #include <hpp/fcl/fwd.hh>
 #include <hpp/fcl/shape/geometric_shapes.h>
 #include <hpp/fcl/shape/convex.h>
 #include <hpp/fcl/BVH/BVH_model.h>
 #include <hpp/fcl/hfield.h>
+#include <hpp/fcl/linear_octree.h>
+#include <hpp/fcl/sdf.h>
 #include <hpp/fcl/serialization/memory.h>
 #include <hpp/fcl/serialization/BVH_model.h>
 
@@ -55,12 +63,15 @@
 #include "doxygen_autodoc/hpp/fcl/BVH/BVH_model.h"
 #include "doxygen_autodoc/hpp/fcl/BV/AABB.h"
 #include "doxygen_autodoc/hpp/fcl/hfield.h"
+#include "doxygen_autodoc/hpp/fcl/linear_octree.h"
+#include "doxygen_autodoc/hpp/fcl/sdf.h"
 #include "doxygen_autodoc/hpp/fcl/shape/geometric_shapes.h"
 #include "doxygen_autodoc/functions.h"
 #endif
 
 using namespace boost::python;
 using namespace hpp::fcl;
+using namespace hpp::fcl::python;
 namespace dv = doxygen::visitor;
 namespace bp = boost::python;
 
@@ -69,8 +80,121 @@ using boost::noncopyable;
 typedef std::vector<Vec3f> Vec3fs;
 typedef std::vector<Triangle> Triangles;
 
+/// Buffers of Python objects on which a geometry is built, held as long as the
+/// geometry.
+struct PythonStorage {
+  PythonStorage() : num_buffers(0) {}
+
+  ~PythonStorage() {
+    if (num_buffers == 0 || !Py_IsInitialized()) return;
+    const PyGILState_STATE state = PyGILState_Ensure();
+    for (int i = 0; i < num_buffers; ++i) PyBuffer_Release(&buffers[i]);
+    PyGILState_Release(state);
+  }
+
+  /// Points stored in a writable float array of shape (N, 3).
+  Vec3f* points(const object& array, unsigned int& num_points) {
+    const Py_buffer& view =
+        acquire(array, PyBUF_C_CONTIGUOUS | PyBUF_WRITABLE | PyBUF_FORMAT);
+    if (bufferType(view) != (sizeof(FCL_REAL) == sizeof(double) ? 'd' : 'f') ||
+        view.itemsize != sizeof(FCL_REAL))
+      throw std::invalid_argument(
+          "the points must be an array of the floating point type of the "
+          "library.");
+    if (view.ndim != 2 || view.shape[1] != 3)
+      throw std::invalid_argument("the points must be of shape (N, 3).");
+    num_points = (unsigned int)view.shape[0];
+    return static_cast<Vec3f*>(view.buf);
+  }
+
+  /// Triangles stored in an integer array of shape (M, 3). They are copied
+  /// when the integers do not have the size of Triangle::index_type, and are
+  /// checked to be non negative before the array is shared otherwise.
+  Triangle* triangles(const object& array, unsigned int& num_triangles) {
+    const Py_buffer& view = acquire(array, PyBUF_C_CONTIGUOUS | PyBUF_FORMAT);
+    const char type = bufferType(view);
+    if (type == 0 || std::strchr("bBhHiIlLqQnN", type) == NULL)
+      throw std::invalid_argument(
+          "the triangles must be an array of integers.");
+    if (view.ndim != 2 || view.shape[1] != 3)
+      throw std::invalid_argument("the triangles must be of shape (M, 3).");
+    num_triangles = (unsigned int)view.shape[0];
+    const bool is_signed = std::islower(type) != 0;
+    const bool is_shared = view.itemsize == sizeof(Triangle::index_type);
+    if (!is_shared) copied_triangles.resize(num_triangles);
+
+    const char* data = static_cast<const char*>(view.buf);
+    for (unsigned int i = 0; i < num_triangles; ++i)
+      for (Triangle::index_type k = 0; k < 3; ++k, data += view.itemsize) {
+        long long index;
+        // Each branch is converted on its own, since the conditional operator
+        // would convert a signed 32 bits index to an unsigned one.
+        switch (view.itemsize) {
+          case 1:
+            if (is_signed)
+              index = *(const int8_t*)data;
+            else
+              index = *(const uint8_t*)data;
+            break;
+          case 2:
+            if (is_signed)
+              index = *(const int16_t*)data;
+            else
+              index = *(const uint16_t*)data;
+            break;
+          case 4:
+            if (is_signed)
+              index = *(const int32_t*)data;
+            else
+              index = *(const uint32_t*)data;
+            break;
+          default:
+            index = *(const int64_t*)data;
+        }
+        // An unsigned 64 bits index above the range of long long is read as
+        // a negative one.
+        if (index < 0) {
+          std::ostringstream oss;
+          oss << "the index " << k << " of the triangle " << i << " is "
+              << (is_signed ? "negative." : "too large.");
+          throw std::invalid_argument(oss.str());
+        }
+        if (!is_shared) copied_triangles[i][k] = (Triangle::index_type)index;
+      }
+    if (is_shared) return static_cast<Triangle*>(view.buf);
+    return copied_triangles.data();
+  }
+
+ private:
+  PythonStorage(const PythonStorage&);
+  PythonStorage& operator=(const PythonStorage&);
+
+  const Py_buffer& acquire(const object& array, int flags) {
+    if (num_buffers == 2)
+      throw std::logic_error("a geometry is built on two arrays at most.");
+    if (PyObject_GetBuffer(array.ptr(), &buffers[num_buffers], flags) != 0)
+      throw_error_already_set();
+    return buffers[num_buffers++];
+  }
+
+  Py_buffer buffers[2];
+  int num_buffers;
+  Triangles copied_triangles;
+};
+
+/// Deleter of a geometry which also releases the storage of the geometry.
+template <typename T>
+struct DeleteWithStorage {
+  shared_ptr<PythonStorage> storage;
+
+  explicit DeleteWithStorage(const shared_ptr<PythonStorage>& storage)
+      : storage(storage) {}
+  void operator()(T* geometry) const { delete geometry; }
+};
+
 struct BVHModelBaseWrapper {
-  typedef Eigen::Matrix<double, Eigen::Dynamic, 3, Eigen::RowMajor> RowMatrixX3;
+  typedef Eigen::Matrix<FCL_REAL, Eigen::Dynamic, 3, Eigen::RowMajor>
+      RowMatrixX3;
   typedef Eigen::Map<RowMatrixX3> MapRowMatrixX3;
   typedef Eigen::Ref<RowMatrixX3> RefRowMatrixX3;
 
@@ -87,6 +211,42 @@ struct BVHModelBaseWrapper {
     if (i >= bvh.num_tris) throw std::out_of_range("index is out of range");
     return bvh.tri_indices[i];
   }
+
+  static object triangles(const object& self) {
+    const BVHModelBase& bvh = extract<const BVHModelBase&>(self);
+    return makeArrayView(self, bvh.tri_indices, bvh.num_tris, 3,
+                         unsignedFormat<Triangle::index_type>(),
+                         sizeof(Triangle::index_type), true, true);
+  }
+};
+
+template <typename BV>
+struct BVHModelWrapper {
+  typedef BVHModel<BV> BVH;
+
+  static shared_ptr<BVH> constructor(const object& vertices,
+                                     const object& triangles) {
+    shared_ptr<PythonStorage> storage(new PythonStorage);
+    unsigned int num_vertices, num_tris = 0;
+    Vec3f* points = storage->points(vertices, num_vertices);
+    Triangle* tris = NULL;
+    if (!triangles.is_none()) tris = storage->triangles(triangles, num_tris);
+
+    shared_ptr<BVH> model(new BVH, DeleteWithStorage<BVH>(storage));
+    int result;
+    {
+      GILRelease release;
+      result = model->buildModel(false, points, num_vertices, tris, num_tris);
+      if (result == BVH_OK) model->computeLocalAABB();
+    }
+    if (result != BVH_OK)
+      throw std::invalid_argument("the BVH model could not be built.");
+    return model;
+  }
+
+  static shared_ptr<BVH> pointCloudConstructor(const object& vertices) {
+    return constructor(vertices, object());
+  }
 };
 
 template <typename BV>
@@ -96,6 +256,20 @@ void exposeBVHModel(const std::string& bvname) {
   const std::string type_name = "BVHModel" + bvname;
   class_<BVH, bases<BVHModelBase>, shared_ptr<BVH> >(
       type_name.c_str(), doxygen::class_doc<BVH>(), no_init)
+      .def("__init__",
+           make_constructor(&BVHModelWrapper<BV>::constructor,
+                            default_call_policies(),
+                            bp::args("vertices", "triangles")),
+           "Build the model on a float64 (float32 in single precision) "
+           "array of vertices of shape (N, 3) and an integer array of "
+           "triangles of shape (M, 3), without copying the vertices. The "
+           "arrays are held by the model.")
+      .def("__init__",
+           make_constructor(&BVHModelWrapper<BV>::pointCloudConstructor,
+                            default_call_policies(), bp::args("vertices")),
+           "Build a point cloud on a float64 (float32 in single precision) "
+           "array of vertices of shape (N, 3), without copying it. The "
+           "array is held by the model.")
       .def(dv::init<BVH>())
       .def(dv::init<BVH, const BVH&>())
       .DEF_CLASS_FUNC(BVH, getNumBVs)
@@ -105,6 +279,42 @@ void exposeBVHModel(const std::string& bvname) {
            return_value_policy<manage_new_object>());
 }
 
+template <typename BV>
+struct HeightFieldWrapper {
+  typedef HeightField<BV> Geometry;
+
+  struct Accessor : Geometry {
+    using Geometry::float_heights;
+    using Geometry::heights;
+    using Geometry::quantized_heights;
+  };
+
+  static object storedHeights(const object& self) {
+    const Geometry& hfield = extract<const Geometry&>(self);
+    switch (hfield.getStorage()) {
+      case HF_STORAGE_FLOAT: {
+        const Eigen::MatrixXf& values = hfield.*(&Accessor::float_heights);
+        return makeArrayView(self, (void*)values.data(), values.rows(),
+                             values.cols(), 'f', sizeof(float), false, true);
+      }
+      case HF_STORAGE_UINT16: {
+        const Eigen::Matrix<uint16_t, Eigen::Dynamic, Eigen::Dynamic>&
+            values = hfield.*(&Accessor::quantized_heights);
+        return makeArrayView(self, (void*)values.data(), values.rows(),
+                             values.cols(), unsignedFormat<uint16_t>(),
+                             sizeof(uint16_t), false, true);
+      }
+      default: {
+        const MatrixXf& values = hfield.*(&Accessor::heights);
+        return makeArrayView(
+            self, (void*)values.data(), values.rows(), values.cols(),
+            sizeof(FCL_REAL) == sizeof(double) ? 'd' : 'f', sizeof(FCL_REAL),
+            false, true);
+      }
+    }
+  }
+};
+
 template <typename BV>
 void exposeHeightField(const std::string& bvname) {
   typedef HeightField<BV> Geometry;
@@ -117,7 +327,7 @@ void exposeHeightField(const std::string& bvname) {
       .def(dv::init<HeightField<BV> >())
       .def(dv::init<HeightField<BV>, const HeightField<BV>&>())
       .def(dv::init<HeightField<BV>, FCL_REAL, FCL_REAL, const MatrixXf&,
-                    bp::optional<FCL_REAL> >())
+                    bp::optional<FCL_REAL, HeightFieldStorage> >())
 
       .DEF_CLASS_FUNC(Geometry, getXDim)
       .DEF_CLASS_FUNC(Geometry, getYDim)
@@ -125,6 +335,11 @@ void exposeHeightField(const std::string& bvname) {
       .DEF_CLASS_FUNC(Geometry, getMaxHeight)
       .DEF_CLASS_FUNC(Geometry, getNodeType)
       .DEF_CLASS_FUNC(Geometry, updateHeights)
+      .DEF_CLASS_FUNC(Geometry, updateHeightsBlock)
+      .DEF_CLASS_FUNC(Geometry, getHeight)
+      .DEF_CLASS_FUNC(Geometry, getStorage)
+      .DEF_CLASS_FUNC(Geometry, getHeightScale)
+      .DEF_CLASS_FUNC(Geometry, getHeightOffset)
 
       .def("clone", &Geometry::clone,
            doxygen::member_func_doc(&Geometry::clone),
@@ -135,9 +350,16 @@ void exposeHeightField(const std::string& bvname) {
       .def("getYGrid", &Geometry::getYGrid,
            doxygen::member_func_doc(&Geometry::getYGrid),
            bp::return_value_policy<bp::copy_const_reference>())
-      .def("getHeights", &Geometry::getHeights,
-           doxygen::member_func_doc(&Geometry::getHeights),
-           bp::return_value_policy<bp::copy_const_reference>())
+      // The heights are copied to Python anyway: decode them so that the
+      // compact storages are supported.
+      .def("getHeights", &Geometry::decodedHeights,
+           doxygen::member_func_doc(&Geometry::getHeights))
+      .DEF_CLASS_FUNC(Geometry, decodedHeights)
+      .def("storedHeights", &HeightFieldWrapper<BV>::storedHeights,
+           bp::args("self"),
+           "Read-only array of the heights as stored, sharing the memory of "
+           "the height field: float64, float32 or quantized uint16 values "
+           "depending on getStorage().")
       .def("getBV", (Node & (Geometry::*)(unsigned int)) & Geometry::getBV,
            doxygen::member_func_doc((Node & (Geometry::*)(unsigned int)) &
                                     Geometry::getBV),
@@ -145,7 +367,8 @@ void exposeHeightField(const std::string& bvname) {
 }
 
 struct ConvexBaseWrapper {
-  typedef Eigen::Matrix<double, Eigen::Dynamic, 3, Eigen::RowMajor> RowMatrixX3;
+  typedef Eigen::Matrix<FCL_REAL, Eigen::Dynamic, 3, Eigen::RowMajor>
+      RowMatrixX3;
   typedef Eigen::Map<RowMatrixX3> MapRowMatrixX3;
   typedef Eigen::Ref<RowMatrixX3> RefRowMatrixX3;
 
@@ -195,6 +418,21 @@ struct ConvexWrapper {
                                              (unsigned int)_points.size(), tris,
                                              (unsigned int)_tris.size()));
   }
+
+  static shared_ptr<Convex_t> arrayConstructor(const object& _points,
+                                               const object& _tris) {
+    shared_ptr<PythonStorage> storage(new PythonStorage);
+    unsigned int num_points, num_tris;
+    Vec3f* points = storage->points(_points, num_points);
+    Triangle* tris = storage->triangles(_tris, num_tris);
+    for (unsigned int i = 0; i < num_tris; ++i)
+      for (Triangle::index_type k = 0; k < 3; ++k)
+        if (tris[i][k] >= num_points)
+          throw std::out_of_range("a triangle refers to an unknown point.");
+    return shared_ptr<Convex_t>(
+        new Convex_t(false, points, num_points, tris, num_tris),
+        DeleteWithStorage<Convex_t>(storage));
+  }
 };
 
 template <typename T>
@@ -278,6 +516,14 @@ void exposeShapes() {
   class_<Convex<Triangle>, bases<ConvexBase>, shared_ptr<Convex<Triangle> >,
          noncopyable>("Convex", doxygen::class_doc<Convex<Triangle> >(),
                       no_init)
+      .def("__init__",
+           make_constructor(&ConvexWrapper<Triangle>::arrayConstructor,
+                            default_call_policies(),
+                            bp::args("points", "triangles")),
+           "Build the convex on a float64 (float32 in single precision) "
+           "array of points of shape (N, 3) and an integer array of "
+           "triangles of shape (M, 3), without copying the points. The "
+           "arrays are held by the convex.")
       .def("__init__", make_constructor(&ConvexWrapper<Triangle>::constructor))
       .DEF_RO_CLASS_ATTRIB(Convex<Triangle>, num_polygons)
       .def("polygons", &ConvexWrapper<Triangle>::polygons);
@@ -361,6 +607,12 @@ void exposeCollisionGeometries() {
       .value("BVH_BUILD_STATE_REPLACE_BEGUN", BVH_BUILD_STATE_REPLACE_BEGUN)
       .export_values();
 
+  enum_<HeightFieldStorage>("HeightFieldStorage")
+      .value("HF_STORAGE_REAL", HF_STORAGE_REAL)
+      .value("HF_STORAGE_FLOAT", HF_STORAGE_FLOAT)
+      .value("HF_STORAGE_UINT16", HF_STORAGE_UINT16)
+      .export_values();
+
   if (!eigenpy::register_symbolic_link_to_registered_type<OBJECT_TYPE>()) {
     enum_<OBJECT_TYPE>("OBJECT_TYPE")
         .value("OT_UNKNOWN", OT_UNKNOWN)
@@ -368,6 +620,8 @@ void exposeCollisionGeometries() {
         .value("OT_GEOM", OT_GEOM)
         .value("OT_OCTREE", OT_OCTREE)
         .value("OT_HFIELD", OT_HFIELD)
+        .value("OT_LINEAR_OCTREE", OT_LINEAR_OCTREE)
+        .value("OT_SDF", OT_SDF)
         .export_values();
   }
 
@@ -395,6 +649,8 @@ void exposeCollisionGeometries() {
         .value("GEOM_OCTREE", GEOM_OCTREE)
         .value("HF_AABB", HF_AABB)
         .value("HF_OBBRSS", HF_OBBRSS)
+        .value("GEOM_LINEAR_OCTREE", GEOM_LINEAR_OCTREE)
+        .value("GEOM_SDF", GEOM_SDF)
         .export_values();
   }
 
@@ -555,6 +811,9 @@ void exposeCollisionGeometries() {
       .def("tri_indices", &BVHModelBaseWrapper::tri_indices,
            bp::args("self", "index"),
            "Retrieve the triangle given by its index.")
+      .def("triangles", &BVHModelBaseWrapper::triangles, bp::args("self"),
+           "Read-only array of the triangles, sharing the memory of the "
+           "model.")
       .def_readonly("num_vertices", &BVHModelBase::num_vertices)
       .def_readonly("num_tris", &BVHModelBase::num_tris)
       .def_readonly("build_state", &BVHModelBase::build_state)
@@ -588,6 +847,61 @@ void exposeCollisionGeometries() {
   exposeBVHModel<OBBRSS>("OBBRSS");
   exposeHeightField<OBBRSS>("OBBRSS");
   exposeHeightField<AABB>("AABB");
+
+  class_<LinearOcTree, bases<CollisionGeometry>, shared_ptr<LinearOcTree> >(
+      "LinearOcTree", doxygen::class_doc<LinearOcTree>(), no_init)
+      .def(dv::init<LinearOcTree, FCL_REAL, bp::optional<unsigned int> >())
+      .def(dv::init<LinearOcTree, const LinearOcTree&>())
+      .DEF_CLASS_FUNC(LinearOcTree, setOccupiedPoints)
+      .DEF_CLASS_FUNC(LinearOcTree, isOccupied)
+      .DEF_CLASS_FUNC(LinearOcTree, getNodeBV)
+      .DEF_CLASS_FUNC(LinearOcTree, getLeafBV)
+      .DEF_CLASS_FUNC(LinearOcTree, getRootBV)
+      .DEF_CLASS_FUNC(LinearOcTree, getResolution)
+      .DEF_CLASS_FUNC(LinearOcTree, getTreeDepth)
+      .DEF_CLASS_FUNC(LinearOcTree, getNumLeaves)
+      .def("clone", &LinearOcTree::clone,
+           doxygen::member_func_doc(&LinearOcTree::clone),
+           return_value_policy<manage_new_object>());
+  doxygen::def("makeLinearOctree", &makeLinearOctree);
+
+  eigenpy::enableEigenPySpecific<SignedDistanceField::Dims>();
+  class_<SignedDistanceField, bases<CollisionGeometry>,
+         shared_ptr<SignedDistanceField> >(
+      "SignedDistanceField", doxygen::class_doc<SignedDistanceField>(),
+      no_init)
+      .def(dv::init<SignedDistanceField, const Vec3f&, FCL_REAL,
+                    const SignedDistanceField::Dims&, const VecXf&>())
+      .def(dv::init<SignedDistanceField, const SignedDistanceField&>())
+      .def("getOrigin", &SignedDistanceField::getOrigin,
+           doxygen::member_func_doc(&SignedDistanceField::getOrigin),
+           bp::return_value_policy<bp::copy_const_reference>())
+      .DEF_CLASS_FUNC(SignedDistanceField, getResolution)
+      .def("getDims", &SignedDistanceField::getDims,
+           doxygen::member_func_doc(&SignedDistanceField::getDims),
+           bp::return_value_policy<bp::copy_const_reference>())
+      .def("getValues", &SignedDistanceField::getValues,
+           doxygen::member_func_doc(&SignedDistanceField::getValues),
+           bp::return_value_policy<bp::copy_const_reference>())
+      .DEF_CLASS_FUNC(SignedDistanceField, getValue)
+      .def("computeDistance",
+           static_cast<FCL_REAL (SignedDistanceField::*)(const Vec3f&) const>(
+               &SignedDistanceField::computeDistance),
+           bp::arg("point"))
+      .def("clone", &SignedDistanceField::clone,
+           doxygen::member_func_doc(&SignedDistanceField::clone),
+           return_value_policy<manage_new_object>());
+  doxygen::def(
+      "makeSignedDistanceField",
+      static_cast<SignedDistanceFieldPtr_t (*)(
+          const BVHModelBase&, const FCL_REAL, const FCL_REAL)>(
+          &makeSignedDistanceField));
+  doxygen::def(
+      "makeSignedDistanceField",
+      static_cast<SignedDistanceFieldPtr_t (*)(const LinearOcTree&,
+                                               const FCL_REAL)>(
+          &makeSignedDistanceField));
+
   exposeComputeMemoryFootprint();
 }
 
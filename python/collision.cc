@@ -80,6 +80,32 @@ void exposeCollisionAPI() {
         .def("clear", &CPUTimes::clear, arg("self"), "Reset the time values.");
   }
 
+  if (!eigenpy::register_symbolic_link_to_registered_type<QueryProfile>()) {
+    class_<QueryProfile>("QueryProfile", no_init)
+        .def_readonly("num_bv_tests", &QueryProfile::num_bv_tests,
+                      "number of tests between bounding volumes")
+        .def_readonly("num_leaf_tests", &QueryProfile::num_leaf_tests,
+                      "number of tests between primitives")
+        .def_readonly("num_gjk_calls", &QueryProfile::num_gjk_calls,
+                      "number of runs of GJK")
+        .def_readonly("num_gjk_iterations", &QueryProfile::num_gjk_iterations,
+                      "total number of iterations of GJK")
+        .def_readonly("num_epa_calls", &QueryProfile::num_epa_calls,
+                      "number of runs of EPA")
+        .def_readonly("num_epa_iterations", &QueryProfile::num_epa_iterations,
+                      "total number of iterations of EPA")
+        .def_readonly("num_epa_faces", &QueryProfile::num_epa_faces,
+                      "total number of faces of the polytopes built by EPA")
+        .def_readonly("num_support_calls", &QueryProfile::num_support_calls,
+                      "number of calls to the support function")
+        .def_readonly("traversal_time", &QueryProfile::traversal_time,
+                      "traversal time in micro seconds (us)")
+        .def_readonly("narrowphase_time", &QueryProfile::narrowphase_time,
+                      "narrowphase time in micro seconds (us)")
+        .def("clear", &QueryProfile::clear, arg("self"),
+             "Reset the statistics.");
+  }
+
   if (!eigenpy::register_symbolic_link_to_registered_type<QueryRequest>()) {
     class_<QueryRequest>("QueryRequest", doxygen::class_doc<QueryRequest>(),
                          no_init)
@@ -112,6 +138,7 @@ void exposeCollisionAPI() {
         .DEF_RW_CLASS_ATTRIB(QueryRequest, cached_gjk_guess)
         .DEF_RW_CLASS_ATTRIB(QueryRequest, cached_support_func_guess)
         .DEF_RW_CLASS_ATTRIB(QueryRequest, enable_timings)
+        .DEF_RW_CLASS_ATTRIB(QueryRequest, enable_profiling)
         .DEF_CLASS_FUNC(QueryRequest, updateGuess);
   }
 
@@ -172,7 +199,8 @@ void exposeCollisionAPI() {
                         no_init)
         .DEF_RW_CLASS_ATTRIB(QueryResult, cached_gjk_guess)
         .DEF_RW_CLASS_ATTRIB(QueryResult, cached_support_func_guess)
-        .DEF_RW_CLASS_ATTRIB(QueryResult, timings);
+        .DEF_RW_CLASS_ATTRIB(QueryResult, timings)
+        .DEF_RW_CLASS_ATTRIB(QueryResult, profile);
   }
 
   if (!eigenpy::register_symbolic_link_to_registered_type<CollisionResult>()) {
@@ -95,6 +95,7 @@ BOOST_PYTHON_MODULE(hppfcl) {
   exposeMeshLoader();
   exposeCollisionAPI();
   exposeDistanceAPI();
+  exposeBatchAPI();
   exposeGJK();
 #ifdef HPP_FCL_HAS_OCTOMAP
   exposeOctree();
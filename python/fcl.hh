@@ -14,6 +14,8 @@ void exposeCollisionAPI();
 
 void exposeDistanceAPI();
 
+void exposeBatchAPI();
+
 void exposeGJK();
 
 #ifdef HPP_FCL_HAS_OCTOMAP
@@ -0,0 +1,32 @@
+//
+// Copyright (c) 2026 INRIA
+//
+
+#ifndef HPP_FCL_PYTHON_GIL_HH
+#define HPP_FCL_PYTHON_GIL_HH
+
+#include <Python.h>
+
+namespace hpp {
+namespace fcl {
+namespace python {
+
+/// @brief Release the global interpreter lock for the lifetime of the object.
+///
+/// No Python object may be accessed while the lock is released.
+struct GILRelease {
+  GILRelease() : state(PyEval_SaveThread()) {}
+  ~GILRelease() { PyEval_RestoreThread(state); }
+
+ private:
+  GILRelease(const GILRelease&);
+  GILRelease& operator=(const GILRelease&);
+
+  PyThreadState* state;
+};
+
+}  // namespace python
+}  // namespace fcl
+}  // namespace hpp
+
+#endif  // ifndef HPP_FCL_PYTHON_GIL_HH
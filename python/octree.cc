@@ -24,7 +24,15 @@ void exposeOctree() {
                            &OcTree::setCellDefaultOccupancy))
       .def(dv::member_func("setOccupancyThres", &OcTree::setOccupancyThres))
       .def(dv::member_func("setFreeThres", &OcTree::setFreeThres))
-      .def(dv::member_func("getRootBV", &OcTree::getRootBV));
+      .def(dv::member_func("getRootBV", &OcTree::getRootBV))
+      .def(dv::member_func("buildOccupiedLeaves", &OcTree::buildOccupiedLeaves))
+      .def(dv::member_func("updateOccupiedLeavesFromChangedKeys",
+                           &OcTree::updateOccupiedLeavesFromChangedKeys))
+      .def(dv::member_func("clearOccupiedLeaves",
+                           &OcTree::clearOccupiedLeaves))
+      .def(dv::member_func("toLinearOcTree", &OcTree::toLinearOcTree))
+      .def(dv::member_func("toSignedDistanceField",
+                           &OcTree::toSignedDistanceField));
 
   doxygen::def("makeOctree", &makeOctree);
 }
@@ -96,11 +96,11 @@ FCL_REAL AABB::distance(const AABB& other, Vec3f* P, Vec3f* Q) const {
     } else {
       if (P && Q) {
         if (bmin >= amin) {
-          FCL_REAL t = 0.5 * (amax + bmin);
+          FCL_REAL t = (amax + bmin) / 2;
           (*P)[i] = t;
           (*Q)[i] = t;
         } else {
-          FCL_REAL t = 0.5 * (amin + bmax);
+          FCL_REAL t = (amin + bmax) / 2;
           (*P)[i] = t;
           (*Q)[i] = t;
         }
@@ -115,7 +115,7 @@ inline OBB merge_largedist(const OBB& b1, const OBB& b2) {
 /// @brief OBB merge method when the centers of two smaller OBB are close
 inline OBB merge_smalldist(const OBB& b1, const OBB& b2) {
   OBB b;
-  b.To = (b1.To + b2.To) * 0.5;
+  b.To = (b1.To + b2.To) * FCL_REAL(0.5);
   Quaternion3f q0(b1.axes), q1(b2.axes);
   if (q0.dot(q1) < 0) q1.coeffs() *= -1;
 
@@ -152,8 +152,8 @@ inline OBB merge_smalldist(const OBB& b1, const OBB& b2) {
   }
 
   for (int j = 0; j < 3; ++j) {
-    b.To.noalias() += (b.axes.col(j) * (0.5 * (pmax[j] + pmin[j])));
-    b.extent[j] = 0.5 * (pmax[j] - pmin[j]);
+    b.To.noalias() += (b.axes.col(j) * (FCL_REAL(0.5) * (pmax[j] + pmin[j])));
+    b.extent[j] = (pmax[j] - pmin[j]) / 2;
   }
 
   return b;
@@ -162,7 +162,9 @@ inline OBB merge_smalldist(const OBB& b1, const OBB& b2) {
 bool obbDisjoint(const Matrix3f& B, const Vec3f& T, const Vec3f& a,
                  const Vec3f& b) {
   FCL_REAL t, s;
-  const FCL_REAL reps = 1e-6;
+  // Margin covering the rounding errors on |B|, larger in single precision.
+  const FCL_REAL reps =
+      (std::max)(FCL_REAL(1e-6), 100 * Eigen::NumTraits<FCL_REAL>::epsilon());
 
   Matrix3f Bf(B.array().abs() + reps);
   // Bf += reps;
@@ -317,7 +319,9 @@ struct HPP_FCL_LOCAL obbDisjoint_check_Ai_cross_Bi {
                          const Matrix3f& Bf, const FCL_REAL& breakDistance2,
                          FCL_REAL& squaredLowerBoundDistance) {
     FCL_REAL sinus2 = 1 - Bf(ia, ib) * Bf(ia, ib);
-    if (sinus2 < 1e-6) return false;
+    if (sinus2 < (std::max)(FCL_REAL(1e-6),
+                            100 * Eigen::NumTraits<FCL_REAL>::epsilon()))
+      return false;
 
     const FCL_REAL s = T[ka] * B(ja, ib) - T[ja] * B(ka, ib);
 
@@ -95,7 +95,9 @@ void segCoords(FCL_REAL& t, FCL_REAL& u, FCL_REAL a, FCL_REAL b,
 bool inVoronoi(FCL_REAL a, FCL_REAL b, FCL_REAL Anorm_dot_B,
                FCL_REAL Anorm_dot_T, FCL_REAL A_dot_B, FCL_REAL A_dot_T,
                FCL_REAL B_dot_T) {
-  if (fabs(Anorm_dot_B) < 1e-7) return false;
+  const FCL_REAL eps =
+      (std::max)(FCL_REAL(1e-7), 10 * Eigen::NumTraits<FCL_REAL>::epsilon());
+  if (fabs(Anorm_dot_B) < eps) return false;
 
   FCL_REAL t, u, v;
 
@@ -108,9 +110,9 @@ bool inVoronoi(FCL_REAL a, FCL_REAL b, FCL_REAL Anorm_dot_B,
   v = t * A_dot_B - B_dot_T;
 
   if (Anorm_dot_B > 0) {
-    if (v > (u + 1e-7)) return true;
+    if (v > (u + eps)) return true;
   } else {
-    if (v < (u - 1e-7)) return true;
+    if (v < (u - eps)) return true;
   }
   return false;
 }
@@ -805,12 +807,12 @@ RSS& RSS::operator+=(const Vec3f& p) {
     if (abs_proj2 < radius)
       ;  // do nothing
     else {
-      radius = 0.5 * (radius + abs_proj2);  // enlarge the r
+      radius = (radius + abs_proj2) / 2;  // enlarge the r
       // change RSS origin position
       if (proj2 > 0)
-        Tr[2] += 0.5 * (abs_proj2 - radius);
+        Tr[2] += (abs_proj2 - radius) / 2;
       else
-        Tr[2] -= 0.5 * (abs_proj2 - radius);
+        Tr[2] -= (abs_proj2 - radius) / 2;
     }
   } else if ((proj0 < length[0]) && (proj0 > 0) &&
              ((proj1 < 0) || (proj1 > length[1]))) {
@@ -831,9 +833,9 @@ RSS& RSS::operator+=(const Vec3f& p) {
         if (proj1 < 0) Tr[1] -= delta_y;
 
         if (proj2 > 0)
-          Tr[2] += 0.5 * (abs_proj2 - radius);
+          Tr[2] += (abs_proj2 - radius) / 2;
         else
-          Tr[2] -= 0.5 * (abs_proj2 - radius);
+          Tr[2] -= (abs_proj2 - radius) / 2;
       }
     }
   } else if ((proj1 < length[1]) && (proj1 > 0) &&
@@ -855,9 +857,9 @@ RSS& RSS::operator+=(const Vec3f& p) {
         if (proj0 < 0) Tr[0] -= delta_x;
 
         if (proj2 > 0)
-          Tr[2] += 0.5 * (abs_proj2 - radius);
+          Tr[2] += (abs_proj2 - radius) / 2;
         else
-          Tr[2] -= 0.5 * (abs_proj2 - radius);
+          Tr[2] -= (abs_proj2 - radius) / 2;
       }
     }
   } else {
@@ -895,9 +897,9 @@ RSS& RSS::operator+=(const Vec3f& p) {
         }
 
         if (proj2 > 0)
-          Tr[2] += 0.5 * (abs_proj2 - radius);
+          Tr[2] += (abs_proj2 - radius) / 2;
         else
-          Tr[2] -= 0.5 * (abs_proj2 - radius);
+          Tr[2] -= (abs_proj2 - radius) / 2;
       }
     }
   }
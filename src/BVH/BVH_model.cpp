@@ -59,7 +59,8 @@ BVHModelBase::BVHModelBase()
       build_state(BVH_BUILD_STATE_EMPTY),
       num_tris_allocated(0),
       num_vertices_allocated(0),
-      num_vertex_updated(0) {}
+      num_vertex_updated(0),
+      own_storage(true) {}
 
 BVHModelBase::BVHModelBase(const BVHModelBase& other)
     : CollisionGeometry(other),
@@ -67,7 +68,8 @@ BVHModelBase::BVHModelBase(const BVHModelBase& other)
       num_vertices(other.num_vertices),
       build_state(other.build_state),
       num_tris_allocated(other.num_tris),
-      num_vertices_allocated(other.num_vertices) {
+      num_vertices_allocated(other.num_vertices),
+      own_storage(true) {
   if (other.vertices) {
     vertices = new Vec3f[num_vertices];
     std::copy(other.vertices, other.vertices + num_vertices, vertices);
@@ -170,10 +172,13 @@ BVHModel<BV>::BVHModel(const BVHModel<BV>& other)
 int BVHModelBase::beginModel(unsigned int num_tris_,
                              unsigned int num_vertices_) {
   if (build_state != BVH_BUILD_STATE_EMPTY) {
-    delete[] vertices;
+    if (own_storage) {
+      delete[] vertices;
+      delete[] tri_indices;
+    }
     vertices = nullptr;
-    delete[] tri_indices;
     tri_indices = nullptr;
+    own_storage = true;
     delete[] prev_vertices;
     prev_vertices = nullptr;
 
@@ -530,6 +535,44 @@ int BVHModelBase::endModel() {
   return BVH_OK;
 }
 
+int BVHModelBase::buildModel(bool own_storage_, Vec3f* vertices_,
+                             unsigned int num_vertices_, Triangle* tri_indices_,
+                             unsigned int num_tris_) {
+  if (num_vertices_ == 0) {
+    std::cerr << "BVH Error! buildModel() called with no vertices."
+              << std::endl;
+    return BVH_ERR_BUILD_EMPTY_MODEL;
+  }
+  for (unsigned int i = 0; i < num_tris_; ++i)
+    for (Triangle::index_type j = 0; j < 3; ++j)
+      if (tri_indices_[i][j] >= num_vertices_) {
+        std::cerr << "BVH Error! Triangle " << i
+                  << " refers to a vertex out of range in buildModel() call."
+                  << std::endl;
+        return BVH_ERR_INCORRECT_DATA;
+      }
+
+  if (own_storage) {
+    delete[] vertices;
+    delete[] tri_indices;
+  }
+  delete[] prev_vertices;
+  prev_vertices = NULL;
+  deleteBVs();
+
+  own_storage = own_storage_;
+  vertices = vertices_;
+  num_vertices_allocated = num_vertices = num_vertices_;
+  tri_indices = num_tris_ > 0 ? tri_indices_ : NULL;
+  num_tris_allocated = num_tris = num_tris_;
+
+  if (!allocateBVs()) return BVH_ERR_MODEL_OUT_OF_MEMORY;
+  buildTree();
+  build_state = BVH_BUILD_STATE_PROCESSED;
+
+  return BVH_OK;
+}
+
 int BVHModelBase::beginReplaceModel() {
   if (build_state != BVH_BUILD_STATE_PROCESSED) {
     std::cerr << "BVH Error! Call beginReplaceModel() on a BVHModel that has "
@@ -635,7 +678,11 @@ int BVHModelBase::beginUpdateModel() {
     return BVH_ERR_BUILD_EMPTY_PREVIOUS_FRAME;
   }
 
-  if (prev_vertices) {
+  if (!own_storage) {
+    // The vertices stay in the storage of the caller.
+    if (!prev_vertices) prev_vertices = new Vec3f[num_vertices];
+    std::copy(vertices, vertices + num_vertices, prev_vertices);
+  } else if (prev_vertices) {
     Vec3f* temp = prev_vertices;
     prev_vertices = vertices;
     vertices = temp;
@@ -38,6 +38,7 @@
 #include <hpp/fcl/BVH/BVH_utility.h>
 #include <hpp/fcl/narrowphase/narrowphase.h>
 #include <hpp/fcl/shape/geometric_shapes_utility.h>
+#include <hpp/fcl/workspace.h>
 
 namespace hpp {
 namespace fcl {
@@ -230,7 +231,8 @@ void getCovariance(Vec3f* ps, Vec3f* ps2, Triangle* ts, unsigned int* indices,
     }
   }
 
-  unsigned int n_points = ((ps2) ? 2 : 1) * ((ts) ? 3 : 1) * n;
+  const FCL_REAL n_points =
+      FCL_REAL(((ps2) ? 2 : 1) * ((ts) ? 3 : 1) * n);
 
   M(0, 0) = S2[0][0] - S1[0] * S1[0] / n_points;
   M(1, 1) = S2[1][1] - S1[1] * S1[1] / n_points;
@@ -255,7 +257,14 @@ void getRadiusAndOriginAndRectangleSize(Vec3f* ps, Vec3f* ps2, Triangle* ts,
 
   unsigned int size_P = ((ps2) ? 2 : 1) * ((ts) ? 3 : 1) * n;
 
-  FCL_REAL(*P)[3] = new FCL_REAL[size_P][3];
+  QueryWorkspace* workspace = QueryWorkspace::current();
+  FCL_REAL(*P)[3];
+  if (workspace) {
+    if (workspace->rss_points.size() < 3 * size_P)
+      workspace->rss_points.resize(3 * size_P);
+    P = reinterpret_cast<FCL_REAL(*)[3]>(workspace->rss_points.data());
+  } else
+    P = new FCL_REAL[size_P][3];
 
   int P_id = 0;
 
@@ -463,7 +472,7 @@ void getRadiusAndOriginAndRectangleSize(Vec3f* ps, Vec3f* ps2, Triangle* ts,
   l[0] = std::max<FCL_REAL>(maxx - minx, 0);
   l[1] = std::max<FCL_REAL>(maxy - miny, 0);
 
-  delete[] P;
+  if (!workspace) delete[] P;
 }
 
 /** @brief Compute the bounding volume extent and center for a set or subset of
@@ -577,9 +586,9 @@ void circumCircleComputation(const Vec3f& a, const Vec3f& b, const Vec3f& c,
   Vec3f e3 = e1.cross(e2);
   FCL_REAL e3_len2 = e3.squaredNorm();
   radius = e1_len2 * e2_len2 * (e1 - e2).squaredNorm() / e3_len2;
-  radius = std::sqrt(radius) * 0.5;
+  radius = std::sqrt(radius) / 2;
 
-  center = (e2 * e1_len2 - e1 * e2_len2).cross(e3) * (0.5 * 1 / e3_len2) + c;
+  center = (e2 * e1_len2 - e1 * e2_len2).cross(e3) / (2 * e3_len2) + c;
 }
 
 static inline FCL_REAL maximumDistance_mesh(Vec3f* ps, Vec3f* ps2, Triangle* ts,
@@ -44,8 +44,8 @@ namespace hpp {
 namespace fcl {
 
 static const double kIOS_RATIO = 1.5;
-static const double invSinA = 2;
-static const double cosA = sqrt(3.0) / 2.0;
+static const FCL_REAL invSinA = 2;
+static const FCL_REAL cosA = sqrt(FCL_REAL(3)) / 2;
 
 static inline void axisFromEigen(Vec3f eigenV[3], Matrix3f::Scalar eigenS[3],
                                  Matrix3f& axes) {
@@ -93,7 +93,7 @@ void fit2(Vec3f* ps, OBB& bv) {
   bv.axes.col(0).noalias() = p1p2;
   generateCoordinateSystem(bv.axes.col(0), bv.axes.col(1), bv.axes.col(2));
 
-  bv.extent << len_p1p2 * 0.5, 0, 0;
+  bv.extent << len_p1p2 / 2, 0, 0;
   bv.To.noalias() = (p1 + p2) / 2;
 }
 
@@ -240,9 +240,9 @@ void fit2(Vec3f* ps, kIOS& bv) {
   axes.col(0).noalias() = p1p2;
   generateCoordinateSystem(axes.col(0), axes.col(1), axes.col(2));
 
-  FCL_REAL r0 = len_p1p2 * 0.5;
+  FCL_REAL r0 = len_p1p2 / 2;
   bv.obb.extent << r0, 0, 0;
-  bv.obb.To = (p1 + p2) * 0.5;
+  bv.obb.To = (p1 + p2) * FCL_REAL(0.5);
 
   bv.spheres[0].o = bv.obb.To;
   bv.spheres[0].r = r0;
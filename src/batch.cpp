@@ -0,0 +1,136 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <hpp/fcl/batch.h>
+
+#include <algorithm>
+#include <exception>
+#include <functional>
+#include <thread>
+
+#include <hpp/fcl/collision.h>
+#include <hpp/fcl/distance.h>
+#include <hpp/fcl/workspace.h>
+
+namespace hpp {
+namespace fcl {
+
+namespace {
+void run(const BatchQuery& query, const CollisionRequest& request,
+         CollisionResult& result) {
+  collide(query.o1, query.tf1, query.o2, query.tf2, request, result);
+}
+
+void run(const BatchQuery& query, const DistanceRequest& request,
+         DistanceResult& result) {
+  distance(query.o1, query.tf1, query.o2, query.tf2, request, result);
+}
+
+/// Run a contiguous range of the queries.
+template <typename Request, typename Result>
+struct BatchWorker {
+  const std::vector<BatchQuery>* queries;
+  const Request* request;
+  std::vector<Result>* results;
+  std::size_t begin, end;
+  std::exception_ptr error;
+
+  void operator()() {
+    QueryWorkspace workspace;
+    QueryWorkspace::Scope scope(workspace);
+    try {
+      for (std::size_t i = begin; i < end; ++i)
+        run((*queries)[i], *request, (*results)[i]);
+    } catch (...) {
+      error = std::current_exception();
+    }
+  }
+};
+
+template <typename Request, typename Result>
+void runBatch(const std::vector<BatchQuery>& queries, const Request& request,
+              std::vector<Result>& results, unsigned int num_threads) {
+  results.assign(queries.size(), Result());
+  if (queries.empty()) return;
+
+  if (num_threads == 0)
+    num_threads = std::max(1u, std::thread::hardware_concurrency());
+  const std::size_t num_workers =
+      std::min((std::size_t)num_threads, queries.size());
+
+  std::vector<BatchWorker<Request, Result> > workers(num_workers);
+  for (std::size_t w = 0; w < num_workers; ++w) {
+    BatchWorker<Request, Result>& worker = workers[w];
+    worker.queries = &queries;
+    worker.request = &request;
+    worker.results = &results;
+    worker.begin = queries.size() * w / num_workers;
+    worker.end = queries.size() * (w + 1) / num_workers;
+  }
+
+  // The calling thread runs the first range. If a thread cannot be started,
+  // the started ones are joined before the error is rethrown.
+  std::vector<std::thread> threads;
+  threads.reserve(num_workers - 1);
+  try {
+    for (std::size_t w = 1; w < num_workers; ++w)
+      threads.push_back(std::thread(std::ref(workers[w])));
+  } catch (...) {
+    for (std::size_t t = 0; t < threads.size(); ++t) threads[t].join();
+    throw;
+  }
+  workers[0]();
+  for (std::size_t t = 0; t < threads.size(); ++t) threads[t].join();
+
+  for (std::size_t w = 0; w < num_workers; ++w)
+    if (workers[w].error) std::rethrow_exception(workers[w].error);
+}
+}  // namespace
+
+void collideBatch(const std::vector<BatchQuery>& queries,
+                  const CollisionRequest& request,
+                  std::vector<CollisionResult>& results,
+                  unsigned int num_threads) {
+  runBatch(queries, request, results, num_threads);
+}
+
+void distanceBatch(const std::vector<BatchQuery>& queries,
+                   const DistanceRequest& request,
+                   std::vector<DistanceResult>& results,
+                   unsigned int num_threads) {
+  runBatch(queries, request, results, num_threads);
+}
+
+}  // namespace fcl
+}  // namespace hpp
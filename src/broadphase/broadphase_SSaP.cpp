@@ -201,6 +201,8 @@ bool SSaPCollisionManager::checkDis(
 //==============================================================================
 void SSaPCollisionManager::collide(CollisionObject* obj,
                                    CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_SSAP);
+  HPP_FCL_TRACE_SPAN("SSaPCollisionManager::collide", "broadphase");
   callback->init();
   if (size() == 0) return;
 
@@ -254,6 +256,8 @@ bool SSaPCollisionManager::collide_(CollisionObject* obj,
 //==============================================================================
 void SSaPCollisionManager::distance(CollisionObject* obj,
                                     DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_SSAP);
+  HPP_FCL_TRACE_SPAN("SSaPCollisionManager::distance", "broadphase");
   callback->init();
   if (size() == 0) return;
 
@@ -266,7 +270,7 @@ bool SSaPCollisionManager::distance_(CollisionObject* obj,
                                      DistanceCallBackBase* callback,
                                      FCL_REAL& min_dist) const {
   static const unsigned int CUTOFF = 100;
-  Vec3f delta = (obj->getAABB().max_ - obj->getAABB().min_) * 0.5;
+  Vec3f delta = (obj->getAABB().max_ - obj->getAABB().min_) * FCL_REAL(0.5);
   Vec3f dummy_vector = obj->getAABB().max_;
   if (min_dist < (std::numeric_limits<FCL_REAL>::max)())
     dummy_vector += Vec3f(min_dist, min_dist, min_dist);
@@ -401,6 +405,8 @@ int SSaPCollisionManager::selectOptimalAxis(
 
 //==============================================================================
 void SSaPCollisionManager::collide(CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_SSAP);
+  HPP_FCL_TRACE_SPAN("SSaPCollisionManager::collide", "broadphase");
   callback->init();
   if (size() == 0) return;
 
@@ -448,6 +454,8 @@ void SSaPCollisionManager::collide(CollisionCallBackBase* callback) const {
 
 //==============================================================================
 void SSaPCollisionManager::distance(DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_SSAP);
+  HPP_FCL_TRACE_SPAN("SSaPCollisionManager::distance", "broadphase");
   callback->init();
   if (size() == 0) return;
 
@@ -463,6 +471,8 @@ void SSaPCollisionManager::distance(DistanceCallBackBase* callback) const {
 //==============================================================================
 void SSaPCollisionManager::collide(BroadPhaseCollisionManager* other_manager_,
                                    CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_SSAP);
+  HPP_FCL_TRACE_SPAN("SSaPCollisionManager::collide", "broadphase");
   callback->init();
   SSaPCollisionManager* other_manager =
       static_cast<SSaPCollisionManager*>(other_manager_);
@@ -488,6 +498,8 @@ void SSaPCollisionManager::collide(BroadPhaseCollisionManager* other_manager_,
 //==============================================================================
 void SSaPCollisionManager::distance(BroadPhaseCollisionManager* other_manager_,
                                     DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_SSAP);
+  HPP_FCL_TRACE_SPAN("SSaPCollisionManager::distance", "broadphase");
   callback->init();
   SSaPCollisionManager* other_manager =
       static_cast<SSaPCollisionManager*>(other_manager_);
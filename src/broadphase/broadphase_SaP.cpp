@@ -568,6 +568,8 @@ void SaPCollisionManager::removeFromOverlapPairs(const SaPPair& p) {
 //==============================================================================
 void SaPCollisionManager::collide(CollisionObject* obj,
                                   CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_SAP);
+  HPP_FCL_TRACE_SPAN("SaPCollisionManager::collide", "broadphase");
   callback->init();
   if (size() == 0) return;
 
@@ -578,7 +580,7 @@ void SaPCollisionManager::collide(CollisionObject* obj,
 bool SaPCollisionManager::distance_(CollisionObject* obj,
                                     DistanceCallBackBase* callback,
                                     FCL_REAL& min_dist) const {
-  Vec3f delta = (obj->getAABB().max_ - obj->getAABB().min_) * 0.5;
+  Vec3f delta = (obj->getAABB().max_ - obj->getAABB().min_) * FCL_REAL(0.5);
   AABB aabb = obj->getAABB();
 
   if (min_dist < (std::numeric_limits<FCL_REAL>::max)()) {
@@ -670,6 +672,8 @@ bool SaPCollisionManager::distance_(CollisionObject* obj,
 //==============================================================================
 void SaPCollisionManager::distance(CollisionObject* obj,
                                    DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_SAP);
+  HPP_FCL_TRACE_SPAN("SaPCollisionManager::distance", "broadphase");
   callback->init();
   if (size() == 0) return;
 
@@ -680,6 +684,8 @@ void SaPCollisionManager::distance(CollisionObject* obj,
 
 //==============================================================================
 void SaPCollisionManager::collide(CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_SAP);
+  HPP_FCL_TRACE_SPAN("SaPCollisionManager::collide", "broadphase");
   callback->init();
   if (size() == 0) return;
 
@@ -694,6 +700,8 @@ void SaPCollisionManager::collide(CollisionCallBackBase* callback) const {
 
 //==============================================================================
 void SaPCollisionManager::distance(DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_SAP);
+  HPP_FCL_TRACE_SPAN("SaPCollisionManager::distance", "broadphase");
   callback->init();
   if (size() == 0) return;
 
@@ -713,6 +721,8 @@ void SaPCollisionManager::distance(DistanceCallBackBase* callback) const {
 //==============================================================================
 void SaPCollisionManager::collide(BroadPhaseCollisionManager* other_manager_,
                                   CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_SAP);
+  HPP_FCL_TRACE_SPAN("SaPCollisionManager::collide", "broadphase");
   callback->init();
   SaPCollisionManager* other_manager =
       static_cast<SaPCollisionManager*>(other_manager_);
@@ -740,6 +750,8 @@ void SaPCollisionManager::collide(BroadPhaseCollisionManager* other_manager_,
 //==============================================================================
 void SaPCollisionManager::distance(BroadPhaseCollisionManager* other_manager_,
                                    DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_SAP);
+  HPP_FCL_TRACE_SPAN("SaPCollisionManager::distance", "broadphase");
   callback->init();
   SaPCollisionManager* other_manager =
       static_cast<SaPCollisionManager*>(other_manager_);
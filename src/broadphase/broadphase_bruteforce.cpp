@@ -87,6 +87,8 @@ void NaiveCollisionManager::getObjects(
 //==============================================================================
 void NaiveCollisionManager::collide(CollisionObject* obj,
                                     CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_NAIVE);
+  HPP_FCL_TRACE_SPAN("NaiveCollisionManager::collide", "broadphase");
   callback->init();
   if (size() == 0) return;
 
@@ -98,6 +100,8 @@ void NaiveCollisionManager::collide(CollisionObject* obj,
 //==============================================================================
 void NaiveCollisionManager::distance(CollisionObject* obj,
                                      DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_NAIVE);
+  HPP_FCL_TRACE_SPAN("NaiveCollisionManager::distance", "broadphase");
   callback->init();
   if (size() == 0) return;
 
@@ -111,6 +115,8 @@ void NaiveCollisionManager::distance(CollisionObject* obj,
 
 //==============================================================================
 void NaiveCollisionManager::collide(CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_NAIVE);
+  HPP_FCL_TRACE_SPAN("NaiveCollisionManager::collide", "broadphase");
   callback->init();
   if (size() == 0) return;
 
@@ -129,6 +135,8 @@ void NaiveCollisionManager::collide(CollisionCallBackBase* callback) const {
 
 //==============================================================================
 void NaiveCollisionManager::distance(DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_NAIVE);
+  HPP_FCL_TRACE_SPAN("NaiveCollisionManager::distance", "broadphase");
   callback->init();
   if (size() == 0) return;
 
@@ -149,6 +157,8 @@ void NaiveCollisionManager::distance(DistanceCallBackBase* callback) const {
 //==============================================================================
 void NaiveCollisionManager::collide(BroadPhaseCollisionManager* other_manager_,
                                     CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_NAIVE);
+  HPP_FCL_TRACE_SPAN("NaiveCollisionManager::collide", "broadphase");
   callback->init();
   NaiveCollisionManager* other_manager =
       static_cast<NaiveCollisionManager*>(other_manager_);
@@ -172,6 +182,8 @@ void NaiveCollisionManager::collide(BroadPhaseCollisionManager* other_manager_,
 //==============================================================================
 void NaiveCollisionManager::distance(BroadPhaseCollisionManager* other_manager_,
                                      DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_NAIVE);
+  HPP_FCL_TRACE_SPAN("NaiveCollisionManager::distance", "broadphase");
   callback->init();
   NaiveCollisionManager* other_manager =
       static_cast<NaiveCollisionManager*>(other_manager_);
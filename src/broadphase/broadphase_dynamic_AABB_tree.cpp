@@ -253,9 +253,11 @@ bool collisionRecurse(DynamicAABBTreeCollisionManager::DynamicAABBNode* root1,
                       DynamicAABBTreeCollisionManager::DynamicAABBNode* root2,
                       CollisionCallBackBase* callback) {
   if (root1->isLeaf() && root2->isLeaf()) {
-    if (!root1->bv.overlap(root2->bv)) return false;
-    return (*callback)(static_cast<CollisionObject*>(root1->data),
-                       static_cast<CollisionObject*>(root2->data));
+    // The leaves may store enlarged AABBs: test the exact ones.
+    CollisionObject* obj1 = static_cast<CollisionObject*>(root1->data);
+    CollisionObject* obj2 = static_cast<CollisionObject*>(root2->data);
+    if (!obj1->getAABB().overlap(obj2->getAABB())) return false;
+    return (*callback)(obj1, obj2);
   }
 
   if (!root1->bv.overlap(root2->bv)) return false;
@@ -275,8 +277,9 @@ bool collisionRecurse(DynamicAABBTreeCollisionManager::DynamicAABBNode* root1,
 bool collisionRecurse(DynamicAABBTreeCollisionManager::DynamicAABBNode* root,
                       CollisionObject* query, CollisionCallBackBase* callback) {
   if (root->isLeaf()) {
-    if (!root->bv.overlap(query->getAABB())) return false;
-    return (*callback)(static_cast<CollisionObject*>(root->data), query);
+    CollisionObject* obj = static_cast<CollisionObject*>(root->data);
+    if (!obj->getAABB().overlap(query->getAABB())) return false;
+    return (*callback)(obj, query);
   }
 
   if (!root->bv.overlap(query->getAABB())) return false;
@@ -427,6 +430,17 @@ bool selfDistanceRecurse(DynamicAABBTreeCollisionManager::DynamicAABBNode* root,
   return false;
 }
 
+//==============================================================================
+/// Throw if obj is in table, whose objects are registered as kind.
+template <typename Table>
+void checkNotRegistered(CollisionObject* obj, const Table& table,
+                        const char* kind) {
+  if (table.find(obj) != table.end())
+    HPP_FCL_THROW_PRETTY("The object is already registered as a "
+                             << kind << " object.",
+                         std::invalid_argument);
+}
+
 }  // namespace dynamic_AABB_tree
 
 }  // namespace detail
@@ -441,10 +455,13 @@ DynamicAABBTreeCollisionManager::DynamicAABBTreeCollisionManager() {
   *tree_topdown_level = 0;
   tree_init_level = 0;
   setup_ = false;
+  static_setup_ = true;
 
   // from experiment, this is the optimal setting
   octree_as_geometry_collide = true;
   octree_as_geometry_distance = false;
+
+  fat_aabb_margin = 0;
 }
 
 //==============================================================================
@@ -452,7 +469,11 @@ void DynamicAABBTreeCollisionManager::registerObjects(
     const std::vector<CollisionObject*>& other_objs) {
   if (other_objs.empty()) return;
 
-  if (size() > 0) {
+  for (size_t i = 0, size = other_objs.size(); i < size; ++i)
+    detail::dynamic_AABB_tree::checkNotRegistered(other_objs[i], static_table,
+                                                  "static");
+
+  if (!dtree.empty()) {
     BroadPhaseCollisionManager::registerObjects(other_objs);
   } else {
     std::vector<DynamicAABBNode*> leaves(other_objs.size());
@@ -476,19 +497,82 @@ void DynamicAABBTreeCollisionManager::registerObjects(
 
 //==============================================================================
 void DynamicAABBTreeCollisionManager::registerObject(CollisionObject* obj) {
+  detail::dynamic_AABB_tree::checkNotRegistered(obj, static_table, "static");
   DynamicAABBNode* node = dtree.insert(obj->getAABB(), obj);
   table[obj] = node;
 }
 
+//==============================================================================
+void DynamicAABBTreeCollisionManager::registerStaticObjects(
+    const std::vector<CollisionObject*>& other_objs) {
+  if (other_objs.empty()) return;
+
+  for (size_t i = 0, size = other_objs.size(); i < size; ++i)
+    detail::dynamic_AABB_tree::checkNotRegistered(other_objs[i], table,
+                                                  "dynamic");
+
+  if (!stree.empty()) {
+    for (size_t i = 0, size = other_objs.size(); i < size; ++i)
+      registerStaticObject(other_objs[i]);
+  } else {
+    std::vector<DynamicAABBNode*> leaves(other_objs.size());
+    static_table.rehash(other_objs.size());
+    for (size_t i = 0, size = other_objs.size(); i < size; ++i) {
+      DynamicAABBNode* node =
+          new DynamicAABBNode;  // node will be managed by the stree
+      node->bv = other_objs[i]->getAABB();
+      node->parent = nullptr;
+      node->children[1] = nullptr;
+      node->data = other_objs[i];
+      static_table[other_objs[i]] = node;
+      leaves[i] = node;
+    }
+
+    stree.init(leaves, tree_init_level);
+  }
+}
+
+//==============================================================================
+void DynamicAABBTreeCollisionManager::registerStaticObject(
+    CollisionObject* obj) {
+  detail::dynamic_AABB_tree::checkNotRegistered(obj, table, "dynamic");
+  DynamicAABBNode* node = stree.insert(obj->getAABB(), obj);
+  static_table[obj] = node;
+  static_setup_ = false;
+}
+
 //==============================================================================
 void DynamicAABBTreeCollisionManager::unregisterObject(CollisionObject* obj) {
-  DynamicAABBNode* node = table[obj];
-  table.erase(obj);
-  dtree.remove(node);
+  velocities.erase(obj);
+  auto it = table.find(obj);
+  if (it != table.end()) {
+    DynamicAABBNode* node = it->second;
+    table.erase(it);
+    dtree.remove(node);
+    return;
+  }
+
+  it = static_table.find(obj);
+  if (it != static_table.end()) {
+    DynamicAABBNode* node = it->second;
+    static_table.erase(it);
+    stree.remove(node);
+  }
+}
+
+//==============================================================================
+bool DynamicAABBTreeCollisionManager::isStatic(CollisionObject* obj) const {
+  return static_table.find(obj) != static_table.end();
 }
 
 //==============================================================================
 void DynamicAABBTreeCollisionManager::setup() {
+  if (!static_setup_) {
+    // The static tree is rebalanced only when static objects changed.
+    if (!stree.empty()) stree.balanceTopdown();
+    static_setup_ = true;
+  }
+
   if (!setup_) {
     size_t num = dtree.size();
     if (num == 0) {
@@ -510,6 +594,19 @@ void DynamicAABBTreeCollisionManager::setup() {
 
 //==============================================================================
 void DynamicAABBTreeCollisionManager::update() {
+  if (fat_aabb_margin > 0) {
+    // Only the objects which left their fat AABB are reinserted.
+    bool moved = false;
+    for (auto it = table.cbegin(); it != table.cend(); ++it)
+      moved |= dtree.update(it->second, it->first->getAABB(),
+                            velocity_(it->first), fat_aabb_margin);
+    if (moved) {
+      setup_ = false;
+      setup();
+    }
+    return;
+  }
+
   for (auto it = table.cbegin(); it != table.cend(); ++it) {
     CollisionObject* obj = it->first;
     DynamicAABBNode* node = it->second;
@@ -529,10 +626,26 @@ void DynamicAABBTreeCollisionManager::update_(CollisionObject* updated_obj) {
   const auto it = table.find(updated_obj);
   if (it != table.end()) {
     DynamicAABBNode* node = it->second;
-    if (!(node->bv == updated_obj->getAABB()))
-      dtree.update(node, updated_obj->getAABB());
+    if (fat_aabb_margin > 0) {
+      if (dtree.update(node, updated_obj->getAABB(), velocity_(updated_obj),
+                       fat_aabb_margin))
+        setup_ = false;
+    } else {
+      if (!(node->bv == updated_obj->getAABB()))
+        dtree.update(node, updated_obj->getAABB());
+      setup_ = false;
+    }
+    return;
+  }
+
+  const auto static_it = static_table.find(updated_obj);
+  if (static_it != static_table.end()) {
+    DynamicAABBNode* node = static_it->second;
+    if (!(node->bv == updated_obj->getAABB())) {
+      stree.update(node, updated_obj->getAABB());
+      static_setup_ = false;
+    }
   }
-  setup_ = false;
 }
 
 //==============================================================================
@@ -549,120 +662,203 @@ void DynamicAABBTreeCollisionManager::update(
   setup();
 }
 
+//==============================================================================
+void DynamicAABBTreeCollisionManager::setVelocity(CollisionObject* obj,
+                                                  const Vec3f& vel) {
+  velocities[obj] = vel;
+}
+
+//==============================================================================
+Vec3f DynamicAABBTreeCollisionManager::velocity_(CollisionObject* obj) const {
+  const auto it = velocities.find(obj);
+  if (it == velocities.end()) return Vec3f::Zero();
+  return it->second;
+}
+
 //==============================================================================
 void DynamicAABBTreeCollisionManager::clear() {
+  velocities.clear();
   dtree.clear();
   table.clear();
+  stree.clear();
+  static_table.clear();
+  static_setup_ = true;
 }
 
 //==============================================================================
 void DynamicAABBTreeCollisionManager::getObjects(
     std::vector<CollisionObject*>& objs) const {
   objs.resize(this->size());
-  std::transform(
+  std::vector<CollisionObject*>::iterator end = std::transform(
       table.begin(), table.end(), objs.begin(),
       std::bind(&DynamicAABBTable::value_type::first, std::placeholders::_1));
+  std::transform(
+      static_table.begin(), static_table.end(), end,
+      std::bind(&DynamicAABBTable::value_type::first, std::placeholders::_1));
 }
 
 //==============================================================================
-void DynamicAABBTreeCollisionManager::collide(
-    CollisionObject* obj, CollisionCallBackBase* callback) const {
-  callback->init();
-  if (size() == 0) return;
+bool DynamicAABBTreeCollisionManager::collide_(
+    DynamicAABBNode* root, CollisionObject* obj,
+    CollisionCallBackBase* callback) const {
   switch (obj->collisionGeometry()->getNodeType()) {
 #if HPP_FCL_HAVE_OCTOMAP
     case GEOM_OCTREE: {
       if (!octree_as_geometry_collide) {
         const OcTree* octree =
             static_cast<const OcTree*>(obj->collisionGeometry().get());
-        detail::dynamic_AABB_tree::collisionRecurse(
-            dtree.getRoot(), octree, octree->getRoot(), octree->getRootBV(),
+        return detail::dynamic_AABB_tree::collisionRecurse(
+            root, octree, octree->getRoot(), octree->getRootBV(),
             obj->getTransform(), callback);
       } else
-        detail::dynamic_AABB_tree::collisionRecurse(dtree.getRoot(), obj,
-                                                    callback);
-    } break;
+        return detail::dynamic_AABB_tree::collisionRecurse(root, obj,
+                                                           callback);
+    }
 #endif
     default:
-      detail::dynamic_AABB_tree::collisionRecurse(dtree.getRoot(), obj,
-                                                  callback);
+      return detail::dynamic_AABB_tree::collisionRecurse(root, obj, callback);
   }
 }
 
 //==============================================================================
-void DynamicAABBTreeCollisionManager::distance(
-    CollisionObject* obj, DistanceCallBackBase* callback) const {
-  callback->init();
-  if (size() == 0) return;
-  FCL_REAL min_dist = (std::numeric_limits<FCL_REAL>::max)();
+bool DynamicAABBTreeCollisionManager::distance_(
+    DynamicAABBNode* root, CollisionObject* obj,
+    DistanceCallBackBase* callback, FCL_REAL& min_dist) const {
   switch (obj->collisionGeometry()->getNodeType()) {
 #if HPP_FCL_HAVE_OCTOMAP
     case GEOM_OCTREE: {
       if (!octree_as_geometry_distance) {
         const OcTree* octree =
             static_cast<const OcTree*>(obj->collisionGeometry().get());
-        detail::dynamic_AABB_tree::distanceRecurse(
-            dtree.getRoot(), octree, octree->getRoot(), octree->getRootBV(),
+        return detail::dynamic_AABB_tree::distanceRecurse(
+            root, octree, octree->getRoot(), octree->getRootBV(),
             obj->getTransform(), callback, min_dist);
       } else
-        detail::dynamic_AABB_tree::distanceRecurse(dtree.getRoot(), obj,
-                                                   callback, min_dist);
-    } break;
+        return detail::dynamic_AABB_tree::distanceRecurse(root, obj, callback,
+                                                          min_dist);
+    }
 #endif
     default:
-      detail::dynamic_AABB_tree::distanceRecurse(dtree.getRoot(), obj, callback,
-                                                 min_dist);
+      return detail::dynamic_AABB_tree::distanceRecurse(root, obj, callback,
+                                                        min_dist);
   }
 }
 
 //==============================================================================
 void DynamicAABBTreeCollisionManager::collide(
-    CollisionCallBackBase* callback) const {
+    CollisionObject* obj, CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_DYNAMIC_AABB_TREE);
+  HPP_FCL_TRACE_SPAN("DynamicAABBTreeCollisionManager::collide", "broadphase");
   callback->init();
   if (size() == 0) return;
-  detail::dynamic_AABB_tree::selfCollisionRecurse(dtree.getRoot(), callback);
+  if (!dtree.empty() && collide_(dtree.getRoot(), obj, callback)) return;
+  if (!stree.empty()) collide_(stree.getRoot(), obj, callback);
 }
 
 //==============================================================================
 void DynamicAABBTreeCollisionManager::distance(
-    DistanceCallBackBase* callback) const {
+    CollisionObject* obj, DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_DYNAMIC_AABB_TREE);
+  HPP_FCL_TRACE_SPAN("DynamicAABBTreeCollisionManager::distance", "broadphase");
   callback->init();
   if (size() == 0) return;
   FCL_REAL min_dist = (std::numeric_limits<FCL_REAL>::max)();
-  detail::dynamic_AABB_tree::selfDistanceRecurse(dtree.getRoot(), callback,
-                                                 min_dist);
+  if (!dtree.empty() && distance_(dtree.getRoot(), obj, callback, min_dist))
+    return;
+  if (!stree.empty()) distance_(stree.getRoot(), obj, callback, min_dist);
+}
+
+//==============================================================================
+void DynamicAABBTreeCollisionManager::collide(
+    CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_DYNAMIC_AABB_TREE);
+  HPP_FCL_TRACE_SPAN("DynamicAABBTreeCollisionManager::collide", "broadphase");
+  callback->init();
+  if (dtree.empty()) return;
+  // Pairs of static objects are skipped.
+  if (detail::dynamic_AABB_tree::selfCollisionRecurse(dtree.getRoot(),
+                                                      callback))
+    return;
+  if (!stree.empty())
+    detail::dynamic_AABB_tree::collisionRecurse(dtree.getRoot(),
+                                                stree.getRoot(), callback);
+}
+
+//==============================================================================
+void DynamicAABBTreeCollisionManager::distance(
+    DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_DYNAMIC_AABB_TREE);
+  HPP_FCL_TRACE_SPAN("DynamicAABBTreeCollisionManager::distance", "broadphase");
+  callback->init();
+  if (dtree.empty()) return;
+  FCL_REAL min_dist = (std::numeric_limits<FCL_REAL>::max)();
+  // Pairs of static objects are skipped.
+  if (detail::dynamic_AABB_tree::selfDistanceRecurse(dtree.getRoot(),
+                                                     callback, min_dist))
+    return;
+  if (!stree.empty())
+    detail::dynamic_AABB_tree::distanceRecurse(
+        dtree.getRoot(), stree.getRoot(), callback, min_dist);
 }
 
 //==============================================================================
 void DynamicAABBTreeCollisionManager::collide(
     BroadPhaseCollisionManager* other_manager_,
     CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_DYNAMIC_AABB_TREE);
+  HPP_FCL_TRACE_SPAN("DynamicAABBTreeCollisionManager::collide", "broadphase");
   callback->init();
   DynamicAABBTreeCollisionManager* other_manager =
       static_cast<DynamicAABBTreeCollisionManager*>(other_manager_);
   if ((size() == 0) || (other_manager->size() == 0)) return;
-  detail::dynamic_AABB_tree::collisionRecurse(
-      dtree.getRoot(), other_manager->dtree.getRoot(), callback);
+  DynamicAABBNode* roots1[2] = {dtree.getRoot(), stree.getRoot()};
+  DynamicAABBNode* roots2[2] = {other_manager->dtree.getRoot(),
+                                other_manager->stree.getRoot()};
+  for (int i = 0; i < 2; ++i) {
+    if (roots1[i] == nullptr) continue;
+    for (int j = 0; j < 2; ++j) {
+      if (roots2[j] == nullptr) continue;
+      if (detail::dynamic_AABB_tree::collisionRecurse(roots1[i], roots2[j],
+                                                      callback))
+        return;
+    }
+  }
 }
 
 //==============================================================================
 void DynamicAABBTreeCollisionManager::distance(
     BroadPhaseCollisionManager* other_manager_,
     DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_DYNAMIC_AABB_TREE);
+  HPP_FCL_TRACE_SPAN("DynamicAABBTreeCollisionManager::distance", "broadphase");
   callback->init();
   DynamicAABBTreeCollisionManager* other_manager =
       static_cast<DynamicAABBTreeCollisionManager*>(other_manager_);
   if ((size() == 0) || (other_manager->size() == 0)) return;
   FCL_REAL min_dist = (std::numeric_limits<FCL_REAL>::max)();
-  detail::dynamic_AABB_tree::distanceRecurse(
-      dtree.getRoot(), other_manager->dtree.getRoot(), callback, min_dist);
+  DynamicAABBNode* roots1[2] = {dtree.getRoot(), stree.getRoot()};
+  DynamicAABBNode* roots2[2] = {other_manager->dtree.getRoot(),
+                                other_manager->stree.getRoot()};
+  for (int i = 0; i < 2; ++i) {
+    if (roots1[i] == nullptr) continue;
+    for (int j = 0; j < 2; ++j) {
+      if (roots2[j] == nullptr) continue;
+      if (detail::dynamic_AABB_tree::distanceRecurse(roots1[i], roots2[j],
+                                                     callback, min_dist))
+        return;
+    }
+  }
 }
 
 //==============================================================================
-bool DynamicAABBTreeCollisionManager::empty() const { return dtree.empty(); }
+bool DynamicAABBTreeCollisionManager::empty() const {
+  return dtree.empty() && stree.empty();
+}
 
 //==============================================================================
-size_t DynamicAABBTreeCollisionManager::size() const { return dtree.size(); }
+size_t DynamicAABBTreeCollisionManager::size() const {
+  return dtree.size() + stree.size();
+}
 
 //==============================================================================
 const detail::HierarchyTree<AABB>& DynamicAABBTreeCollisionManager::getTree()
@@ -674,5 +870,11 @@ detail::HierarchyTree<AABB>& DynamicAABBTreeCollisionManager::getTree() {
   return dtree;
 }
 
+//==============================================================================
+const detail::HierarchyTree<AABB>&
+DynamicAABBTreeCollisionManager::getStaticTree() const {
+  return stree;
+}
+
 }  // namespace fcl
 }  // namespace hpp
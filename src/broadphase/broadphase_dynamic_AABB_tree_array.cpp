@@ -236,9 +236,11 @@ bool collisionRecurse(
   DynamicAABBTreeArrayCollisionManager::DynamicAABBNode* root2 =
       nodes2 + root2_id;
   if (root1->isLeaf() && root2->isLeaf()) {
-    if (!root1->bv.overlap(root2->bv)) return false;
-    return (*callback)(static_cast<CollisionObject*>(root1->data),
-                       static_cast<CollisionObject*>(root2->data));
+    // The leaves may store enlarged AABBs: test the exact ones.
+    CollisionObject* obj1 = static_cast<CollisionObject*>(root1->data);
+    CollisionObject* obj2 = static_cast<CollisionObject*>(root2->data);
+    if (!obj1->getAABB().overlap(obj2->getAABB())) return false;
+    return (*callback)(obj1, obj2);
   }
 
   if (!root1->bv.overlap(root2->bv)) return false;
@@ -270,7 +272,9 @@ inline HPP_FCL_DLLAPI bool collisionRecurse(
   if (!root->bv.overlap(query->getAABB())) return false;
 
   if (root->isLeaf()) {
-    return (*callback)(static_cast<CollisionObject*>(root->data), query);
+    CollisionObject* obj = static_cast<CollisionObject*>(root->data);
+    if (!obj->getAABB().overlap(query->getAABB())) return false;
+    return (*callback)(obj, query);
   }
 
   size_t select_res = implementation_array::select(
@@ -492,6 +496,8 @@ DynamicAABBTreeArrayCollisionManager::DynamicAABBTreeArrayCollisionManager() {
   // from experiment, this is the optimal setting
   octree_as_geometry_collide = true;
   octree_as_geometry_distance = false;
+
+  fat_aabb_margin = 0;
 }
 
 //==============================================================================
@@ -530,6 +536,7 @@ void DynamicAABBTreeArrayCollisionManager::registerObject(
 //==============================================================================
 void DynamicAABBTreeArrayCollisionManager::unregisterObject(
     CollisionObject* obj) {
+  velocities.erase(obj);
   size_t node = table[obj];
   table.erase(obj);
   dtree.remove(node);
@@ -558,6 +565,18 @@ void DynamicAABBTreeArrayCollisionManager::setup() {
 
 //==============================================================================
 void DynamicAABBTreeArrayCollisionManager::update() {
+  if (fat_aabb_margin > 0) {
+    bool moved = false;
+    for (auto it = table.cbegin(), end = table.cend(); it != end; ++it)
+      moved |= dtree.update(it->second, it->first->getAABB(),
+                            velocity_(it->first), fat_aabb_margin);
+    if (moved) {
+      setup_ = false;
+      setup();
+    }
+    return;
+  }
+
   for (auto it = table.cbegin(), end = table.cend(); it != end; ++it) {
     const CollisionObject* obj = it->first;
     size_t node = it->second;
@@ -576,7 +595,11 @@ void DynamicAABBTreeArrayCollisionManager::update_(
   const auto it = table.find(updated_obj);
   if (it != table.end()) {
     size_t node = it->second;
-    if (!(dtree.getNodes()[node].bv == updated_obj->getAABB()))
+    if (fat_aabb_margin > 0) {
+      if (!dtree.update(node, updated_obj->getAABB(), velocity_(updated_obj),
+                        fat_aabb_margin))
+        return;
+    } else if (!(dtree.getNodes()[node].bv == updated_obj->getAABB()))
       dtree.update(node, updated_obj->getAABB());
   }
   setup_ = false;
@@ -597,8 +620,23 @@ void DynamicAABBTreeArrayCollisionManager::update(
   setup();
 }
 
+//==============================================================================
+void DynamicAABBTreeArrayCollisionManager::setVelocity(CollisionObject* obj,
+                                                       const Vec3f& vel) {
+  velocities[obj] = vel;
+}
+
+//==============================================================================
+Vec3f DynamicAABBTreeArrayCollisionManager::velocity_(
+    CollisionObject* obj) const {
+  const auto it = velocities.find(obj);
+  if (it == velocities.end()) return Vec3f::Zero();
+  return it->second;
+}
+
 //==============================================================================
 void DynamicAABBTreeArrayCollisionManager::clear() {
+  velocities.clear();
   dtree.clear();
   table.clear();
 }
@@ -615,6 +653,9 @@ void DynamicAABBTreeArrayCollisionManager::getObjects(
 //==============================================================================
 void DynamicAABBTreeArrayCollisionManager::collide(
     CollisionObject* obj, CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_DYNAMIC_AABB_TREE_ARRAY);
+  HPP_FCL_TRACE_SPAN("DynamicAABBTreeArrayCollisionManager::collide",
+                     "broadphase");
   callback->init();
   if (size() == 0) return;
   switch (obj->collisionGeometry()->getNodeType()) {
@@ -640,6 +681,9 @@ void DynamicAABBTreeArrayCollisionManager::collide(
 //==============================================================================
 void DynamicAABBTreeArrayCollisionManager::distance(
     CollisionObject* obj, DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_DYNAMIC_AABB_TREE_ARRAY);
+  HPP_FCL_TRACE_SPAN("DynamicAABBTreeArrayCollisionManager::distance",
+                     "broadphase");
   callback->init();
   if (size() == 0) return;
   FCL_REAL min_dist = (std::numeric_limits<FCL_REAL>::max)();
@@ -666,6 +710,9 @@ void DynamicAABBTreeArrayCollisionManager::distance(
 //==============================================================================
 void DynamicAABBTreeArrayCollisionManager::collide(
     CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_DYNAMIC_AABB_TREE_ARRAY);
+  HPP_FCL_TRACE_SPAN("DynamicAABBTreeArrayCollisionManager::collide",
+                     "broadphase");
   callback->init();
   if (size() == 0) return;
   detail::dynamic_AABB_tree_array::selfCollisionRecurse(
@@ -675,6 +722,9 @@ void DynamicAABBTreeArrayCollisionManager::collide(
 //==============================================================================
 void DynamicAABBTreeArrayCollisionManager::distance(
     DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_DYNAMIC_AABB_TREE_ARRAY);
+  HPP_FCL_TRACE_SPAN("DynamicAABBTreeArrayCollisionManager::distance",
+                     "broadphase");
   callback->init();
   if (size() == 0) return;
   FCL_REAL min_dist = (std::numeric_limits<FCL_REAL>::max)();
@@ -686,6 +736,9 @@ void DynamicAABBTreeArrayCollisionManager::distance(
 void DynamicAABBTreeArrayCollisionManager::collide(
     BroadPhaseCollisionManager* other_manager_,
     CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_DYNAMIC_AABB_TREE_ARRAY);
+  HPP_FCL_TRACE_SPAN("DynamicAABBTreeArrayCollisionManager::collide",
+                     "broadphase");
   callback->init();
   DynamicAABBTreeArrayCollisionManager* other_manager =
       static_cast<DynamicAABBTreeArrayCollisionManager*>(other_manager_);
@@ -699,6 +752,9 @@ void DynamicAABBTreeArrayCollisionManager::collide(
 void DynamicAABBTreeArrayCollisionManager::distance(
     BroadPhaseCollisionManager* other_manager_,
     DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_DYNAMIC_AABB_TREE_ARRAY);
+  HPP_FCL_TRACE_SPAN("DynamicAABBTreeArrayCollisionManager::distance",
+                     "broadphase");
   callback->init();
   DynamicAABBTreeArrayCollisionManager* other_manager =
       static_cast<DynamicAABBTreeArrayCollisionManager*>(other_manager_);
@@ -0,0 +1,520 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "hpp/fcl/broadphase/broadphase_hierarchical_spatialhash.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace hpp {
+namespace fcl {
+
+namespace {
+/// Cell coordinates above this value are not representable by a CellKey.
+const FCL_REAL max_cell_coordinate = FCL_REAL(4e18);
+
+inline bool isRepresentable(const Vec3f& coords) {
+  return coords.cwiseAbs().maxCoeff() < max_cell_coordinate;
+}
+
+inline std::int64_t cellCoordinate(FCL_REAL x) {
+  return static_cast<std::int64_t>(std::floor(x));
+}
+}  // namespace
+
+//==============================================================================
+HierarchicalSpatialHashingCollisionManager::
+    HierarchicalSpatialHashingCollisionManager(FCL_REAL min_cell_size,
+                                               FCL_REAL level_ratio)
+    : min_cell_size(min_cell_size), level_ratio(level_ratio) {
+  if (min_cell_size <= 0)
+    HPP_FCL_THROW_PRETTY("min_cell_size must be strictly positive.",
+                         std::invalid_argument);
+  if (level_ratio <= 1)
+    HPP_FCL_THROW_PRETTY("level_ratio must be greater than 1.",
+                         std::invalid_argument);
+}
+
+//==============================================================================
+void HierarchicalSpatialHashingCollisionManager::locate(
+    const AABB& aabb, ObjectEntry& entry) const {
+  entry.aabb = aabb;
+  entry.unbounded = true;
+
+  const FCL_REAL size = (aabb.max_ - aabb.min_).maxCoeff();
+  if (!(size < (std::numeric_limits<FCL_REAL>::max)())) return;
+
+  FCL_REAL cell_size = min_cell_size;
+  unsigned int level = 0;
+  while (cell_size < size) {
+    cell_size *= level_ratio;
+    ++level;
+  }
+
+  const Vec3f coords(aabb.min_ / cell_size);
+  if (!isRepresentable(coords)) return;
+
+  entry.unbounded = false;
+  entry.level = level;
+  entry.cell.x = cellCoordinate(coords[0]);
+  entry.cell.y = cellCoordinate(coords[1]);
+  entry.cell.z = cellCoordinate(coords[2]);
+}
+
+//==============================================================================
+void HierarchicalSpatialHashingCollisionManager::insert(
+    CollisionObject* obj, const ObjectEntry& entry) {
+  if (entry.unbounded) {
+    unbounded_objs.push_back(obj);
+    return;
+  }
+
+  LevelMap::iterator it = levels.find(entry.level);
+  if (it == levels.end()) {
+    Level level;
+    level.cell_size = min_cell_size;
+    for (unsigned int i = 0; i < entry.level; ++i)
+      level.cell_size *= level_ratio;
+    level.num_objects = 0;
+    it = levels.insert(std::make_pair(entry.level, level)).first;
+  }
+  it->second.cells[entry.cell].push_back(obj);
+  ++it->second.num_objects;
+}
+
+//==============================================================================
+void HierarchicalSpatialHashingCollisionManager::remove(
+    CollisionObject* obj, const ObjectEntry& entry) {
+  if (entry.unbounded) {
+    std::vector<CollisionObject*>::iterator it =
+        std::find(unbounded_objs.begin(), unbounded_objs.end(), obj);
+    if (it != unbounded_objs.end()) unbounded_objs.erase(it);
+    return;
+  }
+
+  LevelMap::iterator level_it = levels.find(entry.level);
+  if (level_it == levels.end()) return;
+  Level& level = level_it->second;
+
+  CellMap::iterator cell_it = level.cells.find(entry.cell);
+  if (cell_it == level.cells.end()) return;
+  Cell& cell = cell_it->second;
+
+  Cell::iterator it = std::find(cell.begin(), cell.end(), obj);
+  if (it == cell.end()) return;
+  *it = cell.back();
+  cell.pop_back();
+  if (cell.empty()) level.cells.erase(cell_it);
+  if (--level.num_objects == 0) levels.erase(level_it);
+}
+
+//==============================================================================
+void HierarchicalSpatialHashingCollisionManager::registerObject(
+    CollisionObject* obj) {
+  ObjectEntry entry;
+  locate(obj->getAABB(), entry);
+
+  std::pair<ObjectMap::iterator, bool> res =
+      objs.insert(std::make_pair(obj, entry));
+  if (!res.second) {
+    // The object is already registered: just update its location.
+    remove(obj, res.first->second);
+    res.first->second = entry;
+  }
+  insert(obj, entry);
+}
+
+//==============================================================================
+void HierarchicalSpatialHashingCollisionManager::unregisterObject(
+    CollisionObject* obj) {
+  ObjectMap::iterator it = objs.find(obj);
+  if (it == objs.end()) return;
+
+  remove(obj, it->second);
+  objs.erase(it);
+}
+
+//==============================================================================
+void HierarchicalSpatialHashingCollisionManager::setup() {
+  // Do nothing
+}
+
+//==============================================================================
+void HierarchicalSpatialHashingCollisionManager::update() {
+  for (ObjectMap::iterator it = objs.begin(); it != objs.end(); ++it)
+    update(it->first);
+}
+
+//==============================================================================
+void HierarchicalSpatialHashingCollisionManager::update(
+    CollisionObject* updated_obj) {
+  ObjectMap::iterator it = objs.find(updated_obj);
+  if (it == objs.end()) return;
+
+  ObjectEntry& old_entry = it->second;
+  ObjectEntry new_entry;
+  locate(updated_obj->getAABB(), new_entry);
+
+  // Only move the object when it changes of cell.
+  if (old_entry.unbounded != new_entry.unbounded ||
+      (!new_entry.unbounded && (old_entry.level != new_entry.level ||
+                                !(old_entry.cell == new_entry.cell)))) {
+    remove(updated_obj, old_entry);
+    insert(updated_obj, new_entry);
+  }
+  old_entry = new_entry;
+}
+
+//==============================================================================
+void HierarchicalSpatialHashingCollisionManager::update(
+    const std::vector<CollisionObject*>& updated_objs) {
+  for (size_t i = 0; i < updated_objs.size(); ++i) update(updated_objs[i]);
+}
+
+//==============================================================================
+void HierarchicalSpatialHashingCollisionManager::clear() {
+  levels.clear();
+  unbounded_objs.clear();
+  objs.clear();
+}
+
+//==============================================================================
+void HierarchicalSpatialHashingCollisionManager::getObjects(
+    std::vector<CollisionObject*>& objs_) const {
+  objs_.resize(objs.size());
+  size_t i = 0;
+  for (ObjectMap::const_iterator it = objs.begin(); it != objs.end(); ++it)
+    objs_[i++] = it->first;
+}
+
+//==============================================================================
+template <typename Visitor>
+bool HierarchicalSpatialHashingCollisionManager::visitLevel(
+    const Level& level, const AABB& query, Visitor& visitor) const {
+  const Vec3f lo(query.min_ / level.cell_size);
+  const Vec3f hi(query.max_ / level.cell_size);
+
+  // The objects of this level are smaller than a cell. Those overlapping the
+  // query have their lower corner in the cells [lo - 1, hi].
+  bool scan_all = !isRepresentable(lo) || !isRepresentable(hi);
+  CellKey lo_key, hi_key;
+  if (!scan_all) {
+    lo_key.x = cellCoordinate(lo[0]) - 1;
+    lo_key.y = cellCoordinate(lo[1]) - 1;
+    lo_key.z = cellCoordinate(lo[2]) - 1;
+    hi_key.x = cellCoordinate(hi[0]);
+    hi_key.y = cellCoordinate(hi[1]);
+    hi_key.z = cellCoordinate(hi[2]);
+    const FCL_REAL num_cells = FCL_REAL(hi_key.x - lo_key.x + 1) *
+                               FCL_REAL(hi_key.y - lo_key.y + 1) *
+                               FCL_REAL(hi_key.z - lo_key.z + 1);
+    // Iterating over the non empty cells is cheaper than looking up every
+    // cell covered by the query.
+    scan_all = num_cells > FCL_REAL(level.cells.size());
+  }
+
+  if (scan_all) {
+    for (CellMap::const_iterator it = level.cells.begin();
+         it != level.cells.end(); ++it) {
+      for (size_t i = 0; i < it->second.size(); ++i)
+        if (visitor(it->second[i])) return true;
+    }
+    return false;
+  }
+
+  CellKey key;
+  for (key.x = lo_key.x; key.x <= hi_key.x; ++key.x) {
+    for (key.y = lo_key.y; key.y <= hi_key.y; ++key.y) {
+      for (key.z = lo_key.z; key.z <= hi_key.z; ++key.z) {
+        CellMap::const_iterator it = level.cells.find(key);
+        if (it == level.cells.end()) continue;
+        for (size_t i = 0; i < it->second.size(); ++i)
+          if (visitor(it->second[i])) return true;
+      }
+    }
+  }
+  return false;
+}
+
+namespace {
+struct CollideVisitor {
+  CollisionObject* obj;
+  CollisionCallBackBase* callback;
+  bool check_order;
+
+  bool operator()(CollisionObject* obj2) const {
+    if (obj == obj2) return false;
+    if (check_order && !(obj < obj2)) return false;
+    if (!obj->getAABB().overlap(obj2->getAABB())) return false;
+    return (*callback)(obj, obj2);
+  }
+};
+}  // namespace
+
+//==============================================================================
+bool HierarchicalSpatialHashingCollisionManager::collide_(
+    CollisionObject* obj, CollisionCallBackBase* callback,
+    unsigned int min_level, bool check_order) const {
+  const AABB& aabb = obj->getAABB();
+  CollideVisitor visitor = {obj, callback, check_order};
+
+  for (LevelMap::const_iterator it = levels.lower_bound(min_level);
+       it != levels.end(); ++it) {
+    // Pairs between objects of different levels are only tested once, by the
+    // object of the lowest level.
+    visitor.check_order = check_order && it->first == min_level;
+    if (visitLevel(it->second, aabb, visitor)) return true;
+  }
+
+  visitor.check_order = false;
+  for (size_t i = 0; i < unbounded_objs.size(); ++i)
+    if (visitor(unbounded_objs[i])) return true;
+
+  return false;
+}
+
+//==============================================================================
+void HierarchicalSpatialHashingCollisionManager::collide(
+    CollisionObject* obj, CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_HIERARCHICAL_SPATIAL_HASH);
+  HPP_FCL_TRACE_SPAN("HierarchicalSpatialHashingCollisionManager::collide",
+                     "broadphase");
+  callback->init();
+  if (size() == 0) return;
+  collide_(obj, callback, 0, false);
+}
+
+//==============================================================================
+void HierarchicalSpatialHashingCollisionManager::collide(
+    CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_HIERARCHICAL_SPATIAL_HASH);
+  HPP_FCL_TRACE_SPAN("HierarchicalSpatialHashingCollisionManager::collide",
+                     "broadphase");
+  callback->init();
+  if (size() == 0) return;
+
+  for (ObjectMap::const_iterator it = objs.begin(); it != objs.end(); ++it) {
+    CollisionObject* obj = it->first;
+    if (it->second.unbounded) {
+      CollideVisitor visitor = {obj, callback, true};
+      for (size_t i = 0; i < unbounded_objs.size(); ++i)
+        if (visitor(unbounded_objs[i])) return;
+    } else if (collide_(obj, callback, it->second.level, true))
+      return;
+  }
+}
+
+//==============================================================================
+void HierarchicalSpatialHashingCollisionManager::collide(
+    BroadPhaseCollisionManager* other_manager_,
+    CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_HIERARCHICAL_SPATIAL_HASH);
+  HPP_FCL_TRACE_SPAN("HierarchicalSpatialHashingCollisionManager::collide",
+                     "broadphase");
+  callback->init();
+  HierarchicalSpatialHashingCollisionManager* other_manager =
+      static_cast<HierarchicalSpatialHashingCollisionManager*>(other_manager_);
+
+  if ((size() == 0) || (other_manager->size() == 0)) return;
+
+  if (this == other_manager) {
+    collide(callback);
+    return;
+  }
+
+  if (this->size() < other_manager->size()) {
+    for (ObjectMap::const_iterator it = objs.begin(); it != objs.end(); ++it)
+      if (other_manager->collide_(it->first, callback, 0, false)) return;
+  } else {
+    for (ObjectMap::const_iterator it = other_manager->objs.begin();
+         it != other_manager->objs.end(); ++it)
+      if (collide_(it->first, callback, 0, false)) return;
+  }
+}
+
+namespace {
+struct DistanceVisitor {
+  CollisionObject* obj;
+  DistanceCallBackBase* callback;
+  FCL_REAL* min_dist;
+  bool use_tested_set;
+  std::set<std::pair<CollisionObject*, CollisionObject*> >* tested_set;
+
+  /// The current query and the one of the previous pass, if any.
+  AABB query;
+  const AABB* previous_query;
+
+  /// Number of objects overlapping the query.
+  size_t count;
+
+  bool operator()(CollisionObject* obj2) {
+    const AABB& aabb2 = obj2->getAABB();
+    if (!query.overlap(aabb2)) return false;
+    ++count;
+    if (obj == obj2) return false;
+    // Objects overlapping the previous query have already been tested.
+    if (previous_query != NULL && previous_query->overlap(aabb2)) return false;
+
+    if (use_tested_set) {
+      std::pair<CollisionObject*, CollisionObject*> key =
+          obj < obj2 ? std::make_pair(obj, obj2) : std::make_pair(obj2, obj);
+      if (!tested_set->insert(key).second) return false;
+    }
+
+    if (obj->getAABB().distance(aabb2) < *min_dist)
+      return (*callback)(obj, obj2, *min_dist);
+    return false;
+  }
+};
+}  // namespace
+
+//==============================================================================
+bool HierarchicalSpatialHashingCollisionManager::distance_(
+    CollisionObject* obj, DistanceCallBackBase* callback,
+    FCL_REAL& min_dist) const {
+  const AABB& aabb = obj->getAABB();
+
+  // Start with a search radius of the order of the size of the object and
+  // double it until the closest object is found.
+  FCL_REAL radius = min_dist;
+  if (!(radius < (std::numeric_limits<FCL_REAL>::max)()))
+    radius = (std::max)(min_cell_size, (aabb.max_ - aabb.min_).maxCoeff());
+
+  DistanceVisitor visitor;
+  visitor.obj = obj;
+  visitor.callback = callback;
+  visitor.min_dist = &min_dist;
+  visitor.use_tested_set = this->enable_tested_set_;
+  visitor.tested_set = &this->tested_set;
+  visitor.previous_query = NULL;
+
+  AABB previous_query;
+  while (true) {
+    visitor.query = aabb;
+    visitor.query.expand(radius);
+    visitor.count = 0;
+
+    for (LevelMap::const_iterator it = levels.begin(); it != levels.end(); ++it)
+      if (visitLevel(it->second, visitor.query, visitor)) return true;
+    for (size_t i = 0; i < unbounded_objs.size(); ++i)
+      if (visitor(unbounded_objs[i])) return true;
+
+    // Every object closer than min_dist is inside the query, or all the
+    // objects have been tested.
+    if (min_dist <= radius || visitor.count >= size()) break;
+
+    previous_query = visitor.query;
+    visitor.previous_query = &previous_query;
+    radius *= 2;
+  }
+  return false;
+}
+
+//==============================================================================
+void HierarchicalSpatialHashingCollisionManager::distance(
+    CollisionObject* obj, DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_HIERARCHICAL_SPATIAL_HASH);
+  HPP_FCL_TRACE_SPAN("HierarchicalSpatialHashingCollisionManager::distance",
+                     "broadphase");
+  callback->init();
+  if (size() == 0) return;
+  FCL_REAL min_dist = (std::numeric_limits<FCL_REAL>::max)();
+  distance_(obj, callback, min_dist);
+}
+
+//==============================================================================
+void HierarchicalSpatialHashingCollisionManager::distance(
+    DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_HIERARCHICAL_SPATIAL_HASH);
+  HPP_FCL_TRACE_SPAN("HierarchicalSpatialHashingCollisionManager::distance",
+                     "broadphase");
+  callback->init();
+  if (size() == 0) return;
+
+  this->enable_tested_set_ = true;
+  this->tested_set.clear();
+
+  FCL_REAL min_dist = (std::numeric_limits<FCL_REAL>::max)();
+
+  for (ObjectMap::const_iterator it = objs.begin(); it != objs.end(); ++it)
+    if (distance_(it->first, callback, min_dist)) break;
+
+  this->enable_tested_set_ = false;
+  this->tested_set.clear();
+}
+
+//==============================================================================
+void HierarchicalSpatialHashingCollisionManager::distance(
+    BroadPhaseCollisionManager* other_manager_,
+    DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_HIERARCHICAL_SPATIAL_HASH);
+  HPP_FCL_TRACE_SPAN("HierarchicalSpatialHashingCollisionManager::distance",
+                     "broadphase");
+  callback->init();
+  HierarchicalSpatialHashingCollisionManager* other_manager =
+      static_cast<HierarchicalSpatialHashingCollisionManager*>(other_manager_);
+
+  if ((size() == 0) || (other_manager->size() == 0)) return;
+
+  if (this == other_manager) {
+    distance(callback);
+    return;
+  }
+
+  FCL_REAL min_dist = (std::numeric_limits<FCL_REAL>::max)();
+
+  if (this->size() < other_manager->size()) {
+    for (ObjectMap::const_iterator it = objs.begin(); it != objs.end(); ++it)
+      if (other_manager->distance_(it->first, callback, min_dist)) return;
+  } else {
+    for (ObjectMap::const_iterator it = other_manager->objs.begin();
+         it != other_manager->objs.end(); ++it)
+      if (distance_(it->first, callback, min_dist)) return;
+  }
+}
+
+//==============================================================================
+bool HierarchicalSpatialHashingCollisionManager::empty() const {
+  return objs.empty();
+}
+
+//==============================================================================
+size_t HierarchicalSpatialHashingCollisionManager::size() const {
+  return objs.size();
+}
+
+}  // namespace fcl
+}  // namespace hpp
@@ -319,6 +319,8 @@ void IntervalTreeCollisionManager::getObjects(
 //==============================================================================
 void IntervalTreeCollisionManager::collide(
     CollisionObject* obj, CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_INTERVAL_TREE);
+  HPP_FCL_TRACE_SPAN("IntervalTreeCollisionManager::collide", "broadphase");
   callback->init();
   if (size() == 0) return;
   collide_(obj, callback);
@@ -361,6 +363,8 @@ bool IntervalTreeCollisionManager::collide_(
 //==============================================================================
 void IntervalTreeCollisionManager::distance(
     CollisionObject* obj, DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_INTERVAL_TREE);
+  HPP_FCL_TRACE_SPAN("IntervalTreeCollisionManager::distance", "broadphase");
   callback->init();
   if (size() == 0) return;
   FCL_REAL min_dist = (std::numeric_limits<FCL_REAL>::max)();
@@ -373,7 +377,7 @@ bool IntervalTreeCollisionManager::distance_(CollisionObject* obj,
                                              FCL_REAL& min_dist) const {
   static const unsigned int CUTOFF = 100;
 
-  Vec3f delta = (obj->getAABB().max_ - obj->getAABB().min_) * 0.5;
+  Vec3f delta = (obj->getAABB().max_ - obj->getAABB().min_) * FCL_REAL(0.5);
   AABB aabb = obj->getAABB();
   if (min_dist < (std::numeric_limits<FCL_REAL>::max)()) {
     Vec3f min_dist_delta(min_dist, min_dist, min_dist);
@@ -450,6 +454,8 @@ bool IntervalTreeCollisionManager::distance_(CollisionObject* obj,
 //==============================================================================
 void IntervalTreeCollisionManager::collide(
     CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_INTERVAL_TREE);
+  HPP_FCL_TRACE_SPAN("IntervalTreeCollisionManager::collide", "broadphase");
   callback->init();
   if (size() == 0) return;
 
@@ -504,6 +510,8 @@ void IntervalTreeCollisionManager::collide(
 //==============================================================================
 void IntervalTreeCollisionManager::distance(
     DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_INTERVAL_TREE);
+  HPP_FCL_TRACE_SPAN("IntervalTreeCollisionManager::distance", "broadphase");
   callback->init();
   if (size() == 0) return;
 
@@ -522,6 +530,8 @@ void IntervalTreeCollisionManager::distance(
 void IntervalTreeCollisionManager::collide(
     BroadPhaseCollisionManager* other_manager_,
     CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_INTERVAL_TREE);
+  HPP_FCL_TRACE_SPAN("IntervalTreeCollisionManager::collide", "broadphase");
   callback->init();
   IntervalTreeCollisionManager* other_manager =
       static_cast<IntervalTreeCollisionManager*>(other_manager_);
@@ -546,6 +556,8 @@ void IntervalTreeCollisionManager::collide(
 void IntervalTreeCollisionManager::distance(
     BroadPhaseCollisionManager* other_manager_,
     DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_INTERVAL_TREE);
+  HPP_FCL_TRACE_SPAN("IntervalTreeCollisionManager::distance", "broadphase");
   callback->init();
   IntervalTreeCollisionManager* other_manager =
       static_cast<IntervalTreeCollisionManager*>(other_manager_);
@@ -0,0 +1,539 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "hpp/fcl/broadphase/broadphase_radix_SaP.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace hpp {
+namespace fcl {
+
+namespace {
+/// Map a floating point value to an unsigned integer with the same ordering.
+inline std::uint64_t sortKey(FCL_REAL value) {
+  const double x = static_cast<double>(value);
+  std::uint64_t u;
+  std::memcpy(&u, &x, sizeof(u));
+  const std::uint64_t sign_bit = std::uint64_t(1) << 63;
+  return (u & sign_bit) ? ~u : (u | sign_bit);
+}
+
+/// LSD radix sort of keys, applying the same permutation to values.
+void radixSort(std::vector<std::uint64_t>& keys, std::vector<size_t>& values,
+               std::vector<std::uint64_t>& keys_tmp,
+               std::vector<size_t>& values_tmp) {
+  static const int bits = 11;
+  static const size_t num_buckets = size_t(1) << bits;
+  static const std::uint64_t mask = num_buckets - 1;
+
+  const size_t n = keys.size();
+  keys_tmp.resize(n);
+  values_tmp.resize(n);
+
+  size_t count[num_buckets];
+  for (int shift = 0; shift < 64; shift += bits) {
+    std::fill(count, count + num_buckets, 0);
+    for (size_t i = 0; i < n; ++i) ++count[(keys[i] >> shift) & mask];
+    // All the keys share this digit: skip the pass.
+    if (count[(keys[0] >> shift) & mask] == n) continue;
+
+    size_t offset = 0;
+    for (size_t b = 0; b < num_buckets; ++b) {
+      const size_t c = count[b];
+      count[b] = offset;
+      offset += c;
+    }
+    for (size_t i = 0; i < n; ++i) {
+      const size_t dst = count[(keys[i] >> shift) & mask]++;
+      keys_tmp[dst] = keys[i];
+      values_tmp[dst] = values[i];
+    }
+    keys.swap(keys_tmp);
+    values.swap(values_tmp);
+  }
+}
+
+/// Insertion sort of keys, applying the same permutation to values. Returns
+/// false if more than max_moves moves are needed, in which case keys and
+/// values are left partially sorted.
+bool insertionSort(std::vector<std::uint64_t>& keys,
+                   std::vector<size_t>& values, size_t max_moves) {
+  size_t moves = 0;
+  for (size_t i = 1; i < keys.size(); ++i) {
+    const std::uint64_t key = keys[i];
+    const size_t value = values[i];
+    size_t j = i;
+    for (; j > 0 && keys[j - 1] > key; --j) {
+      keys[j] = keys[j - 1];
+      values[j] = values[j - 1];
+      ++moves;
+    }
+    keys[j] = key;
+    values[j] = value;
+    if (moves > max_moves) return false;
+  }
+  return true;
+}
+
+template <typename T>
+void permute(std::vector<T>& array, const std::vector<size_t>& order,
+             std::vector<T>& tmp) {
+  tmp.resize(array.size());
+  for (size_t i = 0; i < order.size(); ++i) tmp[i] = array[order[i]];
+  array.swap(tmp);
+}
+
+/// Pointers to the sorted bounds of a RadixSaPCollisionManager.
+struct SortedBounds {
+  const FCL_REAL* lower[3];
+  const FCL_REAL* upper[3];
+};
+
+/// Call visitor on every sorted position in [begin, end) whose bounds overlap
+/// box. Returns true if visitor asks to stop.
+template <typename Visitor>
+bool visitOverlapping(const SortedBounds& b, size_t begin, size_t end,
+                      const AABB& box, Visitor& visitor) {
+  // The separation along an axis is max(lower) - min(upper), the intervals
+  // overlap when it is not positive. The test is done by blocks of fixed
+  // size so that it is vectorized.
+  static const int block_size = 8;
+  typedef Eigen::Array<FCL_REAL, block_size, 1> Block;
+  typedef Eigen::Map<const Block> MapBlock;
+
+  size_t pos = begin;
+  for (; pos + block_size <= end; pos += block_size) {
+    Block gap = MapBlock(b.lower[0] + pos).max(box.min_[0]) -
+                MapBlock(b.upper[0] + pos).min(box.max_[0]);
+    for (int axis = 1; axis < 3; ++axis)
+      gap = gap.max(MapBlock(b.lower[axis] + pos).max(box.min_[axis]) -
+                    MapBlock(b.upper[axis] + pos).min(box.max_[axis]));
+    if (!(gap <= 0).any()) continue;
+    for (int k = 0; k < block_size; ++k)
+      if (gap[k] <= 0 && visitor(pos + size_t(k))) return true;
+  }
+  for (; pos < end; ++pos) {
+    bool overlap = true;
+    for (int axis = 0; axis < 3 && overlap; ++axis)
+      overlap = b.lower[axis][pos] <= box.max_[axis] &&
+                b.upper[axis][pos] >= box.min_[axis];
+    if (overlap && visitor(pos)) return true;
+  }
+  return false;
+}
+
+struct CollideVisitor {
+  const std::vector<CollisionObject*>* objs;
+  const std::vector<size_t>* indices;
+  CollisionObject* obj;
+  CollisionCallBackBase* callback;
+
+  bool operator()(size_t pos) const {
+    CollisionObject* obj2 = (*objs)[(*indices)[pos]];
+    if (obj2 == obj) return false;
+    return (*callback)(obj, obj2);
+  }
+};
+}  // namespace
+
+//==============================================================================
+RadixSaPCollisionManager::RadixSaPCollisionManager()
+    : max_insertion_sort_ratio(4),
+      sweep_axis(0),
+      max_extent(0),
+      setup_(false) {
+  // Do nothing
+}
+
+//==============================================================================
+void RadixSaPCollisionManager::registerObject(CollisionObject* obj) {
+  objs.push_back(obj);
+  setup_ = false;
+}
+
+//==============================================================================
+void RadixSaPCollisionManager::unregisterObject(CollisionObject* obj) {
+  std::vector<CollisionObject*>::iterator it =
+      std::find(objs.begin(), objs.end(), obj);
+  if (it == objs.end()) return;
+  objs.erase(it);
+  setup_ = false;
+  setup();
+}
+
+//==============================================================================
+void RadixSaPCollisionManager::setup() {
+  if (!setup_) update();
+}
+
+//==============================================================================
+void RadixSaPCollisionManager::update() {
+  const size_t n = objs.size();
+  if (!setup_ || indices.size() != n) {
+    // The previous order is lost.
+    indices.resize(n);
+    for (size_t i = 0; i < n; ++i) indices[i] = i;
+  }
+
+  for (int axis = 0; axis < 3; ++axis) {
+    lower[axis].resize(n);
+    upper[axis].resize(n);
+  }
+
+  bound = AABB();
+  Vec3f sum(Vec3f::Zero()), sum2(Vec3f::Zero());
+  size_t num_finite = 0;
+  for (size_t pos = 0; pos < n; ++pos) {
+    const AABB& aabb = objs[indices[pos]]->getAABB();
+    for (int axis = 0; axis < 3; ++axis) {
+      lower[axis][pos] = aabb.min_[axis];
+      upper[axis][pos] = aabb.max_[axis];
+    }
+    if (pos == 0)
+      bound = aabb;
+    else
+      bound += aabb;
+    // Unbounded objects, such as half-spaces, would make the variance NaN.
+    if (!((aabb.max_ - aabb.min_).maxCoeff() <
+          (std::numeric_limits<FCL_REAL>::max)()))
+      continue;
+    const Vec3f center(aabb.center());
+    sum += center;
+    sum2 += center.cwiseProduct(center);
+    ++num_finite;
+  }
+
+  // Sweep along the axis of largest variance of the object centers.
+  const int previous_axis = sweep_axis;
+  if (num_finite > 0) {
+    const Vec3f variance(sum2 - sum.cwiseProduct(sum) / FCL_REAL(num_finite));
+    Eigen::DenseIndex axis;
+    variance.maxCoeff(&axis);
+    sweep_axis = static_cast<int>(axis);
+  }
+  if (sweep_axis != previous_axis) {
+    for (size_t i = 0; i < n; ++i) indices[i] = i;
+    for (size_t pos = 0; pos < n; ++pos) {
+      const AABB& aabb = objs[pos]->getAABB();
+      for (int axis = 0; axis < 3; ++axis) {
+        lower[axis][pos] = aabb.min_[axis];
+        upper[axis][pos] = aabb.max_[axis];
+      }
+    }
+  }
+
+  max_extent = 0;
+  for (size_t pos = 0; pos < n; ++pos)
+    max_extent = (std::max)(max_extent,
+                            upper[sweep_axis][pos] - lower[sweep_axis][pos]);
+
+  sort();
+  setup_ = true;
+}
+
+//==============================================================================
+void RadixSaPCollisionManager::sort() {
+  const size_t n = indices.size();
+  keys.resize(n);
+  order.resize(n);
+  for (size_t pos = 0; pos < n; ++pos) {
+    keys[pos] = sortKey(lower[sweep_axis][pos]);
+    order[pos] = pos;
+  }
+
+  // The order of the previous update is a good guess when the objects moved
+  // little. Otherwise, fall back to a radix sort.
+  const size_t max_moves =
+      static_cast<size_t>(max_insertion_sort_ratio * FCL_REAL(n));
+  if (!insertionSort(keys, order, max_moves))
+    radixSort(keys, order, keys_tmp, order_tmp);
+
+  permute(indices, order, indices_tmp);
+  for (int axis = 0; axis < 3; ++axis) {
+    permute(lower[axis], order, scratch);
+    permute(upper[axis], order, scratch);
+  }
+}
+
+//==============================================================================
+void RadixSaPCollisionManager::clear() {
+  objs.clear();
+  indices.clear();
+  for (int axis = 0; axis < 3; ++axis) {
+    lower[axis].clear();
+    upper[axis].clear();
+  }
+  setup_ = false;
+}
+
+//==============================================================================
+void RadixSaPCollisionManager::getObjects(
+    std::vector<CollisionObject*>& objs_) const {
+  objs_.resize(objs.size());
+  std::copy(objs.begin(), objs.end(), objs_.begin());
+}
+
+//==============================================================================
+void RadixSaPCollisionManager::sweepRange(FCL_REAL lo, FCL_REAL hi,
+                                          size_t& begin, size_t& end) const {
+  const std::vector<FCL_REAL>& sorted = lower[sweep_axis];
+  begin = static_cast<size_t>(
+      std::lower_bound(sorted.begin(), sorted.end(), lo - max_extent) -
+      sorted.begin());
+  end = static_cast<size_t>(
+      std::upper_bound(sorted.begin() + long(begin), sorted.end(), hi) -
+      sorted.begin());
+}
+
+//==============================================================================
+AABB RadixSaPCollisionManager::cachedAABB(size_t pos) const {
+  return AABB(Vec3f(lower[0][pos], lower[1][pos], lower[2][pos]),
+              Vec3f(upper[0][pos], upper[1][pos], upper[2][pos]));
+}
+
+//==============================================================================
+bool RadixSaPCollisionManager::collide_(
+    CollisionObject* obj, CollisionCallBackBase* callback) const {
+  const AABB& aabb = obj->getAABB();
+  size_t begin, end;
+  sweepRange(aabb.min_[sweep_axis], aabb.max_[sweep_axis], begin, end);
+
+  const SortedBounds bounds = {
+      {lower[0].data(), lower[1].data(), lower[2].data()},
+      {upper[0].data(), upper[1].data(), upper[2].data()}};
+  CollideVisitor visitor = {&objs, &indices, obj, callback};
+  return visitOverlapping(bounds, begin, end, aabb, visitor);
+}
+
+//==============================================================================
+void RadixSaPCollisionManager::collide(CollisionObject* obj,
+                                       CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_RADIX_SAP);
+  HPP_FCL_TRACE_SPAN("RadixSaPCollisionManager::collide", "broadphase");
+  callback->init();
+  if (size() == 0) return;
+
+  collide_(obj, callback);
+}
+
+//==============================================================================
+void RadixSaPCollisionManager::collide(CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_RADIX_SAP);
+  HPP_FCL_TRACE_SPAN("RadixSaPCollisionManager::collide", "broadphase");
+  callback->init();
+  if (size() == 0) return;
+
+  const std::vector<FCL_REAL>& sorted = lower[sweep_axis];
+  const SortedBounds bounds = {
+      {lower[0].data(), lower[1].data(), lower[2].data()},
+      {upper[0].data(), upper[1].data(), upper[2].data()}};
+  const size_t n = indices.size();
+  for (size_t pos = 0; pos < n; ++pos) {
+    // The objects after pos overlap along the sweep axis until their lower
+    // bound is above the upper bound of the object at pos.
+    const size_t end = static_cast<size_t>(
+        std::upper_bound(sorted.begin() + long(pos) + 1, sorted.end(),
+                         upper[sweep_axis][pos]) -
+        sorted.begin());
+    CollideVisitor visitor = {&objs, &indices, objs[indices[pos]], callback};
+    if (visitOverlapping(bounds, pos + 1, end, cachedAABB(pos), visitor))
+      return;
+  }
+}
+
+//==============================================================================
+void RadixSaPCollisionManager::collide(
+    BroadPhaseCollisionManager* other_manager_,
+    CollisionCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_RADIX_SAP);
+  HPP_FCL_TRACE_SPAN("RadixSaPCollisionManager::collide", "broadphase");
+  callback->init();
+  RadixSaPCollisionManager* other_manager =
+      static_cast<RadixSaPCollisionManager*>(other_manager_);
+
+  if ((size() == 0) || (other_manager->size() == 0)) return;
+
+  if (this == other_manager) {
+    collide(callback);
+    return;
+  }
+
+  if (this->size() < other_manager->size()) {
+    for (size_t i = 0; i < objs.size(); ++i)
+      if (other_manager->collide_(objs[i], callback)) return;
+  } else {
+    for (size_t i = 0; i < other_manager->objs.size(); ++i)
+      if (collide_(other_manager->objs[i], callback)) return;
+  }
+}
+
+namespace {
+struct DistanceVisitor {
+  const std::vector<CollisionObject*>* objs;
+  const std::vector<size_t>* indices;
+  const SortedBounds* bounds;
+  CollisionObject* obj;
+  DistanceCallBackBase* callback;
+  FCL_REAL* min_dist;
+  size_t min_index;
+  /// Objects overlapping the query of the previous pass have already been
+  /// tested.
+  const AABB* previous_query;
+
+  bool operator()(size_t pos) const {
+    const size_t index = (*indices)[pos];
+    if (index < min_index) return false;
+    CollisionObject* obj2 = (*objs)[index];
+    if (obj2 == obj) return false;
+
+    const AABB aabb2(
+        Vec3f(bounds->lower[0][pos], bounds->lower[1][pos],
+              bounds->lower[2][pos]),
+        Vec3f(bounds->upper[0][pos], bounds->upper[1][pos],
+              bounds->upper[2][pos]));
+    if (previous_query != NULL && previous_query->overlap(aabb2)) return false;
+    if (obj->getAABB().distance(aabb2) < *min_dist)
+      return (*callback)(obj, obj2, *min_dist);
+    return false;
+  }
+};
+}  // namespace
+
+//==============================================================================
+bool RadixSaPCollisionManager::distance_(CollisionObject* obj,
+                                         DistanceCallBackBase* callback,
+                                         FCL_REAL& min_dist,
+                                         size_t min_index) const {
+  const AABB& aabb = obj->getAABB();
+
+  // Start with the typical distance between objects and double it until the
+  // closest object is found.
+  FCL_REAL radius = min_dist;
+  if (!(radius < (std::numeric_limits<FCL_REAL>::max)())) {
+    radius = (std::max)((aabb.max_ - aabb.min_).maxCoeff(),
+                        (bound.max_ - bound.min_).maxCoeff() /
+                            std::cbrt(FCL_REAL(indices.size())));
+    if (!(radius > 0)) radius = (std::numeric_limits<FCL_REAL>::max)();
+  }
+
+  const SortedBounds bounds = {
+      {lower[0].data(), lower[1].data(), lower[2].data()},
+      {upper[0].data(), upper[1].data(), upper[2].data()}};
+  DistanceVisitor visitor = {&objs,     &indices,  &bounds, obj,
+                             callback, &min_dist, min_index, NULL};
+
+  AABB query, previous_query;
+  while (true) {
+    query = aabb;
+    query.expand(radius);
+
+    size_t begin, end;
+    sweepRange(query.min_[sweep_axis], query.max_[sweep_axis], begin, end);
+    if (visitOverlapping(bounds, begin, end, query, visitor)) return true;
+
+    // Every object closer than min_dist is inside the query, or all the
+    // objects have been tested.
+    if (min_dist <= radius || query.contain(bound)) break;
+
+    previous_query = query;
+    visitor.previous_query = &previous_query;
+    radius *= 2;
+  }
+  return false;
+}
+
+//==============================================================================
+void RadixSaPCollisionManager::distance(CollisionObject* obj,
+                                        DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_RADIX_SAP);
+  HPP_FCL_TRACE_SPAN("RadixSaPCollisionManager::distance", "broadphase");
+  callback->init();
+  if (size() == 0) return;
+
+  FCL_REAL min_dist = (std::numeric_limits<FCL_REAL>::max)();
+  distance_(obj, callback, min_dist, 0);
+}
+
+//==============================================================================
+void RadixSaPCollisionManager::distance(DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_RADIX_SAP);
+  HPP_FCL_TRACE_SPAN("RadixSaPCollisionManager::distance", "broadphase");
+  callback->init();
+  if (size() == 0) return;
+
+  // A pair is tested when processing the object of lowest index: when an
+  // object is processed, every object closer than min_dist is visited.
+  FCL_REAL min_dist = (std::numeric_limits<FCL_REAL>::max)();
+  for (size_t i = 0; i < objs.size(); ++i)
+    if (distance_(objs[i], callback, min_dist, i + 1)) return;
+}
+
+//==============================================================================
+void RadixSaPCollisionManager::distance(
+    BroadPhaseCollisionManager* other_manager_,
+    DistanceCallBackBase* callback) const {
+  HPP_FCL_METRICS_BROADPHASE_SCOPE(BP_RADIX_SAP);
+  HPP_FCL_TRACE_SPAN("RadixSaPCollisionManager::distance", "broadphase");
+  callback->init();
+  RadixSaPCollisionManager* other_manager =
+      static_cast<RadixSaPCollisionManager*>(other_manager_);
+
+  if ((size() == 0) || (other_manager->size() == 0)) return;
+
+  if (this == other_manager) {
+    distance(callback);
+    return;
+  }
+
+  FCL_REAL min_dist = (std::numeric_limits<FCL_REAL>::max)();
+  if (this->size() < other_manager->size()) {
+    for (size_t i = 0; i < objs.size(); ++i)
+      if (other_manager->distance_(objs[i], callback, min_dist, 0)) return;
+  } else {
+    for (size_t i = 0; i < other_manager->objs.size(); ++i)
+      if (distance_(other_manager->objs[i], callback, min_dist, 0)) return;
+  }
+}
+
+//==============================================================================
+bool RadixSaPCollisionManager::empty() const { return objs.empty(); }
+
+//==============================================================================
+size_t RadixSaPCollisionManager::size() const { return objs.size(); }
+
+}  // namespace fcl
+}  // namespace hpp
@@ -117,5 +117,17 @@ bool CollisionCallBackCollect::exist(const CollisionPair& pair) const {
          collision_pairs.end();
 }
 
+CollisionCallBackCollectColliding::CollisionCallBackCollectColliding(
+    const CollisionRequest& request)
+    : request(request) {}
+
+bool CollisionCallBackCollectColliding::collide(CollisionObject* o1,
+                                                CollisionObject* o2) {
+  result.clear();
+  if (::hpp::fcl::collide(o1, o2, request, result))
+    collision_pairs.push_back(std::make_pair(o1, o2));
+  return false;
+}
+
 }  // namespace fcl
 }  // namespace hpp
@@ -39,6 +39,7 @@
 #include <hpp/fcl/collision_utility.h>
 #include <hpp/fcl/collision_func_matrix.h>
 #include <hpp/fcl/narrowphase/narrowphase.h>
+#include <hpp/fcl/tracing.h>
 
 #include <iostream>
 
@@ -67,17 +68,15 @@ std::size_t collide(const CollisionObject* o1, const CollisionObject* o2,
                  result);
 }
 
-std::size_t collide(const CollisionGeometry* o1, const Transform3f& tf1,
-                    const CollisionGeometry* o2, const Transform3f& tf2,
-                    const CollisionRequest& request, CollisionResult& result) {
-  // If securit margin is set to -infinity, return that there is no collision
-  if (request.security_margin == -std::numeric_limits<FCL_REAL>::infinity()) {
-    result.clear();
-    return false;
-  }
-
-  GJKSolver solver(request);
-
+/// Call the collision function between two geometries, with the geometries
+/// swapped when only the reverse order is handled.
+static std::size_t dispatchCollide(const CollisionGeometry* o1,
+                                   const Transform3f& tf1,
+                                   const CollisionGeometry* o2,
+                                   const Transform3f& tf2,
+                                   const GJKSolver& solver,
+                                   const CollisionRequest& request,
+                                   CollisionResult& result) {
   const CollisionFunctionMatrix& looktable = getCollisionFunctionLookTable();
   std::size_t res;
   if (request.num_max_contacts == 0) {
@@ -91,7 +90,8 @@ std::size_t collide(const CollisionGeometry* o1, const Transform3f& tf1,
     NODE_TYPE node_type2 = o2->getNodeType();
 
     if (object_type1 == OT_GEOM &&
-        (object_type2 == OT_BVH || object_type2 == OT_HFIELD)) {
+        (object_type2 == OT_BVH || object_type2 == OT_HFIELD ||
+         object_type2 == OT_LINEAR_OCTREE || object_type2 == OT_SDF)) {
       if (!looktable.collision_matrix[node_type2][node_type1]) {
         HPP_FCL_THROW_PRETTY("Collision function between node type "
                                  << std::string(get_node_type_name(node_type1))
@@ -119,6 +119,30 @@ std::size_t collide(const CollisionGeometry* o1, const Transform3f& tf1,
             o1, tf1, o2, tf2, &solver, request, result);
     }
   }
+  return res;
+}
+
+std::size_t collide(const CollisionGeometry* o1, const Transform3f& tf1,
+                    const CollisionGeometry* o2, const Transform3f& tf2,
+                    const CollisionRequest& request, CollisionResult& result) {
+  HPP_FCL_TRACE_SPAN("collide", "query");
+  // If securit margin is set to -infinity, return that there is no collision
+  if (request.security_margin == -std::numeric_limits<FCL_REAL>::infinity()) {
+    result.clear();
+    return false;
+  }
+
+  GJKSolver solver(request);
+
+  std::size_t res;
+  if (request.enable_profiling) {
+    result.profile.clear();
+    Timer timer;
+    res = dispatchCollide(o1, tf1, o2, tf2, solver, request, result);
+    internal::completeProfile(solver.profile, timer.elapsed().user, result);
+  } else
+    res = dispatchCollide(o1, tf1, o2, tf2, solver, request, result);
+
   if (solver.gjk_initial_guess == GJKInitialGuess::CachedGuess ||
       solver.enable_cached_guess) {
     result.cached_gjk_guess = solver.cached_guess;
@@ -139,7 +163,8 @@ ComputeCollision::ComputeCollision(const CollisionGeometry* o1,
   NODE_TYPE node_type2 = o2->getNodeType();
 
   swap_geoms = object_type1 == OT_GEOM &&
-               (object_type2 == OT_BVH || object_type2 == OT_HFIELD);
+               (object_type2 == OT_BVH || object_type2 == OT_HFIELD ||
+                object_type2 == OT_LINEAR_OCTREE || object_type2 == OT_SDF);
 
   if ((swap_geoms && !looktable.collision_matrix[node_type2][node_type1]) ||
       (!swap_geoms && !looktable.collision_matrix[node_type1][node_type2])) {
@@ -159,7 +184,8 @@ ComputeCollision::ComputeCollision(const CollisionGeometry* o1,
 std::size_t ComputeCollision::run(const Transform3f& tf1,
                                   const Transform3f& tf2,
                                   const CollisionRequest& request,
-                                  CollisionResult& result) const {
+                                  CollisionResult& result,
+                                  GJKSolver& gjk_solver) const {
   // If security margin is set to -infinity, return that there is no collision
   if (request.security_margin == -std::numeric_limits<FCL_REAL>::infinity()) {
     result.clear();
@@ -167,10 +193,10 @@ std::size_t ComputeCollision::run(const Transform3f& tf1,
   }
   std::size_t res;
   if (swap_geoms) {
-    res = func(o2, tf2, o1, tf1, &solver, request, result);
+    res = func(o2, tf2, o1, tf1, &gjk_solver, request, result);
     result.swapObjects();
   } else {
-    res = func(o1, tf1, o2, tf2, &solver, request, result);
+    res = func(o1, tf1, o2, tf2, &gjk_solver, request, result);
   }
   return res;
 }
@@ -178,23 +204,34 @@ std::size_t ComputeCollision::run(const Transform3f& tf1,
 std::size_t ComputeCollision::operator()(const Transform3f& tf1,
                                          const Transform3f& tf2,
                                          const CollisionRequest& request,
-                                         CollisionResult& result) const
+                                         CollisionResult& result) const {
+  return operator()(tf1, tf2, request, result, solver);
+}
 
-{
-  solver.set(request);
+std::size_t ComputeCollision::operator()(const Transform3f& tf1,
+                                         const Transform3f& tf2,
+                                         const CollisionRequest& request,
+                                         CollisionResult& result,
+                                         GJKSolver& gjk_solver) const {
+  HPP_FCL_TRACE_SPAN("ComputeCollision", "query");
+  gjk_solver.set(request);
 
   std::size_t res;
-  if (request.enable_timings) {
+  if (request.enable_timings || request.enable_profiling) {
+    if (request.enable_profiling) result.profile.clear();
     Timer timer;
-    res = run(tf1, tf2, request, result);
-    result.timings = timer.elapsed();
+    res = run(tf1, tf2, request, result, gjk_solver);
+    const CPUTimes timings = timer.elapsed();
+    if (request.enable_timings) result.timings = timings;
+    if (request.enable_profiling)
+      internal::completeProfile(gjk_solver.profile, timings.user, result);
   } else
-    res = run(tf1, tf2, request, result);
+    res = run(tf1, tf2, request, result, gjk_solver);
 
-  if (solver.gjk_initial_guess == GJKInitialGuess::CachedGuess ||
-      solver.enable_cached_guess) {
-    result.cached_gjk_guess = solver.cached_guess;
-    result.cached_support_func_guess = solver.support_func_cached_guess;
+  if (gjk_solver.gjk_initial_guess == GJKInitialGuess::CachedGuess ||
+      gjk_solver.enable_cached_guess) {
+    result.cached_gjk_guess = gjk_solver.cached_guess;
+    result.cached_support_func_guess = gjk_solver.support_func_cached_guess;
   }
 
   return res;
@@ -76,6 +76,44 @@ std::size_t OctreeCollide(const CollisionGeometry* o1, const Transform3f& tf1,
 
 #endif
 
+template <typename T_SH>
+std::size_t LinearOctreeShapeCollide(const CollisionGeometry* o1,
+                                     const Transform3f& tf1,
+                                     const CollisionGeometry* o2,
+                                     const Transform3f& tf2,
+                                     const GJKSolver* nsolver,
+                                     const CollisionRequest& request,
+                                     CollisionResult& result) {
+  if (request.isSatisfied(result)) return result.numContacts();
+
+  LinearOcTreeShapeCollisionTraversalNode<T_SH> node(request);
+  const LinearOcTree* obj1 = static_cast<const LinearOcTree*>(o1);
+  const T_SH* obj2 = static_cast<const T_SH*>(o2);
+
+  initialize(node, *obj1, tf1, *obj2, tf2, nsolver, result);
+  collide(&node, request, result);
+
+  return result.numContacts();
+}
+
+template <typename T_SH>
+std::size_t SDFShapeCollide(const CollisionGeometry* o1, const Transform3f& tf1,
+                            const CollisionGeometry* o2, const Transform3f& tf2,
+                            const GJKSolver* nsolver,
+                            const CollisionRequest& request,
+                            CollisionResult& result) {
+  if (request.isSatisfied(result)) return result.numContacts();
+
+  SDFShapeCollisionTraversalNode<T_SH> node(request);
+  const SignedDistanceField* obj1 = static_cast<const SignedDistanceField*>(o1);
+  const T_SH* obj2 = static_cast<const T_SH*>(o2);
+
+  initialize(node, *obj1, tf1, *obj2, tf2, nsolver, result);
+  collide(&node, request, result);
+
+  return result.numContacts();
+}
+
 namespace details {
 template <typename T_BVH, typename T_SH>
 struct bvh_shape_traits {
@@ -603,6 +641,35 @@ CollisionFunctionMatrix::CollisionFunctionMatrix() {
   collision_matrix[HF_OBBRSS][GEOM_ELLIPSOID] =
       &HeightFieldShapeCollider<OBBRSS, Ellipsoid>::collide;
 
+  collision_matrix[GEOM_LINEAR_OCTREE][GEOM_BOX] =
+      &LinearOctreeShapeCollide<Box>;
+  collision_matrix[GEOM_LINEAR_OCTREE][GEOM_SPHERE] =
+      &LinearOctreeShapeCollide<Sphere>;
+  collision_matrix[GEOM_LINEAR_OCTREE][GEOM_CAPSULE] =
+      &LinearOctreeShapeCollide<Capsule>;
+  collision_matrix[GEOM_LINEAR_OCTREE][GEOM_CONE] =
+      &LinearOctreeShapeCollide<Cone>;
+  collision_matrix[GEOM_LINEAR_OCTREE][GEOM_CYLINDER] =
+      &LinearOctreeShapeCollide<Cylinder>;
+  collision_matrix[GEOM_LINEAR_OCTREE][GEOM_CONVEX] =
+      &LinearOctreeShapeCollide<ConvexBase>;
+  collision_matrix[GEOM_LINEAR_OCTREE][GEOM_PLANE] =
+      &LinearOctreeShapeCollide<Plane>;
+  collision_matrix[GEOM_LINEAR_OCTREE][GEOM_HALFSPACE] =
+      &LinearOctreeShapeCollide<Halfspace>;
+  collision_matrix[GEOM_LINEAR_OCTREE][GEOM_ELLIPSOID] =
+      &LinearOctreeShapeCollide<Ellipsoid>;
+
+  collision_matrix[GEOM_SDF][GEOM_BOX] = &SDFShapeCollide<Box>;
+  collision_matrix[GEOM_SDF][GEOM_SPHERE] = &SDFShapeCollide<Sphere>;
+  collision_matrix[GEOM_SDF][GEOM_CAPSULE] = &SDFShapeCollide<Capsule>;
+  collision_matrix[GEOM_SDF][GEOM_CONE] = &SDFShapeCollide<Cone>;
+  collision_matrix[GEOM_SDF][GEOM_CYLINDER] = &SDFShapeCollide<Cylinder>;
+  collision_matrix[GEOM_SDF][GEOM_CONVEX] = &SDFShapeCollide<ConvexBase>;
+  collision_matrix[GEOM_SDF][GEOM_PLANE] = &SDFShapeCollide<Plane>;
+  collision_matrix[GEOM_SDF][GEOM_HALFSPACE] = &SDFShapeCollide<Halfspace>;
+  collision_matrix[GEOM_SDF][GEOM_ELLIPSOID] = &SDFShapeCollide<Ellipsoid>;
+
   collision_matrix[BV_AABB][BV_AABB] = &BVHCollide<AABB>;
   collision_matrix[BV_OBB][BV_OBB] = &BVHCollide<OBB>;
   collision_matrix[BV_RSS][BV_RSS] = &BVHCollide<RSS>;
@@ -37,6 +37,7 @@
 
 #include <../src/collision_node.h>
 #include <hpp/fcl/internal/traversal_recurse.h>
+#include <hpp/fcl/tracing.h>
 
 namespace hpp {
 namespace fcl {
@@ -44,6 +45,8 @@ namespace fcl {
 void collide(CollisionTraversalNodeBase* node, const CollisionRequest& request,
              CollisionResult& result, BVHFrontList* front_list,
              bool recursive) {
+  HPP_FCL_TRACE_SPAN("collision traversal", "traversal");
+  if (node->collideWithoutRecursion()) return;
   if (front_list && front_list->size() > 0) {
     propagateBVHFrontListCollisionRecurse(node, request, result, front_list);
   } else {
@@ -59,7 +62,9 @@ void collide(CollisionTraversalNodeBase* node, const CollisionRequest& request,
       } else {
         assert(result.distance_lower_bound * result.distance_lower_bound -
                    sqrDistLowerBound <
-               1e-8);
+               (std::max)(FCL_REAL(1e-8),
+                          100 * Eigen::NumTraits<FCL_REAL>::epsilon() *
+                              (1 + sqrDistLowerBound)));
       }
     }
   }
@@ -67,6 +72,7 @@ void collide(CollisionTraversalNodeBase* node, const CollisionRequest& request,
 
 void distance(DistanceTraversalNodeBase* node, BVHFrontList* front_list,
               unsigned int qsize) {
+  HPP_FCL_TRACE_SPAN("distance traversal", "traversal");
   node->preprocess();
 
   if (qsize <= 2)
@@ -0,0 +1,564 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <hpp/fcl/continuous_collision.h>
+#include <hpp/fcl/distance.h>
+#include <hpp/fcl/collision_utility.h>
+#include <hpp/fcl/BVH/BVH_model.h>
+#include <hpp/fcl/BVH/BVH_front.h>
+#include <hpp/fcl/narrowphase/narrowphase.h>
+#include <hpp/fcl/shape/geometric_shapes_utility.h>
+#include <hpp/fcl/internal/intersect.h>
+
+namespace hpp {
+namespace fcl {
+
+Motion::Motion(const Transform3f& tf_beg_, const Transform3f& tf_end,
+               CCDMotionType type_)
+    : tf_beg(tf_beg_), type(type_) {
+  const Eigen::AngleAxis<FCL_REAL> rotation(
+      Matrix3f(tf_beg.getRotation().transpose() * tf_end.getRotation()));
+  axis = rotation.axis();
+  angle = rotation.angle();
+  angular_velocity = tf_beg.getRotation() * (angle * axis);
+
+  const Vec3f delta(tf_end.getTranslation() - tf_beg.getTranslation());
+  axis_point.setZero();
+  if (type == CCDM_LINEAR) {
+    translation = delta;
+    linear_velocity = delta;
+    return;
+  }
+
+  // The screw axis is the set of the points that the motion only translates
+  // along the rotation axis.
+  const Vec3f local_delta(tf_beg.getRotation().transpose() * delta);
+  if (angle < Eigen::NumTraits<FCL_REAL>::dummy_precision()) {
+    translation = local_delta;
+  } else {
+    translation = axis.dot(local_delta) * axis;
+    const Vec3f normal_delta(local_delta - translation);
+    axis_point = FCL_REAL(0.5) * (normal_delta + axis.cross(normal_delta) /
+                                           std::tan(FCL_REAL(0.5) * angle));
+  }
+  linear_velocity = tf_beg.getRotation() * translation;
+}
+
+Transform3f Motion::getTransform(FCL_REAL t) const {
+  const Matrix3f rotation(
+      Eigen::AngleAxis<FCL_REAL>(t * angle, axis).toRotationMatrix());
+  if (type == CCDM_LINEAR)
+    return Transform3f(tf_beg.getRotation() * rotation,
+                       tf_beg.getTranslation() + t * translation);
+  return Transform3f(
+      tf_beg.getRotation() * rotation,
+      tf_beg.getTranslation() +
+          tf_beg.getRotation() *
+              (axis_point - rotation * axis_point + t * translation));
+}
+
+FCL_REAL Motion::computeMotionBound(const Vec3f& direction,
+                                    FCL_REAL radius) const {
+  return linear_velocity.dot(direction) +
+         direction.cross(angular_velocity).norm() *
+             (axis_point.norm() + radius);
+}
+
+FCL_REAL Motion::computeMotionBound(FCL_REAL radius) const {
+  return angular_velocity.norm() * (axis_point.norm() + radius);
+}
+
+namespace details {
+/// @brief Distance between the origin of a geometry and its farthest point.
+static FCL_REAL computeGeometryRadius(const CollisionGeometry* o) {
+  if (o->aabb_radius < 0)
+    HPP_FCL_THROW_PRETTY(
+        "The local AABB of the geometries should be computed before a "
+        "continuous collision query.",
+        std::invalid_argument);
+  return o->aabb_center.norm() + o->aabb_radius;
+}
+
+/// @brief Conservative advancement between two objects, with their distance
+/// given by a ComputeDistance functor.
+static FCL_REAL conservativeAdvancement(
+    const ComputeDistance& compute_distance, const Motion& motion1,
+    const FCL_REAL radius1, const Motion& motion2, const FCL_REAL radius2,
+    const ContinuousCollisionRequest& request,
+    ContinuousCollisionResult& result) {
+  result.clear();
+  DistanceRequest drequest(true);
+  drequest.gjk_initial_guess = GJKInitialGuess::CachedGuess;
+
+  FCL_REAL t = 0;
+  Vec3f direction;
+  while (result.num_iterations < request.num_max_iterations) {
+    ++result.num_iterations;
+    const Transform3f tf1(motion1.getTransform(t)),
+        tf2(motion2.getTransform(t));
+    DistanceResult dresult;
+    const FCL_REAL distance = compute_distance(tf1, tf2, drequest, dresult);
+    drequest.updateGuess(dresult);
+    // Without separation, the direction of the previous step is kept since
+    // not all the distance functions compute a normal.
+    if (distance > 0)
+      direction =
+          (dresult.nearest_points[1] - dresult.nearest_points[0]) / distance;
+    else if (result.num_iterations == 1)
+      direction = dresult.normal;
+    if (distance <= request.toc_err) {
+      result.is_collide = true;
+      result.time_of_contact = t;
+      result.contact_tf1 = tf1;
+      result.contact_tf2 = tf2;
+      result.contact_point =
+          (dresult.nearest_points[0] + dresult.nearest_points[1]) / 2;
+      result.normal = direction;
+      return t;
+    }
+
+    // The gap along the direction between the nearest points cannot close
+    // faster than the relative speed of the objects along it.
+    const FCL_REAL speed = motion1.computeMotionBound(direction, radius1) +
+                           motion2.computeMotionBound(-direction, radius2);
+    if (speed <= 0) return result.time_of_contact;
+    t += distance / speed;
+    if (t >= 1) return result.time_of_contact;
+  }
+
+  // Not converged: report a contact at the last time reached.
+  result.is_collide = true;
+  result.time_of_contact = t;
+  result.contact_tf1 = motion1.getTransform(t);
+  result.contact_tf2 = motion2.getTransform(t);
+  return t;
+}
+
+/// @brief Distance between the origin of the frame of a bounding volume and
+/// its farthest point. Whether the rectangle of the RSS starts or is centered
+/// at its origin, it lies within a diagonal of this point.
+inline FCL_REAL computeBVRadius(const RSS& bv) {
+  return bv.Tr.norm() +
+         std::sqrt(bv.length[0] * bv.length[0] + bv.length[1] * bv.length[1]) +
+         bv.radius;
+}
+
+inline FCL_REAL computeBVRadius(const OBBRSS& bv) {
+  return computeBVRadius(bv.rss);
+}
+
+/// @brief Distance between the origin and the farthest vertex of a triangle.
+inline FCL_REAL computeTriangleRadius(const Vec3f& p1, const Vec3f& p2,
+                                      const Vec3f& p3) {
+  return std::sqrt(std::max(p1.squaredNorm(),
+                            std::max(p2.squaredNorm(), p3.squaredNorm())));
+}
+
+/// @brief One step of conservative advancement between a BVH model and
+/// another object.
+///
+/// The step is the minimum, over the pairs of leaves, of their distance
+/// divided by a bound of their relative speed. A pair of bounding volumes
+/// whose own ratio exceeds the current step is not refined: all the pairs of
+/// leaves below it are farther and slower. It is stored in the front from
+/// which the next step starts.
+struct BVHConservativeAdvancementBase {
+  BVHConservativeAdvancementBase(const Motion& motion1_, const Motion& motion2_,
+                                 const FCL_REAL toc_err_)
+      : motion1(motion1_),
+        motion2(motion2_),
+        toc_err(toc_err_),
+        relative_speed(
+            (motion1.getLinearVelocity() - motion2.getLinearVelocity())
+                .norm()) {}
+
+  /// @brief Start a step at time t.
+  void setTime(const FCL_REAL t) {
+    tf1 = motion1.getTransform(t);
+    tf2 = motion2.getTransform(t);
+    tf = tf1.inverseTimes(tf2);
+    step = 1 - t;
+    min_distance = (std::numeric_limits<FCL_REAL>::max)();
+    next_front.clear();
+  }
+
+  /// @brief Upper bound of the relative speed of the points of the objects
+  /// at distance at most radius1 and radius2 from their origins.
+  FCL_REAL computeMotionBound(const FCL_REAL radius1,
+                              const FCL_REAL radius2) const {
+    return relative_speed + motion1.computeMotionBound(radius1) +
+           motion2.computeMotionBound(radius2);
+  }
+
+  /// @brief Whether a pair of bounding volumes can be left unrefined.
+  bool canStop(const FCL_REAL distance, const FCL_REAL motion_bound) const {
+    return distance > toc_err && distance >= step * motion_bound;
+  }
+
+  /// @brief Take into account the distance between two leaves, with the
+  /// witness points in the frame of the first object.
+  void updateLeaf(const FCL_REAL distance, const FCL_REAL motion_bound,
+                  const Vec3f& p1, const Vec3f& p2) {
+    if (distance < min_distance) {
+      min_distance = distance;
+      nearest_points[0] = p1;
+      nearest_points[1] = p2;
+    }
+    if (motion_bound > 0) step = std::min(step, distance / motion_bound);
+  }
+
+  const Motion& motion1;
+  const Motion& motion2;
+  const FCL_REAL toc_err;
+  const FCL_REAL relative_speed;
+
+  /// @brief Poses at the current time and pose of the second object in the
+  /// frame of the first one.
+  Transform3f tf1, tf2, tf;
+
+  FCL_REAL step;
+  FCL_REAL min_distance;
+  Vec3f nearest_points[2];
+  BVHFrontList next_front;
+};
+
+/// @brief Conservative advancement between two BVH models.
+template <typename BV>
+struct MeshConservativeAdvancement : BVHConservativeAdvancementBase {
+  MeshConservativeAdvancement(const BVHModel<BV>& model1_,
+                              const Motion& motion1_,
+                              const BVHModel<BV>& model2_,
+                              const Motion& motion2_, const FCL_REAL toc_err_)
+      : BVHConservativeAdvancementBase(motion1_, motion2_, toc_err_),
+        model1(model1_),
+        model2(model2_) {}
+
+  void refine(const unsigned int b1, const unsigned int b2) {
+    const BVNode<BV>& node1 = model1.getBV(b1);
+    const BVNode<BV>& node2 = model2.getBV(b2);
+    const FCL_REAL bv_distance =
+        distance(tf.getRotation(), tf.getTranslation(), node1.bv, node2.bv);
+    if (canStop(bv_distance, computeMotionBound(computeBVRadius(node1.bv),
+                                                computeBVRadius(node2.bv)))) {
+      next_front.push_back(BVHFrontNode(b1, b2));
+      return;
+    }
+
+    if (node1.isLeaf() && node2.isLeaf()) {
+      next_front.push_back(BVHFrontNode(b1, b2));
+      const Triangle& tri1 = model1.tri_indices[node1.primitiveId()];
+      const Triangle& tri2 = model2.tri_indices[node2.primitiveId()];
+      const Vec3f &p11 = model1.vertices[tri1[0]],
+                  &p12 = model1.vertices[tri1[1]],
+                  &p13 = model1.vertices[tri1[2]];
+      const Vec3f &p21 = model2.vertices[tri2[0]],
+                  &p22 = model2.vertices[tri2[1]],
+                  &p23 = model2.vertices[tri2[2]];
+      Vec3f p1, p2;
+      const FCL_REAL d = std::sqrt(TriangleDistance::sqrTriDistance(
+          p11, p12, p13, p21, p22, p23, tf.getRotation(), tf.getTranslation(),
+          p1, p2));
+      updateLeaf(d,
+                 computeMotionBound(computeTriangleRadius(p11, p12, p13),
+                                    computeTriangleRadius(p21, p22, p23)),
+                 p1, p2);
+      return;
+    }
+
+    // Descend into the larger bounding volume.
+    if (node2.isLeaf() ||
+        (!node1.isLeaf() && node1.bv.size() > node2.bv.size())) {
+      refine((unsigned int)node1.leftChild(), b2);
+      refine((unsigned int)node1.rightChild(), b2);
+    } else {
+      refine(b1, (unsigned int)node2.leftChild());
+      refine(b1, (unsigned int)node2.rightChild());
+    }
+  }
+
+  const BVHModel<BV>& model1;
+  const BVHModel<BV>& model2;
+};
+
+/// @brief Conservative advancement between a BVH model and a shape.
+template <typename BV, typename S>
+struct MeshShapeConservativeAdvancement : BVHConservativeAdvancementBase {
+  MeshShapeConservativeAdvancement(const BVHModel<BV>& model1_,
+                                   const Motion& motion1_, const S& model2_,
+                                   const Motion& motion2_,
+                                   const FCL_REAL toc_err_)
+      : BVHConservativeAdvancementBase(motion1_, motion2_, toc_err_),
+        model1(model1_),
+        model2(model2_),
+        radius2(computeGeometryRadius(&model2_)) {}
+
+  void setTime(const FCL_REAL t) {
+    BVHConservativeAdvancementBase::setTime(t);
+    computeBV(model2, tf, model2_bv);
+  }
+
+  void refine(const unsigned int b1, const unsigned int b2) {
+    const BVNode<BV>& node1 = model1.getBV(b1);
+    const FCL_REAL bv_distance = node1.bv.distance(model2_bv);
+    if (canStop(bv_distance,
+                computeMotionBound(computeBVRadius(node1.bv), radius2))) {
+      next_front.push_back(BVHFrontNode(b1, b2));
+      return;
+    }
+
+    if (node1.isLeaf()) {
+      next_front.push_back(BVHFrontNode(b1, b2));
+      const Triangle& tri = model1.tri_indices[node1.primitiveId()];
+      const Vec3f &p1 = model1.vertices[tri[0]], &p2 = model1.vertices[tri[1]],
+                  &p3 = model1.vertices[tri[2]];
+      FCL_REAL d;
+      Vec3f closest_p1, closest_p2, normal;
+      nsolver.shapeTriangleInteraction(model2, tf, p1, p2, p3, Transform3f(),
+                                       d, closest_p2, closest_p1, normal);
+      updateLeaf(d,
+                 computeMotionBound(computeTriangleRadius(p1, p2, p3), radius2),
+                 closest_p1, closest_p2);
+      return;
+    }
+
+    refine((unsigned int)node1.leftChild(), b2);
+    refine((unsigned int)node1.rightChild(), b2);
+  }
+
+  const BVHModel<BV>& model1;
+  const S& model2;
+  const FCL_REAL radius2;
+  BV model2_bv;
+  GJKSolver nsolver;
+};
+
+/// @brief Conservative advancement driven by the refinement of a front of
+/// bounding volume pairs.
+template <typename Advancement>
+FCL_REAL bvhConservativeAdvancement(Advancement& advancement,
+                                    const ContinuousCollisionRequest& request,
+                                    ContinuousCollisionResult& result) {
+  result.clear();
+  BVHFrontList front;
+  front.push_back(BVHFrontNode(0, 0));
+
+  FCL_REAL t = 0;
+  Vec3f direction(Vec3f::Zero());
+  while (result.num_iterations < request.num_max_iterations) {
+    ++result.num_iterations;
+    advancement.setTime(t);
+    for (BVHFrontList::const_iterator it = front.begin(); it != front.end();
+         ++it)
+      advancement.refine(it->left, it->right);
+    front.swap(advancement.next_front);
+
+    const FCL_REAL distance = advancement.min_distance;
+    const Vec3f* nearest_points = advancement.nearest_points;
+    if (distance > 0 && distance < (std::numeric_limits<FCL_REAL>::max)())
+      direction = advancement.tf1.getRotation() *
+                  (nearest_points[1] - nearest_points[0]) / distance;
+    if (distance <= request.toc_err) {
+      result.is_collide = true;
+      result.time_of_contact = t;
+      result.contact_tf1 = advancement.tf1;
+      result.contact_tf2 = advancement.tf2;
+      result.contact_point = advancement.tf1.transform(
+          (nearest_points[0] + nearest_points[1]) / 2);
+      result.normal = direction;
+      return t;
+    }
+
+    t += advancement.step;
+    if (t >= 1) return result.time_of_contact;
+  }
+
+  // Not converged: report a contact at the last time reached.
+  result.is_collide = true;
+  result.time_of_contact = t;
+  result.contact_tf1 = advancement.motion1.getTransform(t);
+  result.contact_tf2 = advancement.motion2.getTransform(t);
+  return t;
+}
+
+template <typename BV>
+FCL_REAL meshConservativeAdvancement(const CollisionGeometry* o1,
+                                     const Motion& motion1,
+                                     const CollisionGeometry* o2,
+                                     const Motion& motion2,
+                                     const ContinuousCollisionRequest& request,
+                                     ContinuousCollisionResult& result) {
+  MeshConservativeAdvancement<BV> advancement(
+      *static_cast<const BVHModel<BV>*>(o1), motion1,
+      *static_cast<const BVHModel<BV>*>(o2), motion2, request.toc_err);
+  return bvhConservativeAdvancement(advancement, request, result);
+}
+
+template <typename BV, typename S>
+FCL_REAL meshShapeConservativeAdvancement(
+    const CollisionGeometry* o1, const Motion& motion1,
+    const CollisionGeometry* o2, const Motion& motion2,
+    const ContinuousCollisionRequest& request,
+    ContinuousCollisionResult& result) {
+  MeshShapeConservativeAdvancement<BV, S> advancement(
+      *static_cast<const BVHModel<BV>*>(o1), motion1,
+      *static_cast<const S*>(o2), motion2, request.toc_err);
+  return bvhConservativeAdvancement(advancement, request, result);
+}
+
+template <typename BV>
+FCL_REAL meshShapeConservativeAdvancement(
+    const CollisionGeometry* o1, const Motion& motion1,
+    const CollisionGeometry* o2, const Motion& motion2,
+    const ContinuousCollisionRequest& request,
+    ContinuousCollisionResult& result) {
+  switch (o2->getNodeType()) {
+    case GEOM_BOX:
+      return meshShapeConservativeAdvancement<BV, Box>(
+          o1, motion1, o2, motion2, request, result);
+    case GEOM_SPHERE:
+      return meshShapeConservativeAdvancement<BV, Sphere>(
+          o1, motion1, o2, motion2, request, result);
+    case GEOM_CAPSULE:
+      return meshShapeConservativeAdvancement<BV, Capsule>(
+          o1, motion1, o2, motion2, request, result);
+    case GEOM_CONE:
+      return meshShapeConservativeAdvancement<BV, Cone>(
+          o1, motion1, o2, motion2, request, result);
+    case GEOM_CYLINDER:
+      return meshShapeConservativeAdvancement<BV, Cylinder>(
+          o1, motion1, o2, motion2, request, result);
+    case GEOM_CONVEX:
+      return meshShapeConservativeAdvancement<BV, ConvexBase>(
+          o1, motion1, o2, motion2, request, result);
+    case GEOM_ELLIPSOID:
+      return meshShapeConservativeAdvancement<BV, Ellipsoid>(
+          o1, motion1, o2, motion2, request, result);
+    default:  // Filtered out by isSupportedShape.
+      return -1;
+  }
+}
+
+/// @brief Whether a geometry is a triangle mesh with RSS or OBBRSS bounding
+/// volumes.
+static bool isSupportedMesh(const CollisionGeometry* o) {
+  if (o->getObjectType() != OT_BVH) return false;
+  if (o->getNodeType() != BV_RSS && o->getNodeType() != BV_OBBRSS)
+    return false;
+  return static_cast<const BVHModelBase*>(o)->getModelType() ==
+         BVH_MODEL_TRIANGLES;
+}
+
+/// @brief Whether a geometry is a bounded convex shape.
+static bool isSupportedShape(const CollisionGeometry* o) {
+  switch (o->getNodeType()) {
+    case GEOM_BOX:
+    case GEOM_SPHERE:
+    case GEOM_CAPSULE:
+    case GEOM_CONE:
+    case GEOM_CYLINDER:
+    case GEOM_CONVEX:
+    case GEOM_ELLIPSOID:
+      return true;
+    default:
+      return false;
+  }
+}
+}  // namespace details
+
+FCL_REAL continuousCollide(const CollisionGeometry* o1,
+                           const Transform3f& tf1_beg,
+                           const Transform3f& tf1_end,
+                           const CollisionGeometry* o2,
+                           const Transform3f& tf2_beg,
+                           const Transform3f& tf2_end,
+                           const ContinuousCollisionRequest& request,
+                           ContinuousCollisionResult& result) {
+  const Motion motion1(tf1_beg, tf1_end, request.ccd_motion_type),
+      motion2(tf2_beg, tf2_end, request.ccd_motion_type);
+
+  if (o1->getObjectType() == OT_GEOM && o2->getObjectType() == OT_GEOM)
+    return details::conservativeAdvancement(
+        ComputeDistance(o1, o2), motion1, details::computeGeometryRadius(o1),
+        motion2, details::computeGeometryRadius(o2), request, result);
+
+  if (details::isSupportedMesh(o1) && o1->getNodeType() == o2->getNodeType() &&
+      details::isSupportedMesh(o2)) {
+    if (o1->getNodeType() == BV_RSS)
+      return details::meshConservativeAdvancement<RSS>(
+          o1, motion1, o2, motion2, request, result);
+    return details::meshConservativeAdvancement<OBBRSS>(
+        o1, motion1, o2, motion2, request, result);
+  }
+
+  if (details::isSupportedMesh(o1) && details::isSupportedShape(o2)) {
+    if (o1->getNodeType() == BV_RSS)
+      return details::meshShapeConservativeAdvancement<RSS>(
+          o1, motion1, o2, motion2, request, result);
+    return details::meshShapeConservativeAdvancement<OBBRSS>(
+        o1, motion1, o2, motion2, request, result);
+  }
+
+  if (details::isSupportedShape(o1) && details::isSupportedMesh(o2)) {
+    const FCL_REAL toc =
+        o2->getNodeType() == BV_RSS
+            ? details::meshShapeConservativeAdvancement<RSS>(
+                  o2, motion2, o1, motion1, request, result)
+            : details::meshShapeConservativeAdvancement<OBBRSS>(
+                  o2, motion2, o1, motion1, request, result);
+    std::swap(result.contact_tf1, result.contact_tf2);
+    result.normal = -result.normal;
+    return toc;
+  }
+
+  HPP_FCL_THROW_PRETTY("Continuous collision between node type "
+                           << std::string(get_node_type_name(o1->getNodeType()))
+                           << " and node type "
+                           << std::string(get_node_type_name(o2->getNodeType()))
+                           << " is not yet supported.",
+                       std::invalid_argument);
+}
+
+FCL_REAL continuousCollide(const CollisionObject* o1,
+                           const Transform3f& tf1_end,
+                           const CollisionObject* o2,
+                           const Transform3f& tf2_end,
+                           const ContinuousCollisionRequest& request,
+                           ContinuousCollisionResult& result) {
+  return continuousCollide(o1->collisionGeometry().get(), o1->getTransform(),
+                           tf1_end, o2->collisionGeometry().get(),
+                           o2->getTransform(), tf2_end, request, result);
+}
+
+}  // namespace fcl
+}  // namespace hpp
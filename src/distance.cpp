@@ -39,6 +39,7 @@
 #include <hpp/fcl/collision_utility.h>
 #include <hpp/fcl/distance_func_matrix.h>
 #include <hpp/fcl/narrowphase/narrowphase.h>
+#include <hpp/fcl/tracing.h>
 
 #include <iostream>
 
@@ -57,11 +58,15 @@ FCL_REAL distance(const CollisionObject* o1, const CollisionObject* o2,
                   result);
 }
 
-FCL_REAL distance(const CollisionGeometry* o1, const Transform3f& tf1,
-                  const CollisionGeometry* o2, const Transform3f& tf2,
-                  const DistanceRequest& request, DistanceResult& result) {
-  GJKSolver solver(request);
-
+/// Call the distance function between two geometries, with the geometries
+/// swapped when only the reverse order is handled.
+static FCL_REAL dispatchDistance(const CollisionGeometry* o1,
+                                 const Transform3f& tf1,
+                                 const CollisionGeometry* o2,
+                                 const Transform3f& tf2,
+                                 const GJKSolver& solver,
+                                 const DistanceRequest& request,
+                                 DistanceResult& result) {
   const DistanceFunctionMatrix& looktable = getDistanceFunctionLookTable();
 
   OBJECT_TYPE object_type1 = o1->getObjectType();
@@ -72,7 +77,8 @@ FCL_REAL distance(const CollisionGeometry* o1, const Transform3f& tf1,
   FCL_REAL res = (std::numeric_limits<FCL_REAL>::max)();
 
   if (object_type1 == OT_GEOM &&
-      (object_type2 == OT_BVH || object_type2 == OT_HFIELD)) {
+      (object_type2 == OT_BVH || object_type2 == OT_HFIELD ||
+       object_type2 == OT_LINEAR_OCTREE || object_type2 == OT_SDF)) {
     if (!looktable.distance_matrix[node_type2][node_type1]) {
       HPP_FCL_THROW_PRETTY("Distance function between node type "
                                << std::string(get_node_type_name(node_type1))
@@ -106,6 +112,24 @@ FCL_REAL distance(const CollisionGeometry* o1, const Transform3f& tf1,
           o1, tf1, o2, tf2, &solver, request, result);
     }
   }
+  return res;
+}
+
+FCL_REAL distance(const CollisionGeometry* o1, const Transform3f& tf1,
+                  const CollisionGeometry* o2, const Transform3f& tf2,
+                  const DistanceRequest& request, DistanceResult& result) {
+  HPP_FCL_TRACE_SPAN("distance", "query");
+  GJKSolver solver(request);
+
+  FCL_REAL res;
+  if (request.enable_profiling) {
+    result.profile.clear();
+    Timer timer;
+    res = dispatchDistance(o1, tf1, o2, tf2, solver, request, result);
+    internal::completeProfile(solver.profile, timer.elapsed().user, result);
+  } else
+    res = dispatchDistance(o1, tf1, o2, tf2, solver, request, result);
+
   if (solver.gjk_initial_guess == GJKInitialGuess::CachedGuess ||
       solver.enable_cached_guess) {
     result.cached_gjk_guess = solver.cached_guess;
@@ -126,7 +150,8 @@ ComputeDistance::ComputeDistance(const CollisionGeometry* o1,
   NODE_TYPE node_type2 = o2->getNodeType();
 
   swap_geoms = object_type1 == OT_GEOM &&
-               (object_type2 == OT_BVH || object_type2 == OT_HFIELD);
+               (object_type2 == OT_BVH || object_type2 == OT_HFIELD ||
+                object_type2 == OT_LINEAR_OCTREE || object_type2 == OT_SDF);
 
   if ((swap_geoms && !looktable.distance_matrix[node_type2][node_type1]) ||
       (!swap_geoms && !looktable.distance_matrix[node_type1][node_type2])) {
@@ -145,17 +170,18 @@ ComputeDistance::ComputeDistance(const CollisionGeometry* o1,
 
 FCL_REAL ComputeDistance::run(const Transform3f& tf1, const Transform3f& tf2,
                               const DistanceRequest& request,
-                              DistanceResult& result) const {
+                              DistanceResult& result,
+                              GJKSolver& gjk_solver) const {
   FCL_REAL res;
 
   if (swap_geoms) {
-    res = func(o2, tf2, o1, tf1, &solver, request, result);
+    res = func(o2, tf2, o1, tf1, &gjk_solver, request, result);
     if (request.enable_nearest_points) {
       std::swap(result.o1, result.o2);
       result.nearest_points[0].swap(result.nearest_points[1]);
     }
   } else {
-    res = func(o1, tf1, o2, tf2, &solver, request, result);
+    res = func(o1, tf1, o2, tf2, &gjk_solver, request, result);
   }
 
   return res;
@@ -165,20 +191,33 @@ FCL_REAL ComputeDistance::operator()(const Transform3f& tf1,
                                      const Transform3f& tf2,
                                      const DistanceRequest& request,
                                      DistanceResult& result) const {
-  solver.set(request);
+  return operator()(tf1, tf2, request, result, solver);
+}
+
+FCL_REAL ComputeDistance::operator()(const Transform3f& tf1,
+                                     const Transform3f& tf2,
+                                     const DistanceRequest& request,
+                                     DistanceResult& result,
+                                     GJKSolver& gjk_solver) const {
+  HPP_FCL_TRACE_SPAN("ComputeDistance", "query");
+  gjk_solver.set(request);
 
   FCL_REAL res;
-  if (request.enable_timings) {
+  if (request.enable_timings || request.enable_profiling) {
+    if (request.enable_profiling) result.profile.clear();
     Timer timer;
-    res = run(tf1, tf2, request, result);
-    result.timings = timer.elapsed();
+    res = run(tf1, tf2, request, result, gjk_solver);
+    const CPUTimes timings = timer.elapsed();
+    if (request.enable_timings) result.timings = timings;
+    if (request.enable_profiling)
+      internal::completeProfile(gjk_solver.profile, timings.user, result);
   } else
-    res = run(tf1, tf2, request, result);
+    res = run(tf1, tf2, request, result, gjk_solver);
 
-  if (solver.gjk_initial_guess == GJKInitialGuess::CachedGuess ||
-      solver.enable_cached_guess) {
-    result.cached_gjk_guess = solver.cached_guess;
-    result.cached_support_func_guess = solver.support_func_cached_guess;
+  if (gjk_solver.gjk_initial_guess == GJKInitialGuess::CachedGuess ||
+      gjk_solver.enable_cached_guess) {
+    result.cached_gjk_guess = gjk_solver.cached_guess;
+    result.cached_support_func_guess = gjk_solver.support_func_cached_guess;
   }
   return res;
 }
@@ -127,7 +127,7 @@ FCL_REAL ShapeShapeDistance<Capsule, Capsule>(
     w2 = p2;
   } else {
     // Always non-negative, equal 0 if the segments are colinear
-    FCL_REAL denom = fmax(a * e - b * b, 0);
+    FCL_REAL denom = fmax(a * e - b * b, FCL_REAL(0));
 
     FCL_REAL s;
     FCL_REAL t;
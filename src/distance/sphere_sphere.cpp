@@ -57,7 +57,7 @@ FCL_REAL ShapeShapeDistance<Sphere, Sphere>(
     const CollisionGeometry* o1, const Transform3f& tf1,
     const CollisionGeometry* o2, const Transform3f& tf2, const GJKSolver*,
     const DistanceRequest&, DistanceResult& result) {
-  FCL_REAL epsilon = 1e-7;
+  FCL_REAL epsilon = FCL_REAL(1e-7);
   const Sphere* s1 = static_cast<const Sphere*>(o1);
   const Sphere* s2 = static_cast<const Sphere*>(o2);
 
@@ -81,7 +81,7 @@ FCL_REAL ShapeShapeDistance<Sphere, Sphere>(
   if (collision) {
     // Take contact point at the middle of intersection between each sphere
     // and segment [c1 c2].
-    FCL_REAL abscissa = .5 * r1 + .5 * (dist - r2);
+    FCL_REAL abscissa = r1 / 2 + (dist - r2) / 2;
     Vec3f contact = center1 + abscissa * unit;
     result.nearest_points[0] = result.nearest_points[1] = contact;
     return result.min_distance;
@@ -97,7 +97,7 @@ std::size_t ShapeShapeCollider<Sphere, Sphere>::run(
     const CollisionGeometry* o1, const Transform3f& tf1,
     const CollisionGeometry* o2, const Transform3f& tf2, const GJKSolver*,
     const CollisionRequest& request, CollisionResult& result) {
-  FCL_REAL epsilon = 1e-7;
+  FCL_REAL epsilon = FCL_REAL(1e-7);
   const Sphere* s1 = static_cast<const Sphere*>(o1);
   const Sphere* s2 = static_cast<const Sphere*>(o2);
 
@@ -121,7 +121,7 @@ std::size_t ShapeShapeCollider<Sphere, Sphere>::run(
   if (distToCollision <= request.collision_distance_threshold) {
     // Take contact point at the middle of intersection between each sphere
     // and segment [c1 c2].
-    FCL_REAL abscissa = .5 * r1 + .5 * (dist - r2);
+    FCL_REAL abscissa = r1 / 2 + (dist - r2) / 2;
     Vec3f contactPoint = center1 + abscissa * unit;
     Contact contact(o1, o2, -1, -1, contactPoint, unit,
                     -(distToCollision + margin));
@@ -66,6 +66,42 @@ FCL_REAL Distance(const CollisionGeometry* o1, const Transform3f& tf1,
 
 #endif
 
+template <typename T_SH>
+FCL_REAL LinearOctreeShapeDistance(const CollisionGeometry* o1,
+                                   const Transform3f& tf1,
+                                   const CollisionGeometry* o2,
+                                   const Transform3f& tf2,
+                                   const GJKSolver* nsolver,
+                                   const DistanceRequest& request,
+                                   DistanceResult& result) {
+  if (request.isSatisfied(result)) return result.min_distance;
+  LinearOcTreeShapeDistanceTraversalNode<T_SH> node;
+  const LinearOcTree* obj1 = static_cast<const LinearOcTree*>(o1);
+  const T_SH* obj2 = static_cast<const T_SH*>(o2);
+
+  initialize(node, *obj1, tf1, *obj2, tf2, nsolver, request, result);
+  distance(&node);
+
+  return result.min_distance;
+}
+
+template <typename T_SH>
+FCL_REAL SDFShapeDistance(const CollisionGeometry* o1, const Transform3f& tf1,
+                          const CollisionGeometry* o2, const Transform3f& tf2,
+                          const GJKSolver* nsolver,
+                          const DistanceRequest& request,
+                          DistanceResult& result) {
+  if (request.isSatisfied(result)) return result.min_distance;
+  SDFShapeDistanceTraversalNode<T_SH> node;
+  const SignedDistanceField* obj1 = static_cast<const SignedDistanceField*>(o1);
+  const T_SH* obj2 = static_cast<const T_SH*>(o2);
+
+  initialize(node, *obj1, tf1, *obj2, tf2, nsolver, request, result);
+  distance(&node);
+
+  return result.min_distance;
+}
+
 template <typename T_SH1, typename T_SH2>
 FCL_REAL ShapeShapeDistance(const CollisionGeometry* o1, const Transform3f& tf1,
                             const CollisionGeometry* o2, const Transform3f& tf2,
@@ -593,6 +629,35 @@ DistanceFunctionMatrix::DistanceFunctionMatrix() {
   distance_matrix[HF_OBBRSS][GEOM_ELLIPSOID] =
       &HeightFieldShapeDistancer<OBBRSS, Ellipsoid>::distance;
 
+  distance_matrix[GEOM_LINEAR_OCTREE][GEOM_BOX] =
+      &LinearOctreeShapeDistance<Box>;
+  distance_matrix[GEOM_LINEAR_OCTREE][GEOM_SPHERE] =
+      &LinearOctreeShapeDistance<Sphere>;
+  distance_matrix[GEOM_LINEAR_OCTREE][GEOM_CAPSULE] =
+      &LinearOctreeShapeDistance<Capsule>;
+  distance_matrix[GEOM_LINEAR_OCTREE][GEOM_CONE] =
+      &LinearOctreeShapeDistance<Cone>;
+  distance_matrix[GEOM_LINEAR_OCTREE][GEOM_CYLINDER] =
+      &LinearOctreeShapeDistance<Cylinder>;
+  distance_matrix[GEOM_LINEAR_OCTREE][GEOM_CONVEX] =
+      &LinearOctreeShapeDistance<ConvexBase>;
+  distance_matrix[GEOM_LINEAR_OCTREE][GEOM_PLANE] =
+      &LinearOctreeShapeDistance<Plane>;
+  distance_matrix[GEOM_LINEAR_OCTREE][GEOM_HALFSPACE] =
+      &LinearOctreeShapeDistance<Halfspace>;
+  distance_matrix[GEOM_LINEAR_OCTREE][GEOM_ELLIPSOID] =
+      &LinearOctreeShapeDistance<Ellipsoid>;
+
+  distance_matrix[GEOM_SDF][GEOM_BOX] = &SDFShapeDistance<Box>;
+  distance_matrix[GEOM_SDF][GEOM_SPHERE] = &SDFShapeDistance<Sphere>;
+  distance_matrix[GEOM_SDF][GEOM_CAPSULE] = &SDFShapeDistance<Capsule>;
+  distance_matrix[GEOM_SDF][GEOM_CONE] = &SDFShapeDistance<Cone>;
+  distance_matrix[GEOM_SDF][GEOM_CYLINDER] = &SDFShapeDistance<Cylinder>;
+  distance_matrix[GEOM_SDF][GEOM_CONVEX] = &SDFShapeDistance<ConvexBase>;
+  distance_matrix[GEOM_SDF][GEOM_PLANE] = &SDFShapeDistance<Plane>;
+  distance_matrix[GEOM_SDF][GEOM_HALFSPACE] = &SDFShapeDistance<Halfspace>;
+  distance_matrix[GEOM_SDF][GEOM_ELLIPSOID] = &SDFShapeDistance<Ellipsoid>;
+
   distance_matrix[BV_AABB][BV_AABB] = &BVHDistance<AABB>;
   distance_matrix[BV_OBB][BV_OBB] = &BVHDistance<OBB>;
   distance_matrix[BV_RSS][BV_RSS] = &BVHDistance<RSS>;
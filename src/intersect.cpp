@@ -491,7 +491,7 @@ Project::ProjectResult Project::projectTriangle(const Vec3f& a, const Vec3f& b,
     if (mindist < 0)  // the origin project is within the triangle
     {
       FCL_REAL d = (a - p).dot(n);
-      FCL_REAL s = sqrt(l);
+      FCL_REAL s = std::sqrt(l);
       Vec3f p_to_project = n * (d / l);
       mindist = p_to_project.squaredNorm();
       res.encode = 7;  // m = 0x111
@@ -588,6 +588,12 @@ Project::ProjectResult Project::projectLineOrigin(const Vec3f& a,
       res.sqr_distance = (a + d * res.parameterization[1]).squaredNorm();
       res.encode = 3; /* 0x00 */
     }
+  } else {
+    // the segment is degenerated to a point
+    res.parameterization[0] = 1;
+    res.parameterization[1] = 0;
+    res.sqr_distance = a.squaredNorm();
+    res.encode = 1; /* 0x01 */
   }
 
   return res;
@@ -604,44 +610,44 @@ Project::ProjectResult Project::projectTriangleOrigin(const Vec3f& a,
   const Vec3f& n = dl[0].cross(dl[1]);
   const FCL_REAL l = n.squaredNorm();
 
-  if (l > 0) {
-    FCL_REAL mindist = -1;
-    for (size_t i = 0; i < 3; ++i) {
-      if (vt[i]->dot(dl[i].cross(n)) >
-          0)  // origin is to the outside part of the triangle edge, then the
-              // optimal can only be on the edge
-      {
-        size_t j = nexti[i];
-        ProjectResult res_line = projectLineOrigin(*vt[i], *vt[j]);
-
-        if (mindist < 0 || res_line.sqr_distance < mindist) {
-          mindist = res_line.sqr_distance;
-          res.encode =
-              static_cast<unsigned int>(((res_line.encode & 1) ? 1 << i : 0) +
-                                        ((res_line.encode & 2) ? 1 << j : 0));
-          res.parameterization[i] = res_line.parameterization[0];
-          res.parameterization[j] = res_line.parameterization[1];
-          res.parameterization[nexti[j]] = 0;
-        }
-      }
-    }
-
-    if (mindist < 0)  // the origin project is within the triangle
+  FCL_REAL mindist = -1;
+  for (size_t i = 0; i < 3; ++i) {
+    if (l == 0 ||
+        vt[i]->dot(dl[i].cross(n)) >
+            0)  // origin is to the outside part of the triangle edge, or the
+                // triangle is degenerated, then the optimal can only be on
+                // the edge
     {
-      FCL_REAL d = a.dot(n);
-      FCL_REAL s = sqrt(l);
-      Vec3f o_to_project = n * (d / l);
-      mindist = o_to_project.squaredNorm();
-      res.encode = 7;  // m = 0x111
-      res.parameterization[0] = dl[1].cross(b - o_to_project).norm() / s;
-      res.parameterization[1] = dl[2].cross(c - o_to_project).norm() / s;
-      res.parameterization[2] =
-          1 - res.parameterization[0] - res.parameterization[1];
+      size_t j = nexti[i];
+      ProjectResult res_line = projectLineOrigin(*vt[i], *vt[j]);
+
+      if (mindist < 0 || res_line.sqr_distance < mindist) {
+        mindist = res_line.sqr_distance;
+        res.encode =
+            static_cast<unsigned int>(((res_line.encode & 1) ? 1 << i : 0) +
+                                      ((res_line.encode & 2) ? 1 << j : 0));
+        res.parameterization[i] = res_line.parameterization[0];
+        res.parameterization[j] = res_line.parameterization[1];
+        res.parameterization[nexti[j]] = 0;
+      }
     }
+  }
 
-    res.sqr_distance = mindist;
+  if (mindist < 0)  // the origin project is within the triangle
+  {
+    FCL_REAL d = a.dot(n);
+    FCL_REAL s = std::sqrt(l);
+    Vec3f o_to_project = n * (d / l);
+    mindist = o_to_project.squaredNorm();
+    res.encode = 7;  // m = 0x111
+    res.parameterization[0] = dl[1].cross(b - o_to_project).norm() / s;
+    res.parameterization[1] = dl[2].cross(c - o_to_project).norm() / s;
+    res.parameterization[2] =
+        1 - res.parameterization[0] - res.parameterization[1];
   }
 
+  res.sqr_distance = mindist;
+
   return res;
 }
 
@@ -656,18 +662,24 @@ Project::ProjectResult Project::projectTetrahedraOrigin(const Vec3f& a,
   const Vec3f dl[3] = {a - d, b - d, c - d};
   FCL_REAL vl = triple(dl[0], dl[1], dl[2]);
   bool ng = (vl * a.dot((b - c).cross(a - b))) <= 0;
-  if (ng &&
-      std::abs(vl) > 0)  // abs(vl) == 0, the tetrahedron is degenerated; if ng
-                         // is false, then the last vertex in the tetrahedron
-                         // does not grow toward the origin (in fact origin is
-                         // on the other side of the abc face)
+  if (ng)  // if ng is false, then the last vertex in the tetrahedron does not
+           // grow toward the origin (in fact origin is on the other side of
+           // the abc face)
   {
     FCL_REAL mindist = -1;
+    if (vl == 0) {
+      // the tetrahedron is degenerated, the optimal can only be on a face,
+      // including the abc face
+      res = projectTriangleOrigin(a, b, c);
+      res.parameterization[3] = 0;
+      mindist = res.sqr_distance;
+    }
 
     for (size_t i = 0; i < 3; ++i) {
       size_t j = nexti[i];
       FCL_REAL s = vl * d.dot(dl[i].cross(dl[j]));
-      if (s > 0)  // the origin is to the outside part of a triangle face, then
+      if (vl == 0 ||
+          s > 0)  // the origin is to the outside part of a triangle face, then
                   // the optimal can only be on the triangle face
       {
         ProjectResult res_triangle = projectTriangleOrigin(*vt[i], *vt[j], d);
@@ -0,0 +1,186 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <hpp/fcl/linear_octree.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace hpp {
+namespace fcl {
+
+namespace internal {
+/// @brief Order the leaves by code, and the largest first for equal codes,
+/// so that a leaf comes before the leaves it contains.
+struct LinearOcTreeLeafLess {
+  bool operator()(const std::pair<LinearOcTree::Code, unsigned char>& a,
+                  const std::pair<LinearOcTree::Code, unsigned char>& b) const {
+    if (a.first != b.first) return a.first < b.first;
+    return a.second > b.second;
+  }
+};
+}  // namespace internal
+
+LinearOcTree::LinearOcTree(FCL_REAL resolution_, unsigned int depth_)
+    : CollisionGeometry(), resolution(resolution_), depth(depth_) {
+  if (resolution <= 0)
+    HPP_FCL_THROW_PRETTY("The resolution should be positive.",
+                         std::invalid_argument);
+  if (depth == 0 || depth > max_tree_depth)
+    HPP_FCL_THROW_PRETTY("The depth should be between 1 and "
+                             << max_tree_depth << ", got " << depth << ".",
+                         std::invalid_argument);
+  computeLocalAABB();
+}
+
+void LinearOcTree::setLeaves(const std::vector<Code>& codes_,
+                             const std::vector<unsigned char>& levels_) {
+  if (codes_.size() != levels_.size())
+    HPP_FCL_THROW_PRETTY("The number of codes ("
+                             << codes_.size()
+                             << ") does not match the number of levels ("
+                             << levels_.size() << ").",
+                         std::invalid_argument);
+
+  typedef std::pair<Code, unsigned char> Leaf;
+  std::vector<Leaf> leaves;
+  leaves.reserve(codes_.size());
+  const Code num_voxels = Code(1) << (3 * depth);
+  for (std::size_t i = 0; i < codes_.size(); ++i) {
+    const unsigned int level = levels_[i];
+    if (level > depth || codes_[i] >= num_voxels ||
+        (codes_[i] & ((Code(1) << (3 * level)) - 1)) != 0)
+      HPP_FCL_THROW_PRETTY("The leaf " << i << " of code " << codes_[i]
+                                       << " and level " << level
+                                       << " is not a node of the tree.",
+                           std::invalid_argument);
+    leaves.push_back(Leaf(codes_[i], levels_[i]));
+  }
+  std::sort(leaves.begin(), leaves.end(), internal::LinearOcTreeLeafLess());
+
+  codes.clear();
+  levels.clear();
+  Code covered_end = 0;
+  for (std::size_t i = 0; i < leaves.size(); ++i) {
+    const Code code = leaves[i].first;
+    const unsigned char level = leaves[i].second;
+    // Skip the leaves contained in the previous one.
+    if (!codes.empty() && code < covered_end) continue;
+    covered_end = code + (Code(1) << (3 * level));
+
+    codes.push_back(code);
+    levels.push_back(level);
+    // Merge the eight children of a node when they are all occupied.
+    while (codes.size() >= 8) {
+      const std::size_t first = codes.size() - 8;
+      const unsigned int child_level = levels.back();
+      if (child_level >= depth) break;
+      const Code child_size = Code(1) << (3 * child_level);
+      const Code parent_code = codes[first];
+      if ((parent_code & (8 * child_size - 1)) != 0) break;
+      bool full = true;
+      for (std::size_t k = 0; k < 8 && full; ++k)
+        full = levels[first + k] == child_level &&
+               codes[first + k] == parent_code + k * child_size;
+      if (!full) break;
+      codes.resize(first);
+      levels.resize(first);
+      codes.push_back(parent_code);
+      levels.push_back((unsigned char)(child_level + 1));
+    }
+  }
+  computeLocalAABB();
+}
+
+void LinearOcTree::setOccupiedPoints(
+    const Eigen::Matrix<FCL_REAL, Eigen::Dynamic, 3>& point_cloud) {
+  std::vector<Code> codes_((std::size_t)point_cloud.rows());
+  for (Eigen::DenseIndex row_id = 0; row_id < point_cloud.rows(); ++row_id)
+    codes_[(std::size_t)row_id] =
+        computeCode(Vec3f(point_cloud.row(row_id).transpose()));
+  setLeaves(codes_, std::vector<unsigned char>(codes_.size(), 0));
+}
+
+bool LinearOcTree::computeVoxelCode(const Vec3f& point, Code& code) const {
+  const FCL_REAL half = (FCL_REAL)(Code(1) << (depth - 1));
+  Code keys[3];
+  for (int i = 0; i < 3; ++i) {
+    const FCL_REAL key = std::floor(point[i] / resolution) + half;
+    if (!(key >= 0 && key < 2 * half)) return false;
+    keys[i] = (Code)key;
+  }
+  code = computeCode(keys[0], keys[1], keys[2]);
+  return true;
+}
+
+LinearOcTree::Code LinearOcTree::computeCode(const Vec3f& point) const {
+  Code code;
+  if (!computeVoxelCode(point, code))
+    HPP_FCL_THROW_PRETTY("The point (" << point.transpose()
+                                       << ") is outside of the tree.",
+                         std::invalid_argument);
+  return code;
+}
+
+bool LinearOcTree::isOccupied(const Vec3f& point) const {
+  Code code;
+  if (!computeVoxelCode(point, code)) return false;
+  std::vector<Code>::const_iterator it =
+      std::upper_bound(codes.begin(), codes.end(), code);
+  if (it == codes.begin()) return false;
+  const std::size_t i = (std::size_t)(it - codes.begin()) - 1;
+  return code < codes[i] + (Code(1) << (3 * levels[i]));
+}
+
+void LinearOcTree::computeLocalAABB() {
+  if (codes.empty()) {
+    aabb_local = getRootBV();
+  } else {
+    aabb_local = getLeafBV(0);
+    for (std::size_t i = 1; i < codes.size(); ++i) aabb_local += getLeafBV(i);
+  }
+  aabb_center = aabb_local.center();
+  aabb_radius = (aabb_local.min_ - aabb_center).norm();
+}
+
+LinearOcTreePtr_t makeLinearOctree(
+    const Eigen::Matrix<FCL_REAL, Eigen::Dynamic, 3>& point_cloud,
+    const FCL_REAL resolution) {
+  LinearOcTreePtr_t tree(new LinearOcTree(resolution));
+  tree->setOccupiedPoints(point_cloud);
+  return tree;
+}
+
+}  // namespace fcl
+}  // namespace hpp
@@ -0,0 +1,337 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <hpp/fcl/metrics.h>
+#include <hpp/fcl/collision_utility.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+
+namespace hpp {
+namespace fcl {
+namespace metrics {
+
+namespace {
+typedef std::atomic<boost::uint64_t> Counter;
+
+const std::size_t num_gjk_status_counters = NODE_COUNT * NODE_COUNT * 3;
+const std::size_t num_gjk_iteration_counters =
+    NODE_COUNT * NODE_COUNT * num_iteration_bins;
+const std::size_t num_broadphase_counters = BP_COUNT * 2;
+
+/// Only the owning thread increments its counters: a relaxed load and store
+/// avoid the cost of an atomic read-modify-write.
+inline void increment(Counter& counter) {
+  counter.store(counter.load(std::memory_order_relaxed) + 1,
+                std::memory_order_relaxed);
+}
+
+/// Counters of one thread.
+struct Counters {
+  Counter gjk_status[NODE_COUNT][NODE_COUNT][3];
+  Counter gjk_iterations[NODE_COUNT][NODE_COUNT][num_iteration_bins];
+  Counter epa_status[num_epa_statuses];
+  Counter broadphase_pairs[BP_COUNT][2];
+
+  Counters() { reset(); }
+
+  void reset() {
+    reset(&gjk_status[0][0][0], num_gjk_status_counters);
+    reset(&gjk_iterations[0][0][0], num_gjk_iteration_counters);
+    reset(epa_status, num_epa_statuses);
+    reset(&broadphase_pairs[0][0], num_broadphase_counters);
+  }
+
+  static void reset(Counter* counters, std::size_t n) {
+    for (std::size_t i = 0; i < n; ++i)
+      counters[i].store(0, std::memory_order_relaxed);
+  }
+};
+
+/// Sum of the counters of several threads.
+struct Totals {
+  boost::uint64_t gjk_status[NODE_COUNT][NODE_COUNT][3];
+  boost::uint64_t gjk_iterations[NODE_COUNT][NODE_COUNT][num_iteration_bins];
+  boost::uint64_t epa_status[num_epa_statuses];
+  boost::uint64_t broadphase_pairs[BP_COUNT][2];
+
+  Totals() { reset(); }
+
+  void reset() {
+    std::fill_n(&gjk_status[0][0][0], num_gjk_status_counters, 0);
+    std::fill_n(&gjk_iterations[0][0][0], num_gjk_iteration_counters, 0);
+    std::fill_n(epa_status, num_epa_statuses, 0);
+    std::fill_n(&broadphase_pairs[0][0], num_broadphase_counters, 0);
+  }
+
+  void add(const Counters& counters) {
+    add(&counters.gjk_status[0][0][0], num_gjk_status_counters,
+        &gjk_status[0][0][0]);
+    add(&counters.gjk_iterations[0][0][0], num_gjk_iteration_counters,
+        &gjk_iterations[0][0][0]);
+    add(counters.epa_status, num_epa_statuses, epa_status);
+    add(&counters.broadphase_pairs[0][0], num_broadphase_counters,
+        &broadphase_pairs[0][0]);
+  }
+
+  static void add(const Counter* counters, std::size_t n,
+                  boost::uint64_t* totals) {
+    for (std::size_t i = 0; i < n; ++i)
+      totals[i] += counters[i].load(std::memory_order_relaxed);
+  }
+};
+
+/// Counters of the running threads, and sum of the counters of the threads
+/// which exited.
+struct Registry {
+  std::mutex mutex;
+  std::vector<Counters*> threads;
+  Totals exited;
+
+  static Registry& instance() {
+    static Registry registry;
+    return registry;
+  }
+};
+
+/// Registers the counters of a thread for its lifetime.
+struct ThreadCounters {
+  Counters counters;
+
+  ThreadCounters() {
+    Registry& registry = Registry::instance();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.threads.push_back(&counters);
+  }
+
+  ~ThreadCounters() {
+    Registry& registry = Registry::instance();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.exited.add(counters);
+    registry.threads.erase(std::find(registry.threads.begin(),
+                                     registry.threads.end(), &counters));
+  }
+};
+
+Counters& threadCounters() {
+  static thread_local ThreadCounters thread_counters;
+  return thread_counters.counters;
+}
+
+/// Manager of the outermost BroadPhaseScope of the thread.
+thread_local BroadPhaseManagerType current_manager = BP_COUNT;
+
+const details::EPA::Status epa_statuses[num_epa_statuses] = {
+    details::EPA::Failed,
+    details::EPA::Valid,
+    details::EPA::AccuracyReached,
+    details::EPA::Degenerated,
+    details::EPA::NonConvex,
+    details::EPA::InvalidHull,
+    details::EPA::OutOfFaces,
+    details::EPA::OutOfVertices,
+    details::EPA::FallBack,
+};
+
+const char* epa_status_names[num_epa_statuses] = {
+    "Failed",
+    "Valid",
+    "AccuracyReached",
+    "Degenerated",
+    "NonConvex",
+    "InvalidHull",
+    "OutOfFaces",
+    "OutOfVertices",
+    "FallBack",
+};
+
+const char* gjk_status_names[3] = {"Valid", "Inside", "Failed"};
+
+const char* broadphase_manager_names[BP_COUNT] = {
+    "Naive",
+    "SaP",
+    "SSaP",
+    "RadixSaP",
+    "IntervalTree",
+    "DynamicAABBTree",
+    "DynamicAABBTreeArray",
+    "SpatialHash",
+    "HierarchicalSpatialHash",
+};
+
+template <typename T>
+void writeArray(std::ostream& os, const T* values, std::size_t n) {
+  os << '[';
+  for (std::size_t i = 0; i < n; ++i) os << (i ? "," : "") << values[i];
+  os << ']';
+}
+}  // namespace
+
+std::size_t iterationBin(std::size_t iterations) {
+  std::size_t bin = 0;
+  for (std::size_t bound = 1;
+       bound < iterations && bin + 1 < num_iteration_bins; bound *= 2)
+    ++bin;
+  return bin;
+}
+
+std::size_t epaStatusIndex(details::EPA::Status status) {
+  return (std::size_t)(std::find(epa_statuses, epa_statuses + num_epa_statuses,
+                                 status) -
+                       epa_statuses);
+}
+
+const char* getEPAStatusName(std::size_t index) {
+  return epa_status_names[index];
+}
+
+const char* getBroadPhaseManagerName(BroadPhaseManagerType manager) {
+  return broadphase_manager_names[manager];
+}
+
+MetricsSnapshot::MetricsSnapshot() {
+  std::fill_n(epa_status_counts, num_epa_statuses, 0);
+}
+
+void MetricsSnapshot::toJSON(std::ostream& os) const {
+  os << "{\"gjk\":[";
+  for (std::size_t i = 0; i < gjk.size(); ++i) {
+    const GJKPairMetrics& pair = gjk[i];
+    os << (i ? "," : "") << "{\"shape1\":\""
+       << get_node_type_name(pair.node_type1) << "\",\"shape2\":\""
+       << get_node_type_name(pair.node_type2) << "\",\"status\":{";
+    for (std::size_t s = 0; s < 3; ++s)
+      os << (s ? "," : "") << '"' << gjk_status_names[s]
+         << "\":" << pair.status_counts[s];
+    os << "},\"iterations\":";
+    writeArray(os, pair.iteration_histogram, num_iteration_bins);
+    os << '}';
+  }
+  os << "],\"epa\":{";
+  for (std::size_t s = 0; s < num_epa_statuses; ++s)
+    os << (s ? "," : "") << '"' << epa_status_names[s]
+       << "\":" << epa_status_counts[s];
+  os << "},\"broadphase\":[";
+  for (std::size_t i = 0; i < broadphase.size(); ++i)
+    os << (i ? "," : "") << "{\"manager\":\""
+       << getBroadPhaseManagerName(broadphase[i].manager)
+       << "\",\"collision_pairs\":" << broadphase[i].num_collision_pairs
+       << ",\"distance_pairs\":" << broadphase[i].num_distance_pairs << '}';
+  os << "]}";
+}
+
+std::string MetricsSnapshot::toJSON() const {
+  std::ostringstream os;
+  toJSON(os);
+  return os.str();
+}
+
+MetricsSnapshot snapshot() {
+  Totals totals;
+  {
+    Registry& registry = Registry::instance();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    totals = registry.exited;
+    for (std::size_t i = 0; i < registry.threads.size(); ++i)
+      totals.add(*registry.threads[i]);
+  }
+
+  MetricsSnapshot snapshot;
+  for (int t1 = 0; t1 < NODE_COUNT; ++t1)
+    for (int t2 = 0; t2 < NODE_COUNT; ++t2) {
+      const boost::uint64_t* status = totals.gjk_status[t1][t2];
+      if (status[0] + status[1] + status[2] == 0) continue;
+      GJKPairMetrics pair;
+      pair.node_type1 = (NODE_TYPE)t1;
+      pair.node_type2 = (NODE_TYPE)t2;
+      std::copy(status, status + 3, pair.status_counts);
+      std::copy(totals.gjk_iterations[t1][t2],
+                totals.gjk_iterations[t1][t2] + num_iteration_bins,
+                pair.iteration_histogram);
+      snapshot.gjk.push_back(pair);
+    }
+  std::copy(totals.epa_status, totals.epa_status + num_epa_statuses,
+            snapshot.epa_status_counts);
+  for (int m = 0; m < BP_COUNT; ++m) {
+    const boost::uint64_t* pairs = totals.broadphase_pairs[m];
+    if (pairs[0] + pairs[1] == 0) continue;
+    BroadPhaseMetrics manager;
+    manager.manager = (BroadPhaseManagerType)m;
+    manager.num_collision_pairs = pairs[0];
+    manager.num_distance_pairs = pairs[1];
+    snapshot.broadphase.push_back(manager);
+  }
+  return snapshot;
+}
+
+void reset() {
+  Registry& registry = Registry::instance();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.exited.reset();
+  for (std::size_t i = 0; i < registry.threads.size(); ++i)
+    registry.threads[i]->reset();
+}
+
+void recordGJK(NODE_TYPE node_type1, NODE_TYPE node_type2,
+               details::GJK::Status status, std::size_t iterations) {
+  Counters& counters = threadCounters();
+  increment(counters.gjk_status[node_type1][node_type2][status]);
+  increment(counters.gjk_iterations[node_type1][node_type2]
+                                   [iterationBin(iterations)]);
+}
+
+void recordEPA(details::EPA::Status status) {
+  increment(threadCounters().epa_status[epaStatusIndex(status)]);
+}
+
+void recordBroadPhasePair(bool distance) {
+  if (current_manager == BP_COUNT) return;
+  increment(threadCounters().broadphase_pairs[current_manager][distance]);
+}
+
+BroadPhaseScope::BroadPhaseScope(BroadPhaseManagerType manager)
+    : outermost(current_manager == BP_COUNT) {
+  if (outermost) current_manager = manager;
+}
+
+BroadPhaseScope::~BroadPhaseScope() {
+  if (outermost) current_manager = BP_COUNT;
+}
+
+}  // namespace metrics
+}  // namespace fcl
+}  // namespace hpp
@@ -123,7 +123,7 @@ inline bool sphereCapsuleDistance(const Sphere& s1, const Transform3f& tf1,
   p2 = segment_point - normal * s2.radius;
 
   if (dist <= 0) {
-    p1 = p2 = .5 * (p1 + p2);
+    p1 = p2 = FCL_REAL(0.5) * (p1 + p2);
     return false;
   }
   return true;
@@ -179,7 +179,7 @@ inline bool sphereCylinderDistance(const Sphere& s1, const Transform3f& tf1,
         assert(fabs(dist) - (p1 - p2).norm() < eps);
       } else {
         // Center of sphere is on cylinder boundary
-        normal = .5 * (A + B) - p2;
+        normal = FCL_REAL(0.5) * (A + B) - p2;
         normal.normalize();
         p1 = p2;
         dist = -r1;
@@ -216,7 +216,7 @@ inline bool sphereCylinderDistance(const Sphere& s1, const Transform3f& tf1,
         assert(fabs(dist) - (p1 - p2).norm() < eps);
       } else {
         // Center of sphere is on cylinder boundary
-        normal = .5 * (A + B) - p2;
+        normal = FCL_REAL(0.5) * (A + B) - p2;
         normal.normalize();
         p1 = p2;
         dist = -r1;
@@ -224,7 +224,7 @@ inline bool sphereCylinderDistance(const Sphere& s1, const Transform3f& tf1,
     }
   }
   if (dist < 0) {
-    p1 = p2 = .5 * (p1 + p2);
+    p1 = p2 = FCL_REAL(0.5) * (p1 + p2);
   }
   return (dist > 0);
 }
@@ -640,7 +640,7 @@ static unsigned int intersectRectQuad2(FCL_REAL h[2], FCL_REAL p[8],
   FCL_REAL* r = ret;
   for (int dir = 0; dir <= 1; ++dir) {
     // direction notation: xy[0] = x axis, xy[1] = y axis
-    for (int sign = -1; sign <= 1; sign += 2) {
+    for (FCL_REAL sign = -1; sign <= 1; sign += 2) {
       // chop q along the line xy[dir] = sign*h[dir]
       FCL_REAL* pq = q;
       FCL_REAL* pr = r;
@@ -702,8 +702,8 @@ static inline void cullPoints2(unsigned int n, FCL_REAL p[], unsigned int m,
       cy = p[1];
       break;
     case 2:
-      cx = 0.5 * (p[0] + p[2]);
-      cy = 0.5 * (p[1] + p[3]);
+      cx = (p[0] + p[2]) / 2;
+      cy = (p[1] + p[3]) / 2;
       break;
     default:
       a = 0;
@@ -736,9 +736,9 @@ static inline void cullPoints2(unsigned int n, FCL_REAL p[], unsigned int m,
   avail[i0] = 0;
   iret[0] = i0;
   iret++;
-  const double pi = boost::math::constants::pi<FCL_REAL>();
+  const FCL_REAL pi = boost::math::constants::pi<FCL_REAL>();
   for (unsigned int j = 1; j < m; ++j) {
-    a = j * (2 * pi / m) + A[i0];
+    a = FCL_REAL(j) * (2 * pi / FCL_REAL(m)) + A[i0];
     if (a > pi) a -= 2 * pi;
     FCL_REAL maxdiff = 1e9, diff;
 
@@ -886,7 +886,7 @@ inline unsigned int boxBox2(const Vec3f& halfSide1, const Matrix3f& R1,
     code = 6;
   }
 
-  FCL_REAL fudge2(1.0e-6);
+  FCL_REAL fudge2(FCL_REAL(1.0e-6));
   Q.array() += fudge2;
 
   Vec3f n;
@@ -1386,7 +1386,7 @@ inline bool sphereHalfspaceIntersect(const Sphere& s1, const Transform3f& tf1,
   distance = new_s2.signedDistance(center) - s1.radius;
   if (distance <= 0) {
     normal = -new_s2.n;  // pointing from s1 to s2
-    p1 = p2 = center - new_s2.n * s1.radius - (distance * 0.5) * new_s2.n;
+    p1 = p2 = center - new_s2.n * s1.radius - (distance / 2) * new_s2.n;
     return true;
   } else {
     p1 = center - s1.radius * new_s2.n;
@@ -1438,7 +1438,7 @@ inline bool boxHalfspaceIntersect(const Box& s1, const Transform3f& tf1,
 
   /// find deepest point
   Vec3f p(T);
-  int sign = 0;
+  FCL_REAL sign = 0;
 
   if (std::abs(Q[0] - 1) < halfspaceIntersectTolerance<FCL_REAL>() ||
       std::abs(Q[0] + 1) < halfspaceIntersectTolerance<FCL_REAL>()) {
@@ -1458,7 +1458,7 @@ inline bool boxHalfspaceIntersect(const Box& s1, const Transform3f& tf1,
 
   /// compute the contact point from the deepest point
   normal = -new_s2.n;
-  p1 = p2 = p - new_s2.n * (distance * 0.5);
+  p1 = p2 = p - new_s2.n * (distance / 2);
 
   return true;
 }
@@ -1487,10 +1487,10 @@ inline bool capsuleHalfspaceIntersect(const Capsule& s1, const Transform3f& tf1,
     }
 
     normal = -new_s2.n;
-    p1 = p2 = T + new_s2.n * (-0.5 * distance - s1.radius);
+    p1 = p2 = T + new_s2.n * (-FCL_REAL(0.5) * distance - s1.radius);
     return true;
   } else {
-    int sign = (cosa > 0) ? -1 : 1;
+    FCL_REAL sign = (cosa > 0) ? -1 : 1;
     // closest capsule vertex to halfspace if no collision,
     // or deeper inside halspace if collision
     Vec3f p = T + dir_z * (s1.halfLength * sign);
@@ -1505,7 +1505,7 @@ inline bool capsuleHalfspaceIntersect(const Capsule& s1, const Transform3f& tf1,
     normal = -new_s2.n;
     // deepest point
     Vec3f c = p - new_s2.n * s1.radius;
-    p1 = p2 = c - (0.5 * distance) * new_s2.n;
+    p1 = p2 = c - (FCL_REAL(0.5) * distance) * new_s2.n;
     return true;
   }
 }
@@ -1534,7 +1534,7 @@ inline bool cylinderHalfspaceIntersect(const Cylinder& s1,
     }
 
     normal = -new_s2.n;
-    p1 = p2 = T - (0.5 * distance + s1.radius) * new_s2.n;
+    p1 = p2 = T - (distance / 2 + s1.radius) * new_s2.n;
     return true;
   } else {
     Vec3f C = dir_z * cosa - new_s2.n;
@@ -1547,7 +1547,7 @@ inline bool cylinderHalfspaceIntersect(const Cylinder& s1,
       C *= s;
     }
 
-    int sign = (cosa > 0) ? -1 : 1;
+    FCL_REAL sign = (cosa > 0) ? -1 : 1;
     // deepest point
     Vec3f p = T + dir_z * (s1.halfLength * sign) + C;
     distance = new_s2.signedDistance(p);
@@ -1557,7 +1557,7 @@ inline bool cylinderHalfspaceIntersect(const Cylinder& s1,
       return false;
     } else {
       normal = -new_s2.n;
-      p1 = p2 = p - (0.5 * distance) * new_s2.n;
+      p1 = p2 = p - (FCL_REAL(0.5) * distance) * new_s2.n;
       return true;
     }
   }
@@ -1584,7 +1584,7 @@ inline bool coneHalfspaceIntersect(const Cone& s1, const Transform3f& tf1,
     } else {
       normal = -new_s2.n;
       p1 = p2 =
-          T - dir_z * (s1.halfLength) - new_s2.n * (0.5 * distance + s1.radius);
+          T - dir_z * (s1.halfLength) - new_s2.n * (distance / 2 + s1.radius);
       return true;
     }
   } else {
@@ -1609,7 +1609,7 @@ inline bool coneHalfspaceIntersect(const Cone& s1, const Transform3f& tf1,
     else {
       distance = std::min(d1, d2);
       normal = -new_s2.n;
-      p1 = p2 = ((d1 < d2) ? a1 : a2) - (0.5 * distance) * new_s2.n;
+      p1 = p2 = ((d1 < d2) ? a1 : a2) - (FCL_REAL(0.5) * distance) * new_s2.n;
       return true;
     }
   }
@@ -1635,7 +1635,7 @@ inline bool convexHalfspaceIntersect(
   }
 
   if (depth <= 0) {
-    if (contact_points) *contact_points = v - new_s2.n * (0.5 * depth);
+    if (contact_points) *contact_points = v - new_s2.n * (depth / 2);
     if (penetration_depth) *penetration_depth = depth;
     if (normal) *normal = -new_s2.n;
     return true;
@@ -1678,7 +1678,7 @@ inline bool halfspaceTriangleIntersect(const Halfspace& s1,
   distance = depth;
   if (depth <= 0) {
     normal = new_s1.n;
-    p1 = p2 = v - (0.5 * depth) * new_s1.n;
+    p1 = p2 = v - (depth / 2) * new_s1.n;
     return true;
   } else {
     p1 = v - depth * new_s1.n;
@@ -1734,7 +1734,7 @@ inline bool planeHalfspaceIntersect(const Plane& s1, const Transform3f& tf1,
 
   Vec3f n = new_s2.n * new_s1.d - new_s1.n * new_s2.d;
   Vec3f origin = n.cross(dir);
-  origin *= (1.0 / dir_norm);
+  origin *= (1 / dir_norm);
 
   p = origin;
   d = dir;
@@ -1792,7 +1792,7 @@ inline bool halfspaceIntersect(const Halfspace& s1, const Transform3f& tf1,
 
   Vec3f n = new_s2.n * new_s1.d - new_s1.n * new_s2.d;
   Vec3f origin = n.cross(dir);
-  origin *= (1.0 / dir_norm);
+  origin *= (1 / dir_norm);
 
   p = origin;
   d = dir;
@@ -1919,19 +1919,19 @@ inline bool boxPlaneIntersect(const Box& s1, const Transform3f& tf1,
   // when center is on the positive side of the plane, use a, b, c
   // make (R^T n) (a v1 + b v2 + c v3) the minimum
   // otherwise, use a, b, c make (R^T n) (a v1 + b v2 + c v3) the maximum
-  int sign = (signed_dist > 0) ? 1 : -1;
+  FCL_REAL sign = (signed_dist > 0) ? 1 : -1;
 
   if (std::abs(Q[0] - 1) < planeIntersectTolerance<FCL_REAL>() ||
       std::abs(Q[0] + 1) < planeIntersectTolerance<FCL_REAL>()) {
-    int sign2 = (A[0] > 0) ? -sign : sign;
+    FCL_REAL sign2 = (A[0] > 0) ? -sign : sign;
     p.noalias() += R.col(0) * (s1.halfSide[0] * sign2);
   } else if (std::abs(Q[1] - 1) < planeIntersectTolerance<FCL_REAL>() ||
              std::abs(Q[1] + 1) < planeIntersectTolerance<FCL_REAL>()) {
-    int sign2 = (A[1] > 0) ? -sign : sign;
+    FCL_REAL sign2 = (A[1] > 0) ? -sign : sign;
     p.noalias() += R.col(1) * (s1.halfSide[1] * sign2);
   } else if (std::abs(Q[2] - 1) < planeIntersectTolerance<FCL_REAL>() ||
              std::abs(Q[2] + 1) < planeIntersectTolerance<FCL_REAL>()) {
-    int sign2 = (A[2] > 0) ? -sign : sign;
+    FCL_REAL sign2 = (A[2] > 0) ? -sign : sign;
     p.noalias() += R.col(2) * (s1.halfSide[2] * sign2);
   } else {
     Vec3f tmp(sign * R * s1.halfSide);
@@ -2079,7 +2079,7 @@ inline bool capsulePlaneIntersect(const Capsule& s1, const Transform3f& tf1,
     if (abs_d1 <= s1.radius && abs_d2 <= s1.radius) {
       Vec3f c1 = a1 - new_s2.n * d1;
       Vec3f c2 = a2 - new_s2.n * d2;
-      p1 = p2 = (c1 + c2) * 0.5;
+      p1 = p2 = (c1 + c2) * FCL_REAL(0.5);
     } else if (abs_d1 <= s1.radius) {
       Vec3f c = a1 - new_s2.n * d1;
       p1 = p2 = c;
@@ -2273,7 +2273,7 @@ inline bool conePlaneIntersect(const Cone& s1, const Transform3f& tf1,
 
         Vec3f t1 = (-p[0] * q_d + q * p_d[0]) / (-q_d + p_d[0]);
         Vec3f t2 = (-p[1] * q_d + q * p_d[1]) / (-q_d + p_d[1]);
-        p1 = p2 = (t1 + t2) * 0.5;
+        p1 = p2 = (t1 + t2) * FCL_REAL(0.5);
       } else {
         for (std::size_t i = 0, j = 0; i < 3; ++i) {
           if (!positive[i]) {
@@ -2288,7 +2288,7 @@ inline bool conePlaneIntersect(const Cone& s1, const Transform3f& tf1,
 
         Vec3f t1 = (p[0] * q_d - q * p_d[0]) / (q_d - p_d[0]);
         Vec3f t2 = (p[1] * q_d - q * p_d[1]) / (q_d - p_d[1]);
-        p1 = p2 = (t1 + t2) * 0.5;
+        p1 = p2 = (t1 + t2) * FCL_REAL(0.5);
       }
     }
     return true;
@@ -2431,7 +2431,7 @@ inline bool planeTriangleIntersect(const Plane& s1, const Transform3f& tf1,
 
     Vec3f t1 = (-p[0] * q_d + q * p_d[0]) / (-q_d + p_d[0]);
     Vec3f t2 = (-p[1] * q_d + q * p_d[1]) / (-q_d + p_d[1]);
-    p1 = p2 = (t1 + t2) * 0.5;
+    p1 = p2 = (t1 + t2) * FCL_REAL(0.5);
   } else {
     for (std::size_t i = 0, j = 0; i < 3; ++i) {
       if (!positive[i]) {
@@ -2446,7 +2446,7 @@ inline bool planeTriangleIntersect(const Plane& s1, const Transform3f& tf1,
 
     Vec3f t1 = (p[0] * q_d - q * p_d[0]) / (q_d - p_d[0]);
     Vec3f t2 = (p[1] * q_d - q * p_d[1]) / (q_d - p_d[1]);
-    p1 = p2 = (t1 + t2) * 0.5;
+    p1 = p2 = (t1 + t2) * FCL_REAL(0.5);
   }
   return true;
 }
@@ -38,6 +38,8 @@
 #include <hpp/fcl/narrowphase/gjk.h>
 #include <hpp/fcl/internal/intersect.h>
 #include <hpp/fcl/internal/tools.h>
+#include <hpp/fcl/tracing.h>
+#include <hpp/fcl/workspace.h>
 #include <hpp/fcl/shape/geometric_shapes_traits.h>
 
 namespace hpp {
@@ -65,7 +67,10 @@ void getShapeSupport(const TriangleP* triangle, const Vec3f& dir,
 
 inline void getShapeSupport(const Box* box, const Vec3f& dir, Vec3f& support,
                             int&, MinkowskiDiff::ShapeData*) {
-  const FCL_REAL inflate = (dir.array() == 0).any() ? 1.00000001 : 1.;
+  // The inflation must stay representable in single precision.
+  static const FCL_REAL inflation = (std::max)(
+      FCL_REAL(1e-8), 10 * std::numeric_limits<FCL_REAL>::epsilon());
+  const FCL_REAL inflate = (dir.array() == 0).any() ? 1 + inflation : 1;
   support.noalias() =
       (dir.array() > 0)
           .select(inflate * box->halfSide, -inflate * box->halfSide);
@@ -101,7 +106,7 @@ inline void getShapeSupport(const Capsule* capsule, const Vec3f& dir,
 void getShapeSupport(const Cone* cone, const Vec3f& dir, Vec3f& support, int&,
                      MinkowskiDiff::ShapeData*) {
   // The cone radius is, for -h < z < h, (h - z) * r / (2*h)
-  static const FCL_REAL inflate = 1.00001;
+  static const FCL_REAL inflate = FCL_REAL(1.00001);
   FCL_REAL h = cone->halfLength;
   FCL_REAL r = cone->radius;
 
@@ -141,7 +146,7 @@ void getShapeSupport(const Cylinder* cylinder, const Vec3f& dir, Vec3f& support,
   // The inflation makes the object look strictly convex to GJK and EPA. This
   // helps solving particular cases (e.g. a cylinder with itself at the same
   // position...)
-  static const FCL_REAL inflate = 1.00001;
+  static const FCL_REAL inflate = FCL_REAL(1.00001);
   FCL_REAL half_h = cylinder->halfLength;
   FCL_REAL r = cylinder->radius;
 
@@ -160,7 +165,8 @@ void getShapeSupport(const Cylinder* cylinder, const Vec3f& dir, Vec3f& support,
   else
     support.head<2>() = dir.head<2>().normalized() * r;
   assert(fabs(support[0] * dir[1] - support[1] * dir[0]) <
-         sqrt(std::numeric_limits<FCL_REAL>::epsilon()));
+         sqrt(std::numeric_limits<FCL_REAL>::epsilon()) *
+             (1 + r * dir.head<2>().norm()));
 }
 
 struct SmallConvex : ShapeBase {};
@@ -176,7 +182,9 @@ void getShapeSupportLog(const ConvexBase* convex, const Vec3f& dir,
 
   if (hint < 0 || hint >= (int)convex->num_points) hint = 0;
   FCL_REAL maxdot = pts[hint].dot(dir);
-  std::vector<int8_t>& visited = data->visited;
+  QueryWorkspace* workspace = QueryWorkspace::current();
+  std::vector<int8_t>& visited =
+      workspace ? workspace->visited : data->visited;
   visited.assign(convex->num_points, false);
   visited[static_cast<std::size_t>(hint)] = true;
   // when the first face is orthogonal to dir, all the dot products will be
@@ -321,14 +329,16 @@ void getSupportFuncTpl(const MinkowskiDiff& md, const Vec3f& dir,
                              (bool)shape_traits<Shape1>::NeedNormalizedDir)
   };
 #ifndef NDEBUG
+  const FCL_REAL eps =
+      (std::max)(FCL_REAL(1e-6), 100 * Eigen::NumTraits<FCL_REAL>::epsilon());
   // Need normalized direction and direction is normalized
   assert(!NeedNormalizedDir || !dirIsNormalized ||
-         fabs(dir.squaredNorm() - 1) < 1e-6);
+         fabs(dir.squaredNorm() - 1) < eps);
   // Need normalized direction but direction is not normalized.
   assert(!NeedNormalizedDir || dirIsNormalized ||
-         fabs(dir.normalized().squaredNorm() - 1) < 1e-6);
+         fabs(dir.normalized().squaredNorm() - 1) < eps);
   // Don't need normalized direction. Check that dir is not zero.
-  assert(NeedNormalizedDir || dir.cwiseAbs().maxCoeff() >= 1e-6);
+  assert(NeedNormalizedDir || dir.cwiseAbs().maxCoeff() >= eps);
 #endif
   getSupportTpl<Shape0, Shape1, TransformIsIdentity>(
       static_cast<const Shape0*>(md.shapes[0]),
@@ -520,6 +530,8 @@ void GJK::initialize() {
   status = Failed;
   distance_upper_bound = (std::numeric_limits<FCL_REAL>::max)();
   simplex = NULL;
+  iterations = 0;
+  num_call_support = 0;
   gjk_variant = GJKVariant::DefaultGJK;
   convergence_criterion = GJKConvergenceCriterion::VDB;
   convergence_criterion_type = GJKConvergenceCriterionType::Relative;
@@ -548,14 +560,14 @@ bool getClosestPoints(const GJK::Simplex& simplex, Vec3f& w0, Vec3f& w1) {
       FCL_REAL la, lb;
       Vec3f N(b - a);
       la = N.dot(-a);
+      // The projection of the origin lies inside the segment, up to the
+      // rounding errors, which are significant in single precision.
       if (la <= 0) {
-        assert(false);
         w0 = a0;
         w1 = a1;
       } else {
         lb = N.squaredNorm();
         if (la > lb) {
-          assert(false);
           w0 = b0;
           w1 = b1;
         } else {
@@ -625,6 +637,7 @@ GJK::Status GJK::evaluate(const MinkowskiDiff& shape_, const Vec3f& guess,
                           const support_func_guess_t& supportHint) {
   FCL_REAL alpha = 0;
   iterations = 0;
+  num_call_support = 0;
   const FCL_REAL inflation = shape_.inflation.sum();
   const FCL_REAL upper_bound = distance_upper_bound + inflation;
 
@@ -707,8 +720,6 @@ GJK::Status GJK::evaluate(const MinkowskiDiff& shape_, const Vec3f& guess,
     appendVertex(curr_simplex, -dir, false,
                  support_hint);  // see below, ray points away from origin
 
-    // check removed (by ?): when the new support point is close to previous
-    // support points, stop (as the new simplex is degenerated)
     w = curr_simplex.vertex[curr_simplex.rank - 1]->w;
 
     // check B: no collision if omega > 0
@@ -731,6 +742,11 @@ GJK::Status GJK::evaluate(const MinkowskiDiff& shape_, const Vec3f& guess,
     // check C: when the new support point is close to the sub-simplex where the
     // ray point lies, stop (as the new simplex again is degenerated)
     bool cv_check_passed = checkConvergence(w, rl, alpha, omega);
+    // When the new support point is already in the simplex, stop (as the new
+    // simplex is degenerated). In single precision, the relative criterion
+    // may be below the rounding errors of omega for small distances.
+    for (vertex_id_t i = 0; i + 1 < curr_simplex.rank; ++i)
+      if (curr_simplex.vertex[i]->w == w) cv_check_passed = true;
     // TODO here, we can stop at iteration 0 if this condition is met.
     // We stopping at iteration 0, the closest point will not be valid.
     // if(diff - tolerance * rl <= 0)
@@ -776,7 +792,7 @@ GJK::Status GJK::evaluate(const MinkowskiDiff& shape_, const Vec3f& guess,
     if (!inside) rl = ray.norm();
     if (inside || rl == 0) {
       status = Inside;
-      distance = -inflation - 1.;
+      distance = -inflation - 1;
       break;
     }
 
@@ -784,6 +800,10 @@ GJK::Status GJK::evaluate(const MinkowskiDiff& shape_, const Vec3f& guess,
 
   } while (status == Valid);
 
+  // The convergence criterion may not be met within the iterations, at the
+  // rounding errors of single precision. Keep the last simplex estimate.
+  if (status == Failed) distance = rl - inflation;
+
   simplex = &simplices[current];
   assert(simplex->rank > 0 && simplex->rank < 5);
   return status;
@@ -861,6 +881,7 @@ inline void GJK::removeVertex(Simplex& simplex) {
 inline void GJK::appendVertex(Simplex& simplex, const Vec3f& v,
                               bool isNormalized, support_func_guess_t& hint) {
   simplex.vertex[simplex.rank] = free_v[--nfree];  // set the memory
+  ++num_call_support;
   getSupport(v, isNormalized, *simplex.vertex[simplex.rank++], hint);
 }
 
@@ -881,35 +902,42 @@ bool GJK::encloseOrigin() {
         axis[i] = 0;
       }
       break;
+    // The directions are normalized: the cross products of nearly parallel
+    // vectors are below the rounding errors of the support functions, in
+    // single precision.
     case 2: {
       Vec3f d = simplex->vertex[1]->w - simplex->vertex[0]->w;
       for (int i = 0; i < 3; ++i) {
         axis[i] = 1;
         Vec3f p = d.cross(axis);
-        if (!p.isZero()) {
-          appendVertex(*simplex, p, false, hint);
+        const FCL_REAL norm = p.norm();
+        if (norm > 0) {
+          p /= norm;
+          appendVertex(*simplex, p, true, hint);
           if (encloseOrigin()) return true;
           removeVertex(*simplex);
-          appendVertex(*simplex, -p, false, hint);
+          appendVertex(*simplex, -p, true, hint);
           if (encloseOrigin()) return true;
           removeVertex(*simplex);
         }
         axis[i] = 0;
       }
     } break;
-    case 3:
+    case 3: {
       axis.noalias() =
           (simplex->vertex[1]->w - simplex->vertex[0]->w)
               .cross(simplex->vertex[2]->w - simplex->vertex[0]->w);
-      if (!axis.isZero()) {
-        appendVertex(*simplex, axis, false, hint);
+      const FCL_REAL norm = axis.norm();
+      if (norm > 0) {
+        axis /= norm;
+        appendVertex(*simplex, axis, true, hint);
         if (encloseOrigin()) return true;
         removeVertex(*simplex);
-        appendVertex(*simplex, -axis, false, hint);
+        appendVertex(*simplex, -axis, true, hint);
         if (encloseOrigin()) return true;
         removeVertex(*simplex);
       }
-      break;
+    } break;
     case 4:
       if (std::abs(triple(simplex->vertex[0]->w - simplex->vertex[3]->w,
                           simplex->vertex[1]->w - simplex->vertex[3]->w,
@@ -1069,7 +1097,12 @@ bool GJK::projectTetrahedraOrigin(const Simplex& current, Simplex& next) {
   const Vec3f a_cross_b = A.cross(B);
   const Vec3f a_cross_c = A.cross(C);
 
-  const FCL_REAL dummy_precision = Eigen::NumTraits<FCL_REAL>::epsilon();
+  // The terms of the region tests scale with the fourth power of the simplex
+  // size, and so do their rounding errors.
+  const FCL_REAL sqr_size = (std::max)((std::max)(aa, bb), (std::max)(cc, dd));
+  const FCL_REAL dummy_precision =
+      Eigen::NumTraits<FCL_REAL>::epsilon() *
+      (std::max)(FCL_REAL(1), 100 * sqr_size * sqr_size);
   HPP_FCL_UNUSED_VARIABLE(dummy_precision);
 
 #define REGION_INSIDE()               \
@@ -1261,8 +1294,8 @@ bool GJK::projectTetrahedraOrigin(const Simplex& current, Simplex& next) {
             }       // end of (ACD ^ AD).AO >= 0
           } else {  // not (ACD ^ AC).AO >= 0 / !a10.a11.a2.a12.!a6
             assert(!(da * ca_da + dc * da_aa - dd * ca_aa <=
-                     dummy_precision));  // Not (ACD ^ AD).AO >= 0 /
-                                         // !a10.a11.a2.a12.!a6.!a7
+                     -dummy_precision));  // Not (ACD ^ AD).AO >= 0 /
+                                          // !a10.a11.a2.a12.!a6.!a7
             if (ca * ba_ca + cb * ca_aa - cc * ba_aa <=
                 0) {  // if (ABC ^ AC).AO >= 0 / !a10.a11.a2.a12.!a6.!a7.a5
               // Region AC
@@ -1437,12 +1470,25 @@ bool GJK::projectTetrahedraOrigin(const Simplex& current, Simplex& next) {
 }
 
 void EPA::initialize() {
-  sv_store = new SimplexV[max_vertex_num];
-  fc_store = new SimplexF[max_face_num];
+  QueryWorkspace* workspace = QueryWorkspace::current();
+  owns_store = workspace == NULL;
+  if (owns_store) {
+    sv_store = new SimplexV[max_vertex_num];
+    fc_store = new SimplexF[max_face_num];
+  } else {
+    if (workspace->epa_vertices.size() < max_vertex_num)
+      workspace->epa_vertices.resize(max_vertex_num);
+    if (workspace->epa_faces.size() < max_face_num)
+      workspace->epa_faces.resize(max_face_num);
+    sv_store = workspace->epa_vertices.data();
+    fc_store = workspace->epa_faces.data();
+  }
   status = Failed;
   normal = Vec3f(0, 0, 0);
   depth = 0;
   nextsv = 0;
+  iterations = 0;
+  num_call_support = 0;
   for (size_t i = 0; i < max_face_num; ++i)
     stock.append(&fc_store[max_face_num - i - 1]);
 }
@@ -1467,7 +1513,8 @@ bool EPA::getEdgeDist(SimplexF* face, SimplexV* a, SimplexV* b,
       dist = b->w.norm();
     else {
       dist = std::sqrt(std::max(
-          a->w.squaredNorm() - a_dot_ab * a_dot_ab / ab.squaredNorm(), 0.));
+          a->w.squaredNorm() - a_dot_ab * a_dot_ab / ab.squaredNorm(),
+          FCL_REAL(0)));
     }
 
     return true;
@@ -1529,8 +1576,11 @@ EPA::SimplexF* EPA::findBest() {
 }
 
 EPA::Status EPA::evaluate(GJK& gjk, const Vec3f& guess) {
+  HPP_FCL_TRACE_SPAN("EPA", "narrowphase");
   GJK::Simplex& simplex = *gjk.getSimplex();
   support_func_guess_t hint(gjk.support_hint);
+  const size_t gjk_num_call_support = gjk.getNumCallSupport();
+  iterations = 0;
   if ((simplex.rank > 1) && gjk.encloseOrigin()) {
     while (hull.root) {
       SimplexF* f = hull.root;
@@ -1560,7 +1610,6 @@ EPA::Status EPA::evaluate(GJK& gjk, const Vec3f& guess) {
                                     // minimum distance to origin) to split
       SimplexF outer = *best;
       size_t pass = 0;
-      size_t iterations = 0;
 
       // set the face connectivity
       bind(tetrahedron[0], 0, tetrahedron[1], 0);
@@ -1611,6 +1660,8 @@ EPA::Status EPA::evaluate(GJK& gjk, const Vec3f& guess) {
       result.vertex[0] = outer.vertex[0];
       result.vertex[1] = outer.vertex[1];
       result.vertex[2] = outer.vertex[2];
+      num_call_support =
+          gjk.getNumCallSupport() - gjk_num_call_support + nextsv;
       return status;
     }
   }
@@ -1620,6 +1671,7 @@ EPA::Status EPA::evaluate(GJK& gjk, const Vec3f& guess) {
   // combination describe the origin, the point in the simplex is actually
   // the origin.
   status = FallBack;
+  num_call_support = gjk.getNumCallSupport() - gjk_num_call_support;
   // TODO: define a better normal
   assert(simplex.rank == 1 && simplex.vertex[0]->w.isZero(gjk.getTolerance()));
   normal = -guess;
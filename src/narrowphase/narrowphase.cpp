@@ -479,6 +479,9 @@ bool GJKSolver::shapeDistance<TriangleP, TriangleP>(
   initialize_gjk(gjk, shape, t1, t2, guess, support_hint);
 
   details::GJK::Status gjk_status = gjk.evaluate(shape, guess, support_hint);
+  profileGJK(gjk);
+  HPP_FCL_METRICS_RECORD(recordGJK(GEOM_TRIANGLE, GEOM_TRIANGLE, gjk_status,
+                                   gjk.getIterations()));
   if (gjk_initial_guess == GJKInitialGuess::CachedGuess ||
       enable_cached_guess) {
     cached_guess = gjk.getGuessFromSimplex();
@@ -500,7 +503,7 @@ bool GJKSolver::shapeDistance<TriangleP, TriangleP>(
       FCL_REAL penetrationDepth = details::computePenetration(
           t1.a, t1.b, t1.c, t2.a, t2.b, t2.c, normal);
       dist = -penetrationDepth;
-      assert(dist <= 1e-6);
+      assert(dist <= gjk_tolerance);
       // GJK says Inside when below GJK.tolerance. So non intersecting
       // triangle may trigger "Inside" and have no penetration.
       return penetrationDepth < 0;
@@ -34,6 +34,8 @@
 
 #include <hpp/fcl/octree.h>
 
+#include <algorithm>
+
 namespace hpp {
 namespace fcl {
 namespace internal {
@@ -58,7 +60,7 @@ void computeNeighbors(const std::vector<boost::array<FCL_REAL, 6> >& boxes,
                       std::vector<Neighbors>& neighbors) {
   typedef std::vector<boost::array<FCL_REAL, 6> > VectorArray6;
   FCL_REAL fixedSize = -1;
-  FCL_REAL e(1e-8);
+  FCL_REAL e(FCL_REAL(1e-8));
   for (std::size_t i = 0; i < boxes.size(); ++i) {
     const boost::array<FCL_REAL, 6>& box(boxes[i]);
     Neighbors& n(neighbors[i]);
@@ -126,14 +128,16 @@ void OcTree::exportAsObjFile(const std::string& filename) const {
     FCL_REAL z(box[2]);
     FCL_REAL size(box[3]);
 
-    vertices.push_back(Vec3f(x - .5 * size, y - .5 * size, z - .5 * size));
-    vertices.push_back(Vec3f(x + .5 * size, y - .5 * size, z - .5 * size));
-    vertices.push_back(Vec3f(x - .5 * size, y + .5 * size, z - .5 * size));
-    vertices.push_back(Vec3f(x + .5 * size, y + .5 * size, z - .5 * size));
-    vertices.push_back(Vec3f(x - .5 * size, y - .5 * size, z + .5 * size));
-    vertices.push_back(Vec3f(x + .5 * size, y - .5 * size, z + .5 * size));
-    vertices.push_back(Vec3f(x - .5 * size, y + .5 * size, z + .5 * size));
-    vertices.push_back(Vec3f(x + .5 * size, y + .5 * size, z + .5 * size));
+    FCL_REAL half(size / 2);
+
+    vertices.push_back(Vec3f(x - half, y - half, z - half));
+    vertices.push_back(Vec3f(x + half, y - half, z - half));
+    vertices.push_back(Vec3f(x - half, y + half, z - half));
+    vertices.push_back(Vec3f(x + half, y + half, z - half));
+    vertices.push_back(Vec3f(x - half, y - half, z + half));
+    vertices.push_back(Vec3f(x + half, y - half, z + half));
+    vertices.push_back(Vec3f(x - half, y + half, z + half));
+    vertices.push_back(Vec3f(x + half, y + half, z + half));
 
     // Add face only if box has no neighbor with the same face
     if (!n.minusX()) {
@@ -182,6 +186,237 @@ void OcTree::exportAsObjFile(const std::string& filename) const {
   }
 }
 
+namespace internal {
+struct CompareBoxesAlongAxis {
+  const std::vector<AABB>& boxes;
+  const int axis;
+
+  CompareBoxesAlongAxis(const std::vector<AABB>& boxes_, int axis_)
+      : boxes(boxes_), axis(axis_) {}
+
+  bool operator()(unsigned int a, unsigned int b) const {
+    return boxes[a].min_[axis] < boxes[b].min_[axis];
+  }
+};
+
+/// @brief Build the node of the hierarchy over boxes[order[begin:end]].
+static void buildOccupiedLeavesRecurse(OcTreeOccupiedLeaves& leaves,
+                                       const std::vector<AABB>& boxes,
+                                       std::vector<unsigned int>& order,
+                                       const unsigned int begin,
+                                       const unsigned int end) {
+  const unsigned int node_id = static_cast<unsigned int>(leaves.nodes.size());
+  leaves.nodes.push_back(OcTreeOccupiedLeaves::Node());
+
+  AABB bv(boxes[order[begin]]), centers(boxes[order[begin]].center());
+  for (unsigned int i = begin + 1; i < end; ++i) {
+    bv += boxes[order[i]];
+    centers += boxes[order[i]].center();
+  }
+  leaves.nodes[node_id].bv = bv;
+
+  if (end - begin <= OcTreeOccupiedLeaves::max_leaf_size) {
+    leaves.nodes[node_id].index = begin;
+    leaves.nodes[node_id].num_boxes = end - begin;
+    return;
+  }
+
+  // Median split along the largest extent of the box centers.
+  int axis;
+  (centers.max_ - centers.min_).maxCoeff(&axis);
+  const unsigned int mid = begin + (end - begin) / 2;
+  std::nth_element(order.begin() + begin, order.begin() + mid,
+                   order.begin() + end, CompareBoxesAlongAxis(boxes, axis));
+
+  buildOccupiedLeavesRecurse(leaves, boxes, order, begin, mid);
+  leaves.nodes[node_id].index = static_cast<unsigned int>(leaves.nodes.size());
+  leaves.nodes[node_id].num_boxes = 0;
+  buildOccupiedLeavesRecurse(leaves, boxes, order, mid, end);
+}
+
+/// @brief Code of the octree leaf of the given key and depth.
+static uint64_t occupiedLeafCode(const octomap::OcTree& tree,
+                                 const octomap::OcTreeKey& key,
+                                 const unsigned int depth) {
+  const octomap::OcTreeKey k = tree.adjustKeyAtDepth(key, depth);
+  return (static_cast<uint64_t>(depth) << 48) |
+         (static_cast<uint64_t>(k[0]) << 32) |
+         (static_cast<uint64_t>(k[1]) << 16) | static_cast<uint64_t>(k[2]);
+}
+
+/// @brief Remove the box of the octree leaf of the given code, if any.
+/// @return whether a box was removed.
+static bool removeOccupiedLeaf(OcTreeOccupiedLeaves& leaves,
+                               const uint64_t code) {
+  std::unordered_map<uint64_t, unsigned int>::iterator found =
+      leaves.box_ids.find(code);
+  if (found == leaves.box_ids.end()) return false;
+  leaves.boxes[found->second] = AABB();
+  ++leaves.num_removed_boxes;
+  leaves.box_ids.erase(found);
+  return true;
+}
+
+/// @brief Box of the octree leaf pointed by an octomap iterator.
+template <typename Iterator>
+static AABB occupiedLeafBox(const Iterator& it) {
+  const Vec3f center(FCL_REAL(it.getX()), FCL_REAL(it.getY()),
+                     FCL_REAL(it.getZ()));
+  const Vec3f half_size(Vec3f::Constant(FCL_REAL(it.getSize() / 2)));
+  return AABB(center - half_size, center + half_size);
+}
+}  // namespace internal
+
+void OcTree::buildOccupiedLeaves() {
+  std::vector<AABB> boxes;
+  std::vector<int> node_ids;
+  std::vector<uint64_t> codes;
+  for (octomap::OcTree::leaf_iterator it = tree->begin_leafs(),
+                                      end = tree->end_leafs();
+       it != end; ++it) {
+    if (!isNodeOccupied(&*it)) continue;
+    boxes.push_back(internal::occupiedLeafBox(it));
+    node_ids.push_back(static_cast<int>(&*it - tree->getRoot()));
+    codes.push_back(
+        internal::occupiedLeafCode(*tree, it.getKey(), it.getDepth()));
+  }
+
+  shared_ptr<OcTreeOccupiedLeaves> leaves(new OcTreeOccupiedLeaves);
+  if (!boxes.empty()) {
+    std::vector<unsigned int> order(boxes.size());
+    for (unsigned int i = 0; i < order.size(); ++i) order[i] = i;
+    leaves->nodes.reserve(2 * boxes.size());
+    internal::buildOccupiedLeavesRecurse(
+        *leaves, boxes, order, 0, static_cast<unsigned int>(boxes.size()));
+
+    leaves->boxes.resize(boxes.size());
+    leaves->node_ids.resize(boxes.size());
+    for (unsigned int i = 0; i < order.size(); ++i) {
+      leaves->boxes[i] = boxes[order[i]];
+      leaves->node_ids[i] = node_ids[order[i]];
+      leaves->box_ids[codes[order[i]]] = i;
+    }
+  }
+  leaves->num_hierarchy_boxes = static_cast<unsigned int>(boxes.size());
+  occupied_leaves = leaves;
+}
+
+void OcTree::updateOccupiedLeaves(
+    const std::vector<octomap::OcTreeKey>& keys) {
+  if (!occupied_leaves) {
+    buildOccupiedLeaves();
+    return;
+  }
+  OcTreeOccupiedLeaves& leaves = *occupied_leaves;
+  const unsigned int tree_depth = tree->getTreeDepth();
+
+  // Remove the boxes of the nodes containing the modified voxels, down to the
+  // leaf now containing them. Such a node may have been expanded by octomap.
+  // Below this leaf, remove the boxes of the children of the nodes containing
+  // the voxels, which may have been pruned into the leaf.
+  // The key ranges of the removed nodes are kept in removed_min_keys and
+  // removed_max_keys.
+  std::vector<octomap::OcTreeKey> removed_min_keys, removed_max_keys;
+  for (std::size_t i = 0; i < keys.size(); ++i) {
+    unsigned int leaf_depth = 0;
+    octomap::OcTree::leaf_bbx_iterator leaf =
+        tree->begin_leafs_bbx(keys[i], keys[i]);
+    if (leaf != tree->end_leafs_bbx()) leaf_depth = leaf.getDepth();
+
+    for (unsigned int depth = 0; depth <= tree_depth; ++depth) {
+      const unsigned int level = tree_depth - depth;
+      const unsigned int num_nodes = depth <= leaf_depth ? 1 : 8;
+      for (unsigned int child = 0; child < num_nodes; ++child) {
+        octomap::OcTreeKey key(keys[i]);
+        if (depth > leaf_depth)
+          for (unsigned int k = 0; k < 3; ++k)
+            key[k] = static_cast<octomap::key_type>(
+                (key[k] & ~(1u << level)) | (((child >> k) & 1u) << level));
+        if (!internal::removeOccupiedLeaf(
+                leaves, internal::occupiedLeafCode(*tree, key, depth)))
+          continue;
+        const octomap::key_type mask =
+            static_cast<octomap::key_type>(~((1u << level) - 1));
+        octomap::OcTreeKey min_key, max_key;
+        for (unsigned int k = 0; k < 3; ++k) {
+          min_key[k] = static_cast<octomap::key_type>(key[k] & mask);
+          max_key[k] =
+              static_cast<octomap::key_type>(min_key[k] + ((1u << level) - 1));
+        }
+        removed_min_keys.push_back(min_key);
+        removed_max_keys.push_back(max_key);
+      }
+    }
+  }
+
+  // Add the occupied leaves now containing the modified voxels or covering
+  // the removed nodes.
+  for (std::size_t i = 0; i < keys.size() + removed_min_keys.size(); ++i) {
+    const bool is_voxel = i < keys.size();
+    const octomap::OcTreeKey& min_key =
+        is_voxel ? keys[i] : removed_min_keys[i - keys.size()];
+    const octomap::OcTreeKey& max_key =
+        is_voxel ? keys[i] : removed_max_keys[i - keys.size()];
+    for (octomap::OcTree::leaf_bbx_iterator
+             it = tree->begin_leafs_bbx(min_key, max_key),
+             end = tree->end_leafs_bbx();
+         it != end; ++it) {
+      if (!isNodeOccupied(&*it)) continue;
+      const uint64_t code =
+          internal::occupiedLeafCode(*tree, it.getKey(), it.getDepth());
+      if (leaves.box_ids.count(code)) continue;
+      leaves.box_ids[code] = static_cast<unsigned int>(leaves.boxes.size());
+      leaves.boxes.push_back(internal::occupiedLeafBox(it));
+      leaves.node_ids.push_back(static_cast<int>(&*it - tree->getRoot()));
+    }
+  }
+
+  const std::size_t num_replaced_boxes =
+      leaves.boxes.size() - leaves.num_hierarchy_boxes +
+      leaves.num_removed_boxes;
+  if (num_replaced_boxes > leaves.num_hierarchy_boxes / 4 + 64)
+    buildOccupiedLeaves();
+}
+
+void OcTree::updateOccupiedLeavesFromChangedKeys() {
+  std::vector<octomap::OcTreeKey> keys;
+  keys.reserve(tree->numChangesDetected());
+  for (octomap::KeyBoolMap::const_iterator it = tree->changedKeysBegin(),
+                                           end = tree->changedKeysEnd();
+       it != end; ++it)
+    keys.push_back(it->first);
+  updateOccupiedLeaves(keys);
+}
+
+LinearOcTreePtr_t OcTree::toLinearOcTree() const {
+  const unsigned int depth = tree->getTreeDepth();
+  std::vector<LinearOcTree::Code> codes;
+  std::vector<unsigned char> levels;
+  for (octomap::OcTree::leaf_iterator it = tree->begin_leafs(),
+                                      end = tree->end_leafs();
+       it != end; ++it) {
+    if (!isNodeOccupied(&*it)) continue;
+    // The key of a node is the one of its center voxel: clearing its lowest
+    // bits gives the key of its first voxel.
+    const unsigned int level = depth - it.getDepth();
+    const octomap::key_type mask = (octomap::key_type)(~((1u << level) - 1));
+    const octomap::OcTreeKey& key = it.getKey();
+    codes.push_back(LinearOcTree::computeCode(key[0] & mask, key[1] & mask,
+                                              key[2] & mask));
+    levels.push_back((unsigned char)level);
+  }
+
+  LinearOcTreePtr_t linear_tree(
+      new LinearOcTree(FCL_REAL(tree->getResolution()), depth));
+  linear_tree->setLeaves(codes, levels);
+  return linear_tree;
+}
+
+SignedDistanceFieldPtr_t OcTree::toSignedDistanceField(
+    FCL_REAL padding) const {
+  return makeSignedDistanceField(*toLinearOcTree(), padding);
+}
+
 OcTreePtr_t makeOctree(
     const Eigen::Matrix<FCL_REAL, Eigen::Dynamic, 3>& point_cloud,
     const FCL_REAL resolution) {
@@ -0,0 +1,519 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <hpp/fcl/sdf.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <hpp/fcl/BVH/BVH_model.h>
+#include <hpp/fcl/linear_octree.h>
+#include <hpp/fcl/internal/intersect.h>
+
+namespace hpp {
+namespace fcl {
+
+namespace internal {
+/// @brief Distance between a point and a possibly degenerate triangle.
+static FCL_REAL pointTriangleDistance(const Vec3f& a, const Vec3f& b,
+                                      const Vec3f& c, const Vec3f& p) {
+  FCL_REAL sqr_distance = Project::projectTriangle(a, b, c, p).sqr_distance;
+  if (sqr_distance < 0) {
+    sqr_distance = (p - a).squaredNorm();
+    const Vec3f* vertices[] = {&a, &b, &c, &a};
+    for (int i = 0; i < 3; ++i) {
+      const FCL_REAL d =
+          Project::projectLine(*vertices[i], *vertices[i + 1], p).sqr_distance;
+      if (d >= 0) sqr_distance = std::min(sqr_distance, d);
+    }
+  }
+  return std::sqrt(sqr_distance);
+}
+
+/// @brief Whether the edge (p, q) of a counter-clockwise triangle of the
+/// (y, z) plane contains the points it passes through. For a pair of opposite
+/// edges, exactly one of them does, so that a point on an edge shared by two
+/// triangles belongs to exactly one of them.
+static bool isTopLeftEdge(const Vec3f& p, const Vec3f& q) {
+  return q[2] < p[2] || (q[2] == p[2] && q[1] < p[1]);
+}
+
+/// @brief Orientation of (p, q, r) in the (y, z) plane.
+static FCL_REAL orientYZ(const Vec3f& p, const Vec3f& q, const Vec3f& r) {
+  return (q[1] - p[1]) * (r[2] - p[2]) - (q[2] - p[2]) * (r[1] - p[1]);
+}
+
+/// @brief Orientation of the point r with respect to the edge (p, q) in the
+/// (y, z) plane, computed in an order independent of the one of the
+/// endpoints, so that the edges shared by two triangles agree exactly.
+static FCL_REAL edgeOrientYZ(const Vec3f& p, const Vec3f& q, const Vec3f& r) {
+  if (p[2] < q[2] || (p[2] == q[2] && p[1] < q[1])) return orientYZ(p, q, r);
+  return -orientYZ(q, p, r);
+}
+
+/// @brief Squared Euclidean distance transform of the samples f[0], f[stride],
+/// ... along a line of n samples (Felzenszwalb and Huttenlocher).
+static void distanceTransform(FCL_REAL* f, const Eigen::DenseIndex stride,
+                              const Eigen::DenseIndex n,
+                              std::vector<FCL_REAL>& line,
+                              std::vector<Eigen::DenseIndex>& v,
+                              std::vector<FCL_REAL>& z) {
+  for (Eigen::DenseIndex q = 0; q < n; ++q)
+    line[(std::size_t)q] = f[q * stride];
+
+  // Lower envelope of the parabolas rooted at the samples.
+  std::size_t k = 0;
+  v[0] = 0;
+  z[0] = -std::numeric_limits<FCL_REAL>::infinity();
+  z[1] = std::numeric_limits<FCL_REAL>::infinity();
+  for (Eigen::DenseIndex q = 1; q < n; ++q) {
+    FCL_REAL s;
+    while (true) {
+      const Eigen::DenseIndex r = v[k];
+      s = ((line[(std::size_t)q] + (FCL_REAL)(q * q)) -
+           (line[(std::size_t)r] + (FCL_REAL)(r * r))) /
+          (FCL_REAL)(2 * (q - r));
+      if (s > z[k]) break;
+      --k;
+    }
+    ++k;
+    v[k] = q;
+    z[k] = s;
+    z[k + 1] = std::numeric_limits<FCL_REAL>::infinity();
+  }
+
+  k = 0;
+  for (Eigen::DenseIndex q = 0; q < n; ++q) {
+    while (z[k + 1] < (FCL_REAL)q) ++k;
+    const Eigen::DenseIndex r = v[k];
+    f[q * stride] = (FCL_REAL)((q - r) * (q - r)) + line[(std::size_t)r];
+  }
+}
+
+/// @brief Squared Euclidean distance transform of a grid, in number of
+/// samples.
+static void distanceTransform(VecXf& f,
+                              const SignedDistanceField::Dims& dims) {
+  const Eigen::DenseIndex n = dims.maxCoeff();
+  std::vector<FCL_REAL> line((std::size_t)n), z((std::size_t)n + 1);
+  std::vector<Eigen::DenseIndex> v((std::size_t)n);
+  const Eigen::DenseIndex strides[] = {1, dims[0], dims[0] * dims[1]};
+  for (int axis = 0; axis < 3; ++axis) {
+    const int a1 = (axis + 1) % 3, a2 = (axis + 2) % 3;
+    for (Eigen::DenseIndex i2 = 0; i2 < dims[a2]; ++i2)
+      for (Eigen::DenseIndex i1 = 0; i1 < dims[a1]; ++i1)
+        distanceTransform(f.data() + i1 * strides[a1] + i2 * strides[a2],
+                          strides[axis], dims[axis], line, v, z);
+  }
+}
+}  // namespace internal
+
+SignedDistanceField::SignedDistanceField(const Vec3f& origin_,
+                                         FCL_REAL resolution_,
+                                         const Dims& dims_,
+                                         const VecXf& values_)
+    : CollisionGeometry(),
+      origin(origin_),
+      resolution(resolution_),
+      dims(dims_),
+      values(values_) {
+  if (resolution <= 0)
+    HPP_FCL_THROW_PRETTY("The resolution should be positive.",
+                         std::invalid_argument);
+  if (dims.minCoeff() < 2)
+    HPP_FCL_THROW_PRETTY("The grid should have at least 2 samples per axis.",
+                         std::invalid_argument);
+  if (values.size() != dims.prod())
+    HPP_FCL_THROW_PRETTY("The number of values ("
+                             << values.size()
+                             << ") does not match the number of samples ("
+                             << dims.prod() << ").",
+                         std::invalid_argument);
+  computeLocalAABB();
+  computeBlockBounds();
+}
+
+FCL_REAL SignedDistanceField::computeDistance(const Vec3f& p) const {
+  Vec3f gradient;
+  return computeDistance(p, gradient);
+}
+
+FCL_REAL SignedDistanceField::computeDistance(const Vec3f& p,
+                                              Vec3f& gradient) const {
+  // Coordinates of the closest point of the grid, in number of samples.
+  Vec3f u((p - origin) / resolution);
+  Vec3f outside(Vec3f::Zero());
+  Eigen::DenseIndex ids[3];
+  FCL_REAL t[3];
+  for (int a = 0; a < 3; ++a) {
+    const FCL_REAL max_u = (FCL_REAL)(dims[a] - 1);
+    if (u[a] < 0) {
+      outside[a] = u[a];
+      u[a] = 0;
+    } else if (u[a] > max_u) {
+      outside[a] = u[a] - max_u;
+      u[a] = max_u;
+    }
+    ids[a] = std::min((Eigen::DenseIndex)u[a], dims[a] - 2);
+    t[a] = u[a] - (FCL_REAL)ids[a];
+  }
+
+  const FCL_REAL* c = values.data() + getIndex(ids[0], ids[1], ids[2]);
+  const Eigen::DenseIndex dy = dims[0], dz = dims[0] * dims[1];
+  const FCL_REAL c000 = c[0], c100 = c[1], c010 = c[dy], c110 = c[dy + 1],
+                 c001 = c[dz], c101 = c[dz + 1], c011 = c[dz + dy],
+                 c111 = c[dz + dy + 1];
+
+  const FCL_REAL c00 = c000 + t[0] * (c100 - c000),
+                 c10 = c010 + t[0] * (c110 - c010),
+                 c01 = c001 + t[0] * (c101 - c001),
+                 c11 = c011 + t[0] * (c111 - c011);
+  const FCL_REAL c0 = c00 + t[1] * (c10 - c00), c1 = c01 + t[1] * (c11 - c01);
+  FCL_REAL distance = c0 + t[2] * (c1 - c0);
+
+  gradient[0] = (1 - t[2]) * ((1 - t[1]) * (c100 - c000) +
+                              t[1] * (c110 - c010)) +
+                t[2] * ((1 - t[1]) * (c101 - c001) + t[1] * (c111 - c011));
+  gradient[1] = (1 - t[2]) * (c10 - c00) + t[2] * (c11 - c01);
+  gradient[2] = c1 - c0;
+  gradient /= resolution;
+
+  const FCL_REAL sqr_outside = outside.squaredNorm();
+  if (sqr_outside > 0) {
+    const FCL_REAL norm_outside = std::sqrt(sqr_outside);
+    distance += norm_outside * resolution;
+    for (int a = 0; a < 3; ++a)
+      gradient[a] = outside[a] == 0 ? gradient[a] : outside[a] / norm_outside;
+  }
+  return distance;
+}
+
+void SignedDistanceField::computeDistances(
+    const Eigen::Matrix<FCL_REAL, Eigen::Dynamic, 3>& points,
+    VecXf& distances,
+    Eigen::Matrix<FCL_REAL, Eigen::Dynamic, 3>& gradients) const {
+  distances.resize(points.rows());
+  gradients.resize(points.rows(), 3);
+  Vec3f gradient;
+  for (Eigen::DenseIndex i = 0; i < points.rows(); ++i) {
+    distances[i] = computeDistance(points.row(i).transpose(), gradient);
+    gradients.row(i) = gradient.transpose();
+  }
+}
+
+void SignedDistanceField::computeLocalAABB() {
+  aabb_local = AABB(origin, origin + resolution * (dims.cast<FCL_REAL>() -
+                                                   Vec3f::Ones()));
+  aabb_center = aabb_local.center();
+  aabb_radius = (aabb_local.min_ - aabb_center).norm();
+}
+
+void SignedDistanceField::computeBlockBounds() {
+  block_bounds.clear();
+  block_dims.clear();
+  // The blocks of the first level gather 3 samples along each axis, the ones
+  // of the next levels 2 blocks of the previous level.
+  const VecXf* source = &values;
+  Dims source_dims(dims);
+  Eigen::DenseIndex extent = 2;
+  while (true) {
+    Dims level_dims;
+    for (int a = 0; a < 3; ++a)
+      level_dims[a] = (source_dims[a] - extent + 2) / 2;
+    VecXf bounds(VecXf::Constant(level_dims.prod(),
+                                 (std::numeric_limits<FCL_REAL>::max)()));
+    for (Eigen::DenseIndex k = 0; k < level_dims[2]; ++k)
+      for (Eigen::DenseIndex j = 0; j < level_dims[1]; ++j)
+        for (Eigen::DenseIndex i = 0; i < level_dims[0]; ++i) {
+          FCL_REAL& bound = bounds[i + level_dims[0] * (j + level_dims[1] * k)];
+          for (Eigen::DenseIndex sk = 2 * k;
+               sk <= std::min(2 * k + extent, source_dims[2] - 1); ++sk)
+            for (Eigen::DenseIndex sj = 2 * j;
+                 sj <= std::min(2 * j + extent, source_dims[1] - 1); ++sj)
+              for (Eigen::DenseIndex si = 2 * i;
+                   si <= std::min(2 * i + extent, source_dims[0] - 1); ++si)
+                bound = std::min(
+                    bound, (*source)[si + source_dims[0] *
+                                              (sj + source_dims[1] * sk)]);
+        }
+    block_bounds.push_back(bounds);
+    block_dims.push_back(level_dims);
+    if (level_dims.maxCoeff() == 1) break;
+    source = &block_bounds.back();
+    source_dims = level_dims;
+    extent = 1;
+  }
+}
+
+SignedDistanceFieldPtr_t makeSignedDistanceField(const BVHModelBase& mesh,
+                                                 const FCL_REAL resolution,
+                                                 const FCL_REAL padding) {
+  typedef SignedDistanceField::Dims Dims;
+  if (mesh.getModelType() != BVH_MODEL_TRIANGLES || mesh.num_tris == 0)
+    HPP_FCL_THROW_PRETTY("The mesh should be a non empty triangle model.",
+                         std::invalid_argument);
+  if (resolution <= 0 || padding < 0)
+    HPP_FCL_THROW_PRETTY(
+        "The resolution should be positive and the padding non negative.",
+        std::invalid_argument);
+
+  AABB aabb;
+  for (unsigned int i = 0; i < mesh.num_vertices; ++i)
+    aabb += mesh.vertices[i];
+  const Vec3f origin(aabb.min_ - Vec3f::Constant(padding));
+  Dims dims;
+  for (int a = 0; a < 3; ++a)
+    dims[a] = std::max(
+        (Eigen::DenseIndex)std::ceil(
+            (aabb.max_[a] - aabb.min_[a] + 2 * padding) / resolution) +
+            1,
+        (Eigen::DenseIndex)2);
+  const Eigen::DenseIndex strides[] = {1, dims[0], dims[0] * dims[1]};
+  const Eigen::DenseIndex num_samples = dims.prod();
+
+  // Exact distances to the triangles, in the samples around them.
+  VecXf values(
+      VecXf::Constant(num_samples, std::numeric_limits<FCL_REAL>::max()));
+  std::vector<int> closest((std::size_t)num_samples, -1);
+  for (unsigned int t = 0; t < mesh.num_tris; ++t) {
+    const Triangle& tri = mesh.tri_indices[t];
+    const Vec3f &a = mesh.vertices[tri[0]], &b = mesh.vertices[tri[1]],
+                &c = mesh.vertices[tri[2]];
+    Eigen::DenseIndex lo[3], hi[3];
+    for (int k = 0; k < 3; ++k) {
+      const FCL_REAL min = std::min(a[k], std::min(b[k], c[k]));
+      const FCL_REAL max = std::max(a[k], std::max(b[k], c[k]));
+      lo[k] = std::max(
+          (Eigen::DenseIndex)std::floor((min - origin[k]) / resolution) - 1,
+          (Eigen::DenseIndex)0);
+      hi[k] = std::min(
+          (Eigen::DenseIndex)std::ceil((max - origin[k]) / resolution) + 1,
+          dims[k] - 1);
+    }
+    for (Eigen::DenseIndex k = lo[2]; k <= hi[2]; ++k)
+      for (Eigen::DenseIndex j = lo[1]; j <= hi[1]; ++j)
+        for (Eigen::DenseIndex i = lo[0]; i <= hi[0]; ++i) {
+          const Vec3f p(origin + resolution * Vec3f((FCL_REAL)i, (FCL_REAL)j,
+                                                    (FCL_REAL)k));
+          const Eigen::DenseIndex id = i + dims[0] * (j + dims[1] * k);
+          const FCL_REAL d = internal::pointTriangleDistance(a, b, c, p);
+          if (d < values[id]) {
+            values[id] = d;
+            closest[(std::size_t)id] = (int)t;
+          }
+        }
+  }
+
+  // Propagate the closest triangles by sweeping the grid in the 8 diagonal
+  // directions, twice.
+  for (int pass = 0; pass < 2; ++pass) {
+    for (int direction = 0; direction < 8; ++direction) {
+      Eigen::DenseIndex begin[3], end[3], step[3];
+      for (int a = 0; a < 3; ++a) {
+        step[a] = (direction & (1 << a)) ? -1 : 1;
+        begin[a] = step[a] > 0 ? 1 : dims[a] - 2;
+        end[a] = step[a] > 0 ? dims[a] : -1;
+      }
+      for (Eigen::DenseIndex k = begin[2]; k != end[2]; k += step[2])
+        for (Eigen::DenseIndex j = begin[1]; j != end[1]; j += step[1])
+          for (Eigen::DenseIndex i = begin[0]; i != end[0]; i += step[0]) {
+            const Eigen::DenseIndex id = i + dims[0] * (j + dims[1] * k);
+            const Vec3f p(origin + resolution * Vec3f((FCL_REAL)i,
+                                                      (FCL_REAL)j,
+                                                      (FCL_REAL)k));
+            // Visit the 7 neighbors preceding the sample in the sweep.
+            for (int n = 1; n < 8; ++n) {
+              Eigen::DenseIndex neighbor = id;
+              for (int a = 0; a < 3; ++a)
+                if (n & (1 << a)) neighbor -= step[a] * strides[a];
+              const int t = closest[(std::size_t)neighbor];
+              if (t < 0 || t == closest[(std::size_t)id]) continue;
+              const Triangle& tri = mesh.tri_indices[t];
+              const FCL_REAL d = internal::pointTriangleDistance(
+                  mesh.vertices[tri[0]], mesh.vertices[tri[1]],
+                  mesh.vertices[tri[2]], p);
+              if (d < values[id]) {
+                values[id] = d;
+                closest[(std::size_t)id] = t;
+              }
+            }
+          }
+    }
+  }
+
+  // Count the triangles crossed by the lines of samples along x, before each
+  // sample.
+  std::vector<int> crossings((std::size_t)num_samples, 0);
+  for (unsigned int t = 0; t < mesh.num_tris; ++t) {
+    const Triangle& tri = mesh.tri_indices[t];
+    const Vec3f* v[] = {&mesh.vertices[tri[0]], &mesh.vertices[tri[1]],
+                        &mesh.vertices[tri[2]]};
+    FCL_REAL area = internal::orientYZ(*v[0], *v[1], *v[2]);
+    if (area == 0) continue;
+    if (area < 0) {
+      std::swap(v[1], v[2]);
+      area = -area;
+    }
+
+    Eigen::DenseIndex lo[3], hi[3];
+    for (int k = 1; k < 3; ++k) {
+      const FCL_REAL min =
+          std::min((*v[0])[k], std::min((*v[1])[k], (*v[2])[k]));
+      const FCL_REAL max =
+          std::max((*v[0])[k], std::max((*v[1])[k], (*v[2])[k]));
+      lo[k] = std::max(
+          (Eigen::DenseIndex)std::ceil((min - origin[k]) / resolution),
+          (Eigen::DenseIndex)0);
+      hi[k] = std::min(
+          (Eigen::DenseIndex)std::floor((max - origin[k]) / resolution),
+          dims[k] - 1);
+    }
+    for (Eigen::DenseIndex k = lo[2]; k <= hi[2]; ++k)
+      for (Eigen::DenseIndex j = lo[1]; j <= hi[1]; ++j) {
+        const Vec3f p(0, origin[1] + resolution * (FCL_REAL)j,
+                      origin[2] + resolution * (FCL_REAL)k);
+        FCL_REAL w[3];
+        bool inside = true;
+        for (int e = 0; e < 3 && inside; ++e) {
+          const Vec3f &q0 = *v[(e + 1) % 3], &q1 = *v[(e + 2) % 3];
+          w[e] = internal::edgeOrientYZ(q0, q1, p);
+          inside = w[e] > 0 || (w[e] == 0 && internal::isTopLeftEdge(q0, q1));
+        }
+        if (!inside) continue;
+        const FCL_REAL x =
+            (w[0] * (*v[0])[0] + w[1] * (*v[1])[0] + w[2] * (*v[2])[0]) / area;
+        const Eigen::DenseIndex i = std::max(
+            (Eigen::DenseIndex)std::ceil((x - origin[0]) / resolution),
+            (Eigen::DenseIndex)0);
+        if (i < dims[0])
+          ++crossings[(std::size_t)(i + dims[0] * (j + dims[1] * k))];
+      }
+  }
+
+  // The samples after an odd number of crossings are inside.
+  for (Eigen::DenseIndex row = 0; row < dims[1] * dims[2]; ++row) {
+    int count = 0;
+    for (Eigen::DenseIndex i = 0; i < dims[0]; ++i) {
+      const Eigen::DenseIndex id = i + dims[0] * row;
+      count += crossings[(std::size_t)id];
+      if (count % 2 == 1) values[id] = -values[id];
+    }
+  }
+
+  return SignedDistanceFieldPtr_t(
+      new SignedDistanceField(origin, resolution, dims, values));
+}
+
+SignedDistanceFieldPtr_t makeSignedDistanceField(
+    const Vec3f& origin, const FCL_REAL resolution,
+    const SignedDistanceField::Dims& dims, const std::vector<bool>& occupied) {
+  if (dims.minCoeff() < 2 || (Eigen::DenseIndex)occupied.size() != dims.prod())
+    HPP_FCL_THROW_PRETTY("The occupancy grid should have at least 2 voxels per "
+                         "axis, and as many occupancies as voxels.",
+                         std::invalid_argument);
+
+  // Squared distances to the closest occupied and free voxels.
+  const FCL_REAL inf = (FCL_REAL)1e20;
+  VecXf to_occupied(dims.prod()), to_free(dims.prod());
+  for (Eigen::DenseIndex i = 0; i < dims.prod(); ++i) {
+    to_occupied[i] = occupied[(std::size_t)i] ? 0 : inf;
+    to_free[i] = occupied[(std::size_t)i] ? inf : 0;
+  }
+  internal::distanceTransform(to_occupied, dims);
+  internal::distanceTransform(to_free, dims);
+
+  VecXf values(dims.prod());
+  for (Eigen::DenseIndex i = 0; i < dims.prod(); ++i)
+    values[i] = occupied[(std::size_t)i]
+                    ? -(std::sqrt(to_free[i]) - FCL_REAL(0.5)) * resolution
+                    : (std::sqrt(to_occupied[i]) - FCL_REAL(0.5)) * resolution;
+
+  return SignedDistanceFieldPtr_t(
+      new SignedDistanceField(origin, resolution, dims, values));
+}
+
+SignedDistanceFieldPtr_t makeSignedDistanceField(const LinearOcTree& tree,
+                                                 const FCL_REAL padding) {
+  typedef LinearOcTree::Code Code;
+  typedef SignedDistanceField::Dims Dims;
+  if (tree.getNumLeaves() == 0)
+    HPP_FCL_THROW_PRETTY("The tree has no occupied leaf.",
+                         std::invalid_argument);
+  if (padding < 0)
+    HPP_FCL_THROW_PRETTY("The padding should be non negative.",
+                         std::invalid_argument);
+
+  // Range of the keys of the occupied voxels.
+  const std::vector<Code>& codes = tree.getLeafCodes();
+  const std::vector<unsigned char>& levels = tree.getLeafLevels();
+  Dims lo(Dims::Constant(std::numeric_limits<Eigen::DenseIndex>::max())),
+      hi(Dims::Constant(std::numeric_limits<Eigen::DenseIndex>::min()));
+  for (std::size_t l = 0; l < codes.size(); ++l) {
+    for (int a = 0; a < 3; ++a) {
+      const Eigen::DenseIndex key =
+          (Eigen::DenseIndex)LinearOcTree::compactBits(codes[l] >> a);
+      lo[a] = std::min(lo[a], key);
+      hi[a] = std::max(hi[a], key + ((Eigen::DenseIndex)1 << levels[l]));
+    }
+  }
+  const Eigen::DenseIndex pad =
+      (Eigen::DenseIndex)std::ceil(padding / tree.getResolution());
+  lo.array() -= pad;
+  hi.array() += pad;
+  Dims dims(hi - lo);
+  for (int a = 0; a < 3; ++a) dims[a] = std::max(dims[a], (Eigen::DenseIndex)2);
+
+  std::vector<bool> occupied((std::size_t)dims.prod(), false);
+  for (std::size_t l = 0; l < codes.size(); ++l) {
+    Eigen::DenseIndex begin[3];
+    for (int a = 0; a < 3; ++a)
+      begin[a] =
+          (Eigen::DenseIndex)LinearOcTree::compactBits(codes[l] >> a) - lo[a];
+    const Eigen::DenseIndex size = (Eigen::DenseIndex)1 << levels[l];
+    for (Eigen::DenseIndex k = begin[2]; k < begin[2] + size; ++k)
+      for (Eigen::DenseIndex j = begin[1]; j < begin[1] + size; ++j)
+        for (Eigen::DenseIndex i = begin[0]; i < begin[0] + size; ++i)
+          occupied[(std::size_t)(i + dims[0] * (j + dims[1] * k))] = true;
+  }
+
+  const FCL_REAL half = (FCL_REAL)((Code)1 << (tree.getTreeDepth() - 1));
+  const Vec3f origin(tree.getResolution() *
+                     (lo.cast<FCL_REAL>() +
+                      Vec3f::Constant((FCL_REAL)0.5 - half)));
+  return makeSignedDistanceField(origin, tree.getResolution(), dims, occupied);
+}
+
+}  // namespace fcl
+}  // namespace hpp
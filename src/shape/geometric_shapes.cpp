@@ -92,13 +92,13 @@ void ConvexBase::computeCenter() {
   center.setZero();
   for (std::size_t i = 0; i < num_points; ++i)
     center += points[i];  // TODO(jcarpent): vectorization
-  center /= num_points;
+  center /= FCL_REAL(num_points);
 }
 
 void Halfspace::unitNormalTest() {
   FCL_REAL l = n.norm();
   if (l > 0) {
-    FCL_REAL inv_l = 1.0 / l;
+    FCL_REAL inv_l = 1 / l;
     n *= inv_l;
     d *= inv_l;
   } else {
@@ -110,7 +110,7 @@ void Halfspace::unitNormalTest() {
 void Plane::unitNormalTest() {
   FCL_REAL l = n.norm();
   if (l > 0) {
-    FCL_REAL inv_l = 1.0 / l;
+    FCL_REAL inv_l = 1 / l;
     n *= inv_l;
     d *= inv_l;
   } else {
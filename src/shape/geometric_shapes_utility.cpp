@@ -44,8 +44,9 @@ namespace fcl {
 
 namespace details {
 
-std::vector<Vec3f> getBoundVertices(const Box& box, const Transform3f& tf) {
-  std::vector<Vec3f> result(8);
+void getBoundVertices(const Box& box, const Transform3f& tf,
+                      std::vector<Vec3f>& result) {
+  result.resize(8);
   FCL_REAL a = box.halfSide[0];
   FCL_REAL b = box.halfSide[1];
   FCL_REAL c = box.halfSide[2];
@@ -57,16 +58,15 @@ std::vector<Vec3f> getBoundVertices(const Box& box, const Transform3f& tf) {
   result[5] = tf.transform(Vec3f(-a, b, -c));
   result[6] = tf.transform(Vec3f(-a, -b, c));
   result[7] = tf.transform(Vec3f(-a, -b, -c));
-
-  return result;
 }
 
 // we use icosahedron to bound the sphere
-std::vector<Vec3f> getBoundVertices(const Sphere& sphere,
-                                    const Transform3f& tf) {
-  std::vector<Vec3f> result(12);
-  const FCL_REAL m = (1 + sqrt(5.0)) / 2.0;
-  FCL_REAL edge_size = sphere.radius * 6 / (sqrt(27.0) + sqrt(15.0));
+void getBoundVertices(const Sphere& sphere, const Transform3f& tf,
+                      std::vector<Vec3f>& result) {
+  result.resize(12);
+  const FCL_REAL m = (1 + std::sqrt(FCL_REAL(5))) / 2;
+  FCL_REAL edge_size =
+      sphere.radius * 6 / (std::sqrt(FCL_REAL(27)) + std::sqrt(FCL_REAL(15)));
 
   FCL_REAL a = edge_size;
   FCL_REAL b = m * edge_size;
@@ -82,17 +82,15 @@ std::vector<Vec3f> getBoundVertices(const Sphere& sphere,
   result[9] = tf.transform(Vec3f(b, 0, -a));
   result[10] = tf.transform(Vec3f(-b, 0, a));
   result[11] = tf.transform(Vec3f(-b, 0, -a));
-
-  return result;
 }
 
 // we use scaled icosahedron to bound the ellipsoid
-std::vector<Vec3f> getBoundVertices(const Ellipsoid& ellipsoid,
-                                    const Transform3f& tf) {
-  std::vector<Vec3f> result(12);
-  const FCL_REAL phi = (1 + sqrt(5.0)) / 2.0;
+void getBoundVertices(const Ellipsoid& ellipsoid, const Transform3f& tf,
+                      std::vector<Vec3f>& result) {
+  result.resize(12);
+  const FCL_REAL phi = (1 + std::sqrt(FCL_REAL(5))) / 2;
 
-  const FCL_REAL a = sqrt(3.0) / (phi * phi);
+  const FCL_REAL a = std::sqrt(FCL_REAL(3)) / (phi * phi);
   const FCL_REAL b = phi * a;
 
   const FCL_REAL& A = ellipsoid.radii[0];
@@ -117,20 +115,19 @@ std::vector<Vec3f> getBoundVertices(const Ellipsoid& ellipsoid,
   result[9] = tf.transform(Vec3f(Ab, 0, -Ca));
   result[10] = tf.transform(Vec3f(-Ab, 0, Ca));
   result[11] = tf.transform(Vec3f(-Ab, 0, -Ca));
-
-  return result;
 }
 
-std::vector<Vec3f> getBoundVertices(const Capsule& capsule,
-                                    const Transform3f& tf) {
-  std::vector<Vec3f> result(36);
-  const FCL_REAL m = (1 + sqrt(5.0)) / 2.0;
+void getBoundVertices(const Capsule& capsule, const Transform3f& tf,
+                      std::vector<Vec3f>& result) {
+  result.resize(36);
+  const FCL_REAL m = (1 + std::sqrt(FCL_REAL(5))) / 2;
 
   FCL_REAL hl = capsule.halfLength;
-  FCL_REAL edge_size = capsule.radius * 6 / (sqrt(27.0) + sqrt(15.0));
+  FCL_REAL edge_size =
+      capsule.radius * 6 / (std::sqrt(FCL_REAL(27)) + std::sqrt(FCL_REAL(15)));
   FCL_REAL a = edge_size;
   FCL_REAL b = m * edge_size;
-  FCL_REAL r2 = capsule.radius * 2 / sqrt(3.0);
+  FCL_REAL r2 = capsule.radius * 2 / std::sqrt(FCL_REAL(3));
 
   result[0] = tf.transform(Vec3f(0, a, b + hl));
   result[1] = tf.transform(Vec3f(0, -a, b + hl));
@@ -158,7 +155,7 @@ std::vector<Vec3f> getBoundVertices(const Capsule& capsule,
   result[22] = tf.transform(Vec3f(-b, 0, a - hl));
   result[23] = tf.transform(Vec3f(-b, 0, -a - hl));
 
-  FCL_REAL c = 0.5 * r2;
+  FCL_REAL c = FCL_REAL(0.5) * r2;
   FCL_REAL d = capsule.radius;
   result[24] = tf.transform(Vec3f(r2, 0, hl));
   result[25] = tf.transform(Vec3f(c, d, hl));
@@ -173,16 +170,15 @@ std::vector<Vec3f> getBoundVertices(const Capsule& capsule,
   result[33] = tf.transform(Vec3f(-r2, 0, -hl));
   result[34] = tf.transform(Vec3f(-c, -d, -hl));
   result[35] = tf.transform(Vec3f(c, -d, -hl));
-
-  return result;
 }
 
-std::vector<Vec3f> getBoundVertices(const Cone& cone, const Transform3f& tf) {
-  std::vector<Vec3f> result(7);
+void getBoundVertices(const Cone& cone, const Transform3f& tf,
+                      std::vector<Vec3f>& result) {
+  result.resize(7);
 
   FCL_REAL hl = cone.halfLength;
-  FCL_REAL r2 = cone.radius * 2 / sqrt(3.0);
-  FCL_REAL a = 0.5 * r2;
+  FCL_REAL r2 = cone.radius * 2 / std::sqrt(FCL_REAL(3));
+  FCL_REAL a = FCL_REAL(0.5) * r2;
   FCL_REAL b = cone.radius;
 
   result[0] = tf.transform(Vec3f(r2, 0, -hl));
@@ -193,17 +189,15 @@ std::vector<Vec3f> getBoundVertices(const Cone& cone, const Transform3f& tf) {
   result[5] = tf.transform(Vec3f(a, -b, -hl));
 
   result[6] = tf.transform(Vec3f(0, 0, hl));
-
-  return result;
 }
 
-std::vector<Vec3f> getBoundVertices(const Cylinder& cylinder,
-                                    const Transform3f& tf) {
-  std::vector<Vec3f> result(12);
+void getBoundVertices(const Cylinder& cylinder, const Transform3f& tf,
+                      std::vector<Vec3f>& result) {
+  result.resize(12);
 
   FCL_REAL hl = cylinder.halfLength;
-  FCL_REAL r2 = cylinder.radius * 2 / sqrt(3.0);
-  FCL_REAL a = 0.5 * r2;
+  FCL_REAL r2 = cylinder.radius * 2 / std::sqrt(FCL_REAL(3));
+  FCL_REAL a = FCL_REAL(0.5) * r2;
   FCL_REAL b = cylinder.radius;
 
   result[0] = tf.transform(Vec3f(r2, 0, -hl));
@@ -219,28 +213,22 @@ std::vector<Vec3f> getBoundVertices(const Cylinder& cylinder,
   result[9] = tf.transform(Vec3f(-r2, 0, hl));
   result[10] = tf.transform(Vec3f(-a, -b, hl));
   result[11] = tf.transform(Vec3f(a, -b, hl));
-
-  return result;
 }
 
-std::vector<Vec3f> getBoundVertices(const ConvexBase& convex,
-                                    const Transform3f& tf) {
-  std::vector<Vec3f> result(convex.num_points);
+void getBoundVertices(const ConvexBase& convex, const Transform3f& tf,
+                      std::vector<Vec3f>& result) {
+  result.resize(convex.num_points);
   for (std::size_t i = 0; i < convex.num_points; ++i) {
     result[i] = tf.transform(convex.points[i]);
   }
-
-  return result;
 }
 
-std::vector<Vec3f> getBoundVertices(const TriangleP& triangle,
-                                    const Transform3f& tf) {
-  std::vector<Vec3f> result(3);
+void getBoundVertices(const TriangleP& triangle, const Transform3f& tf,
+                      std::vector<Vec3f>& result) {
+  result.resize(3);
   result[0] = tf.transform(triangle.a);
   result[1] = tf.transform(triangle.b);
   result[2] = tf.transform(triangle.c);
-
-  return result;
 }
 
 }  // namespace details
@@ -296,7 +284,7 @@ void computeBV<AABB, Ellipsoid>(const Ellipsoid& e, const Transform3f& tf,
   const Matrix3f& R = tf.getRotation();
   const Vec3f& T = tf.getTranslation();
 
-  Vec3f v_delta = R * e.radii;
+  Vec3f v_delta = R.cwiseAbs() * e.radii;
   bv.max_ = T + v_delta;
   bv.min_ = T - v_delta;
 }
@@ -0,0 +1,134 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <hpp/fcl/tracing.h>
+
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <ostream>
+
+namespace hpp {
+namespace fcl {
+namespace tracing {
+
+namespace {
+std::atomic<TraceSink*> trace_sink(NULL);
+
+double now() {
+  return std::chrono::duration<double, std::micro>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+unsigned int threadId() {
+  static std::atomic<unsigned int> num_threads(0);
+  static thread_local unsigned int id = num_threads++;
+  return id;
+}
+
+void record(TraceSink* sink, const char* name, const char* category,
+            TraceEvent::Phase phase) {
+  TraceEvent event;
+  event.name = name;
+  event.category = category;
+  event.phase = phase;
+  event.timestamp = now();
+  event.thread_id = threadId();
+  sink->record(event);
+}
+}  // namespace
+
+void setTraceSink(TraceSink* sink) {
+  trace_sink.store(sink, std::memory_order_release);
+}
+
+TraceSink* getTraceSink() {
+  return trace_sink.load(std::memory_order_acquire);
+}
+
+void ChromeTraceWriter::record(const TraceEvent& event) {
+  std::lock_guard<std::mutex> lock(mutex);
+  events.push_back(event);
+}
+
+void ChromeTraceWriter::write(std::ostream& os) const {
+  std::lock_guard<std::mutex> lock(mutex);
+  const std::streamsize precision = os.precision(3);
+  const std::ios_base::fmtflags flags =
+      os.setf(std::ios_base::fixed, std::ios_base::floatfield);
+  os << "{\"traceEvents\":[";
+  for (std::size_t i = 0; i < events.size(); ++i) {
+    const TraceEvent& event = events[i];
+    os << (i ? ",\n" : "\n") << "{\"name\":\"" << event.name
+       << "\",\"cat\":\"" << event.category << "\",\"ph\":\""
+       << (event.phase == TraceEvent::BEGIN ? 'B' : 'E')
+       << "\",\"ts\":" << event.timestamp
+       << ",\"pid\":0,\"tid\":" << event.thread_id << '}';
+  }
+  os << "\n],\"displayTimeUnit\":\"ns\"}\n";
+  os.flags(flags);
+  os.precision(precision);
+}
+
+void ChromeTraceWriter::write(const std::string& filename) const {
+  std::ofstream os(filename.c_str());
+  if (!os.is_open())
+    HPP_FCL_THROW_PRETTY("Cannot open file " << filename,
+                         std::invalid_argument);
+  write(os);
+}
+
+void ChromeTraceWriter::clear() {
+  std::lock_guard<std::mutex> lock(mutex);
+  events.clear();
+}
+
+std::size_t ChromeTraceWriter::size() const {
+  std::lock_guard<std::mutex> lock(mutex);
+  return events.size();
+}
+
+TraceSpan::TraceSpan(const char* name, const char* category)
+    : sink(getTraceSink()), name(name), category(category) {
+  if (sink) tracing::record(sink, name, category, TraceEvent::BEGIN);
+}
+
+TraceSpan::~TraceSpan() {
+  if (sink) tracing::record(sink, name, category, TraceEvent::END);
+}
+
+}  // namespace tracing
+}  // namespace fcl
+}  // namespace hpp
@@ -36,6 +36,7 @@
 /** \author Jia Pan */
 
 #include <hpp/fcl/internal/traversal_recurse.h>
+#include <hpp/fcl/workspace.h>
 
 #include <vector>
 
@@ -51,11 +52,11 @@ void collisionRecurse(CollisionTraversalNodeBase* node, unsigned int b1,
     updateFrontList(front_list, b1, b2);
 
     // if(node->BVDisjoints(b1, b2, sqrDistLowerBound)) return;
-    node->leafCollides(b1, b2, sqrDistLowerBound);
+    node->profiledLeafCollides(b1, b2, sqrDistLowerBound);
     return;
   }
 
-  if (node->BVDisjoints(b1, b2, sqrDistLowerBound)) {
+  if (node->profiledBVDisjoints(b1, b2, sqrDistLowerBound)) {
     updateFrontList(front_list, b1, b2);
     return;
   }
@@ -91,8 +92,11 @@ void collisionNonRecurse(CollisionTraversalNodeBase* node,
   // typedef std::stack<BVPair_t, std::vector<BVPair_t> > Stack_t;
   typedef std::vector<BVPair_t> Stack_t;
 
-  Stack_t pairs;
-  pairs.reserve(1000);
+  Stack_t local_pairs;
+  QueryWorkspace* workspace = QueryWorkspace::current();
+  Stack_t& pairs = workspace ? workspace->bv_pairs : local_pairs;
+  pairs.clear();
+  if (!workspace) pairs.reserve(1000);
   sqrDistLowerBound = std::numeric_limits<FCL_REAL>::infinity();
   FCL_REAL sdlb = std::numeric_limits<FCL_REAL>::infinity();
 
@@ -114,7 +118,7 @@ void collisionNonRecurse(CollisionTraversalNodeBase* node,
       // if (sdlb < sqrDistLowerBound) sqrDistLowerBound = sdlb;
       // continue;
       //}
-      node->leafCollides(a, b, sdlb);
+      node->profiledLeafCollides(a, b, sdlb);
       if (sdlb < sqrDistLowerBound) sqrDistLowerBound = sdlb;
       if (node->canStop() && !front_list) return;
       continue;
@@ -126,7 +130,7 @@ void collisionNonRecurse(CollisionTraversalNodeBase* node,
     // }
 
     // Check the BV
-    if (node->BVDisjoints(a, b, sdlb)) {
+    if (node->profiledBVDisjoints(a, b, sdlb)) {
       if (sdlb < sqrDistLowerBound) sqrDistLowerBound = sdlb;
       updateFrontList(front_list, a, b);
       continue;
@@ -158,7 +162,7 @@ void distanceRecurse(DistanceTraversalNodeBase* node, unsigned int b1,
   if (l1 && l2) {
     updateFrontList(front_list, b1, b2);
 
-    node->leafComputeDistance(b1, b2);
+    node->profiledLeafComputeDistance(b1, b2);
     return;
   }
 
@@ -176,8 +180,8 @@ void distanceRecurse(DistanceTraversalNodeBase* node, unsigned int b1,
     c2 = (unsigned int)node->getSecondRightChild(b2);
   }
 
-  FCL_REAL d1 = node->BVDistanceLowerBound(a1, a2);
-  FCL_REAL d2 = node->BVDistanceLowerBound(c1, c2);
+  FCL_REAL d1 = node->profiledBVDistanceLowerBound(a1, a2);
+  FCL_REAL d2 = node->profiledBVDistanceLowerBound(c1, c2);
 
   if (d2 < d1) {
     if (!node->canStop(d2))
@@ -256,7 +260,7 @@ void distanceQueueRecurse(DistanceTraversalNodeBase* node, unsigned int b1,
     if (l1 && l2) {
       updateFrontList(front_list, min_test.b1, min_test.b2);
 
-      node->leafComputeDistance(min_test.b1, min_test.b2);
+      node->profiledLeafComputeDistance(min_test.b1, min_test.b2);
     } else if (bvtq.full()) {
       // queue should not get two more tests, recur
 
@@ -270,21 +274,21 @@ void distanceQueueRecurse(DistanceTraversalNodeBase* node, unsigned int b1,
         unsigned int c2 = (unsigned int)node->getFirstRightChild(min_test.b1);
         bvt1.b1 = c1;
         bvt1.b2 = min_test.b2;
-        bvt1.d = node->BVDistanceLowerBound(bvt1.b1, bvt1.b2);
+        bvt1.d = node->profiledBVDistanceLowerBound(bvt1.b1, bvt1.b2);
 
         bvt2.b1 = c2;
         bvt2.b2 = min_test.b2;
-        bvt2.d = node->BVDistanceLowerBound(bvt2.b1, bvt2.b2);
+        bvt2.d = node->profiledBVDistanceLowerBound(bvt2.b1, bvt2.b2);
       } else {
         unsigned int c1 = (unsigned int)node->getSecondLeftChild(min_test.b2);
         unsigned int c2 = (unsigned int)node->getSecondRightChild(min_test.b2);
         bvt1.b1 = min_test.b1;
         bvt1.b2 = c1;
-        bvt1.d = node->BVDistanceLowerBound(bvt1.b1, bvt1.b2);
+        bvt1.d = node->profiledBVDistanceLowerBound(bvt1.b1, bvt1.b2);
 
         bvt2.b1 = min_test.b1;
         bvt2.b2 = c2;
-        bvt2.d = node->BVDistanceLowerBound(bvt2.b1, bvt2.b2);
+        bvt2.d = node->profiledBVDistanceLowerBound(bvt2.b1, bvt2.b2);
       }
 
       bvtq.push(bvt1);
@@ -325,7 +329,7 @@ void propagateBVHFrontListCollisionRecurse(CollisionTraversalNodeBase* node,
                                   // collideRecurse will add again.
       collisionRecurse(node, b1, b2, &append, sqrDistLowerBound);
     } else {
-      if (!node->BVDisjoints(b1, b2, sqrDistLowerBound)) {
+      if (!node->profiledBVDisjoints(b1, b2, sqrDistLowerBound)) {
         front_iter->valid = false;
         if (node->firstOverSecond(b1, b2)) {
           unsigned int c1 = (unsigned int)node->getFirstLeftChild(b1);
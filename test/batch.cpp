@@ -0,0 +1,146 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define BOOST_TEST_MODULE FCL_BATCH
+#include <boost/test/included/unit_test.hpp>
+
+#include <hpp/fcl/batch.h>
+#include <hpp/fcl/collision.h>
+#include <hpp/fcl/distance.h>
+#include <hpp/fcl/shape/geometric_shapes.h>
+#include <hpp/fcl/shape/geometric_shape_to_BVH_model.h>
+
+#include "utility.h"
+
+using namespace hpp::fcl;
+
+namespace {
+struct Geometries {
+  Box box;
+  Sphere sphere;
+  Capsule capsule;
+  BVHModel<OBBRSS> mesh;
+  std::vector<const CollisionGeometry*> geometries;
+
+  Geometries() : box(1, 1, 1), sphere(0.5), capsule(0.3, 1) {
+    generateBVHModel(mesh, Sphere(0.6), Transform3f(), 10, 10);
+    geometries.push_back(&box);
+    geometries.push_back(&sphere);
+    geometries.push_back(&capsule);
+    geometries.push_back(&mesh);
+  }
+
+  /// Queries between all the pairs of geometries, in random poses around the
+  /// origin so that about half of them collide.
+  std::vector<BatchQuery> makeQueries(std::size_t n) const {
+    std::vector<Transform3f> tf1(n), tf2(n);
+    FCL_REAL extents[] = {-1.5, -1.5, -1.5, 1.5, 1.5, 1.5};
+    generateRandomTransforms(extents, tf1, n);
+    generateRandomTransforms(extents, tf2, n);
+    std::vector<BatchQuery> queries;
+    for (std::size_t i = 0; i < n; ++i) {
+      const CollisionGeometry* o1 = geometries[i % geometries.size()];
+      const CollisionGeometry* o2 =
+          geometries[(i / geometries.size()) % geometries.size()];
+      queries.push_back(BatchQuery(o1, tf1[i], o2, tf2[i]));
+    }
+    return queries;
+  }
+};
+}  // namespace
+
+BOOST_AUTO_TEST_CASE(collide_batch) {
+  Geometries g;
+  std::vector<BatchQuery> queries = g.makeQueries(200);
+  CollisionRequest request;
+
+  std::vector<CollisionResult> expected(queries.size());
+  std::size_t num_collisions = 0;
+  for (std::size_t i = 0; i < queries.size(); ++i)
+    if (collide(queries[i].o1, queries[i].tf1, queries[i].o2, queries[i].tf2,
+                request, expected[i]))
+      ++num_collisions;
+  BOOST_CHECK(num_collisions > 0);
+  BOOST_CHECK(num_collisions < queries.size());
+
+  unsigned int num_threads[] = {1, 4, 0};
+  for (int t = 0; t < 3; ++t) {
+    std::vector<CollisionResult> results;
+    collideBatch(queries, request, results, num_threads[t]);
+    BOOST_REQUIRE_EQUAL(results.size(), queries.size());
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+      BOOST_CHECK_EQUAL(results[i].isCollision(), expected[i].isCollision());
+      BOOST_CHECK_EQUAL(results[i].numContacts(), expected[i].numContacts());
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(distance_batch) {
+  Geometries g;
+  std::vector<BatchQuery> queries = g.makeQueries(200);
+  DistanceRequest request(true);
+
+  unsigned int num_threads[] = {1, 4, 0};
+  for (int t = 0; t < 3; ++t) {
+    std::vector<DistanceResult> results;
+    distanceBatch(queries, request, results, num_threads[t]);
+    BOOST_REQUIRE_EQUAL(results.size(), queries.size());
+    for (std::size_t i = 0; i < queries.size(); ++i) {
+      DistanceResult expected;
+      distance(queries[i].o1, queries[i].tf1, queries[i].o2, queries[i].tf2,
+               request, expected);
+      BOOST_CHECK_EQUAL(results[i].min_distance, expected.min_distance);
+      BOOST_CHECK(results[i].nearest_points[0] == expected.nearest_points[0]);
+      BOOST_CHECK(results[i].nearest_points[1] == expected.nearest_points[1]);
+    }
+  }
+}
+
+BOOST_AUTO_TEST_CASE(empty_batch) {
+  std::vector<CollisionResult> results(3);
+  collideBatch(std::vector<BatchQuery>(), CollisionRequest(), results, 4);
+  BOOST_CHECK(results.empty());
+}
+
+BOOST_AUTO_TEST_CASE(exception_propagation) {
+  Geometries g;
+  std::vector<BatchQuery> queries = g.makeQueries(100);
+  // Distance is not implemented for meshes with AABB bounding volumes.
+  BVHModel<AABB> mesh;
+  generateBVHModel(mesh, Box(1, 1, 1), Transform3f());
+  queries[77].o1 = &mesh;
+  std::vector<DistanceResult> results;
+  BOOST_CHECK_THROW(distanceBatch(queries, DistanceRequest(), results, 4),
+                    std::invalid_argument);
+}
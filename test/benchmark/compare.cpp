@@ -0,0 +1,156 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/// Run the scenarios of a stored baseline again and report the significant
+/// changes of their median and 99th percentile.
+///
+/// Usage: hpp-fcl-benchmark-compare --baseline <file.json> [--repeat <runs>]
+///          [--threshold <ratio>] [--tail-threshold <ratio>]
+///          [--noise-factor <factor>] [--filter <substring>]
+///          [--max-time <seconds>] [--save <file.json>]
+///
+/// The baseline is written by hpp-fcl-benchmark, preferably with several runs
+/// so that its noise is known. The program fails if a scenario got slower.
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <set>
+
+#include "suite.h"
+
+using namespace hpp::fcl::benchmark;
+
+namespace {
+void printChange(const Change& change) {
+  std::printf(" %10.2f %10.2f %+7.1f%% %5.1f%%", change.baseline,
+              change.current, 100 * change.delta, 100 * change.threshold);
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+  RunOptions options;
+  options.repeats = 3;
+  CompareOptions compare_options;
+  const char* baseline_file = NULL;
+  const char* save = NULL;
+  for (int i = 1; i < argc; ++i) {
+    if (i + 1 < argc && std::strcmp(argv[i], "--baseline") == 0)
+      baseline_file = argv[++i];
+    else if (i + 1 < argc && std::strcmp(argv[i], "--repeat") == 0)
+      options.repeats = (std::size_t)std::atoi(argv[++i]);
+    else if (i + 1 < argc && std::strcmp(argv[i], "--threshold") == 0)
+      compare_options.threshold = std::atof(argv[++i]);
+    else if (i + 1 < argc && std::strcmp(argv[i], "--tail-threshold") == 0)
+      compare_options.tail_threshold = std::atof(argv[++i]);
+    else if (i + 1 < argc && std::strcmp(argv[i], "--noise-factor") == 0)
+      compare_options.noise_factor = std::atof(argv[++i]);
+    else if (i + 1 < argc && std::strcmp(argv[i], "--filter") == 0)
+      options.filter = argv[++i];
+    else if (i + 1 < argc && std::strcmp(argv[i], "--max-time") == 0)
+      options.max_time = std::atof(argv[++i]);
+    else if (i + 1 < argc && std::strcmp(argv[i], "--save") == 0)
+      save = argv[++i];
+    else {
+      baseline_file = NULL;
+      break;
+    }
+  }
+  if (!baseline_file) {
+    std::cerr << "Usage: " << argv[0]
+              << " --baseline <file.json> [--repeat <runs>]"
+                 " [--threshold <ratio>] [--tail-threshold <ratio>]"
+                 " [--noise-factor <factor>] [--filter <substring>]"
+                 " [--max-time <seconds>] [--save <file.json>]"
+              << std::endl;
+    return 1;
+  }
+
+  std::vector<ScenarioResult> baseline;
+  std::ifstream is(baseline_file);
+  if (!is.is_open() || !readJSON(is, baseline)) {
+    std::cerr << "Cannot read results from " << baseline_file << std::endl;
+    return 1;
+  }
+
+  // Only the scenarios of the baseline are run.
+  std::set<std::string> names;
+  for (std::size_t i = 0; i < baseline.size(); ++i)
+    names.insert(baseline[i].name);
+  std::vector<ScenarioPtr_t> scenarios, selection;
+  makeScenarios(scenarios);
+  for (std::size_t i = 0; i < scenarios.size(); ++i)
+    if (names.erase(scenarios[i]->name)) selection.push_back(scenarios[i]);
+
+  const std::vector<ScenarioResult> current = run(selection, options);
+  if (save) {
+    std::ofstream os(save);
+    if (!os.is_open()) {
+      std::cerr << "Cannot open file " << save << std::endl;
+      return 1;
+    }
+    writeJSON(os, current);
+  }
+
+  const std::vector<Comparison> comparisons =
+      compare(baseline, current, compare_options);
+  std::printf("%-48s %10s %10s %8s %6s %10s %10s %8s %6s\n", "scenario",
+              "p50 base", "p50 now", "delta", "thr", "p99 base", "p99 now",
+              "delta", "thr");
+  std::size_t slower = 0, faster = 0;
+  for (std::size_t i = 0; i < comparisons.size(); ++i) {
+    const Comparison& comparison = comparisons[i];
+    std::printf("%-48s", comparison.name.c_str());
+    printChange(comparison.p50);
+    printChange(comparison.p99);
+    if (comparison.slower()) {
+      std::printf("  SLOWER");
+      ++slower;
+    } else if (comparison.p50.faster() || comparison.p99.faster()) {
+      std::printf("  faster");
+      ++faster;
+    }
+    std::printf("\n");
+  }
+  for (std::set<std::string>::const_iterator it = names.begin();
+       it != names.end(); ++it)
+    std::printf("%-48s  missing from the suite\n", it->c_str());
+
+  std::printf("%zu scenarios compared: %zu slower, %zu faster\n",
+              comparisons.size(), slower, faster);
+  return slower > 0 ? 1 : 0;
+}
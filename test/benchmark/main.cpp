@@ -0,0 +1,99 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/// Run the benchmark suite and write the statistics of the scenarios in JSON.
+///
+/// Usage: hpp-fcl-benchmark [--filter <substring>] [--sample-scale <scale>]
+///                          [--max-time <seconds>] [--output <file.json>]
+///                          [--list] [--repeat <runs>]
+///
+/// The suite is meant to be run on a Release build.
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include "suite.h"
+
+using namespace hpp::fcl::benchmark;
+
+int main(int argc, char** argv) {
+  RunOptions options;
+  const char* output = NULL;
+  bool list = false;
+  for (int i = 1; i < argc; ++i) {
+    if (std::strcmp(argv[i], "--list") == 0)
+      list = true;
+    else if (i + 1 < argc && std::strcmp(argv[i], "--filter") == 0)
+      options.filter = argv[++i];
+    else if (i + 1 < argc && std::strcmp(argv[i], "--sample-scale") == 0)
+      options.sample_scale = std::atof(argv[++i]);
+    else if (i + 1 < argc && std::strcmp(argv[i], "--max-time") == 0)
+      options.max_time = std::atof(argv[++i]);
+    else if (i + 1 < argc && std::strcmp(argv[i], "--repeat") == 0)
+      options.repeats = (std::size_t)std::atoi(argv[++i]);
+    else if (i + 1 < argc && std::strcmp(argv[i], "--output") == 0)
+      output = argv[++i];
+    else {
+      std::cerr << "Usage: " << argv[0]
+                << " [--filter <substring>] [--sample-scale <scale>]"
+                   " [--max-time <seconds>] [--output <file.json>] [--list]"
+                   " [--repeat <runs>]"
+                << std::endl;
+      return 1;
+    }
+  }
+
+  std::vector<ScenarioPtr_t> scenarios;
+  makeScenarios(scenarios);
+  if (list) {
+    for (std::size_t i = 0; i < scenarios.size(); ++i)
+      if (scenarios[i]->name.find(options.filter) != std::string::npos)
+        std::cout << scenarios[i]->name << std::endl;
+    return 0;
+  }
+
+  const std::vector<ScenarioResult> results = run(scenarios, options);
+  if (output) {
+    std::ofstream os(output);
+    if (!os.is_open()) {
+      std::cerr << "Cannot open file " << output << std::endl;
+      return 1;
+    }
+    writeJSON(os, results);
+  } else
+    writeJSON(std::cout, results);
+  return 0;
+}
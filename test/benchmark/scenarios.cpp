@@ -0,0 +1,381 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "suite.h"
+
+#include <cstdlib>
+#include <stdexcept>
+#include <sstream>
+
+#include <hpp/fcl/collision.h>
+#include <hpp/fcl/distance.h>
+#include <hpp/fcl/collision_utility.h>
+#include <hpp/fcl/metrics.h>
+#include <hpp/fcl/hfield.h>
+#include <hpp/fcl/linear_octree.h>
+#include <hpp/fcl/sdf.h>
+#include <hpp/fcl/internal/BV_splitter.h>
+#include <hpp/fcl/shape/geometric_shape_to_BVH_model.h>
+#include <hpp/fcl/broadphase/broadphase_bruteforce.h>
+#include <hpp/fcl/broadphase/broadphase_SaP.h>
+#include <hpp/fcl/broadphase/broadphase_SSaP.h>
+#include <hpp/fcl/broadphase/broadphase_interval_tree.h>
+#include <hpp/fcl/broadphase/broadphase_dynamic_AABB_tree.h>
+#include <hpp/fcl/broadphase/broadphase_dynamic_AABB_tree_array.h>
+#include <hpp/fcl/broadphase/broadphase_spatialhash.h>
+#include <hpp/fcl/broadphase/broadphase_hierarchical_spatialhash.h>
+#include <hpp/fcl/broadphase/broadphase_radix_SaP.h>
+
+#include "../utility.h"
+
+namespace hpp {
+namespace fcl {
+namespace benchmark {
+
+namespace {
+/// Number of poses of the second geometry, cycled through by the samples.
+const std::size_t num_poses = 256;
+const std::size_t geometry_samples = 1000;
+const std::size_t broadphase_samples = 20;
+
+/// Size of the geometries, whose center is at the origin of their frame.
+const FCL_REAL half_size = 0.5;
+
+FCL_REAL uniform(FCL_REAL min, FCL_REAL max) {
+  return min + (max - min) * (FCL_REAL)std::rand() / (FCL_REAL)RAND_MAX;
+}
+
+template <typename BV>
+CollisionGeometryPtr_t makeMesh(SplitMethodType split_method) {
+  shared_ptr<BVHModel<BV> > model(new BVHModel<BV>);
+  model->bv_splitter.reset(new BVSplitter<BV>(split_method));
+  generateBVHModel(*model, Sphere(half_size), Transform3f(), 16, 16);
+  return model;
+}
+
+CollisionGeometryPtr_t makeMesh(NODE_TYPE node_type,
+                                SplitMethodType split_method) {
+  switch (node_type) {
+    case BV_AABB:
+      return makeMesh<AABB>(split_method);
+    case BV_OBB:
+      return makeMesh<OBB>(split_method);
+    case BV_RSS:
+      return makeMesh<RSS>(split_method);
+    case BV_kIOS:
+      return makeMesh<kIOS>(split_method);
+    case BV_OBBRSS:
+      return makeMesh<OBBRSS>(split_method);
+    case BV_KDOP16:
+      return makeMesh<KDOP<16> >(split_method);
+    case BV_KDOP18:
+      return makeMesh<KDOP<18> >(split_method);
+    case BV_KDOP24:
+      return makeMesh<KDOP<24> >(split_method);
+    default:
+      return CollisionGeometryPtr_t();
+  }
+}
+
+template <typename BV>
+CollisionGeometryPtr_t makeHeightField() {
+  MatrixXf heights(32, 32);
+  for (Eigen::DenseIndex i = 0; i < heights.size(); ++i)
+    heights.data()[i] = uniform(0, half_size / 2);
+  return CollisionGeometryPtr_t(
+      new HeightField<BV>(4 * half_size, 4 * half_size, heights));
+}
+
+Eigen::Matrix<FCL_REAL, Eigen::Dynamic, 3> makePointCloud() {
+  Eigen::Matrix<FCL_REAL, Eigen::Dynamic, 3> points(1000, 3);
+  for (Eigen::DenseIndex i = 0; i < points.size(); ++i)
+    points.data()[i] = uniform(-half_size, half_size);
+  return points;
+}
+
+/// Geometry of a given node type, or NULL if the suite does not build such
+/// geometries.
+CollisionGeometryPtr_t makeGeometry(NODE_TYPE node_type) {
+  const FCL_REAL s = half_size;
+  switch (node_type) {
+    case GEOM_BOX:
+      return CollisionGeometryPtr_t(new Box(2 * s, 2 * s, 2 * s));
+    case GEOM_SPHERE:
+      return CollisionGeometryPtr_t(new Sphere(s));
+    case GEOM_CAPSULE:
+      return CollisionGeometryPtr_t(new Capsule(s / 2, 2 * s));
+    case GEOM_CONE:
+      return CollisionGeometryPtr_t(new Cone(s, 2 * s));
+    case GEOM_CYLINDER:
+      return CollisionGeometryPtr_t(new Cylinder(s, 2 * s));
+    case GEOM_CONVEX:
+      return CollisionGeometryPtr_t(new Convex<Triangle>(
+          constructPolytopeFromEllipsoid(Ellipsoid(s, 0.8 * s, 0.6 * s))));
+    case GEOM_PLANE:
+      return CollisionGeometryPtr_t(new Plane(Vec3f(0, 0, 1), 0));
+    case GEOM_HALFSPACE:
+      return CollisionGeometryPtr_t(new Halfspace(Vec3f(0, 0, 1), 0));
+    case GEOM_TRIANGLE:
+      return CollisionGeometryPtr_t(new TriangleP(
+          Vec3f(-s, -s, 0), Vec3f(s, -s, 0), Vec3f(0, s, 0)));
+    case GEOM_ELLIPSOID:
+      return CollisionGeometryPtr_t(new Ellipsoid(s, 0.8 * s, 0.6 * s));
+#ifdef HPP_FCL_HAS_OCTOMAP
+    case GEOM_OCTREE:
+      return makeOctree(makePointCloud(), s / 10);
+#endif
+    case HF_AABB:
+      return makeHeightField<AABB>();
+    case HF_OBBRSS:
+      return makeHeightField<OBBRSS>();
+    case GEOM_LINEAR_OCTREE:
+      return makeLinearOctree(makePointCloud(), s / 10);
+    case GEOM_SDF: {
+      const CollisionGeometryPtr_t mesh = makeMesh<OBBRSS>(SPLIT_METHOD_MEAN);
+      return makeSignedDistanceField(
+          static_cast<const BVHModelBase&>(*mesh), s / 10, s / 5);
+    }
+    default:
+      return makeMesh(node_type, SPLIT_METHOD_MEAN);
+  }
+}
+
+/// The distance function matrix has entries for the meshes whose bounding
+/// volumes do not implement the distance.
+bool hasBVDistance(NODE_TYPE node_type) {
+  return node_type != BV_OBB &&
+         (node_type < BV_KDOP16 || node_type > BV_KDOP24);
+}
+
+std::vector<Transform3f> makePoses() {
+  FCL_REAL extents[] = {-2 * half_size, -2 * half_size, -2 * half_size,
+                        2 * half_size,  2 * half_size,  2 * half_size};
+  std::vector<Transform3f> poses;
+  generateRandomTransforms(extents, poses, num_poses);
+  return poses;
+}
+
+class CollisionScenario : public Scenario {
+ public:
+  CollisionScenario(const std::string& name, const std::string& group,
+                    const CollisionGeometryPtr_t& o1,
+                    const CollisionGeometryPtr_t& o2)
+      : Scenario(name, group, geometry_samples),
+        o1(o1),
+        o2(o2),
+        poses(makePoses()),
+        request(CONTACT, 1) {}
+
+  void run(std::size_t i) {
+    result.clear();
+    collide(o1.get(), Transform3f(), o2.get(), poses[i % poses.size()],
+            request, result);
+  }
+
+ private:
+  CollisionGeometryPtr_t o1, o2;
+  std::vector<Transform3f> poses;
+  CollisionRequest request;
+  CollisionResult result;
+};
+
+class DistanceScenario : public Scenario {
+ public:
+  DistanceScenario(const std::string& name, const std::string& group,
+                   const CollisionGeometryPtr_t& o1,
+                   const CollisionGeometryPtr_t& o2)
+      : Scenario(name, group, geometry_samples),
+        o1(o1),
+        o2(o2),
+        poses(makePoses()),
+        request(true) {}
+
+  void run(std::size_t i) {
+    result.clear();
+    distance(o1.get(), Transform3f(), o2.get(), poses[i % poses.size()],
+             request, result);
+  }
+
+ private:
+  CollisionGeometryPtr_t o1, o2;
+  std::vector<Transform3f> poses;
+  DistanceRequest request;
+  DistanceResult result;
+};
+
+/// Objects of a broadphase scene, shared by the scenarios of the managers.
+struct Scene {
+  std::vector<CollisionObject*> objects;
+
+  /// Scene of n boxes, n spheres and n cylinders.
+  explicit Scene(std::size_t n) { generateEnvironments(objects, 100, n); }
+
+  ~Scene() {
+    for (std::size_t i = 0; i < objects.size(); ++i) delete objects[i];
+  }
+};
+
+/// Self collision of the objects of a broadphase manager.
+class BroadPhaseScenario : public Scenario {
+ public:
+  BroadPhaseScenario(const std::string& name,
+                     BroadPhaseCollisionManager* manager,
+                     const shared_ptr<Scene>& scene)
+      : Scenario(name, "broadphase", broadphase_samples),
+        scene(scene),
+        manager(manager),
+        callback(scene->objects.size()) {
+    manager->registerObjects(scene->objects);
+    manager->setup();
+  }
+
+  void run(std::size_t) { manager->collide(&callback); }
+
+ private:
+  shared_ptr<Scene> scene;
+  shared_ptr<BroadPhaseCollisionManager> manager;
+  CollisionCallBackCollect callback;
+};
+
+BroadPhaseCollisionManager* makeManager(
+    metrics::BroadPhaseManagerType type,
+    std::vector<CollisionObject*>& objects) {
+  switch (type) {
+    case metrics::BP_NAIVE:
+      return new NaiveCollisionManager();
+    case metrics::BP_SAP:
+      return new SaPCollisionManager();
+    case metrics::BP_SSAP:
+      return new SSaPCollisionManager();
+    case metrics::BP_RADIX_SAP:
+      return new RadixSaPCollisionManager();
+    case metrics::BP_INTERVAL_TREE:
+      return new IntervalTreeCollisionManager();
+    case metrics::BP_DYNAMIC_AABB_TREE:
+      return new DynamicAABBTreeCollisionManager();
+    case metrics::BP_DYNAMIC_AABB_TREE_ARRAY:
+      return new DynamicAABBTreeArrayCollisionManager();
+    case metrics::BP_SPATIAL_HASH: {
+      Vec3f lower_limit, upper_limit;
+      SpatialHashingCollisionManager<>::computeBound(objects, lower_limit,
+                                                     upper_limit);
+      const FCL_REAL cell_size = (upper_limit - lower_limit).minCoeff() / 20;
+      return new SpatialHashingCollisionManager<>(cell_size, lower_limit,
+                                                  upper_limit);
+    }
+    case metrics::BP_HIERARCHICAL_SPATIAL_HASH:
+      return new HierarchicalSpatialHashingCollisionManager();
+    default:
+      return NULL;
+  }
+}
+
+/// Add a scenario unless its query throws, as for the pairs of geometries
+/// which the function matrices accept but the library rejects at run time.
+void addScenario(std::vector<ScenarioPtr_t>& scenarios, Scenario* scenario) {
+  const ScenarioPtr_t ptr(scenario);
+  try {
+    ptr->run(0);
+  } catch (const std::exception&) {
+    return;
+  }
+  scenarios.push_back(ptr);
+}
+}  // namespace
+
+void makeScenarios(std::vector<ScenarioPtr_t>& scenarios) {
+  std::srand(0);
+
+  const CollisionFunctionMatrix collision_matrix;
+  const DistanceFunctionMatrix distance_matrix;
+  for (int t1 = 0; t1 < NODE_COUNT; ++t1)
+    for (int t2 = 0; t2 < NODE_COUNT; ++t2) {
+      const NODE_TYPE node_type1 = (NODE_TYPE)t1, node_type2 = (NODE_TYPE)t2;
+      const bool has_collision =
+          collision_matrix.collision_matrix[t1][t2] != NULL;
+      const bool has_distance =
+          distance_matrix.distance_matrix[t1][t2] != NULL &&
+          hasBVDistance(node_type1) && hasBVDistance(node_type2);
+      if (!has_collision && !has_distance) continue;
+      const CollisionGeometryPtr_t o1 = makeGeometry(node_type1),
+                                   o2 = makeGeometry(node_type2);
+      if (!o1 || !o2) continue;
+
+      const std::string pair = std::string(get_node_type_name(node_type1)) +
+                               "/" + get_node_type_name(node_type2);
+      if (has_collision)
+        addScenario(scenarios, new CollisionScenario("collide/" + pair,
+                                                     "collide", o1, o2));
+      if (has_distance)
+        addScenario(scenarios, new DistanceScenario("distance/" + pair,
+                                                    "distance", o1, o2));
+    }
+
+  const SplitMethodType split_methods[] = {
+      SPLIT_METHOD_MEAN, SPLIT_METHOD_MEDIAN, SPLIT_METHOD_BV_CENTER};
+  const char* split_method_names[] = {"mean", "median", "bv_center"};
+  for (int t = BV_AABB; t <= BV_KDOP24; ++t)
+    for (int s = 0; s < 3; ++s) {
+      const NODE_TYPE node_type = (NODE_TYPE)t;
+      const CollisionGeometryPtr_t o1 = makeMesh(node_type, split_methods[s]),
+                                   o2 = makeMesh(node_type, split_methods[s]);
+      const std::string name = std::string("mesh_split/") +
+                               get_node_type_name(node_type) + "/" +
+                               split_method_names[s];
+      addScenario(scenarios, new CollisionScenario(name + "/collide",
+                                                   "mesh_split", o1, o2));
+      if (distance_matrix.distance_matrix[t][t] && hasBVDistance(node_type))
+        addScenario(scenarios, new DistanceScenario(name + "/distance",
+                                                    "mesh_split", o1, o2));
+    }
+
+  const std::size_t scene_sizes[] = {20, 100, 300};
+  for (int s = 0; s < 3; ++s) {
+    const shared_ptr<Scene> scene(new Scene(scene_sizes[s]));
+    for (int m = 0; m < metrics::BP_COUNT; ++m) {
+      const metrics::BroadPhaseManagerType type =
+          (metrics::BroadPhaseManagerType)m;
+      std::ostringstream name;
+      name << "broadphase/" << metrics::getBroadPhaseManagerName(type) << "/"
+           << scene->objects.size();
+      addScenario(scenarios,
+                  new BroadPhaseScenario(
+                      name.str(), makeManager(type, scene->objects), scene));
+    }
+  }
+}
+
+}  // namespace benchmark
+}  // namespace fcl
+}  // namespace hpp
@@ -0,0 +1,310 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "suite.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+namespace hpp {
+namespace fcl {
+namespace benchmark {
+
+Statistics::Statistics()
+    : samples(0), min(0), mean(0), stddev(0), p50(0), p90(0), p99(0), max(0) {}
+
+double percentile(const std::vector<double>& sorted, double p) {
+  if (sorted.empty()) return 0;
+  const double rank = p / 100 * (double)(sorted.size() - 1);
+  const std::size_t lower = (std::size_t)std::floor(rank);
+  const std::size_t upper = std::min(lower + 1, sorted.size() - 1);
+  return sorted[lower] +
+         (rank - (double)lower) * (sorted[upper] - sorted[lower]);
+}
+
+Statistics Statistics::compute(std::vector<double> durations) {
+  Statistics stats;
+  stats.samples = durations.size();
+  if (durations.empty()) return stats;
+
+  std::sort(durations.begin(), durations.end());
+  double sum = 0;
+  for (std::size_t i = 0; i < durations.size(); ++i) sum += durations[i];
+  stats.mean = sum / (double)durations.size();
+  double sum_sq = 0;
+  for (std::size_t i = 0; i < durations.size(); ++i)
+    sum_sq += (durations[i] - stats.mean) * (durations[i] - stats.mean);
+  if (durations.size() > 1)
+    stats.stddev = std::sqrt(sum_sq / (double)(durations.size() - 1));
+
+  stats.min = durations.front();
+  stats.max = durations.back();
+  stats.p50 = percentile(durations, 50);
+  stats.p90 = percentile(durations, 90);
+  stats.p99 = percentile(durations, 99);
+  return stats;
+}
+
+namespace {
+typedef std::chrono::steady_clock Clock;
+
+/// Time the queries of a scenario, after a warm-up.
+void sample(Scenario& scenario, const RunOptions& options,
+            std::vector<double>& durations) {
+  const double scaled =
+      std::ceil(options.sample_scale * (double)scenario.samples);
+  const std::size_t samples = std::max((std::size_t)1, (std::size_t)scaled);
+  for (std::size_t i = 0; i < std::min(options.warmup, samples); ++i)
+    scenario.run(i);
+
+  durations.clear();
+  const Clock::time_point begin = Clock::now();
+  for (std::size_t i = 0; i < samples; ++i) {
+    const Clock::time_point start = Clock::now();
+    scenario.run(i);
+    const Clock::time_point end = Clock::now();
+    durations.push_back(
+        std::chrono::duration<double, std::micro>(end - start).count());
+    if (i + 1 >= options.min_samples &&
+        std::chrono::duration<double>(end - begin).count() > options.max_time)
+      break;
+  }
+}
+}  // namespace
+
+std::vector<ScenarioResult> run(const std::vector<ScenarioPtr_t>& scenarios,
+                                const RunOptions& options) {
+  std::vector<Scenario*> selection;
+  for (std::size_t s = 0; s < scenarios.size(); ++s)
+    if (scenarios[s]->name.find(options.filter) != std::string::npos)
+      selection.push_back(scenarios[s].get());
+
+  std::vector<ScenarioResult> results(selection.size());
+  std::vector<std::vector<double> > samples(selection.size());
+  std::vector<double> durations;
+  const std::size_t repeats = std::max((std::size_t)1, options.repeats);
+  for (std::size_t r = 0; r < repeats; ++r) {
+    for (std::size_t s = 0; s < selection.size(); ++s) {
+      sample(*selection[s], options, durations);
+      samples[s].insert(samples[s].end(), durations.begin(), durations.end());
+      if (repeats > 1) {
+        const Statistics stats = Statistics::compute(durations);
+        results[s].run_p50.push_back(stats.p50);
+        results[s].run_p99.push_back(stats.p99);
+      }
+    }
+  }
+
+  for (std::size_t s = 0; s < selection.size(); ++s) {
+    results[s].name = selection[s]->name;
+    results[s].group = selection[s]->group;
+    results[s].statistics = Statistics::compute(samples[s]);
+  }
+  return results;
+}
+
+namespace {
+void writeArray(std::ostream& os, const std::vector<double>& values) {
+  os << "[";
+  for (std::size_t i = 0; i < values.size(); ++i)
+    os << (i ? ", " : "") << values[i];
+  os << "]";
+}
+}  // namespace
+
+void writeJSON(std::ostream& os, const std::vector<ScenarioResult>& results) {
+  os << "{\n  \"version\": \"" << HPP_FCL_VERSION << "\",\n"
+     << "  \"unit\": \"us\",\n  \"scenarios\": [";
+  for (std::size_t i = 0; i < results.size(); ++i) {
+    const ScenarioResult& result = results[i];
+    const Statistics& stats = result.statistics;
+    os << (i ? ",\n" : "\n") << "    {\"name\": \"" << result.name
+       << "\", \"group\": \"" << result.group
+       << "\", \"samples\": " << stats.samples << ", \"min\": " << stats.min
+       << ", \"mean\": " << stats.mean << ", \"stddev\": " << stats.stddev
+       << ", \"p50\": " << stats.p50 << ", \"p90\": " << stats.p90
+       << ", \"p99\": " << stats.p99 << ", \"max\": " << stats.max;
+    if (!result.run_p50.empty()) {
+      os << ", \"p50_runs\": ";
+      writeArray(os, result.run_p50);
+      os << ", \"p99_runs\": ";
+      writeArray(os, result.run_p99);
+    }
+    os << "}";
+  }
+  os << "\n  ]\n}\n";
+}
+
+namespace {
+/// Position of the value of \p key in a flat JSON object, or npos.
+std::size_t findValue(const std::string& object, const std::string& key) {
+  const std::size_t pos = object.find("\"" + key + "\":");
+  if (pos == std::string::npos) return pos;
+  return object.find_first_not_of(" \t\n", pos + key.size() + 3);
+}
+
+bool readString(const std::string& object, const std::string& key,
+                std::string& value) {
+  const std::size_t begin = findValue(object, key);
+  if (begin == std::string::npos || object[begin] != '"') return false;
+  const std::size_t end = object.find('"', begin + 1);
+  if (end == std::string::npos) return false;
+  value = object.substr(begin + 1, end - begin - 1);
+  return true;
+}
+
+bool readNumber(const std::string& object, const std::string& key,
+                double& value) {
+  const std::size_t begin = findValue(object, key);
+  if (begin == std::string::npos) return false;
+  std::istringstream iss(object.substr(begin));
+  return (bool)(iss >> value);
+}
+
+void readArray(const std::string& object, const std::string& key,
+               std::vector<double>& values) {
+  values.clear();
+  const std::size_t begin = findValue(object, key);
+  if (begin == std::string::npos || object[begin] != '[') return;
+  const std::size_t end = object.find(']', begin);
+  std::istringstream iss(object.substr(begin + 1, end - begin - 1));
+  double value;
+  char separator;
+  while (iss >> value) {
+    values.push_back(value);
+    iss >> separator;
+  }
+}
+}  // namespace
+
+bool readJSON(std::istream& is, std::vector<ScenarioResult>& results) {
+  std::ostringstream oss;
+  oss << is.rdbuf();
+  const std::string json = oss.str();
+
+  std::size_t pos = json.find("\"scenarios\"");
+  if (pos == std::string::npos) return false;
+  results.clear();
+  while ((pos = json.find('{', pos)) != std::string::npos) {
+    const std::size_t end = json.find('}', pos);
+    if (end == std::string::npos) return false;
+    const std::string object = json.substr(pos, end - pos + 1);
+    pos = end;
+
+    ScenarioResult result;
+    Statistics& stats = result.statistics;
+    double samples;
+    if (!readString(object, "name", result.name) ||
+        !readString(object, "group", result.group) ||
+        !readNumber(object, "samples", samples) ||
+        !readNumber(object, "min", stats.min) ||
+        !readNumber(object, "mean", stats.mean) ||
+        !readNumber(object, "stddev", stats.stddev) ||
+        !readNumber(object, "p50", stats.p50) ||
+        !readNumber(object, "p90", stats.p90) ||
+        !readNumber(object, "p99", stats.p99) ||
+        !readNumber(object, "max", stats.max))
+      return false;
+    stats.samples = (std::size_t)samples;
+    readArray(object, "p50_runs", result.run_p50);
+    readArray(object, "p99_runs", result.run_p99);
+    results.push_back(result);
+  }
+  return true;
+}
+
+namespace {
+double median(std::vector<double> values) {
+  std::sort(values.begin(), values.end());
+  return percentile(values, 50);
+}
+
+/// Relative standard deviation of the values of the runs.
+double noise(const std::vector<double>& values) {
+  if (values.size() < 2) return 0;
+  const Statistics stats = Statistics::compute(values);
+  return stats.mean > 0 ? stats.stddev / stats.mean : 0;
+}
+
+Change makeChange(double baseline, const std::vector<double>& baseline_runs,
+                  double current, const std::vector<double>& current_runs,
+                  double threshold, double noise_factor) {
+  Change change;
+  change.baseline = baseline_runs.empty() ? baseline : median(baseline_runs);
+  change.current = current_runs.empty() ? current : median(current_runs);
+  change.delta = change.baseline > 0
+                     ? (change.current - change.baseline) / change.baseline
+                     : 0;
+  change.threshold =
+      std::max(threshold, noise_factor * std::max(noise(baseline_runs),
+                                                  noise(current_runs)));
+  return change;
+}
+}  // namespace
+
+std::vector<Comparison> compare(const std::vector<ScenarioResult>& baseline,
+                                const std::vector<ScenarioResult>& current,
+                                const CompareOptions& options) {
+  std::map<std::string, const ScenarioResult*> baselines;
+  for (std::size_t i = 0; i < baseline.size(); ++i)
+    baselines[baseline[i].name] = &baseline[i];
+
+  std::vector<Comparison> comparisons;
+  for (std::size_t i = 0; i < current.size(); ++i) {
+    const ScenarioResult& c = current[i];
+    std::map<std::string, const ScenarioResult*>::const_iterator it =
+        baselines.find(c.name);
+    if (it == baselines.end()) continue;
+    const ScenarioResult& b = *it->second;
+
+    Comparison comparison;
+    comparison.name = c.name;
+    comparison.p50 = makeChange(b.statistics.p50, b.run_p50, c.statistics.p50,
+                                c.run_p50, options.threshold,
+                                options.noise_factor);
+    comparison.p99 = makeChange(b.statistics.p99, b.run_p99, c.statistics.p99,
+                                c.run_p99, options.tail_threshold,
+                                options.noise_factor);
+    comparisons.push_back(comparison);
+  }
+  return comparisons;
+}
+
+}  // namespace benchmark
+}  // namespace fcl
+}  // namespace hpp
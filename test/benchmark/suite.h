@@ -0,0 +1,205 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef HPP_FCL_TEST_BENCHMARK_SUITE_H
+#define HPP_FCL_TEST_BENCHMARK_SUITE_H
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include <hpp/fcl/fwd.hh>
+
+namespace hpp {
+namespace fcl {
+namespace benchmark {
+
+/// @brief Statistics of the durations of the queries of a scenario, in
+/// microseconds.
+struct Statistics {
+  std::size_t samples;
+  double min;
+  double mean;
+  double stddev;
+  double p50;
+  double p90;
+  double p99;
+  double max;
+
+  Statistics();
+
+  /// @brief Statistics of a set of durations.
+  static Statistics compute(std::vector<double> durations);
+};
+
+/// @brief Value of the percentile \p p, between 0 and 100, of sorted values,
+/// interpolated linearly between the closest ranks.
+double percentile(const std::vector<double>& sorted, double p);
+
+/// @brief A sequence of queries timed one by one.
+class Scenario {
+ public:
+  /// \param[in] name unique name, made of the group and of the geometries.
+  /// \param[in] group the kind of query.
+  /// \param[in] samples default number of queries to time.
+  Scenario(const std::string& name, const std::string& group,
+           std::size_t samples)
+      : name(name), group(group), samples(samples) {}
+
+  virtual ~Scenario() {}
+
+  /// @brief Run the query \p i, where \p i is the index of the sample.
+  virtual void run(std::size_t i) = 0;
+
+  const std::string name;
+  const std::string group;
+  const std::size_t samples;
+};
+
+typedef shared_ptr<Scenario> ScenarioPtr_t;
+
+/// @brief Create the scenarios of the suite.
+///
+/// The suite covers every pair of geometries supported by the collision and
+/// distance function matrices, the meshes of every bounding volume type with
+/// every split method, and the broadphase managers with several scene sizes.
+/// The random poses are generated from a fixed seed.
+void makeScenarios(std::vector<ScenarioPtr_t>& scenarios);
+
+struct ScenarioResult {
+  std::string name;
+  std::string group;
+
+  /// @brief statistics of the samples of all the runs
+  Statistics statistics;
+
+  /// @brief median and 99th percentile of each run, when the scenario was run
+  /// several times
+  std::vector<double> run_p50;
+  std::vector<double> run_p99;
+};
+
+struct RunOptions {
+  /// @brief only the scenarios whose name contains this string are run
+  std::string filter;
+
+  /// @brief scale applied to the default number of samples of the scenarios
+  double sample_scale;
+
+  /// @brief number of queries run before timing
+  std::size_t warmup;
+
+  /// @brief the sampling of a scenario stops after this duration, in seconds,
+  /// once min_samples queries were timed
+  double max_time;
+
+  std::size_t min_samples;
+
+  /// @brief number of runs of the whole selection of scenarios
+  std::size_t repeats;
+
+  RunOptions()
+      : sample_scale(1),
+        warmup(10),
+        max_time(2),
+        min_samples(10),
+        repeats(1) {}
+};
+
+/// @brief Run the scenarios selected by the options.
+///
+/// The selection is run options.repeats times in a row, so that a slow
+/// period of the machine affects every scenario alike.
+std::vector<ScenarioResult> run(const std::vector<ScenarioPtr_t>& scenarios,
+                                const RunOptions& options);
+
+/// @brief Write the results as a JSON object.
+void writeJSON(std::ostream& os, const std::vector<ScenarioResult>& results);
+
+/// @brief Read results written by writeJSON.
+/// @return false if the stream does not contain results.
+bool readJSON(std::istream& is, std::vector<ScenarioResult>& results);
+
+struct CompareOptions {
+  /// @brief smallest relative change of the median which is reported
+  double threshold;
+
+  /// @brief smallest relative change of the 99th percentile which is reported
+  double tail_threshold;
+
+  /// @brief number of relative standard deviations between the runs above
+  /// which a change is significant
+  double noise_factor;
+
+  CompareOptions() : threshold(0.05), tail_threshold(0.1), noise_factor(3) {}
+};
+
+/// @brief Change of a statistic of a scenario between two sets of results.
+struct Change {
+  double baseline;
+  double current;
+
+  /// @brief (current - baseline) / baseline
+  double delta;
+
+  /// @brief the change is significant if |delta| is above this value
+  double threshold;
+
+  bool slower() const { return delta > threshold; }
+  bool faster() const { return delta < -threshold; }
+};
+
+struct Comparison {
+  std::string name;
+  Change p50;
+  Change p99;
+
+  bool slower() const { return p50.slower() || p99.slower(); }
+};
+
+/// @brief Compare the scenarios present in both sets of results.
+///
+/// A statistic of a scenario is the median of the values of its runs, and
+/// its noise is the largest relative standard deviation of these values in
+/// both sets. A change is significant if it exceeds both the threshold of
+/// the options and noise_factor times the noise.
+std::vector<Comparison> compare(const std::vector<ScenarioResult>& baseline,
+                                const std::vector<ScenarioResult>& current,
+                                const CompareOptions& options);
+
+}  // namespace benchmark
+}  // namespace fcl
+}  // namespace hpp
+
+#endif
@@ -0,0 +1,125 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define BOOST_TEST_MODULE FCL_BENCHMARK_COMPARE
+#include <boost/test/included/unit_test.hpp>
+
+#include <sstream>
+
+#include "benchmark/suite.h"
+
+using namespace hpp::fcl::benchmark;
+
+ScenarioResult makeResult(const std::string& name, double p50, double p99) {
+  ScenarioResult result;
+  result.name = name;
+  result.group = "test";
+  result.statistics.samples = 10;
+  result.statistics.p50 = p50;
+  result.statistics.p99 = p99;
+  return result;
+}
+
+BOOST_AUTO_TEST_CASE(json_round_trip) {
+  std::vector<ScenarioResult> results;
+  results.push_back(makeResult("a", 1.5, 3));
+  results.push_back(makeResult("b", 2, 4));
+  results[1].run_p50.push_back(1.9);
+  results[1].run_p50.push_back(2.1);
+  results[1].run_p99.push_back(3.5);
+  results[1].run_p99.push_back(4.5);
+
+  std::stringstream ss;
+  writeJSON(ss, results);
+  std::vector<ScenarioResult> read;
+  BOOST_REQUIRE(readJSON(ss, read));
+  BOOST_REQUIRE_EQUAL(read.size(), 2);
+  BOOST_CHECK_EQUAL(read[0].name, "a");
+  BOOST_CHECK_EQUAL(read[0].group, "test");
+  BOOST_CHECK_EQUAL(read[0].statistics.samples, 10);
+  BOOST_CHECK_EQUAL(read[0].statistics.p50, 1.5);
+  BOOST_CHECK(read[0].run_p50.empty());
+  BOOST_REQUIRE_EQUAL(read[1].run_p99.size(), 2);
+  BOOST_CHECK_EQUAL(read[1].run_p99[1], 4.5);
+
+  std::istringstream invalid("{}");
+  BOOST_CHECK(!readJSON(invalid, read));
+}
+
+BOOST_AUTO_TEST_CASE(significant_changes) {
+  std::vector<ScenarioResult> baseline, current;
+  baseline.push_back(makeResult("stable", 10, 20));
+  current.push_back(makeResult("stable", 10.2, 21));
+  baseline.push_back(makeResult("tail", 10, 20));
+  current.push_back(makeResult("tail", 10, 40));
+  baseline.push_back(makeResult("faster", 10, 20));
+  current.push_back(makeResult("faster", 5, 20));
+  current.push_back(makeResult("new", 1, 1));
+
+  const std::vector<Comparison> comparisons =
+      compare(baseline, current, CompareOptions());
+  BOOST_REQUIRE_EQUAL(comparisons.size(), 3);
+  BOOST_CHECK(!comparisons[0].slower());
+  BOOST_CHECK(!comparisons[0].p50.faster());
+  BOOST_CHECK(comparisons[1].slower());
+  BOOST_CHECK(!comparisons[1].p50.slower());
+  BOOST_CHECK_CLOSE(comparisons[1].p99.delta, 1, 1e-8);
+  BOOST_CHECK(!comparisons[2].slower());
+  BOOST_CHECK(comparisons[2].p50.faster());
+}
+
+BOOST_AUTO_TEST_CASE(noisy_runs) {
+  // The median of the runs is used, and the threshold grows with the
+  // spread of the runs.
+  ScenarioResult b = makeResult("noisy", 10, 20), c = b;
+  const double b_runs[] = {8, 10, 12}, c_runs[] = {9, 11.5, 30};
+  for (int i = 0; i < 3; ++i) {
+    b.run_p50.push_back(b_runs[i]);
+    c.run_p50.push_back(c_runs[i]);
+  }
+  const std::vector<Comparison> comparisons = compare(
+      std::vector<ScenarioResult>(1, b), std::vector<ScenarioResult>(1, c),
+      CompareOptions());
+  BOOST_REQUIRE_EQUAL(comparisons.size(), 1);
+  BOOST_CHECK_EQUAL(comparisons[0].p50.baseline, 10);
+  BOOST_CHECK_EQUAL(comparisons[0].p50.current, 11.5);
+  BOOST_CHECK(comparisons[0].p50.threshold > 1);
+  BOOST_CHECK(!comparisons[0].slower());
+
+  CompareOptions quiet;
+  quiet.noise_factor = 0;
+  BOOST_CHECK(compare(std::vector<ScenarioResult>(1, b),
+                      std::vector<ScenarioResult>(1, c), quiet)[0]
+                  .p50.slower());
+}
@@ -42,6 +42,7 @@
 
 #define CHECK_CLOSE_TO_0(x, eps) BOOST_CHECK_CLOSE((x + 1.0), (1.0), (eps))
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <hpp/fcl/distance.h>
@@ -56,9 +57,22 @@ using hpp::fcl::CollisionGeometryPtr_t;
 using hpp::fcl::CollisionObject;
 using hpp::fcl::DistanceRequest;
 using hpp::fcl::DistanceResult;
+using hpp::fcl::FCL_REAL;
 using hpp::fcl::Transform3f;
 using hpp::fcl::Vec3f;
 
+/// Returns the tolerance of BOOST_CHECK_CLOSE, in percent. In single
+/// precision, the translations are rounded and GJK stops at
+/// GJK_DEFAULT_TOLERANCE, so that the small distances are only accurate up to
+/// a relative error of about 1e-3.
+FCL_REAL closeTolerance(double tol) {
+#ifdef HPP_FCL_USE_FLOAT
+  return (std::max)(FCL_REAL(tol), 1000 * hpp::fcl::GJK_DEFAULT_TOLERANCE);
+#else
+  return tol;
+#endif
+}
+
 BOOST_AUTO_TEST_CASE(distance_box_box_1) {
   CollisionGeometryPtr_t s1(new hpp::fcl::Box(6, 10, 2));
   CollisionGeometryPtr_t s2(new hpp::fcl::Box(2, 2, 2));
@@ -90,14 +104,14 @@ BOOST_AUTO_TEST_CASE(distance_box_box_1) {
   const Vec3f& p1 = distanceResult.nearest_points[0];
   const Vec3f& p2 = distanceResult.nearest_points[1];
   BOOST_CHECK_CLOSE(distanceResult.min_distance,
-                    sqrt(dx * dx + dy * dy + dz * dz), 1e-4);
-
-  BOOST_CHECK_CLOSE(p1[0], 3, 1e-6);
-  BOOST_CHECK_CLOSE(p1[1], 5, 1e-6);
-  BOOST_CHECK_CLOSE(p1[2], 1, 1e-6);
-  BOOST_CHECK_CLOSE(p2[0], 24, 1e-6);
-  BOOST_CHECK_CLOSE(p2[1], 19, 1e-6);
-  BOOST_CHECK_CLOSE(p2[2], 4, 1e-6);
+                    sqrt(dx * dx + dy * dy + dz * dz), closeTolerance(1e-4));
+
+  BOOST_CHECK_CLOSE(p1[0], 3, closeTolerance(1e-6));
+  BOOST_CHECK_CLOSE(p1[1], 5, closeTolerance(1e-6));
+  BOOST_CHECK_CLOSE(p1[2], 1, closeTolerance(1e-6));
+  BOOST_CHECK_CLOSE(p2[0], 24, closeTolerance(1e-6));
+  BOOST_CHECK_CLOSE(p2[1], 19, closeTolerance(1e-6));
+  BOOST_CHECK_CLOSE(p2[2], 4, closeTolerance(1e-6));
 }
 
 BOOST_AUTO_TEST_CASE(distance_box_box_2) {
@@ -131,14 +145,15 @@ BOOST_AUTO_TEST_CASE(distance_box_box_2) {
   const Vec3f& p1 = distanceResult.nearest_points[0];
   const Vec3f& p2 = distanceResult.nearest_points[1];
   double distance = -1.62123444 + 10 - 1;
-  BOOST_CHECK_CLOSE(distanceResult.min_distance, distance, 1e-4);
-
-  BOOST_CHECK_CLOSE(p1[0], 0.60947571, 1e-4);
-  BOOST_CHECK_CLOSE(p1[1], 0.01175873, 1e-4);
-  BOOST_CHECK_CLOSE(p1[2], 1, 1e-6);
-  BOOST_CHECK_CLOSE(p2[0], 0.60947571, 1e-4);
-  BOOST_CHECK_CLOSE(p2[1], 0.01175873, 1e-4);
-  BOOST_CHECK_CLOSE(p2[2], -1.62123444 + 10, 1e-4);
+  BOOST_CHECK_CLOSE(distanceResult.min_distance, distance,
+                    closeTolerance(1e-4));
+
+  BOOST_CHECK_CLOSE(p1[0], 0.60947571, closeTolerance(1e-4));
+  BOOST_CHECK_CLOSE(p1[1], 0.01175873, closeTolerance(1e-4));
+  BOOST_CHECK_CLOSE(p1[2], 1, closeTolerance(1e-6));
+  BOOST_CHECK_CLOSE(p2[0], 0.60947571, closeTolerance(1e-4));
+  BOOST_CHECK_CLOSE(p2[1], 0.01175873, closeTolerance(1e-4));
+  BOOST_CHECK_CLOSE(p2[2], -1.62123444 + 10, closeTolerance(1e-4));
 }
 
 BOOST_AUTO_TEST_CASE(distance_box_box_3) {
@@ -171,16 +186,17 @@ BOOST_AUTO_TEST_CASE(distance_box_box_3) {
   const Vec3f& p1 = distanceResult.nearest_points[0];
   const Vec3f& p2 = distanceResult.nearest_points[1];
   double distance = 4 - sqrt(2);
-  BOOST_CHECK_CLOSE(distanceResult.min_distance, distance, 1e-4);
+  BOOST_CHECK_CLOSE(distanceResult.min_distance, distance,
+                    closeTolerance(1e-4));
 
   const Vec3f p1Ref(sqrt(2) / 2 - 2, 1, .5);
   const Vec3f p2Ref(2 - sqrt(2) / 2, 1, .5);
-  BOOST_CHECK_CLOSE(p1[0], p1Ref[0], 1e-4);
-  BOOST_CHECK_CLOSE(p1[1], p1Ref[1], 1e-4);
-  BOOST_CHECK_CLOSE(p1[2], p1Ref[2], 1e-4);
-  BOOST_CHECK_CLOSE(p2[0], p2Ref[0], 1e-4);
-  BOOST_CHECK_CLOSE(p2[1], p2Ref[1], 1e-4);
-  BOOST_CHECK_CLOSE(p2[2], p2Ref[2], 1e-4);
+  BOOST_CHECK_CLOSE(p1[0], p1Ref[0], closeTolerance(1e-4));
+  BOOST_CHECK_CLOSE(p1[1], p1Ref[1], closeTolerance(1e-4));
+  BOOST_CHECK_CLOSE(p1[2], p1Ref[2], closeTolerance(1e-4));
+  BOOST_CHECK_CLOSE(p2[0], p2Ref[0], closeTolerance(1e-4));
+  BOOST_CHECK_CLOSE(p2[1], p2Ref[1], closeTolerance(1e-4));
+  BOOST_CHECK_CLOSE(p2[2], p2Ref[2], closeTolerance(1e-4));
 
   // Apply the same global transform to both objects and recompute
   Transform3f tf3(hpp::fcl::makeQuat(0.435952844074, -0.718287018243,
@@ -203,16 +219,17 @@ BOOST_AUTO_TEST_CASE(distance_box_box_3) {
             << ", p2 = " << distanceResult.nearest_points[1]
             << ", distance = " << distanceResult.min_distance << std::endl;
 
-  BOOST_CHECK_CLOSE(distanceResult.min_distance, distance, 1e-4);
+  BOOST_CHECK_CLOSE(distanceResult.min_distance, distance,
+                    closeTolerance(1e-4));
 
   const Vec3f p1Moved = tf3.transform(p1Ref);
   const Vec3f p2Moved = tf3.transform(p2Ref);
-  BOOST_CHECK_CLOSE(p1[0], p1Moved[0], 1e-4);
-  BOOST_CHECK_CLOSE(p1[1], p1Moved[1], 1e-4);
-  BOOST_CHECK_CLOSE(p1[2], p1Moved[2], 1e-4);
-  BOOST_CHECK_CLOSE(p2[0], p2Moved[0], 1e-4);
-  BOOST_CHECK_CLOSE(p2[1], p2Moved[1], 1e-4);
-  BOOST_CHECK_CLOSE(p2[2], p2Moved[2], 1e-4);
+  BOOST_CHECK_CLOSE(p1[0], p1Moved[0], closeTolerance(1e-4));
+  BOOST_CHECK_CLOSE(p1[1], p1Moved[1], closeTolerance(1e-4));
+  BOOST_CHECK_CLOSE(p1[2], p1Moved[2], closeTolerance(1e-4));
+  BOOST_CHECK_CLOSE(p2[0], p2Moved[0], closeTolerance(1e-4));
+  BOOST_CHECK_CLOSE(p2[1], p2Moved[1], closeTolerance(1e-4));
+  BOOST_CHECK_CLOSE(p2[2], p2Moved[2], closeTolerance(1e-4));
 }
 
 BOOST_AUTO_TEST_CASE(distance_box_box_4) {
@@ -229,26 +246,30 @@ BOOST_AUTO_TEST_CASE(distance_box_box_4) {
   hpp::fcl::distance(&s1, tf1, &s2, tf2, distanceRequest, distanceResult);
 
   distance = 1.;
-  BOOST_CHECK_CLOSE(distanceResult.min_distance, distance, 1e-4);
+  BOOST_CHECK_CLOSE(distanceResult.min_distance, distance,
+                    closeTolerance(1e-4));
 
   tf1.setTranslation(Vec3f(1.01, 0, 0));
   distanceResult.clear();
   hpp::fcl::distance(&s1, tf1, &s2, tf2, distanceRequest, distanceResult);
 
   distance = 0.01;
-  BOOST_CHECK_CLOSE(distanceResult.min_distance, distance, 2e-3);
+  BOOST_CHECK_CLOSE(distanceResult.min_distance, distance,
+                    closeTolerance(2e-3));
 
   tf1.setTranslation(Vec3f(0.99, 0, 0));
   distanceResult.clear();
   hpp::fcl::distance(&s1, tf1, &s2, tf2, distanceRequest, distanceResult);
 
   distance = -0.01;
-  BOOST_CHECK_CLOSE(distanceResult.min_distance, distance, 2e-3);
+  BOOST_CHECK_CLOSE(distanceResult.min_distance, distance,
+                    closeTolerance(2e-3));
 
   tf1.setTranslation(Vec3f(0, 0, 0));
   distanceResult.clear();
   hpp::fcl::distance(&s1, tf1, &s2, tf2, distanceRequest, distanceResult);
 
   distance = -1;
-  BOOST_CHECK_CLOSE(distanceResult.min_distance, distance, 2e-3);
+  BOOST_CHECK_CLOSE(distanceResult.min_distance, distance,
+                    closeTolerance(2e-3));
 }
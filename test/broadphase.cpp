@@ -328,6 +328,8 @@ void broad_phase_self_distance_test(double env_scale, std::size_t env_size,
           AABB, CollisionObject*, SpatialHash, GoogleDenseHashTable> >(
           cell_size, lower_limit, upper_limit));
 #endif
+  managers.push_back(new HierarchicalSpatialHashingCollisionManager());
+  managers.push_back(new RadixSaPCollisionManager());
   managers.push_back(new DynamicAABBTreeCollisionManager());
   managers.push_back(new DynamicAABBTreeArrayCollisionManager());
 
@@ -478,6 +480,8 @@ void broad_phase_distance_test(double env_scale, std::size_t env_size,
           AABB, CollisionObject*, SpatialHash, GoogleDenseHashTable> >(
           cell_size, lower_limit, upper_limit));
 #endif
+  managers.push_back(new HierarchicalSpatialHashingCollisionManager());
+  managers.push_back(new RadixSaPCollisionManager());
   managers.push_back(new DynamicAABBTreeCollisionManager());
   managers.push_back(new DynamicAABBTreeArrayCollisionManager());
 
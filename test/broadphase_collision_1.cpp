@@ -40,6 +40,8 @@
 
 #include "hpp/fcl/broadphase/broadphase_bruteforce.h"
 #include "hpp/fcl/broadphase/broadphase_spatialhash.h"
+#include "hpp/fcl/broadphase/broadphase_hierarchical_spatialhash.h"
+#include "hpp/fcl/broadphase/broadphase_radix_SaP.h"
 #include "hpp/fcl/broadphase/broadphase_SaP.h"
 #include "hpp/fcl/broadphase/broadphase_SSaP.h"
 #include "hpp/fcl/broadphase/broadphase_interval_tree.h"
@@ -230,6 +232,8 @@ void broad_phase_duplicate_check_test(FCL_REAL env_scale, std::size_t env_size,
           AABB, CollisionObject*, detail::SpatialHash, GoogleDenseHashTable>>(
           cell_size, lower_limit, upper_limit));
 #endif
+  managers.push_back(new HierarchicalSpatialHashingCollisionManager());
+  managers.push_back(new RadixSaPCollisionManager());
   managers.push_back(new DynamicAABBTreeCollisionManager());
   managers.push_back(new DynamicAABBTreeArrayCollisionManager());
 
@@ -281,9 +285,9 @@ void broad_phase_duplicate_check_test(FCL_REAL env_scale, std::size_t env_size,
     FCL_REAL rand_trans_z =
         2 * (rand() / (FCL_REAL)RAND_MAX - 0.5) * delta_trans_max;
 
-    Matrix3f dR(Eigen::AngleAxisd(rand_angle_x, Vec3f::UnitX()) *
-                Eigen::AngleAxisd(rand_angle_y, Vec3f::UnitY()) *
-                Eigen::AngleAxisd(rand_angle_z, Vec3f::UnitZ()));
+    Matrix3f dR(AngleAxis(rand_angle_x, Vec3f::UnitX()) *
+                AngleAxis(rand_angle_y, Vec3f::UnitY()) *
+                AngleAxis(rand_angle_z, Vec3f::UnitZ()));
     Vec3f dT(rand_trans_x, rand_trans_y, rand_trans_z);
 
     Matrix3f R = env[i]->getRotation();
@@ -402,6 +406,8 @@ void broad_phase_update_collision_test(FCL_REAL env_scale, std::size_t env_size,
           AABB, CollisionObject*, detail::SpatialHash, GoogleDenseHashTable>>(
           cell_size, lower_limit, upper_limit));
 #endif
+  managers.push_back(new HierarchicalSpatialHashingCollisionManager());
+  managers.push_back(new RadixSaPCollisionManager());
   managers.push_back(new DynamicAABBTreeCollisionManager());
   managers.push_back(new DynamicAABBTreeArrayCollisionManager());
 
@@ -453,9 +459,9 @@ void broad_phase_update_collision_test(FCL_REAL env_scale, std::size_t env_size,
     FCL_REAL rand_trans_z =
         2 * (rand() / (FCL_REAL)RAND_MAX - 0.5) * delta_trans_max;
 
-    Matrix3f dR(Eigen::AngleAxisd(rand_angle_x, Vec3f::UnitX()) *
-                Eigen::AngleAxisd(rand_angle_y, Vec3f::UnitY()) *
-                Eigen::AngleAxisd(rand_angle_z, Vec3f::UnitZ()));
+    Matrix3f dR(AngleAxis(rand_angle_x, Vec3f::UnitX()) *
+                AngleAxis(rand_angle_y, Vec3f::UnitY()) *
+                AngleAxis(rand_angle_z, Vec3f::UnitZ()));
     Vec3f dT(rand_trans_x, rand_trans_y, rand_trans_z);
 
     Matrix3f R = env[i]->getRotation();
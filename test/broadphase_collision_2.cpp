@@ -40,6 +40,8 @@
 
 #include "hpp/fcl/broadphase/broadphase_bruteforce.h"
 #include "hpp/fcl/broadphase/broadphase_spatialhash.h"
+#include "hpp/fcl/broadphase/broadphase_hierarchical_spatialhash.h"
+#include "hpp/fcl/broadphase/broadphase_radix_SaP.h"
 #include "hpp/fcl/broadphase/broadphase_SaP.h"
 #include "hpp/fcl/broadphase/broadphase_SSaP.h"
 #include "hpp/fcl/broadphase/broadphase_interval_tree.h"
@@ -56,8 +58,10 @@
 #include <hash_map>
 #endif
 
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
+#include <set>
 
 using namespace hpp::fcl;
 
@@ -182,6 +186,149 @@ BOOST_AUTO_TEST_CASE(test_core_mesh_bf_broad_phase_collision_mesh_exhaustive) {
 #endif
 }
 
+/// check the sweep axis of RadixSaPCollisionManager with an unbounded object
+BOOST_AUTO_TEST_CASE(test_radix_SaP_unbounded_object) {
+  // Boxes spread along the z axis, and a half-space with an infinite AABB.
+  shared_ptr<Box> box(new Box(1, 1, 1));
+  std::vector<CollisionObject*> env;
+  for (int i = 0; i < 20; ++i)
+    env.push_back(new CollisionObject(
+        box, Transform3f(Vec3f(0.1 * i, 0.2, 0.8 * i - 4))));
+  env.push_back(new CollisionObject(
+      shared_ptr<CollisionGeometry>(new Halfspace(Vec3f(0, 0, 1), 0))));
+  for (std::size_t i = 0; i < env.size(); ++i) env[i]->computeAABB();
+
+  RadixSaPCollisionManager manager;
+  manager.registerObjects(env);
+  manager.setup();
+  BOOST_CHECK_EQUAL(manager.getSweepAxis(), 2);
+
+  NaiveCollisionManager naive;
+  naive.registerObjects(env);
+  naive.setup();
+
+  CollisionCallBackCollect callback(0), naive_callback(0);
+  manager.collide(&callback);
+  naive.collide(&naive_callback);
+  BOOST_CHECK_EQUAL(callback.numCollisionPairs(),
+                    naive_callback.numCollisionPairs());
+  for (std::size_t i = 0; i < naive_callback.numCollisionPairs(); ++i) {
+    const CollisionCallBackCollect::CollisionPair& pair =
+        naive_callback.getCollisionPairs()[i];
+    BOOST_CHECK(callback.exist(pair) ||
+                callback.exist(std::make_pair(pair.second, pair.first)));
+  }
+
+  for (std::size_t i = 0; i < env.size(); ++i) delete env[i];
+}
+
+/// check that the managers reset the callback at each query
+BOOST_AUTO_TEST_CASE(test_core_broad_phase_callback_init) {
+  std::vector<CollisionObject*> env;
+  generateEnvironments(env, 200, 100);
+
+  std::vector<shared_ptr<BroadPhaseCollisionManager> > managers;
+  managers.push_back(make_shared<NaiveCollisionManager>());
+  managers.push_back(make_shared<SaPCollisionManager>());
+  managers.push_back(make_shared<SSaPCollisionManager>());
+  managers.push_back(make_shared<IntervalTreeCollisionManager>());
+  managers.push_back(make_shared<HierarchicalSpatialHashingCollisionManager>());
+  managers.push_back(make_shared<RadixSaPCollisionManager>());
+  managers.push_back(make_shared<DynamicAABBTreeCollisionManager>());
+  managers.push_back(make_shared<DynamicAABBTreeArrayCollisionManager>());
+  for (std::size_t m = 0; m < managers.size(); ++m) {
+    managers[m]->registerObjects(env);
+    managers[m]->setup();
+
+    CollisionCallBackCollect callback(0);
+    managers[m]->collide(&callback);
+    const std::size_t num_pairs = callback.numCollisionPairs();
+    BOOST_CHECK(num_pairs > 0);
+    managers[m]->collide(&callback);
+    BOOST_CHECK_EQUAL(callback.numCollisionPairs(), num_pairs);
+
+    managers[m]->collide(env[0], &callback);
+    const std::size_t num_obj_pairs = callback.numCollisionPairs();
+    managers[m]->collide(env[0], &callback);
+    BOOST_CHECK_EQUAL(callback.numCollisionPairs(), num_obj_pairs);
+  }
+
+  for (std::size_t i = 0; i < env.size(); ++i) delete env[i];
+}
+
+/// check the pairs collected by CollisionCallBackCollectColliding against all
+/// the pairs of objects
+BOOST_AUTO_TEST_CASE(test_core_broad_phase_collect_colliding) {
+  std::vector<CollisionObject*> env;
+  generateEnvironments(env, 200, 100);
+
+  std::set<std::pair<CollisionObject*, CollisionObject*> > expected;
+  for (std::size_t i = 0; i < env.size(); ++i)
+    for (std::size_t j = i + 1; j < env.size(); ++j) {
+      CollisionResult result;
+      if (collide(env[i], env[j], CollisionRequest(), result))
+        expected.insert(std::minmax(env[i], env[j]));
+    }
+  BOOST_CHECK(!expected.empty());
+
+  std::vector<shared_ptr<BroadPhaseCollisionManager> > managers;
+  managers.push_back(make_shared<NaiveCollisionManager>());
+  managers.push_back(make_shared<SaPCollisionManager>());
+  managers.push_back(make_shared<SSaPCollisionManager>());
+  managers.push_back(make_shared<IntervalTreeCollisionManager>());
+  managers.push_back(make_shared<HierarchicalSpatialHashingCollisionManager>());
+  managers.push_back(make_shared<RadixSaPCollisionManager>());
+  managers.push_back(make_shared<DynamicAABBTreeCollisionManager>());
+  managers.push_back(make_shared<DynamicAABBTreeArrayCollisionManager>());
+  for (std::size_t m = 0; m < managers.size(); ++m) {
+    managers[m]->registerObjects(env);
+    managers[m]->setup();
+
+    CollisionCallBackCollectColliding callback;
+    managers[m]->collide(&callback);
+    std::set<std::pair<CollisionObject*, CollisionObject*> > pairs;
+    for (std::size_t i = 0; i < callback.getCollisionPairs().size(); ++i) {
+      const CollisionCallBackCollectColliding::CollisionPair& pair =
+          callback.getCollisionPairs()[i];
+      pairs.insert(std::minmax(pair.first, pair.second));
+    }
+    BOOST_CHECK_EQUAL(pairs.size(), callback.getCollisionPairs().size());
+    BOOST_CHECK(pairs == expected);
+  }
+
+  // With the first half of the objects in the static tree, the pairs of
+  // static objects are skipped.
+  const std::size_t num_static = env.size() / 2;
+  std::set<CollisionObject*> static_objects(env.begin(),
+                                            env.begin() + num_static);
+  DynamicAABBTreeCollisionManager static_manager;
+  static_manager.registerStaticObjects(
+      std::vector<CollisionObject*>(env.begin(), env.begin() + num_static));
+  static_manager.registerObjects(
+      std::vector<CollisionObject*>(env.begin() + num_static, env.end()));
+  static_manager.setup();
+
+  CollisionCallBackCollectColliding callback;
+  static_manager.collide(&callback);
+  std::set<std::pair<CollisionObject*, CollisionObject*> > pairs,
+      expected_dynamic;
+  for (std::size_t i = 0; i < callback.getCollisionPairs().size(); ++i) {
+    const CollisionCallBackCollectColliding::CollisionPair& pair =
+        callback.getCollisionPairs()[i];
+    pairs.insert(std::minmax(pair.first, pair.second));
+  }
+  for (std::set<std::pair<CollisionObject*, CollisionObject*> >::const_iterator
+           it = expected.begin();
+       it != expected.end(); ++it)
+    if (!static_objects.count(it->first) || !static_objects.count(it->second))
+      expected_dynamic.insert(*it);
+  BOOST_CHECK(!expected_dynamic.empty());
+  BOOST_CHECK_EQUAL(pairs.size(), callback.getCollisionPairs().size());
+  BOOST_CHECK(pairs == expected_dynamic);
+
+  for (std::size_t i = 0; i < env.size(); ++i) delete env[i];
+}
+
 void broad_phase_collision_test(FCL_REAL env_scale, std::size_t env_size,
                                 std::size_t query_size,
                                 std::size_t num_max_contacts, bool exhaustive,
@@ -231,6 +378,8 @@ void broad_phase_collision_test(FCL_REAL env_scale, std::size_t env_size,
           AABB, CollisionObject*, detail::SpatialHash, GoogleDenseHashTable> >(
           cell_size, lower_limit, upper_limit));
 #endif
+  managers.push_back(new HierarchicalSpatialHashingCollisionManager());
+  managers.push_back(new RadixSaPCollisionManager());
   managers.push_back(new DynamicAABBTreeCollisionManager());
 
   managers.push_back(new DynamicAABBTreeArrayCollisionManager());
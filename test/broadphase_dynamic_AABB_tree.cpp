@@ -38,6 +38,7 @@
 
 #include <iostream>
 #include <memory>
+#include <set>
 
 #define BOOST_TEST_MODULE BROADPHASE_DYNAMIC_AABB_TREE
 #include <boost/test/included/unit_test.hpp>
@@ -45,6 +46,7 @@
 //#include "hpp/fcl/data_types.h"
 #include "hpp/fcl/shape/geometric_shapes.h"
 #include "hpp/fcl/broadphase/broadphase_dynamic_AABB_tree.h"
+#include "hpp/fcl/broadphase/broadphase_dynamic_AABB_tree_array.h"
 
 using namespace hpp::fcl;
 
@@ -101,8 +103,8 @@ BOOST_AUTO_TEST_CASE(DynamicAABBTreeCollisionManager_class) {
   CollisionGeometryPtr_t sphere1 = make_shared<Sphere>(0.2);
   CollisionObject object0(sphere0);
   CollisionObject object1(sphere1);
-  const Eigen::Vector3d position0(0.1, 0.2, 0.3);
-  const Eigen::Vector3d position1(0.11, 0.21, 0.31);
+  const Vec3f position0(0.1, 0.2, 0.3);
+  const Vec3f position1(0.11, 0.21, 0.31);
 
   // We will use `objects` to check the order of the two collision objects in
   // our callback function.
@@ -119,7 +121,7 @@ BOOST_AUTO_TEST_CASE(DynamicAABBTreeCollisionManager_class) {
   objects.push_back(&object0);
   objects.push_back(&object1);
 
-  std::vector<Eigen::Vector3d> positions;
+  std::vector<Vec3f> positions;
   positions.push_back(position0);
   positions.push_back(position1);
 
@@ -141,3 +143,200 @@ BOOST_AUTO_TEST_CASE(DynamicAABBTreeCollisionManager_class) {
     dynamic_tree.distance(&callback);
   }
 }
+
+// Records the pairs of objects reported by the broadphase.
+struct CollisionCallBackPairs : CollisionCallBackBase {
+  bool collide(CollisionObject* o1, CollisionObject* o2) {
+    if (o2 < o1) std::swap(o1, o2);
+    pairs.insert(std::make_pair(o1, o2));
+    return false;
+  }
+
+  std::set<std::pair<CollisionObject*, CollisionObject*> > pairs;
+};
+
+// Tests that the static objects are stored apart and that the pairs of static
+// objects are skipped by the self collision query.
+BOOST_AUTO_TEST_CASE(DynamicAABBTreeCollisionManager_static_objects) {
+  CollisionGeometryPtr_t box = make_shared<Box>(1.5, 1.5, 1.5);
+  CollisionGeometryPtr_t sphere = make_shared<Sphere>(0.6);
+
+  std::vector<CollisionObject*> static_objects, dynamic_objects;
+  for (int i = 0; i < 10; ++i)
+    for (int j = 0; j < 10; ++j) {
+      CollisionObject* obj = new CollisionObject(box);
+      obj->setTranslation(Vec3f(i, j, 0));
+      obj->computeAABB();
+      static_objects.push_back(obj);
+    }
+  for (int i = 0; i < 5; ++i) {
+    CollisionObject* obj = new CollisionObject(sphere);
+    obj->setTranslation(Vec3f(2 * i, 0.5, 1));
+    obj->computeAABB();
+    dynamic_objects.push_back(obj);
+  }
+
+  DynamicAABBTreeCollisionManager manager;
+  manager.registerStaticObjects(static_objects);
+  manager.registerObjects(dynamic_objects);
+  manager.setup();
+
+  BOOST_CHECK_EQUAL(manager.size(),
+                    static_objects.size() + dynamic_objects.size());
+  BOOST_CHECK_EQUAL(manager.getStaticTree().size(), static_objects.size());
+  BOOST_CHECK_EQUAL(manager.getTree().size(), dynamic_objects.size());
+  BOOST_CHECK(manager.isStatic(static_objects[0]));
+  BOOST_CHECK(!manager.isStatic(dynamic_objects[0]));
+
+  for (int step = 0; step < 3; ++step) {
+    for (size_t i = 0; i < dynamic_objects.size(); ++i) {
+      CollisionObject* obj = dynamic_objects[i];
+      obj->setTranslation(obj->getTranslation() + Vec3f(0.5, 1., 0.));
+      obj->computeAABB();
+    }
+    manager.update();
+
+    CollisionCallBackPairs callback;
+    manager.collide(&callback);
+
+    // Expected pairs: the overlapping pairs with at least one dynamic object.
+    std::set<std::pair<CollisionObject*, CollisionObject*> > expected;
+    for (size_t i = 0; i < dynamic_objects.size(); ++i) {
+      CollisionObject* o1 = dynamic_objects[i];
+      for (size_t j = 0; j < static_objects.size(); ++j) {
+        CollisionObject* o2 = static_objects[j];
+        if (o1->getAABB().overlap(o2->getAABB()))
+          expected.insert(
+              std::make_pair((std::min)(o1, o2), (std::max)(o1, o2)));
+      }
+      for (size_t j = i + 1; j < dynamic_objects.size(); ++j) {
+        CollisionObject* o2 = dynamic_objects[j];
+        if (o1->getAABB().overlap(o2->getAABB()))
+          expected.insert(
+              std::make_pair((std::min)(o1, o2), (std::max)(o1, o2)));
+      }
+    }
+    BOOST_CHECK(!expected.empty());
+    BOOST_CHECK(callback.pairs == expected);
+  }
+
+  manager.unregisterObject(static_objects[0]);
+  BOOST_CHECK_EQUAL(manager.getStaticTree().size(), static_objects.size() - 1);
+  BOOST_CHECK(!manager.isStatic(static_objects[0]));
+
+  manager.clear();
+  for (size_t i = 0; i < static_objects.size(); ++i) delete static_objects[i];
+  for (size_t i = 0; i < dynamic_objects.size(); ++i)
+    delete dynamic_objects[i];
+}
+
+// Tests that an object cannot be registered both as static and as dynamic.
+BOOST_AUTO_TEST_CASE(DynamicAABBTreeCollisionManager_static_and_dynamic) {
+  CollisionGeometryPtr_t box = make_shared<Box>(1, 1, 1);
+  CollisionObject static_obj(box), dynamic_obj(box), other_obj(box);
+  static_obj.computeAABB();
+  dynamic_obj.computeAABB();
+  other_obj.computeAABB();
+  std::vector<CollisionObject*> objects(1, &other_obj);
+
+  DynamicAABBTreeCollisionManager manager;
+  manager.registerStaticObject(&static_obj);
+  manager.registerObject(&dynamic_obj);
+
+  BOOST_CHECK_THROW(manager.registerObject(&static_obj),
+                    std::invalid_argument);
+  BOOST_CHECK_THROW(manager.registerStaticObject(&dynamic_obj),
+                    std::invalid_argument);
+  objects.push_back(&dynamic_obj);
+  BOOST_CHECK_THROW(manager.registerStaticObjects(objects),
+                    std::invalid_argument);
+  objects.back() = &static_obj;
+  BOOST_CHECK_THROW(manager.registerObjects(objects), std::invalid_argument);
+  BOOST_CHECK_EQUAL(manager.size(), 2);
+
+  // The bulk registration into an empty tree checks the objects as well.
+  DynamicAABBTreeCollisionManager other_manager;
+  other_manager.registerStaticObject(&static_obj);
+  BOOST_CHECK_THROW(other_manager.registerObjects(objects),
+                    std::invalid_argument);
+  BOOST_CHECK_EQUAL(other_manager.size(), 1);
+
+  manager.setup();
+  CollisionCallBackPairs callback;
+  manager.collide(&callback);
+  BOOST_CHECK_EQUAL(callback.pairs.size(), 1);
+
+  manager.clear();
+  other_manager.clear();
+}
+
+// Tests that, with fat AABBs, small motions leave the tree untouched while
+// the reported pairs stay those of the exact AABBs.
+template <typename Manager>
+void test_fat_aabbs() {
+  CollisionGeometryPtr_t sphere = make_shared<Sphere>(0.4);
+
+  std::vector<CollisionObject*> objects;
+  for (int i = 0; i < 20; ++i) {
+    CollisionObject* obj = new CollisionObject(sphere);
+    obj->setTranslation(Vec3f(i, 0, 0));
+    obj->computeAABB();
+    objects.push_back(obj);
+  }
+
+  Manager manager;
+  manager.fat_aabb_margin = 0.2;
+  manager.registerObjects(objects);
+  manager.setup();
+
+  const Vec3f step(0.15, 0, 0);
+  manager.setVelocity(objects[0], step);
+  for (int k = 0; k < 4; ++k) {
+    // Objects 0 and 1 get closer at every step.
+    objects[0]->setTranslation(objects[0]->getTranslation() + step);
+    objects[0]->computeAABB();
+    manager.update();
+
+    CollisionCallBackPairs callback;
+    manager.collide(&callback);
+    // The exact AABBs of the spheres overlap from the second step.
+    BOOST_CHECK_EQUAL(callback.pairs.size(), k == 0 ? 0u : 1u);
+  }
+
+  manager.clear();
+  for (size_t i = 0; i < objects.size(); ++i) delete objects[i];
+}
+
+BOOST_AUTO_TEST_CASE(DynamicAABBTreeCollisionManager_fat_aabbs) {
+  test_fat_aabbs<DynamicAABBTreeCollisionManager>();
+  test_fat_aabbs<DynamicAABBTreeArrayCollisionManager>();
+
+  CollisionGeometryPtr_t sphere = make_shared<Sphere>(0.5);
+  CollisionObject object(sphere);
+  object.computeAABB();
+
+  DynamicAABBTreeCollisionManager manager;
+  manager.fat_aabb_margin = 0.1;
+  manager.registerObject(&object);
+  manager.setup();
+
+  // A motion which leaves the exact AABB reinserts the object with a fat AABB,
+  // extended along the velocity.
+  manager.setVelocity(&object, Vec3f(1, 0, 0));
+  object.setTranslation(Vec3f(0.05, 0, 0));
+  object.computeAABB();
+  manager.update();
+  const AABB fat_aabb = manager.getTree().getRoot()->bv;
+  // Tolerance in percent, at the precision of FCL_REAL.
+  const FCL_REAL tol = (std::max)(FCL_REAL(1e-8),
+                                  1000 * Eigen::NumTraits<FCL_REAL>::epsilon());
+  BOOST_CHECK(fat_aabb.contain(object.getAABB()));
+  BOOST_CHECK_CLOSE(fat_aabb.max_[0], object.getAABB().max_[0] + 1.1, tol);
+  BOOST_CHECK_CLOSE(fat_aabb.min_[0], object.getAABB().min_[0] - 0.1, tol);
+
+  // A motion inside the fat AABB does not change the tree.
+  object.setTranslation(Vec3f(0.5, 0, 0));
+  object.computeAABB();
+  manager.update();
+  BOOST_CHECK(manager.getTree().getRoot()->bv == fat_aabb);
+}
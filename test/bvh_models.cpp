@@ -276,11 +276,77 @@ void testBVHModelSubModel() {
   BOOST_CHECK_EQUAL(model->build_state, BVH_BUILD_STATE_PROCESSED);
 }
 
+template <typename BV>
+void testBVHModelStorage() {
+  BVHModel<BV> reference;
+  generateBVHModel(reference, Box(1, 1, 1), Transform3f());
+  std::vector<Vec3f> points(reference.vertices,
+                            reference.vertices + reference.num_vertices);
+  std::vector<Triangle> tri_indices(reference.tri_indices,
+                                    reference.tri_indices + reference.num_tris);
+
+  {
+    // The model uses the storage of the caller.
+    BVHModel<BV> model;
+    int result = model.buildModel(false, points.data(),
+                                  (unsigned int)points.size(),
+                                  tri_indices.data(),
+                                  (unsigned int)tri_indices.size());
+    BOOST_CHECK_EQUAL(result, BVH_OK);
+    BOOST_CHECK(!model.ownStorage());
+    BOOST_CHECK(model.vertices == points.data());
+    BOOST_CHECK(model.tri_indices == tri_indices.data());
+    BOOST_CHECK_EQUAL(model.build_state, BVH_BUILD_STATE_PROCESSED);
+    BOOST_CHECK_EQUAL(model.getNumBVs(), reference.getNumBVs());
+    model.computeLocalAABB();
+    BOOST_CHECK(model == reference);
+
+    // Updates keep the storage of the caller.
+    BOOST_CHECK_EQUAL(model.beginUpdateModel(), BVH_OK);
+    for (std::size_t i = 0; i < points.size(); ++i)
+      model.updateVertex(points[i] + Vec3f(1, 0, 0));
+    BOOST_CHECK_EQUAL(model.endUpdateModel(), BVH_OK);
+    BOOST_CHECK(model.vertices == points.data());
+    BOOST_CHECK(model.prev_vertices[0] == reference.vertices[0]);
+    BOOST_CHECK(points[0] == reference.vertices[0] + Vec3f(1, 0, 0));
+
+    // A copy owns its storage.
+    BVHModel<BV> copy(model);
+    BOOST_CHECK(copy.ownStorage());
+    BOOST_CHECK(copy.vertices != points.data());
+
+    // Clearing the model does not release the storage of the caller.
+    model.beginModel();
+    BOOST_CHECK(model.ownStorage());
+    BOOST_CHECK(model.vertices != points.data());
+  }
+  BOOST_CHECK(points[0] == reference.vertices[0] + Vec3f(1, 0, 0));
+
+  // The model takes the ownership of the storage.
+  Vec3f* vertices = new Vec3f[8];
+  std::copy(reference.vertices, reference.vertices + 8, vertices);
+  BVHModel<BV> model;
+  BOOST_CHECK_EQUAL(model.buildModel(true, vertices, 8, NULL, 0), BVH_OK);
+  BOOST_CHECK(model.ownStorage());
+  BOOST_CHECK_EQUAL(model.getModelType(), BVH_MODEL_POINTCLOUD);
+
+  // Invalid models.
+  BOOST_CHECK_EQUAL(model.buildModel(false, points.data(), 0, NULL, 0),
+                    BVH_ERR_BUILD_EMPTY_MODEL);
+  tri_indices[3].set(0, 1, 8);
+  BOOST_CHECK_EQUAL(model.buildModel(false, points.data(), 8,
+                                     tri_indices.data(),
+                                     (unsigned int)tri_indices.size()),
+                    BVH_ERR_INCORRECT_DATA);
+  BOOST_CHECK(model.vertices == vertices);
+}
+
 template <typename BV>
 void testBVHModel() {
   testBVHModelTriangles<BV>();
   testBVHModelPointCloud<BV>();
   testBVHModelSubModel<BV>();
+  testBVHModelStorage<BV>();
 }
 
 BOOST_AUTO_TEST_CASE(building_bvh_models) {
@@ -53,8 +53,15 @@
 
 using namespace hpp::fcl;
 
+typedef Eigen::Matrix<FCL_REAL, 4, 1> Vec4f;
+
+// Tolerance of BOOST_CHECK_CLOSE, in percent. The distances are differences of
+// translations of magnitude 20, which are rounded at the precision of FCL_REAL.
+static const FCL_REAL tol =
+    (std::max)(FCL_REAL(1e-6), 10000 * Eigen::NumTraits<FCL_REAL>::epsilon());
+
 BOOST_AUTO_TEST_CASE(collision_capsule_capsule_trivial) {
-  const double radius = 1.;
+  const FCL_REAL radius = 1;
 
   CollisionGeometryPtr_t c1(new Capsule(radius, 0.));
   CollisionGeometryPtr_t c2(new Capsule(radius, 0.));
@@ -72,14 +79,14 @@ BOOST_AUTO_TEST_CASE(collision_capsule_capsule_trivial) {
   Transform3f tf2;
 
   for (int i = 0; i < num_tests; ++i) {
-    Eigen::Vector3d p1 = Eigen::Vector3d::Random() * (2. * radius);
-    Eigen::Vector3d p2 = Eigen::Vector3d::Random() * (2. * radius);
+    Vec3f p1 = Vec3f::Random() * (2 * radius);
+    Vec3f p2 = Vec3f::Random() * (2 * radius);
 
-    Eigen::Matrix3d rot1 =
-        Eigen::Quaterniond(Eigen::Vector4d::Random().normalized())
+    Matrix3f rot1 =
+        Quaternion3f(Vec4f::Random().normalized())
             .toRotationMatrix();
-    Eigen::Matrix3d rot2 =
-        Eigen::Quaterniond(Eigen::Vector4d::Random().normalized())
+    Matrix3f rot2 =
+        Quaternion3f(Vec4f::Random().normalized())
             .toRotationMatrix();
 
     tf1.setTranslation(p1);
@@ -105,13 +112,13 @@ BOOST_AUTO_TEST_CASE(collision_capsule_capsule_trivial) {
     BOOST_CHECK_EQUAL(sphere_num_collisions, capsule_num_collisions);
     if (sphere_num_collisions == 0 && capsule_num_collisions == 0)
       BOOST_CHECK_CLOSE(sphere_collisionResult.distance_lower_bound,
-                        capsule_collisionResult.distance_lower_bound, 1e-6);
+                        capsule_collisionResult.distance_lower_bound, tol);
   }
 }
 
 BOOST_AUTO_TEST_CASE(collision_capsule_capsule_aligned) {
-  const double radius = 0.01;
-  const double length = 0.2;
+  const FCL_REAL radius = FCL_REAL(0.01);
+  const FCL_REAL length = FCL_REAL(0.2);
 
   CollisionGeometryPtr_t c1(new Capsule(radius, length));
   CollisionGeometryPtr_t c2(new Capsule(radius, length));
@@ -124,15 +131,14 @@ BOOST_AUTO_TEST_CASE(collision_capsule_capsule_aligned) {
   Transform3f tf1;
   Transform3f tf2;
 
-  Eigen::Vector3d p1 = Eigen::Vector3d::Zero();
-  Eigen::Vector3d p2_no_collision =
-      Eigen::Vector3d(0., 0.,
-                      2 * (length / 2. + radius) +
-                          1e-3);  // because capsule are along the Z axis
+  Vec3f p1 = Vec3f::Zero();
+  // because capsule are along the Z axis
+  Vec3f p2_no_collision =
+      Vec3f(0., 0., 2 * (length / 2 + radius) + FCL_REAL(1e-3));
 
   for (int i = 0; i < num_tests; ++i) {
-    Eigen::Matrix3d rot =
-        Eigen::Quaterniond(Eigen::Vector4d::Random().normalized())
+    Matrix3f rot =
+        Quaternion3f(Vec4f::Random().normalized())
             .toRotationMatrix();
 
     tf1.setTranslation(p1);
@@ -153,11 +159,11 @@ BOOST_AUTO_TEST_CASE(collision_capsule_capsule_aligned) {
     BOOST_CHECK(capsule_num_collisions == 0);
   }
 
-  Eigen::Vector3d p2_with_collision =
-      Eigen::Vector3d(0., 0., std::min(length / 2., radius) * (1. - 1e-2));
+  Vec3f p2_with_collision =
+      Vec3f(0., 0., std::min(length / 2, radius) * FCL_REAL(1. - 1e-2));
   for (int i = 0; i < num_tests; ++i) {
-    Eigen::Matrix3d rot =
-        Eigen::Quaterniond(Eigen::Vector4d::Random().normalized())
+    Matrix3f rot =
+        Quaternion3f(Vec4f::Random().normalized())
             .toRotationMatrix();
 
     tf1.setTranslation(p1);
@@ -178,17 +184,17 @@ BOOST_AUTO_TEST_CASE(collision_capsule_capsule_aligned) {
     BOOST_CHECK(capsule_num_collisions > 0);
   }
 
-  p2_no_collision = Eigen::Vector3d(0., 0., 2 * (length / 2. + radius) + 1e-3);
+  p2_no_collision =
+      Vec3f(0., 0., 2 * (length / 2 + radius) + FCL_REAL(1e-3));
 
-  Transform3f geom1_placement(Eigen::Matrix3d::Identity(),
-                              Eigen::Vector3d::Zero());
-  Transform3f geom2_placement(Eigen::Matrix3d::Identity(), p2_no_collision);
+  Transform3f geom1_placement(Matrix3f::Identity(), Vec3f::Zero());
+  Transform3f geom2_placement(Matrix3f::Identity(), p2_no_collision);
 
   for (int i = 0; i < num_tests; ++i) {
-    Eigen::Matrix3d rot =
-        Eigen::Quaterniond(Eigen::Vector4d::Random().normalized())
+    Matrix3f rot =
+        Quaternion3f(Vec4f::Random().normalized())
             .toRotationMatrix();
-    Eigen::Vector3d trans = Eigen::Vector3d::Random();
+    Vec3f trans = Vec3f::Random();
 
     Transform3f displacement(rot, trans);
     Transform3f tf1 = displacement * geom1_placement;
@@ -208,15 +214,15 @@ BOOST_AUTO_TEST_CASE(collision_capsule_capsule_aligned) {
   }
 
   //  p2_with_collision =
-  //  Eigen::Vector3d(0.,0.,std::min(length/2.,radius)*(1.-1e-2));
-  p2_with_collision = Eigen::Vector3d(0., 0., 0.01);
+  //  Vec3f(0.,0.,std::min(length/2.,radius)*(1.-1e-2));
+  p2_with_collision = Vec3f(0., 0., FCL_REAL(0.01));
   geom2_placement.setTranslation(p2_with_collision);
 
   for (int i = 0; i < num_tests; ++i) {
-    Eigen::Matrix3d rot =
-        Eigen::Quaterniond(Eigen::Vector4d::Random().normalized())
+    Matrix3f rot =
+        Quaternion3f(Vec4f::Random().normalized())
             .toRotationMatrix();
-    Eigen::Vector3d trans = Eigen::Vector3d::Random();
+    Vec3f trans = Vec3f::Random();
 
     Transform3f displacement(rot, trans);
     Transform3f tf1 = displacement * geom1_placement;
@@ -241,7 +247,7 @@ BOOST_AUTO_TEST_CASE(distance_capsulecapsule_origin) {
   CollisionGeometryPtr_t s2(new Capsule(5, 10));
 
   Transform3f tf1;
-  Transform3f tf2(Vec3f(20.1, 0, 0));
+  Transform3f tf2(Vec3f(FCL_REAL(20.1), 0, 0));
 
   CollisionObject o1(s1, tf1);
   CollisionObject o2(s2, tf2);
@@ -259,7 +265,7 @@ BOOST_AUTO_TEST_CASE(distance_capsulecapsule_origin) {
             << ", p2 = " << distanceResult.nearest_points[1]
             << ", distance = " << distanceResult.min_distance << std::endl;
 
-  BOOST_CHECK_CLOSE(distanceResult.min_distance, 10.1, 1e-6);
+  BOOST_CHECK_CLOSE(distanceResult.min_distance, FCL_REAL(10.1), tol);
 }
 
 BOOST_AUTO_TEST_CASE(distance_capsulecapsule_transformXY) {
@@ -285,8 +291,8 @@ BOOST_AUTO_TEST_CASE(distance_capsulecapsule_transformXY) {
             << ", p2 = " << distanceResult.nearest_points[1]
             << ", distance = " << distanceResult.min_distance << std::endl;
 
-  FCL_REAL expected = sqrt(800) - 10;
-  BOOST_CHECK_CLOSE(distanceResult.min_distance, expected, 1e-6);
+  FCL_REAL expected = std::sqrt(FCL_REAL(800)) - 10;
+  BOOST_CHECK_CLOSE(distanceResult.min_distance, expected, tol);
 }
 
 BOOST_AUTO_TEST_CASE(distance_capsulecapsule_transformZ) {
@@ -294,7 +300,7 @@ BOOST_AUTO_TEST_CASE(distance_capsulecapsule_transformZ) {
   CollisionGeometryPtr_t s2(new Capsule(5, 10));
 
   Transform3f tf1;
-  Transform3f tf2(Vec3f(0, 0, 20.1));
+  Transform3f tf2(Vec3f(0, 0, FCL_REAL(20.1)));
 
   CollisionObject o1(s1, tf1);
   CollisionObject o2(s2, tf2);
@@ -312,7 +318,7 @@ BOOST_AUTO_TEST_CASE(distance_capsulecapsule_transformZ) {
             << ", p2 = " << distanceResult.nearest_points[1]
             << ", distance = " << distanceResult.min_distance << std::endl;
 
-  BOOST_CHECK_CLOSE(distanceResult.min_distance, 0.1, 1e-6);
+  BOOST_CHECK_CLOSE(distanceResult.min_distance, FCL_REAL(0.1), tol);
 }
 
 BOOST_AUTO_TEST_CASE(distance_capsulecapsule_transformZ2) {
@@ -320,7 +326,8 @@ BOOST_AUTO_TEST_CASE(distance_capsulecapsule_transformZ2) {
   CollisionGeometryPtr_t s2(new Capsule(5, 10));
 
   Transform3f tf1;
-  Transform3f tf2(makeQuat(sqrt(2) / 2, 0, sqrt(2) / 2, 0), Vec3f(0, 0, 25.1));
+  const FCL_REAL c = std::sqrt(FCL_REAL(2)) / 2;
+  Transform3f tf2(makeQuat(c, 0, c, 0), Vec3f(0, 0, FCL_REAL(25.1)));
 
   CollisionObject o1(s1, tf1);
   CollisionObject o2(s2, tf2);
@@ -346,7 +353,7 @@ BOOST_AUTO_TEST_CASE(distance_capsulecapsule_transformZ2) {
   const Vec3f& p1 = distanceResult.nearest_points[0];
   const Vec3f& p2 = distanceResult.nearest_points[1];
 
-  BOOST_CHECK_CLOSE(distanceResult.min_distance, 10.1, 1e-6);
+  BOOST_CHECK_CLOSE(distanceResult.min_distance, FCL_REAL(10.1), tol);
   CHECK_CLOSE_TO_0(p1[0], 1e-4);
   CHECK_CLOSE_TO_0(p1[1], 1e-4);
   BOOST_CHECK_CLOSE(p1[2], 10, 1e-4);
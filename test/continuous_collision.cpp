@@ -0,0 +1,221 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define BOOST_TEST_MODULE FCL_CONTINUOUS_COLLISION
+#include <boost/test/included/unit_test.hpp>
+
+#include <hpp/fcl/continuous_collision.h>
+#include <hpp/fcl/collision.h>
+#include <hpp/fcl/distance.h>
+#include <hpp/fcl/shape/geometric_shapes.h>
+#include <hpp/fcl/shape/geometric_shape_to_BVH_model.h>
+
+#include "utility.h"
+
+using namespace hpp::fcl;
+
+// The poses are only exact up to the rounding errors of FCL_REAL.
+static const FCL_REAL prec =
+    (std::max)(FCL_REAL(1e-8), 100 * Eigen::NumTraits<FCL_REAL>::epsilon());
+
+bool isApprox(const Transform3f& tf1, const Transform3f& tf2, FCL_REAL prec) {
+  return tf1.getRotation().isApprox(tf2.getRotation(), prec) &&
+         tf1.getTranslation().isApprox(tf2.getTranslation(), prec);
+}
+
+BOOST_AUTO_TEST_CASE(motion_interpolation) {
+  FCL_REAL extents[] = {-1, -1, -1, 1, 1, 1};
+  Transform3f tf_beg, tf_end;
+  generateRandomTransform(extents, tf_beg);
+  generateRandomTransform(extents, tf_end);
+
+  for (int type = CCDM_LINEAR; type <= CCDM_SCREW; ++type) {
+    const Motion motion(tf_beg, tf_end, (CCDMotionType)type);
+    BOOST_CHECK(isApprox(motion.getTransform(0), tf_beg, prec));
+    BOOST_CHECK(isApprox(motion.getTransform(1), tf_end, prec));
+  }
+
+  // A screw motion has a constant twist: its two halves are the same relative
+  // motion.
+  const Motion screw(tf_beg, tf_end, CCDM_SCREW);
+  const Transform3f half(tf_beg.inverseTimes(screw.getTransform(0.5)));
+  BOOST_CHECK(isApprox(screw.getTransform(0.5) * half, tf_end, prec));
+}
+
+BOOST_AUTO_TEST_CASE(sphere_sphere_time_of_contact) {
+  CollisionObject o1(shared_ptr<CollisionGeometry>(new Sphere(0.5)));
+  CollisionObject o2(shared_ptr<CollisionGeometry>(new Sphere(0.5)),
+                     Transform3f(Vec3f(3, 0, 0)));
+
+  // The centers are at distance 1 when t = 1 / 3.
+  ContinuousCollisionRequest request;
+  ContinuousCollisionResult result;
+  FCL_REAL toc = continuousCollide(&o1, Transform3f(), &o2,
+                                   Transform3f(Vec3f(-3, 0, 0)), request,
+                                   result);
+  BOOST_CHECK(result.is_collide);
+  BOOST_CHECK(toc == result.time_of_contact);
+  BOOST_CHECK(toc <= FCL_REAL(1) / 3 + prec);
+  BOOST_CHECK(toc >= FCL_REAL(1) / 3 - request.toc_err / 6 - prec);
+  BOOST_CHECK(result.normal.isApprox(Vec3f(1, 0, 0), 1e-6));
+  BOOST_CHECK(result.contact_point.isApprox(Vec3f(0.5, 0, 0), 1e-3));
+  BOOST_CHECK(result.contact_tf2.getTranslation().isApprox(
+      Vec3f(3 - 6 * toc, 0, 0), prec));
+
+  // Passing by.
+  o2.setTransform(Transform3f(Vec3f(3, 1.1, 0)));
+  toc = continuousCollide(&o1, Transform3f(), &o2,
+                          Transform3f(Vec3f(-3, 1.1, 0)), request, result);
+  BOOST_CHECK(!result.is_collide);
+  BOOST_CHECK(toc == 1);
+
+  // In collision at the beginning.
+  o2.setTransform(Transform3f(Vec3f(0.5, 0, 0)));
+  toc = continuousCollide(&o1, Transform3f(), &o2, Transform3f(Vec3f(3, 0, 0)),
+                          request, result);
+  BOOST_CHECK(result.is_collide);
+  BOOST_CHECK(toc == 0);
+
+  // The local AABB of bare geometries is not computed.
+  Sphere sphere(0.5);
+  BOOST_CHECK_THROW(continuousCollide(&sphere, Transform3f(), Transform3f(),
+                                      &sphere, Transform3f(), Transform3f(),
+                                      request, result),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(rotating_box_time_of_contact) {
+  Box box(2, 0.1, 0.1);
+  Capsule capsule(0.1, 1);
+  box.computeLocalAABB();
+  capsule.computeLocalAABB();
+
+  // The box rotates about an axis which does not go through its center.
+  Transform3f box_beg(Vec3f(0.2, 0, 0)), box_end;
+  box_end.setQuatRotation(
+      makeQuat(std::cos(3 * M_PI / 8), 0, 0, std::sin(3 * M_PI / 8)));
+  box_end.setTranslation(Vec3f(0, 0.2, 0.1));
+  const Transform3f capsule_tf(Vec3f(-0.3, 0.9, 0));
+
+  for (int type = CCDM_LINEAR; type <= CCDM_SCREW; ++type) {
+    ContinuousCollisionRequest request(100, 1e-6, (CCDMotionType)type);
+    ContinuousCollisionResult result;
+    const FCL_REAL toc =
+        continuousCollide(&box, box_beg, box_end, &capsule, capsule_tf,
+                          capsule_tf, request, result);
+    BOOST_REQUIRE(result.is_collide);
+    BOOST_CHECK(result.num_iterations < request.num_max_iterations);
+
+    // The objects are separated before the time of contact and in contact
+    // right after it.
+    const Motion motion(box_beg, box_end, request.ccd_motion_type);
+    DistanceRequest drequest;
+    DistanceResult dresult;
+    for (int i = 0; i < 100; ++i) {
+      const FCL_REAL t = toc * i / 100;
+      dresult.clear();
+      BOOST_CHECK(distance(&box, motion.getTransform(t), &capsule, capsule_tf,
+                           drequest, dresult) > 0);
+    }
+    dresult.clear();
+    BOOST_CHECK_SMALL(distance(&box, motion.getTransform(toc), &capsule,
+                               capsule_tf, drequest, dresult),
+                      request.toc_err);
+    BOOST_CHECK(isApprox(result.contact_tf1, motion.getTransform(toc), 1e-8));
+  }
+}
+
+template <typename BV>
+void checkMeshTimeOfContact() {
+  Box box(2, 0.1, 0.1), plate(0.01, 1, 1);
+  Capsule capsule(0.1, 1);
+  box.computeLocalAABB();
+  plate.computeLocalAABB();
+  capsule.computeLocalAABB();
+  BVHModel<BV> box_mesh, plate_mesh;
+  generateBVHModel(box_mesh, box, Transform3f());
+  generateBVHModel(plate_mesh, plate, Transform3f());
+
+  Transform3f box_beg(Vec3f(0.2, 0, 0)), box_end;
+  box_end.setQuatRotation(
+      makeQuat(std::cos(3 * M_PI / 8), 0, 0, std::sin(3 * M_PI / 8)));
+  box_end.setTranslation(Vec3f(0, 0.2, 0.1));
+  const Transform3f capsule_tf(Vec3f(-0.3, 0.9, 0));
+
+  for (int type = CCDM_LINEAR; type <= CCDM_SCREW; ++type) {
+    ContinuousCollisionRequest request(1000, 1e-4, (CCDMotionType)type);
+    ContinuousCollisionResult expected, result;
+    const FCL_REAL expected_toc =
+        continuousCollide(&box, box_beg, box_end, &capsule, capsule_tf,
+                          capsule_tf, request, expected);
+    BOOST_REQUIRE(expected.is_collide);
+
+    // Mesh and shape, in both orders.
+    FCL_REAL toc = continuousCollide(&box_mesh, box_beg, box_end, &capsule,
+                                     capsule_tf, capsule_tf, request, result);
+    BOOST_CHECK(result.is_collide);
+    BOOST_CHECK_SMALL(toc - expected_toc, FCL_REAL(1e-3));
+    BOOST_CHECK(result.normal.isApprox(expected.normal, 1e-2));
+
+    toc = continuousCollide(&capsule, capsule_tf, capsule_tf, &box_mesh,
+                            box_beg, box_end, request, result);
+    BOOST_CHECK(result.is_collide);
+    BOOST_CHECK_SMALL(toc - expected_toc, FCL_REAL(1e-3));
+    BOOST_CHECK(result.normal.isApprox(-expected.normal, 1e-2));
+    BOOST_CHECK(isApprox(result.contact_tf2, expected.contact_tf1, 1e-3));
+
+    // Two meshes: the box crosses the thin plate between the two poses.
+    const Transform3f plate_tf(Vec3f(0.6, 0.6, 0));
+    DistanceRequest drequest;
+    DistanceResult dresult;
+    BOOST_CHECK(distance(&box, box_beg, &plate, plate_tf, drequest, dresult) >
+                0);
+    dresult.clear();
+    BOOST_CHECK(distance(&box, box_end, &plate, plate_tf, drequest, dresult) >
+                0);
+    toc = continuousCollide(&box, box_beg, box_end, &plate, plate_tf, plate_tf,
+                            request, expected);
+    BOOST_REQUIRE(expected.is_collide);
+    toc = continuousCollide(&box_mesh, box_beg, box_end, &plate_mesh, plate_tf,
+                            plate_tf, request, result);
+    BOOST_CHECK(result.is_collide);
+    BOOST_CHECK_SMALL(toc - expected.time_of_contact, FCL_REAL(1e-3));
+    BOOST_CHECK(result.num_iterations < request.num_max_iterations);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(mesh_time_of_contact) {
+  checkMeshTimeOfContact<RSS>();
+  checkMeshTimeOfContact<OBBRSS>();
+}
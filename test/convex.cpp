@@ -177,7 +177,10 @@ void compareShapeDistance(const Sa& sa, const Sb& sb, const Transform3f& tf1,
 
 BOOST_AUTO_TEST_CASE(compare_convex_box) {
   FCL_REAL extents[6] = {0, 0, 0, 10, 10, 10};
-  FCL_REAL l = 1, w = 1, d = 1, eps = 1e-4;
+  FCL_REAL l = 1, w = 1, d = 1;
+  // Tolerance of BOOST_CHECK_CLOSE, in percent. GJK converges up to
+  // GJK_DEFAULT_TOLERANCE, relatively to the distance.
+  FCL_REAL eps = (std::max)(FCL_REAL(1e-4), 100 * GJK_DEFAULT_TOLERANCE);
   Box box(l * 2, w * 2, d * 2);
   Convex<Quadrilateral> convex_box(buildBox(l, w, d));
 
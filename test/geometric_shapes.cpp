@@ -43,14 +43,23 @@
 #include <hpp/fcl/distance.h>
 #include "utility.h"
 #include <iostream>
+#include <thread>
 #include <hpp/fcl/internal/tools.h>
 #include <hpp/fcl/shape/geometric_shape_to_BVH_model.h>
+#include <hpp/fcl/shape/geometric_shapes_utility.h>
 
 using namespace hpp::fcl;
 
 FCL_REAL extents[6] = {0, 0, 0, 10, 10, 10};
 
 FCL_REAL tol_gjk = 0.01;
+
+/// Returns tol in double precision, grown to the rounding errors on the
+/// coordinates of the tests in single precision.
+FCL_REAL tolerance(double tol) {
+  return (std::max)(FCL_REAL(tol),
+                    1000 * Eigen::NumTraits<FCL_REAL>::epsilon());
+}
 GJKSolver solver1;
 GJKSolver solver2;
 
@@ -168,7 +177,7 @@ void testShapeIntersection(const S1& s1, const Transform3f& tf1, const S2& s2,
                            FCL_REAL* expected_depth = NULL,
                            Vec3f* expected_normal = NULL,
                            bool check_opposite_normal = false,
-                           FCL_REAL tol = 1e-9) {
+                           FCL_REAL tol = tolerance(1e-9)) {
   CollisionRequest request;
   CollisionResult result;
 
@@ -234,6 +243,32 @@ BOOST_AUTO_TEST_CASE(cone_to_bvh) {
   generateBVHModel(bvh, shape, Transform3f(), 50);
 }
 
+BOOST_AUTO_TEST_CASE(ellipsoid_aabb) {
+  Ellipsoid ellipsoid(1, 2, 3);
+  const Vec3f T(1, -2, 3);
+  AABB aabb;
+
+  // A quarter turn around z swaps the extents along x and y.
+  Matrix3f R;
+  R << 0, -1, 0, 1, 0, 0, 0, 0, 1;
+  computeBV(ellipsoid, Transform3f(R, T), aabb);
+  BOOST_CHECK(aabb.min_.isApprox(T - Vec3f(2, 1, 3)));
+  BOOST_CHECK(aabb.max_.isApprox(T + Vec3f(2, 1, 3)));
+
+  // The AABB contains the exact extents of the rotated ellipsoid.
+  for (int i = 1; i < 8; ++i) {
+    const Vec3f axis(Vec3f(i & 1, (i >> 1) & 1, (i >> 2) & 1).normalized());
+    R = AngleAxis(0.3 * i, axis).toRotationMatrix();
+    computeBV(ellipsoid, Transform3f(R, T), aabb);
+    for (int k = 0; k < 3; ++k) {
+      const FCL_REAL extent =
+          R.row(k).cwiseProduct(ellipsoid.radii.transpose()).norm();
+      BOOST_CHECK(aabb.min_[k] <= T[k] - extent);
+      BOOST_CHECK(aabb.max_[k] >= T[k] + extent);
+    }
+  }
+}
+
 BOOST_AUTO_TEST_CASE(shapeIntersection_cylinderbox) {
   Cylinder s1(0.029, 0.1);
   Box s2(1.6, 0.6, 0.025);
@@ -415,11 +450,11 @@ void testBoxBoxContactPoints(const Matrix3f& R) {
 
   Vec3f normal;
   Vec3f point(0., 0., 0.);
-  double distance;
+  FCL_REAL distance;
 
   // Make sure the two boxes are colliding
-  solver1.gjk_tolerance = 1e-5;
-  solver1.epa_tolerance = 1e-5;
+  solver1.gjk_tolerance = tolerance(1e-5);
+  solver1.epa_tolerance = tolerance(1e-5);
   bool res =
       solver1.shapeIntersect(s1, tf1, s2, tf2, distance, true, &point, &normal);
   FCL_CHECK(res);
@@ -431,8 +466,8 @@ void testBoxBoxContactPoints(const Matrix3f& R) {
   std::sort(vertices.begin(), vertices.end(), compareContactPoints);
 
   // The lowest vertex along z-axis should be the contact point
-  FCL_CHECK(normal.isApprox(Vec3f(0, 0, 1), 1e-6));
-  FCL_CHECK(vertices[0].head<2>().isApprox(point.head<2>(), 1e-6));
+  FCL_CHECK(normal.isApprox(Vec3f(0, 0, 1), tolerance(1e-6)));
+  FCL_CHECK(vertices[0].head<2>().isApprox(point.head<2>(), tolerance(1e-6)));
   FCL_CHECK(vertices[0][2] <= point[2] && point[2] < 0);
 }
 
@@ -474,7 +509,7 @@ BOOST_AUTO_TEST_CASE(shapeIntersection_boxbox) {
   normal << 1, 0, 0;
   SET_LINE;
   testShapeIntersection(s1, tf1, s2, tf2, true, NULL, NULL, &normal, false,
-                        1e-8);
+                        tolerance(1e-8));
 
   tf1 = Transform3f();
   tf2 = Transform3f(Vec3f(15.01, 0, 0));
@@ -532,7 +567,7 @@ BOOST_AUTO_TEST_CASE(shapeIntersection_spherebox) {
   testShapeIntersection(s1, tf1, s2, tf2, true, NULL, NULL, NULL);
 
   tf1 = Transform3f();
-  tf2 = Transform3f(Vec3f(22.50001, 0, 0));
+  tf2 = Transform3f(Vec3f(FCL_REAL(22.5) + tolerance(1e-5), 0, 0));
   SET_LINE;
   testShapeIntersection(s1, tf1, s2, tf2, false);
 
@@ -871,12 +906,13 @@ BOOST_AUTO_TEST_CASE(shapeIntersection_spheretriangle) {
       solver1.shapeTriangleInteraction(s, Transform3f(), t[0], t[1], t[2],
                                        Transform3f(), distance, c1, c2, normal);
   BOOST_CHECK(res);
-  BOOST_CHECK(isEqual(normal, Vec3f(1, 0, 0), 1e-9));
+  BOOST_CHECK(isEqual(normal, Vec3f(1, 0, 0), tolerance(1e-9)));
 
   res = solver1.shapeTriangleInteraction(s, transform, t[0], t[1], t[2],
                                          transform, distance, c1, c2, normal);
   BOOST_CHECK(res);
-  BOOST_CHECK(isEqual(normal, transform.getRotation() * Vec3f(1, 0, 0), 1e-9));
+  BOOST_CHECK(isEqual(normal, transform.getRotation() * Vec3f(1, 0, 0),
+                      tolerance(1e-9)));
 }
 
 BOOST_AUTO_TEST_CASE(shapeIntersection_halfspacetriangle) {
@@ -918,21 +954,21 @@ BOOST_AUTO_TEST_CASE(shapeIntersection_halfspacetriangle) {
                                          transform, distance, c1, c2, normal);
   // BOOST_CHECK(res);
   if (res)
-    BOOST_CHECK(
-        isEqual(normal, transform.getRotation() * Vec3f(1, 0, 0), 1e-9));
+    BOOST_CHECK(isEqual(normal, transform.getRotation() * Vec3f(1, 0, 0),
+                        tolerance(1e-9)));
 
   res =
       solver1.shapeTriangleInteraction(hs, Transform3f(), t[0], t[1], t[2],
                                        Transform3f(), distance, c1, c2, normal);
   // BOOST_CHECK(res);
-  if (res) BOOST_CHECK(isEqual(normal, Vec3f(1, 0, 0), 1e-9));
+  if (res) BOOST_CHECK(isEqual(normal, Vec3f(1, 0, 0), tolerance(1e-9)));
 
   res = solver1.shapeTriangleInteraction(hs, transform, t[0], t[1], t[2],
                                          transform, distance, c1, c2, normal);
   // BOOST_CHECK(res);
   if (res)
-    BOOST_CHECK(
-        isEqual(normal, transform.getRotation() * Vec3f(1, 0, 0), 1e-9));
+    BOOST_CHECK(isEqual(normal, transform.getRotation() * Vec3f(1, 0, 0),
+                        tolerance(1e-9)));
 }
 
 BOOST_AUTO_TEST_CASE(shapeIntersection_planetriangle) {
@@ -971,12 +1007,13 @@ BOOST_AUTO_TEST_CASE(shapeIntersection_planetriangle) {
       solver1.shapeTriangleInteraction(hs, Transform3f(), t[0], t[1], t[2],
                                        Transform3f(), distance, c1, c2, normal);
   BOOST_CHECK(res);
-  BOOST_CHECK(isEqual(normal, Vec3f(1, 0, 0), 1e-9));
+  BOOST_CHECK(isEqual(normal, Vec3f(1, 0, 0), tolerance(1e-9)));
 
   res = solver1.shapeTriangleInteraction(hs, transform, t[0], t[1], t[2],
                                          transform, distance, c1, c2, normal);
   BOOST_CHECK(res);
-  BOOST_CHECK(isEqual(normal, transform.getRotation() * Vec3f(1, 0, 0), 1e-9));
+  BOOST_CHECK(isEqual(normal, transform.getRotation() * Vec3f(1, 0, 0),
+                      tolerance(1e-9)));
 }
 
 BOOST_AUTO_TEST_CASE(shapeIntersection_halfspacesphere) {
@@ -2914,16 +2951,19 @@ BOOST_AUTO_TEST_CASE(shapeDistance_boxsphere) {
     res = solver1.shapeDistance(s1, Transform3f(Vec3f(dbox, 0., 0.)), s2,
                                 Transform3f(), dist, closest_p1, closest_p2,
                                 normal);
-    BOOST_CHECK_CLOSE(dist, (dbox - s1.radius - s2.halfSide(0)), 1e-6);
-    EIGEN_VECTOR_IS_APPROX(normal, -Vec3f(1, 0, 0), 1e-6);
+    BOOST_CHECK_CLOSE(dist, (dbox - s1.radius - s2.halfSide(0)),
+                      100 * tolerance(1e-8));
+    EIGEN_VECTOR_IS_APPROX(normal, -Vec3f(1, 0, 0), tolerance(1e-6));
 
     res = solver1.shapeDistance(s1, transform, s2, transform, dist, closest_p1,
                                 closest_p2, normal);
     res = solver1.shapeDistance(
         s1, transform * Transform3f(Vec3f(dbox, 0., 0.)), s2, transform, dist,
         closest_p1, closest_p2, normal);
-    BOOST_CHECK_CLOSE(dist, (dbox - s1.radius - s2.halfSide(0)), 1e-6);
-    EIGEN_VECTOR_IS_APPROX(normal, -transform.getRotation().col(0), 1e-6);
+    BOOST_CHECK_CLOSE(dist, (dbox - s1.radius - s2.halfSide(0)),
+                      100 * tolerance(1e-8));
+    EIGEN_VECTOR_IS_APPROX(normal, -transform.getRotation().col(0),
+                           tolerance(1e-6));
   }
 
   res = solver1.shapeDistance(s1, Transform3f(), s2, Transform3f(), dist,
@@ -3234,7 +3274,7 @@ BOOST_AUTO_TEST_CASE(shapeIntersectionGJK_boxbox) {
   normal << 1, 0, 0;
   SET_LINE;
   testShapeIntersection(s1, tf1, s2, tf2, true, NULL, NULL, &normal, false,
-                        1e-8);
+                        tolerance(1e-8));
 
   tf1 = transform;
   tf2 = transform * Transform3f(Vec3f(15.01, 0, 0));
@@ -3286,9 +3326,9 @@ BOOST_AUTO_TEST_CASE(shapeIntersectionGJK_spherebox) {
   tf2 = Transform3f(Vec3f(22.5, 0, 0));
   normal << 1, 0, 0;
   SET_LINE;
-  testShapeIntersection(
-      s1, tf1, s2, tf2, true, NULL, NULL, &normal, false,
-      1e-7);  // built-in GJK solver requires larger tolerance than libccd
+  // built-in GJK solver requires larger tolerance than libccd
+  testShapeIntersection(s1, tf1, s2, tf2, true, NULL, NULL, &normal, false,
+                        tolerance(1e-7));
 
   tf1 = transform;
   tf2 = transform * Transform3f(Vec3f(22.51, 0, 0));
@@ -3606,12 +3646,13 @@ BOOST_AUTO_TEST_CASE(shapeIntersectionGJK_spheretriangle) {
       solver2.shapeTriangleInteraction(s, Transform3f(), t[0], t[1], t[2],
                                        Transform3f(), distance, c1, c2, normal);
   BOOST_CHECK(res);
-  BOOST_CHECK(isEqual(normal, Vec3f(1, 0, 0), 1e-9));
+  BOOST_CHECK(isEqual(normal, Vec3f(1, 0, 0), tolerance(1e-9)));
 
   res = solver2.shapeTriangleInteraction(s, transform, t[0], t[1], t[2],
                                          transform, distance, c1, c2, normal);
   BOOST_CHECK(res);
-  BOOST_CHECK(isEqual(normal, transform.getRotation() * Vec3f(1, 0, 0), 1e-9));
+  BOOST_CHECK(isEqual(normal, transform.getRotation() * Vec3f(1, 0, 0),
+                      tolerance(1e-9)));
 }
 
 BOOST_AUTO_TEST_CASE(shapeIntersectionGJK_halfspacetriangle) {
@@ -3654,12 +3695,13 @@ BOOST_AUTO_TEST_CASE(shapeIntersectionGJK_halfspacetriangle) {
       solver2.shapeTriangleInteraction(hs, Transform3f(), t[0], t[1], t[2],
                                        Transform3f(), distance, c1, c2, normal);
   BOOST_CHECK(res);
-  BOOST_CHECK(isEqual(normal, Vec3f(1, 0, 0), 1e-9));
+  BOOST_CHECK(isEqual(normal, Vec3f(1, 0, 0), tolerance(1e-9)));
 
   res = solver2.shapeTriangleInteraction(hs, transform, t[0], t[1], t[2],
                                          transform, distance, c1, c2, normal);
   BOOST_CHECK(res);
-  BOOST_CHECK(isEqual(normal, transform.getRotation() * Vec3f(1, 0, 0), 1e-9));
+  BOOST_CHECK(isEqual(normal, transform.getRotation() * Vec3f(1, 0, 0),
+                      tolerance(1e-9)));
 }
 
 BOOST_AUTO_TEST_CASE(shapeIntersectionGJK_planetriangle) {
@@ -3702,12 +3744,13 @@ BOOST_AUTO_TEST_CASE(shapeIntersectionGJK_planetriangle) {
       solver2.shapeTriangleInteraction(hs, Transform3f(), t[0], t[1], t[2],
                                        Transform3f(), distance, c1, c2, normal);
   BOOST_CHECK(res);
-  BOOST_CHECK(isEqual(normal, Vec3f(1, 0, 0), 1e-9));
+  BOOST_CHECK(isEqual(normal, Vec3f(1, 0, 0), tolerance(1e-9)));
 
   res = solver2.shapeTriangleInteraction(hs, transform, t[0], t[1], t[2],
                                          transform, distance, c1, c2, normal);
   BOOST_CHECK(res);
-  BOOST_CHECK(isEqual(normal, transform.getRotation() * Vec3f(1, 0, 0), 1e-9));
+  BOOST_CHECK(isEqual(normal, transform.getRotation() * Vec3f(1, 0, 0),
+                      tolerance(1e-9)));
 }
 
 BOOST_AUTO_TEST_CASE(spheresphere) {
@@ -3994,7 +4037,7 @@ void testReversibleShapeDistance(const S1& s1, const S2& s2,
   bool resA;
   bool resB;
 
-  const double tol = 1e-6;
+  const FCL_REAL tol = tolerance(1e-6);
 
   resA = solver1.shapeDistance(s1, tf1, s2, tf2, distA, p1A, p2A, normalA);
   resB = solver1.shapeDistance(s2, tf2, s1, tf1, distB, p1B, p2B, normalB);
@@ -4067,3 +4110,124 @@ BOOST_AUTO_TEST_CASE(reversibleShapeDistance_allshapes) {
 
   //  testReversibleShapeDistance(plane, halfspace, distance);
 }
+
+BOOST_AUTO_TEST_CASE(compute_collision_external_solver) {
+  // A single ComputeCollision / ComputeDistance can be queried with a solver
+  // owned by the caller: results must match the ones of the internal solver.
+  Box box(1, 2, 3);
+  Capsule capsule(0.5, 2);
+  const ComputeCollision calc_collision(&box, &capsule);
+  const ComputeDistance calc_distance(&box, &capsule);
+
+  std::vector<Transform3f> tfs;
+  generateRandomTransforms(extents, tfs, 20);
+
+  CollisionRequest colRequest(CONTACT, 1);
+  DistanceRequest distRequest(true);
+  GJKSolver solverA, solverB;
+  for (std::size_t i = 0; i < tfs.size(); ++i) {
+    CollisionResult resRef, resA, resB;
+    calc_collision(tfs[i], Transform3f(), colRequest, resRef);
+    calc_collision(tfs[i], Transform3f(), colRequest, resA, solverA);
+    calc_collision(tfs[i], Transform3f(), colRequest, resB, solverB);
+    BOOST_CHECK_EQUAL(resRef.isCollision(), resA.isCollision());
+    BOOST_CHECK_EQUAL(resRef.isCollision(), resB.isCollision());
+
+    DistanceResult dresRef, dresA;
+    FCL_REAL dref = calc_distance(tfs[i], Transform3f(), distRequest, dresRef);
+    FCL_REAL dA =
+        calc_distance(tfs[i], Transform3f(), distRequest, dresA, solverA);
+    BOOST_CHECK_CLOSE(dref, dA, 100 * tolerance(1e-8));
+    BOOST_CHECK(isEqual(dresRef.nearest_points[0], dresA.nearest_points[0]));
+  }
+}
+
+struct CountingComputeCollision : ComputeCollision {
+  CountingComputeCollision(const CollisionGeometry* o1,
+                           const CollisionGeometry* o2)
+      : ComputeCollision(o1, o2), calls(0) {}
+
+  mutable std::size_t calls;
+
+ protected:
+  std::size_t run(const Transform3f& tf1, const Transform3f& tf2,
+                  const CollisionRequest& request, CollisionResult& result,
+                  GJKSolver& gjk_solver) const {
+    ++calls;
+    return ComputeCollision::run(tf1, tf2, request, result, gjk_solver);
+  }
+};
+
+BOOST_AUTO_TEST_CASE(compute_collision_override_run) {
+  // The overload of run taking a solver is used with the internal solver as
+  // well as with a solver owned by the caller.
+  Box box(1, 2, 3);
+  Capsule capsule(0.5, 2);
+  const CountingComputeCollision calc_collision(&box, &capsule);
+
+  CollisionRequest request;
+  CollisionResult result;
+  GJKSolver solver;
+  calc_collision(Transform3f(), Transform3f(), request, result);
+  calc_collision(Transform3f(), Transform3f(), request, result, solver);
+  BOOST_CHECK_EQUAL(calc_collision.calls, 2);
+}
+
+BOOST_AUTO_TEST_CASE(compute_collision_shared_between_threads) {
+  // A single ComputeCollision / ComputeDistance is queried concurrently, each
+  // thread owning its solver. Results must match the sequential ones.
+  Box box(1, 2, 3);
+  Capsule capsule(0.5, 2);
+  const ComputeCollision calc_collision(&box, &capsule);
+  const ComputeDistance calc_distance(&box, &capsule);
+
+  std::vector<Transform3f> tfs;
+  generateRandomTransforms(extents, tfs, 200);
+
+  CollisionRequest colRequest(CONTACT, 1);
+  DistanceRequest distRequest(true);
+
+  std::vector<bool> refCollisions(tfs.size());
+  std::vector<FCL_REAL> refDistances(tfs.size());
+  GJKSolver refSolver;
+  for (std::size_t i = 0; i < tfs.size(); ++i) {
+    CollisionResult result;
+    calc_collision(tfs[i], Transform3f(), colRequest, result, refSolver);
+    refCollisions[i] = result.isCollision();
+    DistanceResult dresult;
+    refDistances[i] =
+        calc_distance(tfs[i], Transform3f(), distRequest, dresult, refSolver);
+  }
+
+  const std::size_t num_threads = 4;
+  std::vector<std::vector<bool> > collisions(
+      num_threads, std::vector<bool>(tfs.size()));
+  std::vector<std::vector<FCL_REAL> > distances(
+      num_threads, std::vector<FCL_REAL>(tfs.size()));
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < num_threads; ++t) {
+    threads.push_back(std::thread([&, t]() {
+      GJKSolver solver;
+      // Each thread starts at a different transform so that the threads
+      // query different configurations at the same time.
+      for (std::size_t k = 0; k < tfs.size(); ++k) {
+        const std::size_t i = (k + t * tfs.size() / num_threads) % tfs.size();
+        CollisionResult result;
+        calc_collision(tfs[i], Transform3f(), colRequest, result, solver);
+        collisions[t][i] = result.isCollision();
+        DistanceResult dresult;
+        distances[t][i] =
+            calc_distance(tfs[i], Transform3f(), distRequest, dresult, solver);
+      }
+    }));
+  }
+  for (std::size_t t = 0; t < num_threads; ++t) threads[t].join();
+
+  for (std::size_t t = 0; t < num_threads; ++t) {
+    for (std::size_t i = 0; i < tfs.size(); ++i) {
+      BOOST_CHECK_EQUAL(collisions[t][i], refCollisions[i]);
+      BOOST_CHECK_CLOSE(distances[t][i], refDistances[i],
+                        100 * tolerance(1e-8));
+    }
+  }
+}
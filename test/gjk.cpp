@@ -84,7 +84,12 @@ void test_gjk_distance_triangle_triangle(
   clock_t start, end;
 
   std::size_t nCol = 0, nDiff = 0;
-  FCL_REAL eps = 1e-7;
+  // The closest points are computed up to the GJK tolerance, which is looser
+  // in single precision.
+  FCL_REAL eps =
+      (std::max)(FCL_REAL(1e-7), 1000 * Eigen::NumTraits<FCL_REAL>::epsilon());
+  // Triangle 1 is nearly degenerated at i == 0.
+  const FCL_REAL degenerated = FCL_REAL(1e-7);
   Results_t results(N);
   for (std::size_t i = 0; i < N; ++i) {
     Vec3f P1_loc(Vec3f::Random()), P2_loc(Vec3f::Random()),
@@ -183,14 +188,14 @@ void test_gjk_distance_triangle_triangle(
     Vec3f u2(Q2 - Q1);
     Vec3f v2(Q3 - Q1);
     Vec3f w2(u2.cross(v2));
-    BOOST_CHECK(w1.squaredNorm() > eps * eps);
+    BOOST_CHECK(w1.squaredNorm() > degenerated * degenerated);
     M.col(0) = u1;
     M.col(1) = v1;
     M.col(2) = w1;
     // Compute a1 such that p1 = P1 + a11 u1 + a12 v1 + a13 u1 x v1
     a1 = M.inverse() * (p1 - P1);
     EIGEN_VECTOR_IS_APPROX(p1, P1 + a1[0] * u1 + a1[1] * v1, eps);
-    BOOST_CHECK(w2.squaredNorm() > eps * eps);
+    BOOST_CHECK(w2.squaredNorm() > degenerated * degenerated);
     // Compute a2 such that p2 = Q1 + a21 u2 + a22 v2 + a23 u2 x v2
     M.col(0) = u2;
     M.col(1) = v2;
@@ -242,9 +247,9 @@ void test_gjk_distance_triangle_triangle(
     grad_g(3, 5) = 1;
     // Check that closest points are on triangles planes
     // Projection of [P1p1] on line normal to triangle 1 plane is equal to 0
-    BOOST_CHECK_SMALL(a1[2], eps);
+    BOOST_CHECK_SMALL(a1[2] * w1.norm(), eps);
     // Projection of [Q1p2] on line normal to triangle 2 plane is equal to 0
-    BOOST_CHECK_SMALL(a2[2], eps);
+    BOOST_CHECK_SMALL(a2[2] * w2.norm(), eps);
 
     /* Check Karush–Kuhn–Tucker conditions
                     6
@@ -348,8 +353,11 @@ void test_gjk_unit_sphere(FCL_REAL center_distance, Vec3f ray,
   Vec3f w0_expected(tf0.inverse().transform(tf0.getTranslation() + ray));
   Vec3f w1_expected(tf0.inverse().transform(tf1.getTranslation() - ray));
 
-  EIGEN_VECTOR_IS_APPROX(w0, w0_expected, 1e-10);
-  EIGEN_VECTOR_IS_APPROX(w1, w1_expected, 1e-10);
+  // The rotations are only exact up to the rounding errors of the scalar.
+  const FCL_REAL prec =
+      (std::max)(FCL_REAL(1e-10), 100 * Eigen::NumTraits<FCL_REAL>::epsilon());
+  EIGEN_VECTOR_IS_APPROX(w0, w0_expected, prec);
+  EIGEN_VECTOR_IS_APPROX(w1, w1_expected, prec);
 }
 
 BOOST_AUTO_TEST_CASE(sphere_sphere) {
@@ -415,8 +423,10 @@ void test_gjk_triangle_capsule(Vec3f T, bool expect_collision,
     epa.getClosestPoints(shape, w0, w1);
   }
 
-  EIGEN_VECTOR_IS_APPROX(w0, w0_expected, 1e-10);
-  EIGEN_VECTOR_IS_APPROX(w1 - T, w1_expected, 1e-10);
+  const FCL_REAL prec =
+      (std::max)(FCL_REAL(1e-10), 100 * Eigen::NumTraits<FCL_REAL>::epsilon());
+  EIGEN_VECTOR_IS_APPROX(w0, w0_expected, prec);
+  EIGEN_VECTOR_IS_APPROX(w1 - T, w1_expected, prec);
 }
 
 BOOST_AUTO_TEST_CASE(triangle_capsule) {
@@ -441,3 +451,34 @@ BOOST_AUTO_TEST_CASE(triangle_capsule) {
   test_gjk_triangle_capsule(Vec3f(-0.5, -0.01, 0), true, true, Vec3f(0, 1, 0),
                             Vec3f(0.5, 0, 0));
 }
+
+BOOST_AUTO_TEST_CASE(default_tolerance) {
+  using namespace hpp::fcl;
+#ifdef HPP_FCL_USE_FLOAT
+  BOOST_CHECK_EQUAL(sizeof(FCL_REAL), sizeof(float));
+#else
+  BOOST_CHECK_EQUAL(sizeof(FCL_REAL), sizeof(double));
+#endif
+
+  GJKSolver solver;
+  BOOST_CHECK_EQUAL(solver.gjk_tolerance, GJK_DEFAULT_TOLERANCE);
+  BOOST_CHECK_EQUAL(solver.epa_tolerance, GJK_DEFAULT_TOLERANCE);
+  CollisionRequest request;
+  BOOST_CHECK_EQUAL(request.gjk_tolerance, GJK_DEFAULT_TOLERANCE);
+  BOOST_CHECK_EQUAL(GJKSolver(request).epa_tolerance, GJK_DEFAULT_TOLERANCE);
+
+  // GJK must converge with the default tolerance on shapes far from the
+  // origin, where the rounding errors are the largest.
+  Box box(1, 1, 1);
+  const Transform3f tf0(Matrix3f::Identity(), Vec3f(100, 100, 100)),
+      tf1(Matrix3f::Identity(), Vec3f(101.5, 100.2, 100.1));
+  details::MinkowskiDiff shape;
+  shape.set(&box, &box, tf0, tf1);
+
+  const unsigned int max_iterations = 128;
+  details::GJK gjk(max_iterations, GJK_DEFAULT_TOLERANCE);
+  details::GJK::Status status = gjk.evaluate(shape, Vec3f(1, 0, 0));
+  BOOST_CHECK_EQUAL(status, details::GJK::Valid);
+  BOOST_CHECK(gjk.getIterations() < max_iterations);
+  BOOST_CHECK_CLOSE(gjk.distance, FCL_REAL(0.5), 1e-2);
+}
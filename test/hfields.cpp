@@ -414,9 +414,8 @@ BOOST_AUTO_TEST_CASE(hfield_with_square_hole) {
   const Eigen::DenseIndex nx = 100, ny = 100;
 
   typedef AABB BV;
-  const MatrixXf X =
-      Eigen::RowVectorXd::LinSpaced(nx, -1., 1.).replicate(ny, 1);
-  const MatrixXf Y = Eigen::VectorXd::LinSpaced(ny, 1., -1.).replicate(1, nx);
+  const MatrixXf X = VecXf::LinSpaced(nx, -1., 1.).transpose().replicate(ny, 1);
+  const MatrixXf Y = VecXf::LinSpaced(ny, 1., -1.).replicate(1, nx);
 
   const FCL_REAL dim_square = 0.5;
 
@@ -424,7 +423,7 @@ BOOST_AUTO_TEST_CASE(hfield_with_square_hole) {
       (X.array().abs() < dim_square) && (Y.array().abs() < dim_square);
 
   const MatrixXf heights =
-      MatrixXf::Ones(ny, nx) - hole.cast<double>().matrix();
+      MatrixXf::Ones(ny, nx) - hole.cast<FCL_REAL>().matrix();
 
   const HeightField<BV> hfield(2., 2., heights, -10.);
 
@@ -458,9 +457,8 @@ BOOST_AUTO_TEST_CASE(hfield_with_circular_hole) {
   //  typedef OBBRSS BV; TODO(jcarpent): OBBRSS does not work (compile in Debug
   //  mode), as the overlap of OBBRSS is not satisfactory yet.
   typedef AABB BV;
-  const MatrixXf X =
-      Eigen::RowVectorXd::LinSpaced(nx, -1., 1.).replicate(ny, 1);
-  const MatrixXf Y = Eigen::VectorXd::LinSpaced(ny, 1., -1.).replicate(1, nx);
+  const MatrixXf X = VecXf::LinSpaced(nx, -1., 1.).transpose().replicate(ny, 1);
+  const MatrixXf Y = VecXf::LinSpaced(ny, 1., -1.).replicate(1, nx);
 
   const FCL_REAL dim_hole = 1;
 
@@ -468,7 +466,7 @@ BOOST_AUTO_TEST_CASE(hfield_with_circular_hole) {
       (X.array().square() + Y.array().square() <= dim_hole);
 
   const MatrixXf heights =
-      MatrixXf::Ones(ny, nx) - hole.cast<double>().matrix();
+      MatrixXf::Ones(ny, nx) - hole.cast<FCL_REAL>().matrix();
 
   const HeightField<BV> hfield(2., 2., heights, -10.);
 
@@ -518,3 +516,169 @@ BOOST_AUTO_TEST_CASE(hfield_with_circular_hole) {
     BOOST_CHECK(!result.isCollision());
   }
 }
+
+BOOST_AUTO_TEST_CASE(hfield_cell_split_along_diagonal) {
+  // A single cell whose diagonal from (x0, y1) to (x1, y0) is a valley: the
+  // surface is made of two triangles, whose height at the cell center is 0,
+  // while the convex hull of the cell would reach 1.
+  MatrixXf heights(2, 2);
+  heights << 1., 0., 0., 1.;
+  HeightField<AABB> hfield(1., 1., heights, -1.);
+
+  Sphere sphere(0.1);
+  const Transform3f hfield_pos;
+
+  {
+    CollisionResult result;
+    CollisionRequest request;
+    collide(&hfield, hfield_pos, &sphere, Transform3f(Vec3f(0., 0., 0.5)),
+            request, result);
+
+    BOOST_CHECK(!result.isCollision());
+  }
+
+  {
+    CollisionResult result;
+    CollisionRequest request;
+    collide(&hfield, hfield_pos, &sphere, Transform3f(Vec3f(0., 0., 0.05)),
+            request, result);
+
+    BOOST_CHECK(result.isCollision());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(hfield_max_height_pyramid) {
+  const Eigen::DenseIndex nx = 23, ny = 17;
+  const MatrixXf heights = MatrixXf::Random(ny, nx);
+  HeightField<OBBRSS> hfield(2., 1.5, heights, -1.);
+
+  const std::vector<MatrixXf>& pyramid = hfield.getMaxHeightPyramid();
+  BOOST_CHECK(pyramid.back().size() == 1);
+  BOOST_CHECK(pyramid.back()(0, 0) == hfield.getMaxHeight());
+  for (size_t level = 0; level < pyramid.size(); ++level) {
+    const Eigen::DenseIndex step = Eigen::DenseIndex(1) << level;
+    const MatrixXf& max_heights = pyramid[level];
+    BOOST_CHECK(max_heights.rows() == (ny - 1 + step - 1) / step);
+    BOOST_CHECK(max_heights.cols() == (nx - 1 + step - 1) / step);
+    for (Eigen::DenseIndex by = 0; by < max_heights.rows(); ++by)
+      for (Eigen::DenseIndex bx = 0; bx < max_heights.cols(); ++bx) {
+        const Eigen::DenseIndex y0 = by * step, x0 = bx * step,
+                                y1 = (std::min)(y0 + step, ny - 1),
+                                x1 = (std::min)(x0 + step, nx - 1);
+        BOOST_CHECK(max_heights(by, bx) ==
+                    heights.block(y0, x0, y1 - y0 + 1, x1 - x0 + 1).maxCoeff());
+      }
+  }
+
+  for (Eigen::DenseIndex y_id = 0; y_id < ny - 1; ++y_id)
+    for (Eigen::DenseIndex x_id = 0; x_id < nx - 1; ++x_id) {
+      const HFNode<OBBRSS>& node =
+          hfield.getBV(hfield.getCellBVIndex(x_id, y_id));
+      BOOST_CHECK(node.isLeaf());
+      BOOST_CHECK(node.x_id == x_id && node.y_id == y_id);
+    }
+
+  // The pyramid follows the updates of the heights.
+  hfield.updateHeights(heights.array() + 1.);
+  BOOST_CHECK(hfield.getMaxHeightPyramid().back()(0, 0) ==
+              heights.maxCoeff() + 1.);
+
+  // Collisions through the grid match the geometry of the height field.
+  HeightField<OBBRSS> flat(2., 1.5, MatrixXf::Zero(ny, nx), -1.);
+  const Sphere sphere(0.05);
+  for (int i = 0; i < 200; ++i) {
+    const Vec3f center(Vec3f::Random().cwiseProduct(Vec3f(1.1, 0.85, 1.2)));
+    const Transform3f sphere_pos(center);
+    CollisionRequest request;
+    CollisionResult result;
+    collide(&flat, Transform3f(), &sphere, sphere_pos, request, result);
+
+    const bool inside = std::abs(center[0]) <= 1. + sphere.radius &&
+                        std::abs(center[1]) <= 0.75 + sphere.radius &&
+                        center[2] >= -1. - sphere.radius &&
+                        center[2] <= sphere.radius;
+    const bool clearly_inside = std::abs(center[0]) < 1. &&
+                                std::abs(center[1]) < 0.75 &&
+                                center[2] > -1. && center[2] < 0.;
+    if (!inside) BOOST_CHECK(!result.isCollision());
+    if (clearly_inside) BOOST_CHECK(result.isCollision());
+  }
+}
+
+BOOST_AUTO_TEST_CASE(hfield_update_heights_block) {
+  const Eigen::DenseIndex nx = 31, ny = 20;
+  MatrixXf heights = MatrixXf::Random(ny, nx);
+  HeightField<OBBRSS> hfield(3., 2., heights, -1.);
+
+  const Eigen::DenseIndex x_ids[] = {0, 7, 25}, y_ids[] = {0, 11, 15};
+  for (int k = 0; k < 3; ++k) {
+    const MatrixXf patch = 2. * MatrixXf::Random(5, 6);
+    hfield.updateHeightsBlock(x_ids[k], y_ids[k], patch);
+    heights.block(y_ids[k], x_ids[k], 5, 6) = patch;
+
+    const HeightField<OBBRSS> reference(3., 2., heights, -1.);
+    BOOST_CHECK(hfield == reference);
+    BOOST_CHECK(hfield.getMaxHeightPyramid() ==
+                reference.getMaxHeightPyramid());
+  }
+
+  BOOST_CHECK_THROW(hfield.updateHeightsBlock(28, 0, MatrixXf::Zero(2, 4)),
+                    std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(hfield_compact_storage) {
+  const Eigen::DenseIndex nx = 40, ny = 30;
+  const MatrixXf heights = MatrixXf::Random(ny, nx);
+  const FCL_REAL min_height = -0.5;
+  const HeightField<OBBRSS> reference(2., 1.5, heights, min_height);
+  BOOST_CHECK(reference.decodedHeights() == reference.getHeights());
+
+  const HeightFieldStorage storages[] = {HF_STORAGE_FLOAT, HF_STORAGE_UINT16};
+  for (int k = 0; k < 2; ++k) {
+    HeightField<OBBRSS> hfield(2., 1.5, heights, min_height, storages[k]);
+    BOOST_CHECK(hfield.getStorage() == storages[k]);
+    BOOST_CHECK_THROW(hfield.getHeights(), std::logic_error);
+
+    // Heights are rounded up.
+    const FCL_REAL tol = storages[k] == HF_STORAGE_FLOAT
+                             ? 1e-6
+                             : 1.0001 * hfield.getHeightScale();
+    const MatrixXf stored_heights = hfield.decodedHeights();
+    const MatrixXf delta = stored_heights - reference.getHeights();
+    BOOST_CHECK(delta.minCoeff() >= 0.);
+    BOOST_CHECK(delta.maxCoeff() <= tol);
+    BOOST_CHECK(hfield.getMaxHeight() == stored_heights.maxCoeff());
+    BOOST_CHECK(hfield.getMaxHeight() >= reference.getMaxHeight());
+    for (Eigen::DenseIndex y_id = 0; y_id < ny; ++y_id)
+      for (Eigen::DenseIndex x_id = 0; x_id < nx; ++x_id)
+        BOOST_CHECK(hfield.getHeight(x_id, y_id) ==
+                    stored_heights(y_id, x_id));
+
+    // The bounding volumes contain the ones of the original heights.
+    for (Eigen::DenseIndex y_id = 0; y_id < ny - 1; ++y_id)
+      for (Eigen::DenseIndex x_id = 0; x_id < nx - 1; ++x_id) {
+        const unsigned int i = reference.getCellBVIndex(x_id, y_id);
+        BOOST_CHECK(hfield.getBV(i).max_height >=
+                    reference.getBV(i).max_height);
+      }
+
+    // A sphere resting on a vertex still collides.
+    const Sphere sphere(0.01);
+    const Eigen::DenseIndex x_id = 12, y_id = 7;
+    const FCL_REAL z = (std::max)(heights(y_id, x_id), min_height);
+    const Transform3f sphere_pos(Vec3f(hfield.getXGrid()[x_id],
+                                       hfield.getYGrid()[y_id],
+                                       z + 0.5 * sphere.radius));
+    CollisionRequest request;
+    CollisionResult result;
+    collide(&hfield, Transform3f(), &sphere, sphere_pos, request, result);
+    BOOST_CHECK(result.isCollision());
+
+    // Updates out of the quantization range rescale the heights.
+    const MatrixXf patch = MatrixXf::Constant(3, 3, 2.);
+    hfield.updateHeightsBlock(x_id, y_id, patch);
+    BOOST_CHECK(hfield.getMaxHeight() >= 2.);
+    BOOST_CHECK(hfield.getHeight(x_id + 1, y_id + 1) >= 2.);
+    BOOST_CHECK(hfield.getHeight(0, 0) >= reference.getHeights()(0, 0));
+  }
+}
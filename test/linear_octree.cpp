@@ -0,0 +1,158 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define BOOST_TEST_MODULE FCL_LINEAR_OCTREE
+#include <boost/test/included/unit_test.hpp>
+
+#include <hpp/fcl/collision.h>
+#include <hpp/fcl/distance.h>
+#include <hpp/fcl/linear_octree.h>
+#include <hpp/fcl/shape/geometric_shapes.h>
+#include <hpp/fcl/shape/geometric_shapes_utility.h>
+
+#include "utility.h"
+
+using namespace hpp::fcl;
+
+BOOST_AUTO_TEST_CASE(linear_octree_leaves) {
+  LinearOcTree tree(0.5, 4);
+  BOOST_CHECK(tree.getRootBV() ==
+              AABB(Vec3f(-4., -4., -4.), Vec3f(4., 4., 4.)));
+
+  // The eight voxels of a block are merged into one leaf of level 1, which
+  // contains the leaf of level 0 given twice.
+  std::vector<LinearOcTree::Code> codes;
+  std::vector<unsigned char> levels;
+  for (LinearOcTree::Code i = 0; i < 8; ++i) {
+    codes.push_back(64 + i);
+    levels.push_back(0);
+  }
+  codes.push_back(64);
+  levels.push_back(0);
+  codes.push_back(LinearOcTree::computeCode(7, 7, 7));
+  levels.push_back(0);
+  tree.setLeaves(codes, levels);
+
+  BOOST_REQUIRE(tree.getNumLeaves() == 2);
+  BOOST_CHECK(tree.getLeafLevels()[0] == 1);
+  BOOST_CHECK(tree.getLeafCodes()[0] == 64);
+  BOOST_CHECK(tree.getLeafBV(0) ==
+              AABB(Vec3f(-2., -4., -4.), Vec3f(-1., -3., -3.)));
+  BOOST_CHECK(tree.getLeafBV(1) ==
+              AABB(Vec3f(-0.5, -0.5, -0.5), Vec3f(0., 0., 0.)));
+
+  BOOST_CHECK(tree.isOccupied(Vec3f(-1.2, -3.9, -3.1)));
+  BOOST_CHECK(tree.isOccupied(Vec3f(-0.1, -0.1, -0.1)));
+  BOOST_CHECK(!tree.isOccupied(Vec3f(0.1, -0.1, -0.1)));
+  BOOST_CHECK(!tree.isOccupied(Vec3f(10., 0., 0.)));
+
+  tree.computeLocalAABB();
+  BOOST_CHECK(tree.aabb_local ==
+              AABB(Vec3f(-2., -4., -4.), Vec3f(0., 0., 0.)));
+
+  // Code of a node which is not aligned on its level.
+  BOOST_CHECK_THROW(
+      tree.setLeaves(std::vector<LinearOcTree::Code>(1, 1),
+                     std::vector<unsigned char>(1, 1)),
+      std::invalid_argument);
+  BOOST_CHECK_THROW(tree.computeCode(Vec3f(4., 0., 0.)),
+                    std::invalid_argument);
+}
+
+template <typename S>
+void test_linear_octree_shape(const LinearOcTree& tree, const S& shape) {
+  std::vector<Transform3f> transforms;
+  FCL_REAL extents[] = {-1.5, -1.5, -1.5, 1.5, 1.5, 1.5};
+  const std::size_t N = 100;
+  generateRandomTransforms(extents, transforms, 2 * N);
+
+  CollisionRequest request;
+  DistanceRequest drequest;
+  for (std::size_t i = 0; i < N; ++i) {
+    const Transform3f& tf1(transforms[2 * i]);
+    const Transform3f& tf2(transforms[2 * i + 1]);
+
+    // Compare with the boxes of the leaves, one by one.
+    bool collision = false;
+    FCL_REAL min_distance = (std::numeric_limits<FCL_REAL>::max)();
+    for (std::size_t k = 0; k < tree.getNumLeaves(); ++k) {
+      Box box;
+      Transform3f box_tf;
+      constructBox(tree.getLeafBV(k), tf1, box, box_tf);
+      CollisionResult boxResult;
+      collision |= collide(&box, box_tf, &shape, tf2, request, boxResult) > 0;
+      DistanceResult boxDResult;
+      min_distance = std::min(
+          min_distance, distance(&box, box_tf, &shape, tf2, drequest,
+                                 boxDResult));
+    }
+
+    CollisionResult result;
+    collide(&tree, tf1, &shape, tf2, request, result);
+    BOOST_CHECK(result.isCollision() == collision);
+    if (result.isCollision()) BOOST_CHECK(result.getContact(0).o1 == &tree);
+
+    CollisionResult swappedResult;
+    collide(&shape, tf2, &tree, tf1, request, swappedResult);
+    BOOST_CHECK(swappedResult.isCollision() == collision);
+    if (swappedResult.isCollision())
+      BOOST_CHECK(swappedResult.getContact(0).o2 == &tree);
+
+    // Once a penetrating leaf is found, the other leaves are pruned.
+    DistanceResult dresult;
+    distance(&tree, tf1, &shape, tf2, drequest, dresult);
+    if (min_distance > 0)
+      BOOST_CHECK_SMALL(dresult.min_distance - min_distance, FCL_REAL(1e-6));
+    else
+      BOOST_CHECK(dresult.min_distance <= 0);
+
+    DistanceResult swappedDResult;
+    distance(&shape, tf2, &tree, tf1, drequest, swappedDResult);
+    BOOST_CHECK_SMALL(swappedDResult.min_distance - dresult.min_distance,
+                      FCL_REAL(1e-6));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(linear_octree_collision_distance) {
+  Eigen::Matrix<FCL_REAL, Eigen::Dynamic, 3> points(
+      Eigen::Matrix<FCL_REAL, Eigen::Dynamic, 3>::Random(200, 3));
+  LinearOcTreePtr_t tree(makeLinearOctree(points, 0.1));
+  BOOST_REQUIRE(tree->getNumLeaves() > 0);
+  for (Eigen::DenseIndex i = 0; i < points.rows(); ++i)
+    BOOST_CHECK(tree->isOccupied(points.row(i).transpose()));
+
+  test_linear_octree_shape(*tree, Sphere(0.2));
+  test_linear_octree_shape(*tree, Box(0.3, 0.1, 0.5));
+  test_linear_octree_shape(*tree, Capsule(0.1, 0.4));
+}
@@ -0,0 +1,152 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define BOOST_TEST_MODULE FCL_METRICS
+#include <boost/test/included/unit_test.hpp>
+
+#include <thread>
+
+#include <hpp/fcl/collision.h>
+#include <hpp/fcl/metrics.h>
+#include <hpp/fcl/shape/geometric_shapes.h>
+#include <hpp/fcl/broadphase/broadphase_bruteforce.h>
+#include <hpp/fcl/broadphase/default_broadphase_callbacks.h>
+
+using namespace hpp::fcl;
+
+BOOST_AUTO_TEST_CASE(iteration_bins) {
+  BOOST_CHECK_EQUAL(metrics::iterationBin(0), 0);
+  BOOST_CHECK_EQUAL(metrics::iterationBin(1), 0);
+  BOOST_CHECK_EQUAL(metrics::iterationBin(2), 1);
+  BOOST_CHECK_EQUAL(metrics::iterationBin(3), 2);
+  BOOST_CHECK_EQUAL(metrics::iterationBin(4), 2);
+  BOOST_CHECK_EQUAL(metrics::iterationBin(5), 3);
+  BOOST_CHECK_EQUAL(metrics::iterationBin(256), 8);
+  BOOST_CHECK_EQUAL(metrics::iterationBin(1000), 8);
+
+  for (std::size_t i = 0; i < metrics::num_epa_statuses; ++i)
+    BOOST_CHECK(metrics::getEPAStatusName(i) != NULL);
+  BOOST_CHECK_EQUAL(metrics::epaStatusIndex(details::EPA::Failed), 0);
+  BOOST_CHECK_EQUAL(metrics::epaStatusIndex(details::EPA::FallBack), 8);
+}
+
+void collideBoxes() {
+  Box box(1, 1, 1);
+  CollisionRequest request(CONTACT, 1);
+  CollisionResult result;
+  collide(&box, Transform3f(), &box, Transform3f(Vec3f(0.5, 0.1, 0)), request,
+          result);
+  BOOST_CHECK(result.isCollision());
+}
+
+#ifdef HPP_FCL_ENABLE_METRICS
+BOOST_AUTO_TEST_CASE(narrowphase) {
+  metrics::reset();
+  collideBoxes();
+
+  metrics::MetricsSnapshot snapshot = metrics::snapshot();
+  BOOST_REQUIRE_EQUAL(snapshot.gjk.size(), 1);
+  const metrics::GJKPairMetrics& pair = snapshot.gjk[0];
+  BOOST_CHECK_EQUAL(pair.node_type1, GEOM_BOX);
+  BOOST_CHECK_EQUAL(pair.node_type2, GEOM_BOX);
+  // The boxes are in deep penetration: GJK returns Inside and EPA is run.
+  BOOST_CHECK_EQUAL(pair.status_counts[details::GJK::Inside], 1);
+  BOOST_CHECK_EQUAL(pair.status_counts[details::GJK::Valid], 0);
+  boost::uint64_t runs = 0;
+  for (std::size_t i = 0; i < metrics::num_iteration_bins; ++i)
+    runs += pair.iteration_histogram[i];
+  BOOST_CHECK_EQUAL(runs, 1);
+
+  boost::uint64_t epa_runs = 0;
+  for (std::size_t i = 0; i < metrics::num_epa_statuses; ++i)
+    epa_runs += snapshot.epa_status_counts[i];
+  BOOST_CHECK_EQUAL(epa_runs, 1);
+  BOOST_CHECK(snapshot.broadphase.empty());
+
+  // The counters of a thread are kept after it exits.
+  std::thread thread(collideBoxes);
+  thread.join();
+  snapshot = metrics::snapshot();
+  BOOST_REQUIRE_EQUAL(snapshot.gjk.size(), 1);
+  BOOST_CHECK_EQUAL(snapshot.gjk[0].status_counts[details::GJK::Inside], 2);
+
+  metrics::reset();
+  snapshot = metrics::snapshot();
+  BOOST_CHECK(snapshot.gjk.empty());
+}
+
+BOOST_AUTO_TEST_CASE(broadphase) {
+  shared_ptr<CollisionGeometry> sphere(new Sphere(1));
+  CollisionObject o1(sphere, Transform3f()),
+      o2(sphere, Transform3f(Vec3f(1, 0, 0))),
+      o3(sphere, Transform3f(Vec3f(0, 1, 0)));
+  NaiveCollisionManager manager;
+  manager.registerObject(&o1);
+  manager.registerObject(&o2);
+  manager.registerObject(&o3);
+  manager.setup();
+
+  metrics::reset();
+  CollisionCallBackDefault callback;
+  callback.data.request.num_max_contacts = 10;
+  manager.collide(&callback);
+  DistanceCallBackDefault distance_callback;
+  manager.distance(&distance_callback);
+
+  const metrics::MetricsSnapshot snapshot = metrics::snapshot();
+  BOOST_REQUIRE_EQUAL(snapshot.broadphase.size(), 1);
+  BOOST_CHECK_EQUAL(snapshot.broadphase[0].manager, metrics::BP_NAIVE);
+  BOOST_CHECK_EQUAL(snapshot.broadphase[0].num_collision_pairs, 3);
+  BOOST_CHECK(snapshot.broadphase[0].num_distance_pairs > 0);
+
+  const std::string json = snapshot.toJSON();
+  BOOST_CHECK(json.find("\"manager\":\"Naive\"") != std::string::npos);
+  BOOST_CHECK(json.find("\"collision_pairs\":3") != std::string::npos);
+}
+#else
+BOOST_AUTO_TEST_CASE(disabled) {
+  collideBoxes();
+
+  const metrics::MetricsSnapshot snapshot = metrics::snapshot();
+  BOOST_CHECK(snapshot.gjk.empty());
+  BOOST_CHECK(snapshot.broadphase.empty());
+  for (std::size_t i = 0; i < metrics::num_epa_statuses; ++i)
+    BOOST_CHECK_EQUAL(snapshot.epa_status_counts[i], 0);
+  BOOST_CHECK_EQUAL(snapshot.toJSON(),
+                    "{\"gjk\":[],\"epa\":{\"Failed\":0,\"Valid\":0,"
+                    "\"AccuracyReached\":0,\"Degenerated\":0,\"NonConvex\":0,"
+                    "\"InvalidHull\":0,\"OutOfFaces\":0,\"OutOfVertices\":0,"
+                    "\"FallBack\":0},\"broadphase\":[]}");
+}
+#endif
@@ -143,7 +143,8 @@ void test_nesterov_gjk(const ShapeBase& shape0, const ShapeBase& shape1) {
     // Make sure GJK and Nesterov accelerated GJK find the same distance between
     // the shapes
     BOOST_CHECK(res_nesterov_gjk_1 == res_gjk_1);
-    BOOST_CHECK_SMALL(fabs(ray_gjk.norm() - ray_nesterov.norm()), 1e-4);
+    BOOST_CHECK_SMALL(fabs(ray_gjk.norm() - ray_nesterov.norm()),
+                      FCL_REAL(1e-4));
 
     // Make sure GJK and Nesterov accelerated GJK converges in a reasonable
     // amount of iterations
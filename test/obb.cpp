@@ -154,7 +154,9 @@ typedef boost::chrono::high_resolution_clock clock_type;
 typedef clock_type::duration duration_type;
 
 const char* sep = ",\t";
-const FCL_REAL eps = 1.5e-7;
+// The distances are computed at the rounding errors of FCL_REAL.
+const FCL_REAL eps =
+    (std::max)(FCL_REAL(1.5e-7), 10 * Eigen::NumTraits<FCL_REAL>::epsilon());
 
 const Eigen::IOFormat py_fmt(Eigen::FullPrecision, 0,
                              ", ",   // Coeff separator
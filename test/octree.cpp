@@ -166,3 +166,279 @@ BOOST_AUTO_TEST_CASE(OCTREE) {
     }
   }
 }
+
+/// Check that the distances computed with and without the hierarchy of the
+/// occupied leaves agree. A distance query stops at the first penetrating
+/// pair, so that only the sign is compared when the objects collide.
+void checkOccupiedLeavesDistance(const hpp::fcl::DistanceResult& dresult,
+                                 const hpp::fcl::DistanceResult& flatDResult) {
+  if (dresult.min_distance <= 0) {
+    BOOST_CHECK(flatDResult.min_distance <= 0);
+    return;
+  }
+  BOOST_CHECK_CLOSE(dresult.min_distance, flatDResult.min_distance,
+                    FCL_REAL(1e-3));
+}
+
+BOOST_AUTO_TEST_CASE(OCTREE_OCCUPIED_LEAVES) {
+  FCL_REAL resolution(10.);
+  boost::filesystem::path path(TEST_RESOURCES_DIR);
+  OcTree envOctree(
+      hpp::fcl::loadOctreeFile((path / "env.octree").string(), resolution));
+  OcTree flatOctree(envOctree);
+  flatOctree.buildOccupiedLeaves();
+  BOOST_REQUIRE(flatOctree.getOccupiedLeaves());
+  BOOST_CHECK(!envOctree.getOccupiedLeaves());
+  BOOST_CHECK(!flatOctree.getOccupiedLeaves()->boxes.empty());
+
+  // A smaller octree, to test the collisions between two octrees.
+  hpp::fcl::shared_ptr<octomap::OcTree> octomap(new octomap::OcTree(20.));
+  for (int i = 0; i < 200; ++i) {
+    const Vec3f p(100. * Vec3f::Random());
+    octomap->updateNode(octomap::point3d((float)p[0], (float)p[1], (float)p[2]),
+                        true);
+  }
+  octomap->updateInnerOccupancy();
+  OcTree smallOctree(octomap), flatSmallOctree(octomap);
+  flatSmallOctree.buildOccupiedLeaves();
+
+  std::vector<Vec3f> pRob;
+  std::vector<Triangle> tRob;
+  loadOBJFile((path / "rob.obj").string().c_str(), pRob, tRob);
+  BVHModel<OBBRSS> robMesh;
+  makeMesh(pRob, tRob, robMesh);
+
+  std::vector<Transform3f> transforms;
+  FCL_REAL extents[] = {-2000, -2000, 0, 2000, 2000, 2000};
+  const std::size_t N = 100;
+  generateRandomTransforms(extents, transforms, 2 * N);
+
+  hpp::fcl::Box box(200., 100., 300.);
+  CollisionRequest request(hpp::fcl::CONTACT, 1);
+  hpp::fcl::DistanceRequest drequest;
+  for (std::size_t i = 0; i < N; ++i) {
+    const Transform3f& tf1(transforms[2 * i]);
+    const Transform3f& tf2(transforms[2 * i + 1]);
+
+    CollisionResult result, flatResult;
+    hpp::fcl::collide(&envOctree, tf1, &box, tf2, request, result);
+    hpp::fcl::collide(&flatOctree, tf1, &box, tf2, request, flatResult);
+    BOOST_CHECK(result.isCollision() == flatResult.isCollision());
+
+    hpp::fcl::DistanceResult dresult, flatDResult;
+    hpp::fcl::distance(&box, tf2, &envOctree, tf1, drequest, dresult);
+    hpp::fcl::distance(&box, tf2, &flatOctree, tf1, drequest, flatDResult);
+    checkOccupiedLeavesDistance(dresult, flatDResult);
+
+    // Octree and mesh.
+    result.clear();
+    flatResult.clear();
+    hpp::fcl::collide(&envOctree, tf1, &robMesh, tf2, request, result);
+    hpp::fcl::collide(&flatOctree, tf1, &robMesh, tf2, request, flatResult);
+    BOOST_CHECK(result.isCollision() == flatResult.isCollision());
+
+    result.clear();
+    flatResult.clear();
+    hpp::fcl::collide(&robMesh, tf2, &envOctree, tf1, request, result);
+    hpp::fcl::collide(&robMesh, tf2, &flatOctree, tf1, request, flatResult);
+    BOOST_CHECK(result.isCollision() == flatResult.isCollision());
+
+    // The distance without the hierarchy is slow.
+    if (i % 10 == 0) {
+      dresult.clear();
+      flatDResult.clear();
+      hpp::fcl::distance(&envOctree, tf1, &robMesh, tf2, drequest, dresult);
+      hpp::fcl::distance(&flatOctree, tf1, &robMesh, tf2, drequest,
+                         flatDResult);
+      checkOccupiedLeavesDistance(dresult, flatDResult);
+    }
+
+    // Two octrees.
+    result.clear();
+    flatResult.clear();
+    hpp::fcl::collide(&envOctree, tf1, &smallOctree, tf2, request, result);
+    hpp::fcl::collide(&flatOctree, tf1, &flatSmallOctree, tf2, request,
+                      flatResult);
+    BOOST_CHECK(result.isCollision() == flatResult.isCollision());
+
+    dresult.clear();
+    flatDResult.clear();
+    hpp::fcl::distance(&smallOctree, tf2, &envOctree, tf1, drequest, dresult);
+    hpp::fcl::distance(&flatSmallOctree, tf2, &flatOctree, tf1, drequest,
+                       flatDResult);
+    checkOccupiedLeavesDistance(dresult, flatDResult);
+  }
+
+  // Changing the thresholds discards the hierarchy.
+  flatOctree.setOccupancyThres(0.9);
+  BOOST_CHECK(!flatOctree.getOccupiedLeaves());
+}
+
+BOOST_AUTO_TEST_CASE(OCTREE_TO_LINEAR_OCTREE) {
+  FCL_REAL resolution(10.);
+  boost::filesystem::path path(TEST_RESOURCES_DIR);
+  OcTree envOctree(
+      hpp::fcl::loadOctreeFile((path / "env.octree").string(), resolution));
+  hpp::fcl::LinearOcTreePtr_t linearOctree(envOctree.toLinearOcTree());
+  BOOST_CHECK(linearOctree->getTreeDepth() == envOctree.getTreeDepth());
+  BOOST_CHECK(linearOctree->getRootBV() == envOctree.getRootBV());
+  BOOST_CHECK(linearOctree->getNumLeaves() > 0);
+
+  std::vector<Transform3f> transforms;
+  FCL_REAL extents[] = {-2000, -2000, 0, 2000, 2000, 2000};
+  const std::size_t N = 100;
+  generateRandomTransforms(extents, transforms, 2 * N);
+
+  hpp::fcl::Box box(200., 100., 300.);
+  CollisionRequest request(hpp::fcl::CONTACT, 1);
+  hpp::fcl::DistanceRequest drequest;
+  for (std::size_t i = 0; i < N; ++i) {
+    const Transform3f& tf1(transforms[2 * i]);
+    const Transform3f& tf2(transforms[2 * i + 1]);
+
+    CollisionResult result, linearResult;
+    hpp::fcl::collide(&envOctree, tf1, &box, tf2, request, result);
+    hpp::fcl::collide(linearOctree.get(), tf1, &box, tf2, request,
+                      linearResult);
+    BOOST_CHECK(result.isCollision() == linearResult.isCollision());
+
+    hpp::fcl::DistanceResult dresult, linearDResult;
+    hpp::fcl::distance(&box, tf2, &envOctree, tf1, drequest, dresult);
+    hpp::fcl::distance(&box, tf2, linearOctree.get(), tf1, drequest,
+                       linearDResult);
+    // The distances reach a few thousands: the tolerance is relative in
+    // single precision.
+    BOOST_CHECK_SMALL(
+        dresult.min_distance - linearDResult.min_distance,
+        (std::max)(FCL_REAL(1e-6), 10 * Eigen::NumTraits<FCL_REAL>::epsilon() *
+                                       std::abs(dresult.min_distance)));
+  }
+}
+
+BOOST_AUTO_TEST_CASE(OCTREE_UPDATE_OCCUPIED_LEAVES) {
+  hpp::fcl::shared_ptr<octomap::OcTree> octomap(new octomap::OcTree(0.1));
+  octomap->enableChangeDetection(true);
+  for (int i = 0; i < 1000; ++i) {
+    const Vec3f p(Vec3f::Random());
+    octomap->updateNode(octomap::point3d((float)p[0], (float)p[1], (float)p[2]),
+                        true);
+  }
+  octomap->updateInnerOccupancy();
+  octomap->resetChangeDetection();
+
+  OcTree octree(octomap);
+  octree.buildOccupiedLeaves();
+
+  hpp::fcl::Sphere sphere(0.05);
+  CollisionRequest request;
+  for (int step = 0; step < 5; ++step) {
+    // Integrate a new scan: occupied and free voxels.
+    for (int i = 0; i < 20; ++i) {
+      const Vec3f p(Vec3f::Random());
+      octomap->updateNode(
+          octomap::point3d((float)p[0], (float)p[1], (float)p[2]), i % 2 == 0);
+    }
+    octomap->updateInnerOccupancy();
+    octree.updateOccupiedLeavesFromChangedKeys();
+    octomap->resetChangeDetection();
+
+    OcTree rebuiltOctree(octomap);
+    rebuiltOctree.buildOccupiedLeaves();
+    for (int i = 0; i < 200; ++i) {
+      const Transform3f tf(Vec3f(Vec3f::Random()));
+      CollisionResult result, rebuiltResult;
+      hpp::fcl::collide(&octree, Transform3f(), &sphere, tf, request, result);
+      hpp::fcl::collide(&rebuiltOctree, Transform3f(), &sphere, tf, request,
+                        rebuiltResult);
+      BOOST_CHECK(result.isCollision() == rebuiltResult.isCollision());
+    }
+  }
+}
+
+/// Check that the collisions of small spheres centered at the voxels of
+/// [min_key, max_key] are the same as with a rebuilt hierarchy.
+void checkOccupiedLeavesUpToDate(
+    const OcTree& octree,
+    const hpp::fcl::shared_ptr<octomap::OcTree>& octomap,
+    const octomap::OcTreeKey& min_key, const octomap::OcTreeKey& max_key) {
+  OcTree rebuiltOctree(octomap);
+  rebuiltOctree.buildOccupiedLeaves();
+
+  hpp::fcl::Sphere sphere(0.2 * octomap->getResolution());
+  CollisionRequest request;
+  for (octomap::key_type x = min_key[0]; x <= max_key[0]; ++x)
+    for (octomap::key_type y = min_key[1]; y <= max_key[1]; ++y)
+      for (octomap::key_type z = min_key[2]; z <= max_key[2]; ++z) {
+        const octomap::point3d p =
+            octomap->keyToCoord(octomap::OcTreeKey(x, y, z));
+        const Transform3f tf(Vec3f(p.x(), p.y(), p.z()));
+        CollisionResult result, rebuiltResult;
+        hpp::fcl::collide(&octree, Transform3f(), &sphere, tf, request,
+                          result);
+        hpp::fcl::collide(&rebuiltOctree, Transform3f(), &sphere, tf, request,
+                          rebuiltResult);
+        BOOST_CHECK(result.isCollision() == rebuiltResult.isCollision());
+      }
+}
+
+BOOST_AUTO_TEST_CASE(OCTREE_UPDATE_OCCUPIED_LEAVES_PRUNING) {
+  hpp::fcl::shared_ptr<octomap::OcTree> octomap(new octomap::OcTree(0.1));
+  octomap->enableChangeDetection(true);
+  octomap->updateNode(octomap::point3d(1.f, 1.f, 1.f), true);
+  octomap->updateInnerOccupancy();
+  octomap->resetChangeDetection();
+
+  OcTree octree(octomap);
+  octree.buildOccupiedLeaves();
+
+  // The 8 voxels of a node of depth tree_depth - 1.
+  octomap::OcTreeKey origin = octomap->coordToKey(0.05, 0.05, 0.05);
+  for (unsigned int k = 0; k < 3; ++k)
+    origin[k] = static_cast<octomap::key_type>(origin[k] & ~1u);
+  std::vector<octomap::OcTreeKey> block;
+  for (unsigned int child = 0; child < 8; ++child) {
+    octomap::OcTreeKey key(origin);
+    for (unsigned int k = 0; k < 3; ++k)
+      key[k] = static_cast<octomap::key_type>(key[k] + ((child >> k) & 1u));
+    block.push_back(key);
+  }
+  octomap::OcTreeKey min_key(origin), max_key(origin);
+  for (unsigned int k = 0; k < 3; ++k) {
+    min_key[k] = static_cast<octomap::key_type>(min_key[k] - 2);
+    max_key[k] = static_cast<octomap::key_type>(max_key[k] + 3);
+  }
+
+  // Fill the block voxel by voxel: the leaves are pruned into their parent
+  // once the block is full.
+  for (std::size_t i = 0; i < block.size(); ++i) {
+    octomap->updateNode(block[i], true);
+    octomap->updateInnerOccupancy();
+    octree.updateOccupiedLeavesFromChangedKeys();
+    octomap->resetChangeDetection();
+    checkOccupiedLeavesUpToDate(octree, octomap, min_key, max_key);
+  }
+  octomap::OcTree::leaf_bbx_iterator leaf =
+      octomap->begin_leafs_bbx(block[0], block[0]);
+  BOOST_REQUIRE(leaf != octomap->end_leafs_bbx());
+  BOOST_CHECK_EQUAL(leaf.getDepth(), octomap->getTreeDepth() - 1);
+
+  // Clear one voxel: the pruned leaf is expanded, its 7 other children
+  // remain occupied.
+  const float occupied_log_odds = leaf->getLogOdds();
+  while (octomap->isNodeOccupied(octomap->search(block[3])))
+    octomap->updateNode(block[3], false);
+  octomap->updateInnerOccupancy();
+  octree.updateOccupiedLeavesFromChangedKeys();
+  octomap->resetChangeDetection();
+  checkOccupiedLeavesUpToDate(octree, octomap, min_key, max_key);
+
+  // Fill it again: the block is pruned back.
+  octomap->setNodeValue(block[3], occupied_log_odds);
+  octomap->updateInnerOccupancy();
+  octree.updateOccupiedLeavesFromChangedKeys();
+  octomap->resetChangeDetection();
+  checkOccupiedLeavesUpToDate(octree, octomap, min_key, max_key);
+  leaf = octomap->begin_leafs_bbx(block[0], block[0]);
+  BOOST_REQUIRE(leaf != octomap->end_leafs_bbx());
+  BOOST_CHECK_EQUAL(leaf.getDepth(), octomap->getTreeDepth() - 1);
+}
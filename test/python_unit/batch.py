@@ -0,0 +1,96 @@
+import unittest
+from test_case import TestCase
+import hppfcl
+
+hppfcl.switchToNumpyArray()
+import numpy as np
+
+
+def poses_xyzquat(translations):
+    poses = np.zeros((len(translations), 7))
+    poses[:, :3] = translations
+    poses[:, 6] = 1
+    return poses
+
+
+class TestBatchAPI(TestCase):
+    def setUp(self):
+        self.sphere = hppfcl.Sphere(0.5)
+        self.box = hppfcl.Box(1, 1, 1)
+        self.x = np.linspace(0, 3, 20)
+        self.translations = np.zeros((len(self.x), 3))
+        self.translations[:, 0] = self.x
+
+    def test_collide_poses(self):
+        tf1 = poses_xyzquat(np.zeros((1, 3)))
+        tf2 = poses_xyzquat(self.translations)
+        collisions, lower_bounds = hppfcl.collideBatch(
+            self.sphere, self.box, tf1, tf2, num_threads=4
+        )
+        self.assertEqual(collisions.shape, (len(self.x),))
+        self.assertEqual(collisions.dtype, bool)
+        for i, x in enumerate(self.x):
+            req = hppfcl.CollisionRequest()
+            res = hppfcl.CollisionResult()
+            M2 = hppfcl.Transform3f(np.eye(3), self.translations[i])
+            expected = hppfcl.collide(
+                self.sphere, hppfcl.Transform3f(), self.box, M2, req, res
+            )
+            self.assertEqual(collisions[i], expected > 0)
+
+    def test_distance_matrices(self):
+        tf1 = np.tile(np.eye(4), (len(self.x), 1, 1))
+        tf2 = tf1.copy()
+        tf2[:, :3, 3] = self.translations
+        distances, p1, p2 = hppfcl.distanceBatch(self.sphere, self.box, tf1, tf2)
+        self.assertEqual(p1.shape, (len(self.x), 3))
+        for i, x in enumerate(self.x):
+            if x > 1:
+                self.assertApprox(distances[i], x - 1)
+                self.assertApprox(p1[i], [0.5, 0, 0])
+                self.assertApprox(p2[i], [x - 0.5, 0, 0])
+
+    def test_pairs(self):
+        geometries = [self.sphere, self.box, hppfcl.Sphere(0.1)]
+        transforms = poses_xyzquat([[0, 0, 0], [2, 0, 0], [0, 0.55, 0]])
+        pairs = np.array([[0, 1], [0, 2], [1, 2]])
+        collisions, _ = hppfcl.collideBatch(geometries, transforms, pairs)
+        self.assertEqual(list(collisions), [False, True, False])
+        distances, _, _ = hppfcl.distanceBatch(geometries, transforms, pairs)
+        self.assertApprox(distances[0], 1)
+
+    def test_empty_poses(self):
+        for tf1, tf2 in [
+            (np.zeros((0, 7)), poses_xyzquat(np.zeros((1, 3)))),
+            (poses_xyzquat(np.zeros((1, 3))), np.zeros((0, 7))),
+            (np.zeros((0, 7)), np.zeros((0, 7))),
+        ]:
+            collisions, lower_bounds = hppfcl.collideBatch(
+                self.sphere, self.box, tf1, tf2
+            )
+            self.assertEqual(collisions.shape, (0,))
+            self.assertEqual(lower_bounds.shape, (0,))
+            distances, p1, p2 = hppfcl.distanceBatch(self.sphere, self.box, tf1, tf2)
+            self.assertEqual(distances.shape, (0,))
+            self.assertEqual(p1.shape, (0, 3))
+        with self.assertRaises(ValueError):
+            hppfcl.collideBatch(
+                self.sphere,
+                self.box,
+                np.zeros((0, 7)),
+                poses_xyzquat(np.zeros((2, 3))),
+            )
+
+    def test_invalid_arguments(self):
+        with self.assertRaises(ValueError):
+            hppfcl.collideBatch(
+                self.sphere, self.box, np.zeros((3, 6)), np.zeros((3, 6))
+            )
+        with self.assertRaises(IndexError):
+            hppfcl.collideBatch(
+                [self.sphere], poses_xyzquat([[0, 0, 0]]), np.array([[0, 1]])
+            )
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,86 @@
+import unittest
+from test_case import TestCase
+import hppfcl
+
+hppfcl.switchToNumpyArray()
+import numpy as np
+
+
+class TestBroadPhase(TestCase):
+    def setUp(self):
+        # Spheres of radius 0.5 along the x axis, the first four overlapping
+        # their neighbours.
+        self.x = [0.0, 0.8, 1.6, 2.4, 4.0, 6.0]
+        self.objects = []
+        for x in self.x:
+            obj = hppfcl.CollisionObject(hppfcl.Sphere(0.5))
+            obj.setTransform(hppfcl.Transform3f(np.eye(3), np.array([x, 0, 0])))
+            self.objects.append(obj)
+
+    def expected_pairs(self):
+        pairs = []
+        for i in range(len(self.objects)):
+            for j in range(i + 1, len(self.objects)):
+                req = hppfcl.CollisionRequest()
+                res = hppfcl.CollisionResult()
+                if hppfcl.collide(self.objects[i], self.objects[j], req, res):
+                    pairs.append([i, j])
+        return np.array(pairs).reshape(-1, 2)
+
+    def test_colliding_pairs(self):
+        expected = self.expected_pairs()
+        self.assertEqual(expected.shape, (3, 2))
+        for manager in [
+            hppfcl.NaiveCollisionManager(),
+            hppfcl.SaPCollisionManager(),
+            hppfcl.DynamicAABBTreeCollisionManager(),
+            hppfcl.DynamicAABBTreeArrayCollisionManager(),
+        ]:
+            manager.registerObjects(self.objects)
+            manager.setup()
+            pairs = manager.collidingPairs(objects=self.objects)
+            self.assertEqual(pairs.shape, (3, 2))
+            self.assertTrue((pairs == expected).all())
+
+            # Indices in getObjects() by default.
+            registered = manager.getObjects()
+            pairs = manager.collidingPairs()
+            self.assertEqual(len(pairs), 3)
+            for i, j in pairs:
+                self.assertTrue(i < j)
+                k = self.objects.index(registered[i])
+                l = self.objects.index(registered[j])
+                self.assertTrue([min(k, l), max(k, l)] in expected.tolist())
+
+    def test_colliding_pairs_request(self):
+        manager = hppfcl.DynamicAABBTreeCollisionManager()
+        manager.registerObjects(self.objects)
+        manager.setup()
+        # The spheres penetrate by 0.2 at most.
+        request = hppfcl.CollisionRequest()
+        request.security_margin = -0.3
+        pairs = manager.collidingPairs(request, self.objects)
+        self.assertEqual(pairs.shape, (0, 2))
+
+    def test_unknown_object(self):
+        manager = hppfcl.NaiveCollisionManager()
+        manager.registerObjects(self.objects)
+        manager.setup()
+        with self.assertRaises(ValueError):
+            manager.collidingPairs(objects=self.objects[1:])
+
+    def test_callback(self):
+        manager = hppfcl.NaiveCollisionManager()
+        manager.registerObjects(self.objects)
+        manager.setup()
+        callback = hppfcl.CollisionCallBackCollectColliding()
+        manager.collide(callback)
+        pairs = callback.getCollisionPairs()
+        self.assertEqual(len(pairs), 3)
+        for o1, o2 in pairs:
+            self.assertIsInstance(o1, hppfcl.CollisionObject)
+            self.assertIsInstance(o2, hppfcl.CollisionObject)
+
+
+if __name__ == "__main__":
+    unittest.main()
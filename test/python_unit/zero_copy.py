@@ -0,0 +1,134 @@
+import unittest
+from test_case import TestCase
+import hppfcl
+
+hppfcl.switchToNumpyArray()
+import numpy as np
+
+
+def box_mesh():
+    vertices = 0.5 * np.array(
+        [
+            [-1, -1, -1],
+            [1, -1, -1],
+            [1, 1, -1],
+            [-1, 1, -1],
+            [-1, -1, 1],
+            [1, -1, 1],
+            [1, 1, 1],
+            [-1, 1, 1],
+        ],
+        dtype=np.float64,
+    )
+    triangles = np.array(
+        [
+            [0, 2, 1],
+            [0, 3, 2],
+            [4, 5, 6],
+            [4, 6, 7],
+            [0, 1, 5],
+            [0, 5, 4],
+            [1, 2, 6],
+            [1, 6, 5],
+            [2, 3, 7],
+            [2, 7, 6],
+            [3, 0, 4],
+            [3, 4, 7],
+        ],
+        dtype=np.int64,
+    )
+    return vertices, triangles
+
+
+class TestZeroCopy(TestCase):
+    def test_bvh_model(self):
+        vertices, triangles = box_mesh()
+        model = hppfcl.BVHModelOBBRSS(vertices, triangles)
+        self.assertEqual(model.num_vertices, 8)
+        self.assertEqual(model.num_tris, 12)
+        self.assertEqual(
+            model.build_state, hppfcl.BVHBuildState.BVH_BUILD_STATE_PROCESSED
+        )
+
+        # The model and the arrays share their memory.
+        view = model.vertices()
+        self.assertTrue(np.shares_memory(view, vertices))
+        tris = model.triangles()
+        self.assertFalse(tris.flags.writeable)
+        self.assertTrue(np.array_equal(tris, triangles))
+        self.assertTrue(np.shares_memory(tris, triangles))
+
+        # The views keep the model alive.
+        del model
+        self.assertTrue(np.array_equal(tris, triangles))
+
+        # Triangles of another integer type are converted.
+        model = hppfcl.BVHModelOBB(vertices, triangles.astype(np.int32))
+        self.assertTrue(np.array_equal(model.triangles(), triangles))
+
+        # Point cloud.
+        model = hppfcl.BVHModelOBB(vertices)
+        self.assertEqual(model.num_tris, 0)
+        self.assertEqual(model.triangles().shape, (0, 3))
+
+    def test_bvh_model_collision(self):
+        vertices, triangles = box_mesh()
+        model = hppfcl.BVHModelOBBRSS(vertices, triangles)
+        req = hppfcl.DistanceRequest()
+        res = hppfcl.DistanceResult()
+        M = hppfcl.Transform3f(np.eye(3), np.array([2.0, 0, 0]))
+        distance = hppfcl.distance(
+            model, hppfcl.Transform3f(), hppfcl.Sphere(0.5), M, req, res
+        )
+        self.assertApprox(distance, 1.0)
+
+    def test_invalid_arrays(self):
+        vertices, triangles = box_mesh()
+        with self.assertRaises(ValueError):
+            hppfcl.BVHModelOBBRSS(vertices.astype(np.float32), triangles)
+        with self.assertRaises(ValueError):
+            hppfcl.BVHModelOBBRSS(vertices[:, :2].copy(), triangles)
+        with self.assertRaises(ValueError):
+            hppfcl.BVHModelOBBRSS(vertices, triangles + 8)
+        with self.assertRaises(ValueError):
+            hppfcl.BVHModelOBBRSS(vertices, triangles.astype(np.float64))
+        negative = triangles.astype(np.int32)
+        negative[2, 1] = -1
+        with self.assertRaisesRegex(ValueError, "index 1 of the triangle 2"):
+            hppfcl.BVHModelOBBRSS(vertices, negative)
+        with self.assertRaisesRegex(ValueError, "index 1 of the triangle 2"):
+            hppfcl.BVHModelOBBRSS(vertices, negative.astype(np.int64))
+        read_only = vertices.copy()
+        read_only.flags.writeable = False
+        with self.assertRaises(BufferError):
+            hppfcl.BVHModelOBBRSS(read_only, triangles)
+
+    def test_convex(self):
+        vertices, triangles = box_mesh()
+        convex = hppfcl.Convex(vertices, triangles)
+        self.assertEqual(convex.num_points, 8)
+        self.assertEqual(convex.num_polygons, 12)
+        self.assertTrue(np.shares_memory(convex.points(), vertices))
+        with self.assertRaises(IndexError):
+            hppfcl.Convex(vertices, triangles + 8)
+
+    def test_height_field(self):
+        heights = np.random.rand(5, 6)
+        hfield = hppfcl.HeightFieldOBBRSS(1.0, 2.0, heights)
+        stored = hfield.storedHeights()
+        self.assertFalse(stored.flags.writeable)
+        self.assertEqual(stored.dtype, np.float64)
+        self.assertApprox(stored, heights)
+
+        hfield = hppfcl.HeightFieldOBBRSS(
+            1.0, 2.0, heights, 0.0, hppfcl.HeightFieldStorage.HF_STORAGE_FLOAT
+        )
+        self.assertEqual(hfield.storedHeights().dtype, np.float32)
+        hfield = hppfcl.HeightFieldOBBRSS(
+            1.0, 2.0, heights, 0.0, hppfcl.HeightFieldStorage.HF_STORAGE_UINT16
+        )
+        self.assertEqual(hfield.storedHeights().dtype, np.uint16)
+
+
+if __name__ == "__main__":
+    unittest.main()
@@ -0,0 +1,156 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define BOOST_TEST_MODULE FCL_QUERY_PROFILE
+#include <boost/test/included/unit_test.hpp>
+
+#include <hpp/fcl/collision.h>
+#include <hpp/fcl/distance.h>
+#include <hpp/fcl/shape/geometric_shapes.h>
+#include <hpp/fcl/shape/geometric_shape_to_BVH_model.h>
+
+#include "utility.h"
+
+using namespace hpp::fcl;
+
+void checkEmpty(const QueryProfile& profile) {
+  BOOST_CHECK_EQUAL(profile.num_bv_tests, 0);
+  BOOST_CHECK_EQUAL(profile.num_leaf_tests, 0);
+  BOOST_CHECK_EQUAL(profile.num_gjk_calls, 0);
+  BOOST_CHECK_EQUAL(profile.num_epa_calls, 0);
+  BOOST_CHECK_EQUAL(profile.num_support_calls, 0);
+  BOOST_CHECK_EQUAL(profile.traversal_time, 0);
+  BOOST_CHECK_EQUAL(profile.narrowphase_time, 0);
+}
+
+BOOST_AUTO_TEST_CASE(shape_shape) {
+  Box box(1, 1, 1);
+  const Transform3f tf1, tf2(Vec3f(0.5, 0.1, 0));
+
+  CollisionRequest request(CONTACT, 1);
+  CollisionResult result;
+  collide(&box, tf1, &box, tf2, request, result);
+  BOOST_CHECK(result.isCollision());
+  checkEmpty(result.profile);
+
+  // The boxes are in deep penetration: EPA is run after GJK.
+  request.enable_profiling = true;
+  CollisionResult profiled;
+  collide(&box, tf1, &box, tf2, request, profiled);
+  BOOST_CHECK(profiled.isCollision());
+  BOOST_CHECK(profiled.getContact(0) == result.getContact(0));
+
+  const QueryProfile& profile = profiled.profile;
+  BOOST_CHECK_EQUAL(profile.num_bv_tests, 0);
+  BOOST_CHECK_EQUAL(profile.num_leaf_tests, 1);
+  BOOST_CHECK_EQUAL(profile.num_gjk_calls, 1);
+  BOOST_CHECK(profile.num_gjk_iterations > 0);
+  BOOST_CHECK_EQUAL(profile.num_epa_calls, 1);
+  BOOST_CHECK(profile.num_epa_faces >= 4);
+  BOOST_CHECK(profile.num_support_calls >
+              profile.num_gjk_iterations + profile.num_epa_iterations);
+  BOOST_CHECK_EQUAL(profile.traversal_time, 0);
+  BOOST_CHECK(profile.narrowphase_time >= 0);
+
+  // The profile describes the last query only.
+  ComputeCollision compute(&box, &box);
+  profiled.clear();
+  compute(tf1, tf2, request, profiled);
+  BOOST_CHECK_EQUAL(profiled.profile.num_gjk_calls, 1);
+  BOOST_CHECK_EQUAL(profiled.profile.num_epa_calls, 1);
+
+  DistanceRequest drequest;
+  drequest.enable_profiling = true;
+  DistanceResult dresult;
+  distance(&box, tf1, &box, Transform3f(Vec3f(2, 0, 0)), drequest, dresult);
+  BOOST_CHECK_EQUAL(dresult.profile.num_leaf_tests, 1);
+  BOOST_CHECK_EQUAL(dresult.profile.num_gjk_calls, 1);
+  BOOST_CHECK_EQUAL(dresult.profile.num_epa_calls, 0);
+
+  dresult.clear();
+  checkEmpty(dresult.profile);
+}
+
+BOOST_AUTO_TEST_CASE(mesh_shape) {
+  BVHModel<OBBRSS> mesh;
+  generateBVHModel(mesh, Sphere(1), Transform3f(), 16, 16);
+  Box box(0.5, 0.5, 0.5);
+  const Transform3f tf2(Vec3f(0.9, 0, 0));
+
+  CollisionRequest request(CONTACT, 1000);
+  request.enable_profiling = true;
+  CollisionResult result;
+  collide(&mesh, Transform3f(), &box, tf2, request, result);
+  BOOST_CHECK(result.isCollision());
+
+  // Each leaf test between a triangle and the box runs GJK once.
+  const QueryProfile& profile = result.profile;
+  BOOST_CHECK(profile.num_bv_tests > 0);
+  BOOST_CHECK(profile.num_leaf_tests > 0);
+  BOOST_CHECK(profile.num_leaf_tests < (unsigned int)mesh.num_tris);
+  BOOST_CHECK_EQUAL(profile.num_gjk_calls, profile.num_leaf_tests);
+  BOOST_CHECK(profile.traversal_time >= 0);
+  BOOST_CHECK(profile.narrowphase_time > 0);
+
+  // The counts do not depend on the order of the objects.
+  CollisionResult swapped;
+  collide(&box, tf2, &mesh, Transform3f(), request, swapped);
+  BOOST_CHECK_EQUAL(swapped.profile.num_bv_tests, profile.num_bv_tests);
+  BOOST_CHECK_EQUAL(swapped.profile.num_leaf_tests, profile.num_leaf_tests);
+  BOOST_CHECK_EQUAL(swapped.numContacts(), result.numContacts());
+}
+
+BOOST_AUTO_TEST_CASE(mesh_mesh) {
+  BVHModel<OBBRSS> mesh;
+  generateBVHModel(mesh, Sphere(1), Transform3f(), 16, 16);
+  const Transform3f tf2(Vec3f(3, 0, 0));
+
+  DistanceRequest request;
+  DistanceResult result;
+  const FCL_REAL d =
+      distance(&mesh, Transform3f(), &mesh, tf2, request, result);
+  checkEmpty(result.profile);
+
+  request.enable_profiling = true;
+  DistanceResult profiled;
+  BOOST_CHECK_EQUAL(
+      distance(&mesh, Transform3f(), &mesh, tf2, request, profiled), d);
+
+  // Triangles are tested without GJK.
+  const QueryProfile& profile = profiled.profile;
+  BOOST_CHECK(profile.num_bv_tests > 0);
+  BOOST_CHECK(profile.num_leaf_tests > 0);
+  BOOST_CHECK_EQUAL(profile.num_gjk_calls, 0);
+  BOOST_CHECK(profile.traversal_time > 0);
+}
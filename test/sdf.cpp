@@ -0,0 +1,223 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define BOOST_TEST_MODULE FCL_SDF
+#include <boost/test/included/unit_test.hpp>
+
+#include <hpp/fcl/collision.h>
+#include <hpp/fcl/distance.h>
+#include <hpp/fcl/sdf.h>
+#include <hpp/fcl/linear_octree.h>
+#include <hpp/fcl/shape/geometric_shapes.h>
+#include <hpp/fcl/shape/geometric_shape_to_BVH_model.h>
+
+#include "utility.h"
+
+using namespace hpp::fcl;
+
+/// Tolerance on the values which are exact up to rounding errors.
+const FCL_REAL eps = (std::max)(FCL_REAL(1e-8),
+                                1000 * Eigen::NumTraits<FCL_REAL>::epsilon());
+
+/// Signed distance to the box [-0.5, 0.5]^3.
+FCL_REAL unitBoxDistance(const Vec3f& p) {
+  const Vec3f q(p.cwiseAbs() - Vec3f::Constant(0.5));
+  return q.cwiseMax(FCL_REAL(0)).norm() + std::min(q.maxCoeff(), FCL_REAL(0));
+}
+
+BOOST_AUTO_TEST_CASE(sdf_from_mesh) {
+  BVHModel<OBBRSS> mesh;
+  generateBVHModel(mesh, Box(1., 1., 1.), Transform3f());
+
+  const FCL_REAL resolution = FCL_REAL(0.05);
+  SignedDistanceFieldPtr_t sdf(
+      makeSignedDistanceField(mesh, resolution, FCL_REAL(0.3)));
+  BOOST_CHECK(sdf->getDims() == SignedDistanceField::Dims(33, 33, 33));
+
+  for (int i = 0; i < 1000; ++i) {
+    const Vec3f p(Vec3f::Random());
+    Vec3f gradient;
+    const FCL_REAL d = sdf->computeDistance(p, gradient);
+    BOOST_CHECK_SMALL(d - unitBoxDistance(p), resolution);
+  }
+
+  Vec3f gradient;
+  BOOST_CHECK_SMALL(sdf->computeDistance(Vec3f(FCL_REAL(0.7), FCL_REAL(0.1), 0),
+                                         gradient) -
+                        FCL_REAL(0.2),
+                    FCL_REAL(1e-6));
+  BOOST_CHECK(gradient.isApprox(Vec3f(1., 0., 0.), 100 * eps));
+  BOOST_CHECK_SMALL(
+      sdf->computeDistance(Vec3f(0, FCL_REAL(-0.4), FCL_REAL(0.1))) +
+          FCL_REAL(0.1),
+      FCL_REAL(1e-6));
+  // Extrapolation outside of the grid.
+  BOOST_CHECK_SMALL(sdf->computeDistance(Vec3f(0., 0., 2.)) - FCL_REAL(1.5),
+                    FCL_REAL(1e-6));
+}
+
+BOOST_AUTO_TEST_CASE(sdf_from_occupancy) {
+  const FCL_REAL resolution = FCL_REAL(0.1);
+  const SignedDistanceField::Dims dims(5, 5, 5);
+  std::vector<bool> occupied((std::size_t)dims.prod(), false);
+  occupied[2 + 5 * (2 + 5 * 2)] = true;
+  SignedDistanceFieldPtr_t sdf(
+      makeSignedDistanceField(Vec3f::Zero(), resolution, dims, occupied));
+
+  BOOST_CHECK_CLOSE(sdf->getValue(2, 2, 2), -0.05, eps);
+  BOOST_CHECK_CLOSE(sdf->getValue(3, 2, 2), 0.05, eps);
+  BOOST_CHECK_CLOSE(sdf->getValue(3, 3, 2), (std::sqrt(2.) - 0.5) * 0.1, eps);
+  BOOST_CHECK_CLOSE(sdf->getValue(0, 0, 0), (std::sqrt(12.) - 0.5) * 0.1, eps);
+
+  LinearOcTree tree(resolution);
+  Eigen::Matrix<FCL_REAL, Eigen::Dynamic, 3> points(2, 3);
+  points << 1, 1, 1, 7, 1, 1;
+  points *= resolution / 2;
+  tree.setOccupiedPoints(points);
+  sdf = makeSignedDistanceField(tree, FCL_REAL(0.2));
+  BOOST_CHECK(sdf->getDims() == SignedDistanceField::Dims(8, 5, 5));
+  BOOST_CHECK_CLOSE(sdf->computeDistance(points.row(0).transpose()), -0.05,
+                    eps);
+  BOOST_CHECK_CLOSE(sdf->computeDistance(points.row(1).transpose()), -0.05,
+                    eps);
+  BOOST_CHECK_CLOSE(sdf->computeDistance(Vec3f(3, 1, 1) * resolution / 2), 0.05,
+                    eps);
+  BOOST_CHECK_CLOSE(sdf->computeDistance(Vec3f(1, 1, 5) * resolution / 2), 0.15,
+                    eps);
+}
+
+BOOST_AUTO_TEST_CASE(sdf_shape_collision_distance) {
+  const Box unit_box(1., 1., 1.);
+  BVHModel<OBBRSS> mesh;
+  generateBVHModel(mesh, unit_box, Transform3f());
+
+  const FCL_REAL resolution = FCL_REAL(0.05);
+  SignedDistanceFieldPtr_t sdf(
+      makeSignedDistanceField(mesh, resolution, FCL_REAL(0.3)));
+  const FCL_REAL tolerance = std::sqrt(FCL_REAL(3)) * resolution;
+  Transform3f tf1;
+  tf1.setQuatRotation(makeQuat(0., 0., 0., 1.));
+  tf1.setTranslation(Vec3f(1, 2, 3) / 10);
+  const Sphere sphere(FCL_REAL(0.1));
+  const Box box(FCL_REAL(0.2), FCL_REAL(0.1), FCL_REAL(0.3));
+
+  DistanceRequest drequest;
+  CollisionRequest crequest(CONTACT, 1);
+  for (int i = 0; i < 100; ++i) {
+    const Vec3f center(Vec3f::Random());
+    const Transform3f tf2(tf1 * Transform3f(center));
+
+    // The sphere is exact.
+    const FCL_REAL expected = unitBoxDistance(center) - sphere.radius;
+    DistanceResult dresult;
+    FCL_REAL d = distance(sdf.get(), tf1, &sphere, tf2, drequest, dresult);
+    BOOST_CHECK_SMALL(d - expected, tolerance);
+    BOOST_CHECK_SMALL((dresult.nearest_points[1] - dresult.nearest_points[0])
+                              .norm() -
+                          std::fabs(d),
+                      eps);
+
+    DistanceResult dresult_swapped;
+    FCL_REAL d_swapped =
+        distance(&sphere, tf2, sdf.get(), tf1, drequest, dresult_swapped);
+    BOOST_CHECK_SMALL(d - d_swapped, eps);
+
+    CollisionResult cresult;
+    collide(sdf.get(), tf1, &sphere, tf2, crequest, cresult);
+    if (expected < -tolerance) BOOST_CHECK(cresult.isCollision());
+    if (expected > tolerance) BOOST_CHECK(!cresult.isCollision());
+    if (cresult.isCollision()) {
+      const Contact& contact = cresult.getContact(0);
+      BOOST_CHECK(contact.o1 == sdf.get());
+      BOOST_CHECK_SMALL(contact.penetration_depth + d, eps);
+    }
+
+    // When separated, the distance to the box matches the one between the
+    // boxes.
+    DistanceResult box_dresult, unit_box_dresult;
+    d = distance(sdf.get(), tf1, &box, tf2, drequest, box_dresult);
+    const FCL_REAL box_d =
+        distance(&unit_box, tf1, &box, tf2, drequest, unit_box_dresult);
+    if (box_d > 0) BOOST_CHECK_SMALL(d - box_d, tolerance);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(sdf_plane_halfspace_distance) {
+  BVHModel<OBBRSS> mesh;
+  generateBVHModel(mesh, Box(1., 1., 1.), Transform3f());
+
+  const FCL_REAL resolution = FCL_REAL(0.05);
+  SignedDistanceFieldPtr_t sdf(
+      makeSignedDistanceField(mesh, resolution, FCL_REAL(0.3)));
+  const FCL_REAL tolerance = std::sqrt(FCL_REAL(3)) * resolution;
+  const std::vector<VecXf>& bounds = sdf->getBlockBounds();
+  BOOST_CHECK(sdf->getBlockDims().back() == SignedDistanceField::Dims(1, 1, 1));
+  BOOST_CHECK_EQUAL(bounds.back()[0], sdf->getValues().minCoeff());
+
+  Transform3f tf1;
+  tf1.setQuatRotation(makeQuat(0., 0., 0., 1.));
+  tf1.setTranslation(Vec3f(1, 2, 3) / 10);
+  DistanceRequest drequest;
+  for (int i = 0; i < 100; ++i) {
+    // Planes and halfspaces z = offset in the frame of the box, tilted.
+    const FCL_REAL offset = FCL_REAL(2.5) * Vec3f::Random()[0];
+    const Vec3f n(Vec3f(FCL_REAL(0.2) * Vec3f::Random()[0],
+                        FCL_REAL(0.2) * Vec3f::Random()[1], 1.)
+                      .normalized());
+    // Support of the unit box along n and -n.
+    const FCL_REAL support = n.cwiseAbs().sum() / 2;
+    const Plane plane(n, offset);
+    const Halfspace halfspace(n, offset);
+
+    // The distance to the plane is the one to the box when separated, and
+    // the penetration of the field otherwise, smaller than the box support.
+    DistanceResult dresult;
+    const FCL_REAL d_plane =
+        distance(sdf.get(), tf1, &plane, tf1, drequest, dresult);
+    if (std::fabs(offset) > support)
+      BOOST_CHECK_SMALL(d_plane - (std::fabs(offset) - support), tolerance);
+    else
+      BOOST_CHECK(d_plane < tolerance);
+
+    // The halfspace n.x <= offset contains the box when offset is larger than
+    // its support, and then reaches the center of the box.
+    dresult.clear();
+    const FCL_REAL d_halfspace =
+        distance(sdf.get(), tf1, &halfspace, tf1, drequest, dresult);
+    if (offset < -support)
+      BOOST_CHECK_SMALL(d_halfspace - (-offset - support), tolerance);
+    else if (offset >= 0)
+      BOOST_CHECK_SMALL(d_halfspace + FCL_REAL(0.5), tolerance);
+  }
+}
@@ -59,6 +59,14 @@ using hpp::fcl::Vec3f;
 
 #define MATH_SQUARED(x) (x * x)
 
+// Tolerances of BOOST_CHECK_SMALL and of BOOST_CHECK_CLOSE (in percent). The
+// distances are differences of translations, rounded at the precision of
+// FCL_REAL.
+static const FCL_REAL small_tol =
+    (std::max)(FCL_REAL(1e-8), 100 * Eigen::NumTraits<FCL_REAL>::epsilon());
+static const FCL_REAL close_tol =
+    (std::max)(FCL_REAL(1e-8), 10000 * Eigen::NumTraits<FCL_REAL>::epsilon());
+
 BOOST_AUTO_TEST_CASE(aabb_aabb) {
   CollisionGeometryPtr_t b1(new hpp::fcl::Box(1, 1, 1));
   CollisionGeometryPtr_t b2(new hpp::fcl::Box(1, 1, 1));
@@ -67,7 +75,6 @@ BOOST_AUTO_TEST_CASE(aabb_aabb) {
   const Transform3f tf2_collision(Vec3f(0, 1, 1));
   hpp::fcl::Box s1(1, 1, 1);
   hpp::fcl::Box s2(1, 1, 1);
-  const double tol = 1e-8;
 
   AABB bv1, bv2;
   computeBV(s1, Transform3f(), bv1);
@@ -82,13 +89,13 @@ BOOST_AUTO_TEST_CASE(aabb_aabb) {
     bool res =
         bv1.overlap(bv2_transformed, collisionRequest, sqrDistLowerBound);
     BOOST_CHECK(res);
-    BOOST_CHECK_CLOSE(sqrDistLowerBound, 0, tol);
+    BOOST_CHECK_CLOSE(sqrDistLowerBound, 0, close_tol);
   }
 
   // No security margin - no collision
   {
     CollisionRequest collisionRequest(CONTACT, 1);
-    const double distance = 0.01;
+    const FCL_REAL distance = FCL_REAL(0.01);
     Transform3f tf2_no_collision(
         Vec3f(tf2_collision.getTranslation() + Vec3f(0, 0, distance)));
     AABB bv2_transformed;
@@ -97,13 +104,13 @@ BOOST_AUTO_TEST_CASE(aabb_aabb) {
     bool res =
         bv1.overlap(bv2_transformed, collisionRequest, sqrDistLowerBound);
     BOOST_CHECK(!res);
-    BOOST_CHECK_CLOSE(sqrDistLowerBound, MATH_SQUARED(distance), tol);
+    BOOST_CHECK_CLOSE(sqrDistLowerBound, MATH_SQUARED(distance), close_tol);
   }
 
   // Security margin - collision
   {
     CollisionRequest collisionRequest(CONTACT, 1);
-    const double distance = 0.01;
+    const FCL_REAL distance = FCL_REAL(0.01);
     collisionRequest.security_margin = distance;
     Transform3f tf2_no_collision(
         Vec3f(tf2_collision.getTranslation() + Vec3f(0, 0, distance)));
@@ -113,13 +120,13 @@ BOOST_AUTO_TEST_CASE(aabb_aabb) {
     bool res =
         bv1.overlap(bv2_transformed, collisionRequest, sqrDistLowerBound);
     BOOST_CHECK(res);
-    BOOST_CHECK_SMALL(sqrDistLowerBound, tol);
+    BOOST_CHECK_SMALL(sqrDistLowerBound, small_tol);
   }
 
   // Negative security margin - collion because the two boxes are in contact
   {
     CollisionRequest collisionRequest(CONTACT, 1);
-    const double distance = -0.01;
+    const FCL_REAL distance = FCL_REAL(-0.01);
     collisionRequest.security_margin = distance;
     const Transform3f tf2(
         Vec3f(tf2_collision.getTranslation() + Vec3f(0, distance, distance)));
@@ -129,13 +136,13 @@ BOOST_AUTO_TEST_CASE(aabb_aabb) {
     bool res =
         bv1.overlap(bv2_transformed, collisionRequest, sqrDistLowerBound);
     BOOST_CHECK(res);
-    BOOST_CHECK_SMALL(sqrDistLowerBound, tol);
+    BOOST_CHECK_SMALL(sqrDistLowerBound, small_tol);
   }
 
   // Negative security margin - no collision
   {
     CollisionRequest collisionRequest(CONTACT, 1);
-    const double distance = -0.01;
+    const FCL_REAL distance = FCL_REAL(-0.01);
     collisionRequest.security_margin = distance;
     AABB bv2_transformed;
     computeBV(s2, tf2_collision, bv2_transformed);
@@ -143,9 +150,10 @@ BOOST_AUTO_TEST_CASE(aabb_aabb) {
     bool res =
         bv1.overlap(bv2_transformed, collisionRequest, sqrDistLowerBound);
     BOOST_CHECK(!res);
-    BOOST_CHECK_CLOSE(
-        sqrDistLowerBound,
-        MATH_SQUARED((std::sqrt(2) * collisionRequest.security_margin)), tol);
+    BOOST_CHECK_CLOSE(sqrDistLowerBound,
+                      MATH_SQUARED((std::sqrt(FCL_REAL(2)) *
+                                    collisionRequest.security_margin)),
+                      close_tol);
   }
 }
 
@@ -165,7 +173,7 @@ BOOST_AUTO_TEST_CASE(aabb_aabb_degenerated_cases) {
   // The two AABB are collocated
   {
     CollisionRequest collisionRequest(CONTACT, 1);
-    const double distance = -2.;
+    const FCL_REAL distance = -2;
     collisionRequest.security_margin = distance;
     AABB bv2_transformed;
     computeBV(s2, tf2_collision, bv2_transformed);
@@ -193,64 +201,66 @@ BOOST_AUTO_TEST_CASE(sphere_sphere) {
     collide(s1.get(), tf1, s2.get(), tf2_collision, collisionRequest,
             collisionResult);
     BOOST_CHECK(collisionResult.isCollision());
-    BOOST_CHECK_CLOSE(collisionResult.distance_lower_bound, 0, 1e-8);
-    BOOST_CHECK_SMALL(-collisionResult.getContact(0).penetration_depth, 1e-8);
+    BOOST_CHECK_CLOSE(collisionResult.distance_lower_bound, 0, close_tol);
+    BOOST_CHECK_SMALL(-collisionResult.getContact(0).penetration_depth,
+                      small_tol);
   }
 
   // No security margin - no collision
   {
     CollisionRequest collisionRequest(CONTACT, 1);
     CollisionResult collisionResult;
-    const double distance = 0.01;
+    const FCL_REAL distance = FCL_REAL(0.01);
     Transform3f tf2_no_collision(
         Vec3f(tf2_collision.getTranslation() + Vec3f(0, 0, distance)));
     collide(s1.get(), tf1, s2.get(), tf2_no_collision, collisionRequest,
             collisionResult);
     BOOST_CHECK(!collisionResult.isCollision());
-    BOOST_CHECK_CLOSE(collisionResult.distance_lower_bound, distance, 1e-8);
+    BOOST_CHECK_CLOSE(collisionResult.distance_lower_bound, distance,
+                      close_tol);
   }
 
   // Positive security margin - collision
   {
     CollisionRequest collisionRequest(CONTACT, 1);
     CollisionResult collisionResult;
-    const double distance = 0.01;
+    const FCL_REAL distance = FCL_REAL(0.01);
     collisionRequest.security_margin = distance;
     Transform3f tf2_no_collision(
         Vec3f(tf2_collision.getTranslation() + Vec3f(0, 0, distance)));
     collide(s1.get(), tf1, s2.get(), tf2_no_collision, collisionRequest,
             collisionResult);
     BOOST_CHECK(collisionResult.isCollision());
-    BOOST_CHECK_CLOSE(collisionResult.distance_lower_bound, 0, 1e-8);
+    BOOST_CHECK_CLOSE(collisionResult.distance_lower_bound, 0, close_tol);
     BOOST_CHECK_CLOSE(-collisionResult.getContact(0).penetration_depth,
-                      distance, 1e-8);
+                      distance, close_tol);
   }
 
   // Negative security margin - collion because the two spheres are in contact
   {
     CollisionRequest collisionRequest(CONTACT, 1);
     CollisionResult collisionResult;
-    const double distance = -0.01;
+    const FCL_REAL distance = FCL_REAL(-0.01);
     collisionRequest.security_margin = distance;
     Transform3f tf2(
         Vec3f(tf2_collision.getTranslation() + Vec3f(0, 0, distance)));
     collide(s1.get(), tf1, s2.get(), tf2, collisionRequest, collisionResult);
     BOOST_CHECK(collisionResult.isCollision());
-    BOOST_CHECK_SMALL(collisionResult.distance_lower_bound, 1e-8);
+    BOOST_CHECK_SMALL(collisionResult.distance_lower_bound, small_tol);
     BOOST_CHECK_CLOSE(-collisionResult.getContact(0).penetration_depth,
-                      distance, 1e-8);
+                      distance, close_tol);
   }
 
   // Negative security margin - no collision
   {
     CollisionRequest collisionRequest(CONTACT, 1);
     CollisionResult collisionResult;
-    collisionRequest.security_margin = -0.01;
+    collisionRequest.security_margin = FCL_REAL(-0.01);
     collide(s1.get(), tf1, s2.get(), tf2_collision, collisionRequest,
             collisionResult);
     BOOST_CHECK(!collisionResult.isCollision());
     BOOST_CHECK_CLOSE(collisionResult.distance_lower_bound,
-                      -collisionRequest.security_margin, 1e-8);
+                      -collisionRequest.security_margin, close_tol);
   }
 }
 
@@ -268,63 +278,66 @@ BOOST_AUTO_TEST_CASE(capsule_capsule) {
     collide(c1.get(), tf1, c2.get(), tf2_collision, collisionRequest,
             collisionResult);
     BOOST_CHECK(collisionResult.isCollision());
-    BOOST_CHECK_SMALL(collisionResult.distance_lower_bound, 1e-8);
-    BOOST_CHECK_SMALL(-collisionResult.getContact(0).penetration_depth, 1e-8);
+    BOOST_CHECK_SMALL(collisionResult.distance_lower_bound, small_tol);
+    BOOST_CHECK_SMALL(-collisionResult.getContact(0).penetration_depth,
+                      small_tol);
   }
 
   // No security margin - no collision
   {
     CollisionRequest collisionRequest(CONTACT, 1);
     CollisionResult collisionResult;
-    const double distance = 0.01;
+    const FCL_REAL distance = FCL_REAL(0.01);
     Transform3f tf2_no_collision(
         Vec3f(tf2_collision.getTranslation() + Vec3f(0, distance, 0)));
     collide(c1.get(), tf1, c2.get(), tf2_no_collision, collisionRequest,
             collisionResult);
     BOOST_CHECK(!collisionResult.isCollision());
-    BOOST_CHECK_CLOSE(collisionResult.distance_lower_bound, distance, 1e-8);
+    BOOST_CHECK_CLOSE(collisionResult.distance_lower_bound, distance,
+                      close_tol);
   }
 
   // Positive security margin - collision
   {
     CollisionRequest collisionRequest(CONTACT, 1);
     CollisionResult collisionResult;
-    const double distance = 0.01;
+    const FCL_REAL distance = FCL_REAL(0.01);
     collisionRequest.security_margin = distance;
     Transform3f tf2_no_collision(
         Vec3f(tf2_collision.getTranslation() + Vec3f(0, distance, 0)));
     collide(c1.get(), tf1, c2.get(), tf2_no_collision, collisionRequest,
             collisionResult);
     BOOST_CHECK(collisionResult.isCollision());
-    BOOST_CHECK_SMALL(collisionResult.distance_lower_bound, 1e-8);
+    BOOST_CHECK_SMALL(collisionResult.distance_lower_bound, small_tol);
     BOOST_CHECK_CLOSE(-collisionResult.getContact(0).penetration_depth,
-                      distance, 1e-8);
+                      distance, close_tol);
   }
 
   // Negative security margin - collion because the two capsules are in contact
   {
     CollisionRequest collisionRequest(CONTACT, 1);
     CollisionResult collisionResult;
-    const double distance = -0.01;
+    const FCL_REAL distance = FCL_REAL(-0.01);
     collisionRequest.security_margin = distance;
     Transform3f tf2(
         Vec3f(tf2_collision.getTranslation() + Vec3f(0, distance, 0)));
     collide(c1.get(), tf1, c2.get(), tf2, collisionRequest, collisionResult);
     BOOST_CHECK(collisionResult.isCollision());
-    BOOST_CHECK_SMALL(collisionResult.distance_lower_bound, 1e-8);
+    BOOST_CHECK_SMALL(collisionResult.distance_lower_bound, small_tol);
     BOOST_CHECK_CLOSE(-collisionResult.getContact(0).penetration_depth,
-                      distance, 1e-8);
+                      distance, close_tol);
   }
 
   // Negative security margin - no collision
   {
     CollisionRequest collisionRequest(CONTACT, 1);
     CollisionResult collisionResult;
-    collisionRequest.security_margin = -0.01;
+    collisionRequest.security_margin = FCL_REAL(-0.01);
     collide(c1.get(), tf1, c2.get(), tf2_collision, collisionRequest,
             collisionResult);
     BOOST_CHECK(!collisionResult.isCollision());
-    BOOST_CHECK_CLOSE(collisionResult.distance_lower_bound, 0.01, 1e-8);
+    BOOST_CHECK_CLOSE(collisionResult.distance_lower_bound, FCL_REAL(0.01),
+                      close_tol);
   }
 }
 
@@ -335,7 +348,8 @@ BOOST_AUTO_TEST_CASE(box_box) {
   const Transform3f tf1;
   const Transform3f tf2_collision(Vec3f(0, 1, 1));
 
-  const double tol = 1e-3;
+  // GJK converges up to GJK_DEFAULT_TOLERANCE, relatively to the distance.
+  const FCL_REAL tol = (std::max)(FCL_REAL(1e-3), 1000 * GJK_DEFAULT_TOLERANCE);
 
   // No security margin - collision
   {
@@ -345,13 +359,14 @@ BOOST_AUTO_TEST_CASE(box_box) {
             collisionResult);
     BOOST_CHECK(collisionResult.isCollision());
     BOOST_CHECK_SMALL(collisionResult.distance_lower_bound, tol);
-    BOOST_CHECK_SMALL(-collisionResult.getContact(0).penetration_depth, 1e-8);
+    BOOST_CHECK_SMALL(-collisionResult.getContact(0).penetration_depth,
+                      small_tol);
   }
 
   // No security margin - no collision
   {
     CollisionRequest collisionRequest(CONTACT, 1);
-    const double distance = 0.01;
+    const FCL_REAL distance = FCL_REAL(0.01);
     const Transform3f tf2_no_collision(
         (tf2_collision.getTranslation() + Vec3f(0, 0, distance)).eval());
 
@@ -365,7 +380,7 @@ BOOST_AUTO_TEST_CASE(box_box) {
   // Positive security margin - collision
   {
     CollisionRequest collisionRequest(CONTACT, 1);
-    const double distance = 0.01;
+    const FCL_REAL distance = FCL_REAL(0.01);
     collisionRequest.security_margin = distance;
     CollisionResult collisionResult;
     collide(b1.get(), tf1, b2.get(), tf2_collision, collisionRequest,
@@ -373,13 +388,14 @@ BOOST_AUTO_TEST_CASE(box_box) {
     BOOST_CHECK(collisionResult.isCollision());
     BOOST_CHECK_CLOSE(collisionResult.distance_lower_bound,
                       -collisionRequest.security_margin, tol);
-    BOOST_CHECK_SMALL(-collisionResult.getContact(0).penetration_depth, 1e-8);
+    BOOST_CHECK_SMALL(-collisionResult.getContact(0).penetration_depth,
+                      small_tol);
   }
 
   // Negative security margin - no collision
   {
     CollisionRequest collisionRequest(CONTACT, 1);
-    collisionRequest.security_margin = -0.01;
+    collisionRequest.security_margin = FCL_REAL(-0.01);
     CollisionResult collisionResult;
     collide(b1.get(), tf1, b2.get(), tf2_collision, collisionRequest,
             collisionResult);
@@ -391,7 +407,7 @@ BOOST_AUTO_TEST_CASE(box_box) {
   // Negative security margin - collision
   {
     CollisionRequest collisionRequest(CONTACT, 1);
-    const FCL_REAL distance = -0.01;
+    const FCL_REAL distance = FCL_REAL(-0.01);
     collisionRequest.security_margin = distance;
     CollisionResult collisionResult;
 
@@ -419,13 +435,14 @@ void test_shape_shape(const ShapeType1& shape1, const Transform3f& tf1,
             collisionResult);
     BOOST_CHECK(collisionResult.isCollision());
     BOOST_CHECK_SMALL(collisionResult.distance_lower_bound, tol);
-    BOOST_CHECK_SMALL(-collisionResult.getContact(0).penetration_depth, 1e-8);
+    BOOST_CHECK_SMALL(-collisionResult.getContact(0).penetration_depth,
+                      small_tol);
   }
 
   // No security margin - no collision
   {
     CollisionRequest collisionRequest(CONTACT, 1);
-    const double distance = 0.01;
+    const FCL_REAL distance = FCL_REAL(0.01);
     const Transform3f tf2_no_collision(
         (tf2_collision.getTranslation() + Vec3f(0, 0, distance)).eval());
 
@@ -439,7 +456,7 @@ void test_shape_shape(const ShapeType1& shape1, const Transform3f& tf1,
   // Positive security margin - collision
   {
     CollisionRequest collisionRequest(CONTACT, 1);
-    const double distance = 0.01;
+    const FCL_REAL distance = FCL_REAL(0.01);
     collisionRequest.security_margin = distance;
     CollisionResult collisionResult;
     collide(&shape1, tf1, &shape2, tf2_collision, collisionRequest,
@@ -447,13 +464,14 @@ void test_shape_shape(const ShapeType1& shape1, const Transform3f& tf1,
     BOOST_CHECK(collisionResult.isCollision());
     BOOST_CHECK_CLOSE(collisionResult.distance_lower_bound,
                       -collisionRequest.security_margin, tol);
-    BOOST_CHECK_SMALL(-collisionResult.getContact(0).penetration_depth, 1e-8);
+    BOOST_CHECK_SMALL(-collisionResult.getContact(0).penetration_depth,
+                      small_tol);
   }
 
   // Negative security margin - no collision
   {
     CollisionRequest collisionRequest(CONTACT, 1);
-    collisionRequest.security_margin = -0.01;
+    collisionRequest.security_margin = FCL_REAL(-0.01);
     CollisionResult collisionResult;
     collide(&shape1, tf1, &shape2, tf2_collision, collisionRequest,
             collisionResult);
@@ -468,7 +486,7 @@ void test_shape_shape(const ShapeType1& shape1, const Transform3f& tf1,
   // Negative security margin - collision
   {
     CollisionRequest collisionRequest(CONTACT, 1);
-    const FCL_REAL distance = -0.01;
+    const FCL_REAL distance = FCL_REAL(-0.01);
     collisionRequest.security_margin = distance;
     CollisionResult collisionResult;
 
@@ -496,7 +514,7 @@ BOOST_AUTO_TEST_CASE(sphere_box) {
   const Transform3f tf1;
   const Transform3f tf2_collision(Vec3f(0, 0, 1));
 
-  const double tol = 1e-6;
+  const FCL_REAL tol = (std::max)(FCL_REAL(1e-6), close_tol);
 
   test_shape_shape(*b1.get(), tf1, *s2.get(), tf2_collision, tol);
   test_shape_shape(box_convex, tf1, *s2.get(), tf2_collision, tol);
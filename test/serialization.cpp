@@ -165,6 +165,9 @@ BOOST_AUTO_TEST_CASE(test_collision_data) {
   collision_result.distance_lower_bound = 0.1;
   test_serialization(collision_result);
 
+  collision_request.enable_profiling = true;
+  test_serialization(collision_request);
+
   DistanceRequest distance_request(true, 1., 2.);
   test_serialization(distance_request);
 
@@ -175,6 +178,22 @@ BOOST_AUTO_TEST_CASE(test_collision_data) {
   test_serialization(distance_result);
 }
 
+BOOST_AUTO_TEST_CASE(test_collision_data_version_0) {
+  // Archive written before QueryRequest::enable_profiling was serialized.
+  boost::filesystem::path path(TEST_RESOURCES_DIR);
+  std::ifstream ifs((path / "collision_request_v0.txt").string().c_str());
+  boost::archive::text_iarchive ia(ifs);
+
+  CollisionRequest collision_request;
+  collision_request.enable_profiling = true;
+  ia >> collision_request;
+
+  CollisionRequest expected_request(CONTACT, 3);
+  expected_request.security_margin = 0.25;
+  BOOST_CHECK(collision_request == expected_request);
+  BOOST_CHECK(!collision_request.enable_profiling);
+}
+
 BOOST_AUTO_TEST_CASE(test_BVHModel) {
   std::vector<Vec3f> p1, p2;
   std::vector<Triangle> t1, t2;
@@ -224,6 +243,56 @@ BOOST_AUTO_TEST_CASE(test_HeightField) {
     HeightField<OBBRSS> hfield_copy;
     test_serialization(hfield, hfield_copy, STREAM);
   }
+
+  // Test HeightField with quantized heights
+  {
+    HeightField<OBBRSS> quantized_hfield(x_dim, y_dim, heights, min_altitude,
+                                         HF_STORAGE_UINT16);
+    HeightField<OBBRSS> hfield_copy;
+    test_serialization(quantized_hfield, hfield_copy);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(test_HeightField_version_0) {
+  // Archive written before the compact storages of the heights.
+  boost::filesystem::path path(TEST_RESOURCES_DIR);
+#ifdef HPP_FCL_USE_FLOAT
+  // The default AABB bounds of the double precision archive do not fit in a
+  // float: this copy stores the float bounds.
+  std::ifstream ifs((path / "hfield_v0_float.txt").string().c_str());
+#else
+  std::ifstream ifs((path / "hfield_v0.txt").string().c_str());
+#endif
+  boost::archive::text_iarchive ia(ifs);
+
+  HeightField<OBBRSS> hfield;
+  ia >> hfield;
+
+  MatrixXf heights(3, 4);
+  heights << 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0, 1.1, 1.2;
+  const HeightField<OBBRSS> expected_hfield(2., 1., heights, -1.);
+  BOOST_CHECK(hfield.getStorage() == HF_STORAGE_REAL);
+#ifdef HPP_FCL_USE_FLOAT
+  // The bounding volumes of the archive were computed in double precision.
+  const FCL_REAL prec = 10 * Eigen::NumTraits<FCL_REAL>::epsilon();
+  BOOST_CHECK(hfield.getHeights().isApprox(expected_hfield.getHeights(), prec));
+  BOOST_CHECK(hfield.getXGrid().isApprox(expected_hfield.getXGrid(), prec));
+  BOOST_CHECK(hfield.getYGrid().isApprox(expected_hfield.getYGrid(), prec));
+  BOOST_CHECK_CLOSE(hfield.getMinHeight(), expected_hfield.getMinHeight(),
+                    100 * prec);
+  BOOST_CHECK_CLOSE(hfield.getMaxHeight(), expected_hfield.getMaxHeight(),
+                    100 * prec);
+  // 2 x 3 cells: 6 leaves and 5 inner nodes.
+  for (unsigned int i = 0; i < 11; ++i) {
+    const OBBRSS& bv = hfield.getBV(i).bv;
+    const OBBRSS& expected_bv = expected_hfield.getBV(i).bv;
+    BOOST_CHECK(bv.obb.To.isApprox(expected_bv.obb.To, prec));
+    BOOST_CHECK(bv.obb.extent.isApprox(expected_bv.obb.extent, prec));
+    BOOST_CHECK(bv.rss.Tr.isApprox(expected_bv.rss.Tr, prec));
+  }
+#else
+  BOOST_CHECK(hfield == expected_hfield);
+#endif
 }
 
 BOOST_AUTO_TEST_CASE(test_shapes) {
@@ -0,0 +1,146 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define BOOST_TEST_MODULE FCL_TRACING
+#include <boost/test/included/unit_test.hpp>
+
+#include <sstream>
+
+#include <hpp/fcl/collision.h>
+#include <hpp/fcl/hfield.h>
+#include <hpp/fcl/tracing.h>
+#include <hpp/fcl/shape/geometric_shapes.h>
+
+using namespace hpp::fcl;
+
+struct RecordingSink : tracing::TraceSink {
+  std::vector<tracing::TraceEvent> events;
+
+  void record(const tracing::TraceEvent& event) { events.push_back(event); }
+};
+
+BOOST_AUTO_TEST_CASE(spans) {
+  RecordingSink sink;
+  {
+    tracing::TraceSpan ignored("ignored", "test");
+  }
+  BOOST_CHECK(sink.events.empty());
+
+  tracing::setTraceSink(&sink);
+  BOOST_CHECK(tracing::getTraceSink() == &sink);
+  {
+    tracing::TraceSpan outer("outer", "test");
+    tracing::TraceSpan inner("inner", "test");
+  }
+  tracing::setTraceSink(NULL);
+
+  BOOST_REQUIRE_EQUAL(sink.events.size(), 4);
+  BOOST_CHECK_EQUAL(sink.events[0].name, std::string("outer"));
+  BOOST_CHECK_EQUAL(sink.events[0].phase, tracing::TraceEvent::BEGIN);
+  BOOST_CHECK_EQUAL(sink.events[1].name, std::string("inner"));
+  BOOST_CHECK_EQUAL(sink.events[2].name, std::string("inner"));
+  BOOST_CHECK_EQUAL(sink.events[2].phase, tracing::TraceEvent::END);
+  BOOST_CHECK_EQUAL(sink.events[3].name, std::string("outer"));
+  for (std::size_t i = 1; i < sink.events.size(); ++i) {
+    BOOST_CHECK(sink.events[i - 1].timestamp <= sink.events[i].timestamp);
+    BOOST_CHECK_EQUAL(sink.events[i].thread_id, sink.events[0].thread_id);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(chrome_trace_writer) {
+  tracing::ChromeTraceWriter writer;
+  tracing::setTraceSink(&writer);
+
+  Box box(1, 1, 1);
+  CollisionRequest request(CONTACT, 1);
+  CollisionResult result;
+  collide(&box, Transform3f(), &box, Transform3f(Vec3f(0.5, 0.1, 0)), request,
+          result);
+  BOOST_CHECK(result.isCollision());
+  {
+    tracing::TraceSpan span("user", "test");
+  }
+  tracing::setTraceSink(NULL);
+
+  std::ostringstream os;
+  writer.write(os);
+  const std::string json = os.str();
+  BOOST_CHECK_EQUAL(json.find("{\"traceEvents\":["), 0);
+  BOOST_CHECK(json.find("\"name\":\"user\",\"cat\":\"test\",\"ph\":\"B\"") !=
+              std::string::npos);
+  BOOST_CHECK(json.find("\"name\":\"user\",\"cat\":\"test\",\"ph\":\"E\"") !=
+              std::string::npos);
+#ifdef HPP_FCL_ENABLE_TRACING
+  // Collision between shapes goes through the distance traversal, and EPA
+  // is run since the boxes are in deep penetration.
+  BOOST_CHECK_EQUAL(writer.size(), 8);
+  const std::size_t collide = json.find("\"name\":\"collide\""),
+                    traversal = json.find("\"name\":\"distance traversal\""),
+                    epa = json.find("\"name\":\"EPA\",\"cat\":\"narrowphase\"");
+  BOOST_CHECK(collide < traversal);
+  BOOST_CHECK(traversal < epa);
+  BOOST_CHECK(epa != std::string::npos);
+  BOOST_CHECK(json.rfind("\"name\":\"collide\"") > epa);
+#else
+  BOOST_CHECK_EQUAL(writer.size(), 2);
+#endif
+
+  writer.clear();
+  BOOST_CHECK_EQUAL(writer.size(), 0);
+}
+
+BOOST_AUTO_TEST_CASE(height_field_traversal) {
+  RecordingSink sink;
+  tracing::setTraceSink(&sink);
+
+  const HeightField<AABB> hfield(2., 2., MatrixXf::Zero(8, 8), -1.);
+  Sphere sphere(0.5);
+  CollisionRequest request(CONTACT, 1);
+  CollisionResult result;
+  collide(&hfield, Transform3f(), &sphere, Transform3f(Vec3f(0.1, 0.2, 0.3)),
+          request, result);
+  BOOST_CHECK(result.isCollision());
+  tracing::setTraceSink(NULL);
+
+  std::size_t num_traversal_events = 0;
+  for (std::size_t i = 0; i < sink.events.size(); ++i)
+    if (sink.events[i].name == std::string("collision traversal"))
+      ++num_traversal_events;
+#ifdef HPP_FCL_ENABLE_TRACING
+  // The grid traversal of the height field runs in the collision traversal.
+  BOOST_CHECK_EQUAL(num_traversal_events, 2);
+#else
+  BOOST_CHECK_EQUAL(num_traversal_events, 0);
+#endif
+}
@@ -0,0 +1,232 @@
+/*
+ * Software License Agreement (BSD License)
+ *
+ *  Copyright (c) 2026, INRIA
+ *  All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *
+ *   * Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *   * Redistributions in binary form must reproduce the above
+ *     copyright notice, this list of conditions and the following
+ *     disclaimer in the documentation and/or other materials provided
+ *     with the distribution.
+ *   * Neither the name of Open Source Robotics Foundation nor the names of its
+ *     contributors may be used to endorse or promote products derived
+ *     from this software without specific prior written permission.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ *  "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ *  LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+ *  FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+ *  COPYRIGHT OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+ *  INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ *  BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ *  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+ *  CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ *  LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ *  ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ *  POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#define BOOST_TEST_MODULE FCL_ZERO_ALLOCATION
+#include <boost/test/included/unit_test.hpp>
+
+#include <cstdlib>
+#include <new>
+
+#include <hpp/fcl/collision.h>
+#include <hpp/fcl/distance.h>
+#include <hpp/fcl/hfield.h>
+#include <hpp/fcl/workspace.h>
+#include <hpp/fcl/shape/convex.h>
+#include <hpp/fcl/shape/geometric_shape_to_BVH_model.h>
+
+using namespace hpp::fcl;
+
+namespace {
+bool count_allocations = false;
+std::size_t num_allocations = 0;
+
+void countAllocation() {
+  if (count_allocations) ++num_allocations;
+}
+}  // namespace
+
+// The allocations are counted by intercepting malloc when the C library
+// allows it, which also catches the allocations of operator new, and by
+// replacing operator new otherwise.
+#if defined(__GLIBC__)
+extern "C" {
+void* __libc_malloc(std::size_t size);
+void* __libc_calloc(std::size_t num, std::size_t size);
+void* __libc_realloc(void* ptr, std::size_t size);
+void* __libc_memalign(std::size_t alignment, std::size_t size);
+
+void* malloc(std::size_t size) {
+  countAllocation();
+  return __libc_malloc(size);
+}
+
+void* calloc(std::size_t num, std::size_t size) {
+  countAllocation();
+  return __libc_calloc(num, size);
+}
+
+void* realloc(void* ptr, std::size_t size) {
+  countAllocation();
+  return __libc_realloc(ptr, size);
+}
+
+void* memalign(std::size_t alignment, std::size_t size) {
+  countAllocation();
+  return __libc_memalign(alignment, size);
+}
+}
+#else
+void* operator new(std::size_t size) {
+  countAllocation();
+  void* ptr = std::malloc(size ? size : 1);
+  if (ptr == NULL) throw std::bad_alloc();
+  return ptr;
+}
+
+void operator delete(void* ptr) throw() { std::free(ptr); }
+#endif
+
+/// Convex approximation of a sphere with enough vertices for the support
+/// function to climb the neighbor graph.
+shared_ptr<Convex<Triangle> > makeConvexSphere(FCL_REAL radius) {
+  const unsigned int nlat = 6, nlon = 12, num_points = nlat * nlon + 2;
+  Vec3f* points = new Vec3f[num_points];
+  points[0] = Vec3f(0, 0, radius);
+  points[1] = Vec3f(0, 0, -radius);
+  for (unsigned int i = 0; i < nlat; ++i) {
+    const FCL_REAL theta = M_PI * (i + 1) / (nlat + 1);
+    for (unsigned int j = 0; j < nlon; ++j) {
+      const FCL_REAL phi = 2 * M_PI * j / nlon;
+      points[2 + i * nlon + j] =
+          radius * Vec3f(std::sin(theta) * std::cos(phi),
+                         std::sin(theta) * std::sin(phi), std::cos(theta));
+    }
+  }
+
+  const unsigned int num_triangles = 2 * nlon * nlat;
+  Triangle* triangles = new Triangle[num_triangles];
+  unsigned int n = 0;
+#define INDEX(i, j) (2 + (i)*nlon + (j) % nlon)
+  for (unsigned int j = 0; j < nlon; ++j) {
+    triangles[n++].set(0, INDEX(0, j), INDEX(0, j + 1));
+    triangles[n++].set(1, INDEX(nlat - 1, j + 1), INDEX(nlat - 1, j));
+    for (unsigned int i = 0; i + 1 < nlat; ++i) {
+      triangles[n++].set(INDEX(i, j), INDEX(i + 1, j), INDEX(i + 1, j + 1));
+      triangles[n++].set(INDEX(i, j), INDEX(i + 1, j + 1), INDEX(i, j + 1));
+    }
+  }
+#undef INDEX
+  return shared_ptr<Convex<Triangle> >(new Convex<Triangle>(
+      true, points, num_points, triangles, num_triangles));
+}
+
+struct Queries {
+  shared_ptr<Convex<Triangle> > convex;
+  BVHModel<OBBRSS> mesh;
+  HeightField<OBBRSS> hfield;
+  Box box;
+  Capsule capsule;
+  ComputeCollision compute_collision;
+
+  CollisionRequest collision_request;
+  CollisionResult collision_result;
+  DistanceRequest distance_request;
+  DistanceResult distance_result;
+
+  Queries()
+      : convex(makeConvexSphere(0.5)),
+        hfield(2, 2, MatrixXf::Zero(10, 10), -1),
+        box(0.3, 0.3, 0.3),
+        capsule(0.2, 0.5),
+        compute_collision(&box, &capsule),
+        collision_request(CONTACT, 10) {
+    generateBVHModel(mesh, Sphere(0.5), Transform3f(), 16, 16);
+    distance_request.enable_nearest_points = true;
+  }
+
+  /// Run queries which use EPA, the support function of large convex objects
+  /// and the traversal of BVH models and height fields.
+  void run() {
+    const Transform3f near(Vec3f(0.2, 0.1, 0.3)), far(Vec3f(2, 0, 0));
+
+    collision_result.clear();
+    collide(convex.get(), Transform3f(), convex.get(), near,
+            collision_request, collision_result);
+    distance_result.clear();
+    distance(convex.get(), Transform3f(), convex.get(), far, distance_request,
+             distance_result);
+
+    collision_result.clear();
+    collide(&mesh, Transform3f(), &mesh, near, collision_request,
+            collision_result);
+    collision_result.clear();
+    collide(&mesh, Transform3f(), &box, near, collision_request,
+            collision_result);
+    distance_result.clear();
+    distance(&mesh, Transform3f(), &capsule, far, distance_request,
+             distance_result);
+
+    collision_result.clear();
+    collide(&hfield, Transform3f(), convex.get(), near, collision_request,
+            collision_result);
+
+    collision_result.clear();
+    compute_collision(Transform3f(), near, collision_request,
+                      collision_result);
+  }
+};
+
+BOOST_AUTO_TEST_CASE(steady_state) {
+  Queries queries;
+  QueryWorkspace workspace;
+  QueryWorkspace::Scope scope(workspace);
+  BOOST_CHECK(QueryWorkspace::current() == &workspace);
+
+  // The first run sizes the buffers.
+  queries.run();
+  BOOST_CHECK(queries.collision_result.isCollision());
+
+  num_allocations = 0;
+  count_allocations = true;
+  for (int i = 0; i < 10; ++i) queries.run();
+  count_allocations = false;
+  BOOST_CHECK_EQUAL(num_allocations, 0);
+  BOOST_CHECK(!workspace.epa_faces.empty());
+  BOOST_CHECK(!workspace.visited.empty());
+}
+
+BOOST_AUTO_TEST_CASE(without_workspace) {
+  BOOST_CHECK(QueryWorkspace::current() == NULL);
+  Queries queries;
+  queries.run();
+
+  num_allocations = 0;
+  count_allocations = true;
+  queries.run();
+  count_allocations = false;
+  BOOST_CHECK(num_allocations > 0);
+}
+
+BOOST_AUTO_TEST_CASE(nested_scopes) {
+  QueryWorkspace outer, inner;
+  {
+    QueryWorkspace::Scope outer_scope(outer);
+    {
+      QueryWorkspace::Scope inner_scope(inner);
+      BOOST_CHECK(QueryWorkspace::current() == &inner);
+    }
+    BOOST_CHECK(QueryWorkspace::current() == &outer);
+  }
+  BOOST_CHECK(QueryWorkspace::current() == NULL);
+}